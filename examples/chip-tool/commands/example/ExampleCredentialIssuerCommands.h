@@ -22,10 +22,12 @@
 #include <controller/CHIPDeviceControllerFactory.h>
 #include <controller/ExampleOperationalCredentialsIssuer.h>
 #include <credentials/DeviceAttestationCredsProvider.h>
-#include <credentials/attestation_verifier/DefaultDeviceAttestationVerifier.h>
+#include <credentials/attestation_verifier/BatchedDACVerifier.h>
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
 #include <credentials/examples/DeviceAttestationCredsExample.h>
 
+#include <memory>
+
 class ExampleCredentialIssuerCommands : public CredentialIssuerCommands
 {
 public:
@@ -39,12 +41,20 @@ public:
     {
         chip::Credentials::SetDeviceAttestationCredentialsProvider(chip::Credentials::Examples::GetExampleDACProvider());
 
-        mDacVerifier = chip::Credentials::GetDefaultDACVerifier(trustStore, revocationDelegate);
-        VerifyOrDie(mDacVerifier != nullptr);
+        // All the commissioners of a stack share the verifier, so that devices commissioned in parallel are verified in
+        // parallel too. It is only replaced when the stack is set up again with another trust store.
+        if (mDacVerifier == nullptr || mDacVerifierTrustStore != trustStore ||
+            mDacVerifierRevocationDelegate != revocationDelegate)
+        {
+            mDacVerifierTrustStore         = trustStore;
+            mDacVerifierRevocationDelegate = revocationDelegate;
+
+            mDacVerifier = std::make_unique<chip::Credentials::BatchedDACVerifier>(trustStore, revocationDelegate);
+        }
 
         mDacVerifier->EnableCdTestKeySupport(mAllowTestCdSigningKey);
         mDacVerifier->EnableVerboseLogs(true);
-        setupParams.deviceAttestationVerifier = mDacVerifier;
+        setupParams.deviceAttestationVerifier = mDacVerifier.get();
 
         return CHIP_NO_ERROR;
     }
@@ -112,5 +122,7 @@ protected:
 
 private:
     chip::Controller::ExampleOperationalCredentialsIssuer mOpCredsIssuer;
-    chip::Credentials::DeviceAttestationVerifier * mDacVerifier;
+    std::unique_ptr<chip::Credentials::BatchedDACVerifier> mDacVerifier;
+    const chip::Credentials::AttestationTrustStore * mDacVerifierTrustStore                 = nullptr;
+    chip::Credentials::DeviceAttestationRevocationDelegate * mDacVerifierRevocationDelegate = nullptr;
 };
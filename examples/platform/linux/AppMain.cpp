@@ -640,6 +640,9 @@ int ChipLinuxAppInit(int argc, char * const argv[], OptionSet * customOptions,
     err = DeviceLayer::PlatformMgr().InitChipStack();
     SuccessOrExit(err);
 
+    err = DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask();
+    SuccessOrExit(err);
+
     // Init the commissionable data provider based on command line options
     // to handle custom verifiers, discriminators, etc.
     err = chip::examples::InitCommissionableDataProvider(gCommissionableDataProvider, LinuxDeviceOptions::GetInstance());
@@ -1093,6 +1096,8 @@ void ChipLinuxAppMainLoop(chip::ServerInitParams & initParams, AppMainLoopImplem
 
     ApplicationShutdown();
 
+    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().StopBackgroundEventLoopTask();
+
 #if defined(ENABLE_CHIP_SHELL)
     shellThread.join();
 #endif
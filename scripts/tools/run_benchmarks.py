@@ -0,0 +1,271 @@
+#!/usr/bin/env -S python3 -B
+#
+#    Copyright (c) 2026 Project CHIP Authors
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+# /// script
+# requires-python = ">=3.10"
+# dependencies = [
+#     "click",
+#     "coloredlogs",
+#     "tabulate",
+# ]
+# ///
+#
+# Runs the stack microbenchmarks (the `*-benchmark` executables built by
+# //src/benchmarks:benchmarks) and compares their results between builds.
+# Example calls:
+#
+#  ./scripts/build/gn_gen.sh --args='is_debug=false' out/bench
+#  ninja -C out/bench src/benchmarks:benchmarks
+#
+#  uv run --script scripts/tools/run_benchmarks.py run \
+#     --repeat 3 --output out/bench/results.csv out/bench
+#
+#  uv run --script scripts/tools/run_benchmarks.py compare \
+#     --threshold 10 out/master/results.csv out/bench/results.csv
+#
+# Each benchmark prints CSV rows `benchmark,<parameter>,metric,value,better`
+# on stdout (see src/benchmarks/BenchmarkHelpers.h), preceded by a header
+# naming its parameter. `better` is `higher` or `lower` and tells which
+# direction of change is an improvement for the metric. Rows of all
+# benchmarks are merged under a `benchmark,parameter,metric,value,better`
+# header; when a benchmark is repeated, the median value of each metric is
+# kept.
+#
+
+import csv
+import logging
+import statistics
+import subprocess
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+
+import click
+import coloredlogs
+import tabulate
+
+# Supported log levels, mapping string values required for argument
+# parsing into logging constants
+__LOG_LEVELS__ = {
+    "debug": logging.DEBUG,
+    "info": logging.INFO,
+    "warn": logging.WARNING,
+    "fatal": logging.FATAL,
+}
+
+HEADER = ["benchmark", "parameter", "metric", "value", "better"]
+
+DIRECTIONS = ("higher", "lower")
+
+BENCHMARK_SUFFIX = "-benchmark"
+
+
+@dataclass(frozen=True)
+class Key:
+    benchmark: str
+    parameter: str
+    metric: str
+
+
+@dataclass(frozen=True)
+class Result:
+    value: float
+    better: str
+
+
+def find_benchmarks(build_dir: Path, selected: tuple[str, ...]) -> list[Path]:
+    result = []
+    for path in sorted(build_dir.glob(f"*{BENCHMARK_SUFFIX}")):
+        if not path.is_file() or not path.stat().st_mode & 0o111:
+            continue
+        name = path.name[: -len(BENCHMARK_SUFFIX)]
+        if selected and name not in selected:
+            continue
+        result.append(path)
+    return result
+
+
+def parse_results(output: str) -> dict[Key, Result]:
+    """Parses the CSV output of one benchmark run.
+
+    Anything that is not a result row (header, banners printed by the
+    platform code) is skipped.
+    """
+    results = {}
+    for row in csv.reader(output.splitlines()):
+        if len(row) != len(HEADER) or row[4] not in DIRECTIONS:
+            continue
+        try:
+            value = float(row[3])
+        except ValueError:
+            continue
+        results[Key(benchmark=row[0], parameter=row[1], metric=row[2])] = Result(value=value, better=row[4])
+    return results
+
+
+def run_benchmark(path: Path, repeat: int) -> dict[Key, Result]:
+    samples: dict[Key, list[Result]] = {}
+    for iteration in range(repeat):
+        logging.info("Running %s (%d/%d)", path.name, iteration + 1, repeat)
+        output = subprocess.run(
+            [path.as_posix()], check=True, capture_output=True, text=True
+        ).stdout
+        for key, result in parse_results(output).items():
+            samples.setdefault(key, []).append(result)
+
+    if not samples:
+        logging.warning("%s did not report any result", path.name)
+
+    return {
+        key: Result(value=statistics.median(r.value for r in results), better=results[0].better)
+        for key, results in samples.items()
+    }
+
+
+def read_results(path: Path) -> dict[Key, Result]:
+    with open(path, newline="") as f:
+        return parse_results(f.read())
+
+
+def write_results(results: dict[Key, Result], f):
+    writer = csv.writer(f, lineterminator="\n")
+    writer.writerow(HEADER)
+    for key, result in results.items():
+        writer.writerow([key.benchmark, key.parameter, key.metric, f"{result.value:.10g}", result.better])
+
+
+@click.group()
+@click.option(
+    "--log-level",
+    default="INFO",
+    show_default=True,
+    type=click.Choice(list(__LOG_LEVELS__.keys()), case_sensitive=False),
+    help="Determines the verbosity of script output.",
+)
+def main(log_level):
+    log_fmt = "%(asctime)s %(levelname)-7s %(message)s"
+    coloredlogs.install(level=__LOG_LEVELS__[log_level], fmt=log_fmt)
+
+
+@main.command()
+@click.option(
+    "--benchmark",
+    "selected",
+    multiple=True,
+    help="Only run this benchmark (name without the -benchmark suffix, e.g. tlv). Can be repeated.",
+)
+@click.option(
+    "--repeat",
+    default=1,
+    show_default=True,
+    type=click.IntRange(min=1),
+    help="Number of runs of each benchmark; the median value of each metric is reported.",
+)
+@click.option(
+    "--output",
+    default=None,
+    type=click.Path(dir_okay=False, path_type=Path),
+    help="File to write the results to (defaults to stdout).",
+)
+@click.argument(
+    "build_dir", type=click.Path(exists=True, file_okay=False, path_type=Path)
+)
+def run(selected, repeat: int, output: Path | None, build_dir: Path):
+    """Runs the benchmarks found in BUILD_DIR and merges their results."""
+    benchmarks = find_benchmarks(build_dir, selected)
+    if not benchmarks:
+        raise click.ClickException(f"No benchmark found in {build_dir}")
+
+    results = {}
+    for path in benchmarks:
+        results.update(run_benchmark(path, repeat))
+
+    if output is None:
+        write_results(results, sys.stdout)
+    else:
+        with open(output, "w", newline="") as f:
+            write_results(results, f)
+        logging.info("Wrote %d results to %s", len(results), output)
+
+
+@main.command()
+@click.option(
+    "--threshold",
+    default=5.0,
+    show_default=True,
+    type=click.FloatRange(min=0),
+    help="Relative change (in percent) above which a metric is reported as a regression or an improvement.",
+)
+@click.option(
+    "--fail-on-regression",
+    default=False,
+    is_flag=True,
+    help="Exit with an error if any metric regressed by more than the threshold.",
+)
+@click.option(
+    "--style",
+    default="simple",
+    show_default=True,
+    help="tablefmt style for table output (e.g.: simple, plain, grid, pipe, orgtbl, jira, psql, rst)",
+)
+@click.argument("baseline", type=click.Path(exists=True, dir_okay=False, path_type=Path))
+@click.argument("current", type=click.Path(exists=True, dir_okay=False, path_type=Path))
+def compare(threshold: float, fail_on_regression: bool, style: str, baseline: Path, current: Path):
+    """Compares the results in CURRENT against the ones in BASELINE."""
+    before = read_results(baseline)
+    after = read_results(current)
+
+    rows = []
+    regressions = 0
+    for key in list(before.keys()) + [k for k in after.keys() if k not in before]:
+        if key not in after:
+            rows.append([key.benchmark, key.parameter, key.metric, before[key].value, None, None, "REMOVED"])
+            continue
+        if key not in before:
+            rows.append([key.benchmark, key.parameter, key.metric, None, after[key].value, None, "ADDED"])
+            continue
+
+        old, new = before[key].value, after[key].value
+        if old == 0:
+            change = 0.0 if new == 0 else float("inf")
+        else:
+            change = (new - old) * 100.0 / abs(old)
+
+        status = ""
+        if abs(change) > threshold:
+            # The current build is authoritative if a metric changed direction.
+            improved = (change > 0) == (after[key].better == "higher")
+            status = "IMPROVED" if improved else "REGRESSED"
+            regressions += 0 if improved else 1
+
+        rows.append([key.benchmark, key.parameter, key.metric, old, new, f"{change:+.1f}%", status])
+
+    print(
+        tabulate.tabulate(
+            rows,
+            headers=["Benchmark", "Parameter", "Metric", "Baseline", "Current", "Change", "Status"],
+            tablefmt=style,
+        )
+    )
+
+    if regressions:
+        logging.warning("%d metrics regressed by more than %g%%", regressions, threshold)
+        if fail_on_regression:
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main(auto_envvar_prefix="CHIP")
@@ -952,6 +952,366 @@ CHIP_ERROR Copy(const Entry & entry, EntryStorage & storage)
     return CopyViaInterface(entry, storage);
 }
 
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+
+// The access control list compiled for checks: one rule per subject of each entry (or a single
+// rule for an entry without subjects, which grants any subject), sorted by fabric, auth mode and
+// subject. A check then looks only at the rules of its subject, of its CATs and of the entries
+// without subjects, instead of going through every entry of every fabric.
+//
+// Any entry grants access on its own, so the order of the entries does not matter. Results are
+// the same as the default check algorithm of AccessControl, which is left to run (by returning
+// CHIP_ERROR_NOT_IMPLEMENTED) where the index cannot decide:
+//
+//   - auth modes other than CASE and group (e.g. PASE);
+//   - fabrics with an entry that the default algorithm would reject with an error;
+//   - device type targets, since the delegate has no device type resolver.
+//
+// The index is rebuilt on the first check after the access control list changes. Recent
+// decisions are kept in a small LRU cache, cleared when the list changes.
+class CompiledAcl
+{
+public:
+    // The access control list has changed.
+    static void Invalidate()
+    {
+        sStale = true;
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+        sDecisionCount = 0;
+#endif
+    }
+
+    static CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege)
+    {
+        const AuthMode authMode = subjectDescriptor.authMode;
+        VerifyOrReturnError(authMode == AuthMode::kCase || authMode == AuthMode::kGroup, CHIP_ERROR_NOT_IMPLEMENTED);
+
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+        bool allowed = false;
+        if (FindDecision(subjectDescriptor, requestPath, requestPrivilege, allowed))
+        {
+            return allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        }
+#endif
+
+        if (sStale)
+        {
+            Build();
+        }
+
+        const FabricIndex fabricIndex = subjectDescriptor.fabricIndex;
+        VerifyOrReturnError(!IsFallbackFabric(fabricIndex), CHIP_ERROR_NOT_IMPLEMENTED);
+
+        const uint8_t privilege = chip::to_underlying(requestPrivilege);
+        bool undecided          = false;
+
+        // Entries without subjects, then entries with the subject itself, then entries with one of its CATs.
+        bool matched = MatchRules(Key(fabricIndex, authMode, SubjectKind::kAny, kUndefinedNodeId), 0, privilege, requestPath,
+                                  undecided);
+        if (!matched)
+        {
+            matched = MatchRules(Key(fabricIndex, authMode, SubjectKind::kNode, subjectDescriptor.subject), 0, privilege,
+                                 requestPath, undecided);
+        }
+        for (size_t i = 0; !matched && authMode == AuthMode::kCase && i < subjectDescriptor.cats.size(); i++)
+        {
+            const auto cat = subjectDescriptor.cats.values[i];
+            if (cat != chip::kUndefinedCAT)
+            {
+                matched = MatchRules(Key(fabricIndex, authMode, SubjectKind::kCat, CatSubject(cat)),
+                                     chip::GetCASEAuthTagVersion(cat), privilege, requestPath, undecided);
+            }
+        }
+
+        // A device type target might have granted access: let the default algorithm decide.
+        VerifyOrReturnError(matched || !undecided, CHIP_ERROR_NOT_IMPLEMENTED);
+
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+        AddDecision(subjectDescriptor, requestPath, requestPrivilege, matched);
+#endif
+
+        return matched ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+    }
+
+private:
+    enum class SubjectKind : uint8_t
+    {
+        kAny,  // entry without subjects
+        kNode, // operational node ID or group ID
+        kCat,  // CAT, without its version
+    };
+
+    struct Rule
+    {
+        NodeId subject;
+        uint16_t entry; // index in EntryStorage::acl
+        uint16_t catVersion;
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        SubjectKind kind;
+        uint8_t privileges; // request privileges granted by the entry
+
+        bool operator<(const Rule & other) const
+        {
+            if (fabricIndex != other.fabricIndex)
+            {
+                return fabricIndex < other.fabricIndex;
+            }
+            if (authMode != other.authMode)
+            {
+                return authMode < other.authMode;
+            }
+            if (kind != other.kind)
+            {
+                return kind < other.kind;
+            }
+            return subject < other.subject;
+        }
+    };
+
+    static constexpr size_t kMaxRules = MATTER_ARRAY_SIZE(EntryStorage::acl) * std::max<size_t>(EntryStorage::kMaxSubjects, 1);
+
+    static Rule Key(FabricIndex fabricIndex, AuthMode authMode, SubjectKind kind, NodeId subject)
+    {
+        Rule key        = {};
+        key.subject     = subject;
+        key.fabricIndex = fabricIndex;
+        key.authMode    = authMode;
+        key.kind        = kind;
+        return key;
+    }
+
+    // Rules for CAT subjects are keyed without the CAT version.
+    static NodeId CatSubject(chip::CASEAuthTag cat) { return chip::NodeIdFromCASEAuthTag(cat) & ~chip::kTagVersionMask; }
+
+    // Request privileges granted by an entry privilege.
+    static uint8_t GrantedPrivileges(Privilege privilege)
+    {
+        switch (privilege)
+        {
+        case Privilege::kView:
+            return chip::to_underlying(Privilege::kView);
+        case Privilege::kProxyView:
+            return chip::to_underlying(Privilege::kProxyView) | chip::to_underlying(Privilege::kView);
+        case Privilege::kOperate:
+            return chip::to_underlying(Privilege::kOperate) | chip::to_underlying(Privilege::kView);
+        case Privilege::kManage:
+            return chip::to_underlying(Privilege::kManage) | chip::to_underlying(Privilege::kOperate) |
+                chip::to_underlying(Privilege::kView);
+        case Privilege::kAdminister:
+            return chip::Access::kAllPrivilegeBits;
+        }
+        return 0;
+    }
+
+    static bool IsFallbackFabric(FabricIndex fabricIndex) { return sFallbackFabrics[fabricIndex / 8] & (1u << (fabricIndex % 8)); }
+
+    static void SetFallbackFabric(FabricIndex fabricIndex)
+    {
+        sFallbackFabrics[fabricIndex / 8] = static_cast<uint8_t>(sFallbackFabrics[fabricIndex / 8] | (1u << (fabricIndex % 8)));
+    }
+
+    // Adds the rules of an entry. Returns false if the default algorithm would reject the entry.
+    static bool Compile(size_t entryIndex, const EntryStorage & storage)
+    {
+        const AuthMode authMode = storage.mAuthMode;
+        VerifyOrReturnValue(authMode == AuthMode::kCase || authMode == AuthMode::kGroup, false);
+
+        Rule rule        = {};
+        rule.entry       = static_cast<uint16_t>(entryIndex);
+        rule.catVersion  = 0;
+        rule.fabricIndex = storage.mFabricIndex;
+        rule.authMode    = authMode;
+        rule.privileges  = GrantedPrivileges(storage.mPrivilege);
+
+        size_t subjectCount = 0;
+        for (const auto & subjectStorage : storage.mSubjects)
+        {
+            NodeId subject = kUndefinedNodeId;
+            if (subjectStorage.Get(subject) != CHIP_NO_ERROR)
+            {
+                break;
+            }
+            if (chip::IsOperationalNodeId(subject))
+            {
+                VerifyOrReturnValue(authMode == AuthMode::kCase, false);
+                rule.kind = SubjectKind::kNode;
+            }
+            else if (chip::IsCASEAuthTag(subject))
+            {
+                VerifyOrReturnValue(authMode == AuthMode::kCase, false);
+                const chip::CASEAuthTag cat = chip::CASEAuthTagFromNodeId(subject);
+                rule.kind                   = SubjectKind::kCat;
+                rule.catVersion             = chip::GetCASEAuthTagVersion(cat);
+                subject                     = CatSubject(cat);
+            }
+            else if (chip::IsGroupId(subject))
+            {
+                VerifyOrReturnValue(authMode == AuthMode::kGroup, false);
+                rule.kind = SubjectKind::kNode;
+            }
+            else
+            {
+                return false;
+            }
+            rule.subject         = subject;
+            sRules[sRuleCount++] = rule;
+            subjectCount++;
+        }
+
+        if (subjectCount == 0)
+        {
+            rule.kind            = SubjectKind::kAny;
+            rule.subject         = kUndefinedNodeId;
+            sRules[sRuleCount++] = rule;
+        }
+
+        return true;
+    }
+
+    static void Build()
+    {
+        sRuleCount = 0;
+        memset(sFallbackFabrics, 0, sizeof(sFallbackFabrics));
+
+        constexpr auto & acl = EntryStorage::acl;
+        for (size_t i = 0; i < MATTER_ARRAY_SIZE(acl) && acl[i].InUse(); i++)
+        {
+            if (!Compile(i, acl[i]))
+            {
+                // Rules the entry may have added before being rejected are never looked at.
+                SetFallbackFabric(acl[i].mFabricIndex);
+            }
+        }
+
+        std::sort(sRules, sRules + sRuleCount);
+        sStale = false;
+    }
+
+    // Whether a rule with the key (and, for CATs, a version up to catVersion) grants the
+    // privilege on the path. Sets undecided if a device type target might grant it.
+    static bool MatchRules(const Rule & key, uint16_t catVersion, uint8_t privilege, const RequestPath & requestPath,
+                           bool & undecided)
+    {
+        const auto range = std::equal_range(sRules, sRules + sRuleCount, key);
+        for (const Rule * rule = range.first; rule != range.second; ++rule)
+        {
+            if ((rule->privileges & privilege) == 0)
+            {
+                continue;
+            }
+            if (rule->kind == SubjectKind::kCat && (rule->catVersion == 0 || catVersion < rule->catVersion))
+            {
+                continue;
+            }
+            if (MatchTargets(EntryStorage::acl[rule->entry], requestPath, undecided))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool MatchTargets(const EntryStorage & storage, const RequestPath & requestPath, bool & undecided)
+    {
+        bool hasTargets = false;
+        for (const auto & targetStorage : storage.mTargets)
+        {
+            Target target;
+            if (targetStorage.Get(target) != CHIP_NO_ERROR)
+            {
+                break;
+            }
+            hasTargets = true;
+            if ((target.flags & Target::kCluster) && target.cluster != requestPath.cluster)
+            {
+                continue;
+            }
+            if ((target.flags & Target::kEndpoint) && target.endpoint != requestPath.endpoint)
+            {
+                continue;
+            }
+            if (target.flags & Target::kDeviceType)
+            {
+                undecided = true;
+                continue;
+            }
+            return true;
+        }
+        return !hasTargets;
+    }
+
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    struct Decision
+    {
+        NodeId subject;
+        chip::CATValues cats;
+        ClusterId cluster;
+        EndpointId endpoint;
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        Privilege privilege;
+        bool allowed;
+
+        bool Matches(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege) const
+        {
+            return subject == subjectDescriptor.subject && cluster == requestPath.cluster && endpoint == requestPath.endpoint &&
+                fabricIndex == subjectDescriptor.fabricIndex && authMode == subjectDescriptor.authMode &&
+                privilege == requestPrivilege && cats.values == subjectDescriptor.cats.values;
+        }
+    };
+
+    static constexpr size_t kMaxDecisions = CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE;
+
+    // Decisions are kept most recently used first.
+    static bool FindDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                             Privilege requestPrivilege, bool & allowed)
+    {
+        for (size_t i = 0; i < sDecisionCount; i++)
+        {
+            if (sDecisions[i].Matches(subjectDescriptor, requestPath, requestPrivilege))
+            {
+                const Decision decision = sDecisions[i];
+                memmove(sDecisions + 1, sDecisions, i * sizeof(Decision));
+                sDecisions[0] = decision;
+                allowed       = decision.allowed;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void AddDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege, bool allowed)
+    {
+        // Evicts the least recently used decision when full.
+        sDecisionCount = std::min(sDecisionCount + 1, kMaxDecisions);
+        memmove(sDecisions + 1, sDecisions, (sDecisionCount - 1) * sizeof(Decision));
+
+        Decision & decision  = sDecisions[0];
+        decision.subject     = subjectDescriptor.subject;
+        decision.cats        = subjectDescriptor.cats;
+        decision.cluster     = requestPath.cluster;
+        decision.endpoint    = requestPath.endpoint;
+        decision.fabricIndex = subjectDescriptor.fabricIndex;
+        decision.authMode    = subjectDescriptor.authMode;
+        decision.privilege   = requestPrivilege;
+        decision.allowed     = allowed;
+    }
+
+    static Decision sDecisions[kMaxDecisions];
+    static size_t sDecisionCount;
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
+    static Rule sRules[kMaxRules];
+    static size_t sRuleCount;
+    static uint8_t sFallbackFabrics[256 / 8];
+    static bool sStale;
+};
+
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+
 class AccessControlDelegate : public AccessControl::Delegate
 {
 public:
@@ -962,6 +1322,7 @@ public:
         {
             storage.Clear();
         }
+        InvalidateCompiledAcl();
         return CHIP_NO_ERROR;
     }
 
@@ -1037,6 +1398,7 @@ public:
 
     CHIP_ERROR CreateEntry(size_t * index, const Entry & entry, FabricIndex * fabricIndex) override
     {
+        InvalidateCompiledAcl();
         if (auto * storage = EntryStorage::FindUnusedInAcl())
         {
             CHIP_ERROR err = Copy(entry, *storage);
@@ -1076,6 +1438,7 @@ public:
 
     CHIP_ERROR UpdateEntry(size_t index, const Entry & entry, const FabricIndex * fabricIndex) override
     {
+        InvalidateCompiledAcl();
         if (auto * storage = EntryStorage::FindUsedInAcl(index, fabricIndex))
         {
             return Copy(entry, *storage);
@@ -1085,6 +1448,7 @@ public:
 
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex) override
     {
+        InvalidateCompiledAcl();
         if (auto * storage = EntryStorage::FindUsedInAcl(index, fabricIndex))
         {
             // Best effort attempt to preserve any outstanding delegates...
@@ -1141,7 +1505,19 @@ public:
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                      Privilege requestPrivilege) override
     {
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+        return CompiledAcl::Check(subjectDescriptor, requestPath, requestPrivilege);
+#else
         return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif
+    }
+
+private:
+    static void InvalidateCompiledAcl()
+    {
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+        CompiledAcl::Invalidate();
+#endif
     }
 };
 
@@ -1154,6 +1530,17 @@ EntryStorage EntryStorage::pool[];
 EntryDelegate EntryDelegate::pool[];
 EntryIteratorDelegate EntryIteratorDelegate::pool[];
 
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+CompiledAcl::Rule CompiledAcl::sRules[];
+size_t CompiledAcl::sRuleCount = 0;
+uint8_t CompiledAcl::sFallbackFabrics[];
+bool CompiledAcl::sStale = true;
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+CompiledAcl::Decision CompiledAcl::sDecisions[];
+size_t CompiledAcl::sDecisionCount = 0;
+#endif
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+
 } // namespace
 
 namespace chip {
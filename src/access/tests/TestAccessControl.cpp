@@ -1990,6 +1990,77 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+// Checks are repeated, so that the ones made after a change of the access control list
+// cannot be answered from what was decided before the change.
+TEST_F(TestAccessControl, TestCheckAfterEntryChanges)
+{
+    SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    subjectDescriptor.cats.values[0]    = kCASEAuthTag2;
+    RequestPath requestPath             = { .cluster = kOnOffCluster, .endpoint = 1 };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+
+    auto check = [&](Privilege privilege) {
+        CHIP_ERROR result = accessControl.Check(subjectDescriptor, requestPath, privilege);
+        EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, privilege), result);
+        return result;
+    };
+
+    auto update = [&](const EntryData & entryData) {
+        Entry entry;
+        ReturnErrorOnFailure(accessControl.PrepareEntry(entry));
+        ReturnErrorOnFailure(LoadEntry(entry, entryData));
+        return accessControl.UpdateEntry(0, entry);
+    };
+
+    EXPECT_EQ(check(Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    EntryData entryData = {
+        .fabricIndex = 1,
+        .privilege   = Privilege::kOperate,
+        .authMode    = AuthMode::kCase,
+        .subjects    = { kOperationalNodeId1 },
+    };
+    EXPECT_EQ(LoadAccessControl(accessControl, &entryData, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kOperate), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+
+    // Privilege
+    entryData.privilege = Privilege::kManage;
+    EXPECT_EQ(update(entryData), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kManage), CHIP_NO_ERROR);
+
+    // Subject
+    entryData.subjects[0] = kOperationalNodeId2;
+    EXPECT_EQ(update(entryData), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+
+    // CAT subject, with a version above then at most the version of the CAT of the subject
+    entryData.subjects[0] = kCASEAuthTagAsNodeId3;
+    EXPECT_EQ(update(entryData), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+    entryData.subjects[0] = kCASEAuthTagAsNodeId2;
+    EXPECT_EQ(update(entryData), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kManage), CHIP_NO_ERROR);
+
+    // Targets
+    entryData.targets[0] = { .flags = Target::kCluster | Target::kEndpoint, .cluster = kOnOffCluster, .endpoint = 2 };
+    EXPECT_EQ(update(entryData), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+    entryData.targets[1] = { .flags = Target::kCluster, .cluster = kOnOffCluster };
+    EXPECT_EQ(update(entryData), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kManage), CHIP_NO_ERROR);
+
+    // Device type not on the endpoint (see testDeviceTypeResolver)
+    entryData.targets[1] = { .flags = Target::kCluster | Target::kDeviceType, .cluster = kOnOffCluster, .deviceType = 0x0000'0100 };
+    EXPECT_EQ(update(entryData), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+
+    EXPECT_EQ(accessControl.DeleteEntry(0), CHIP_NO_ERROR);
+    EXPECT_EQ(check(Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
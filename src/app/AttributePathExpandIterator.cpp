@@ -17,11 +17,9 @@
 #include <app/AttributePathExpandIterator.h>
 
 #include <app/GlobalAttributes.h>
-#include <app/data-model-provider/MetadataLookup.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CodeUtils.h>
-#include <lib/support/ReadOnlyBuffer.h>
 
 #include <optional>
 
@@ -31,7 +29,7 @@ namespace chip {
 namespace app {
 
 AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position) :
-    mDataModelProvider(dataModel), mPosition(position)
+    mMetadata(dataModel->GetMetadataSnapshot()), mPosition(position)
 {}
 
 bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::AttributeEntry> * entry)
@@ -119,17 +117,18 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttribute(std::optio
         mAttributeIndex = kInvalidIndex;
     }
 
+    // all attributes ON THE CURRENT cluster
+    Span<const DataModel::AttributeEntry> attributes = mMetadata.Attributes(mPosition.mOutputPath);
+
     if (mAttributeIndex == kInvalidIndex)
     {
         // start a new iteration of attributes on the current cluster path.
-        mAttributes = mDataModelProvider->AttributesIgnoreError(mPosition.mOutputPath);
-
         if (mPosition.mOutputPath.mAttributeId != kInvalidAttributeId)
         {
             // Position on the correct attribute if we have a start point
             mAttributeIndex = 0;
-            while ((mAttributeIndex < mAttributes.size()) &&
-                   (mAttributes[mAttributeIndex].attributeId != mPosition.mOutputPath.mAttributeId))
+            while ((mAttributeIndex < attributes.size()) &&
+                   (attributes[mAttributeIndex].attributeId != mPosition.mOutputPath.mAttributeId))
             {
                 mAttributeIndex++;
             }
@@ -144,20 +143,19 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttribute(std::optio
             //
             // For wildcard expansion, we validate that this is a valid attribute for the given
             // cluster on the given endpoint. If not a wildcard expansion, return it as-is.
-            DataModel::AttributeFinder finder(mDataModelProvider);
-
-            const ConcreteAttributePath attributePath(mPosition.mOutputPath.mEndpointId, mPosition.mOutputPath.mClusterId,
-                                                      mPosition.mAttributePath->mValue.mAttributeId);
-            std::optional<DataModel::AttributeEntry> foundEntry = finder.Find(attributePath);
+            const AttributeId attributeId = mPosition.mAttributePath->mValue.mAttributeId;
 
             // if the entry is valid, we can just return it
-            if (foundEntry.has_value())
+            for (const auto & attributeEntry : attributes)
             {
-                if (entry)
+                if (attributeEntry.attributeId == attributeId)
                 {
-                    entry->emplace(*foundEntry);
+                    if (entry)
+                    {
+                        entry->emplace(attributeEntry);
+                    }
+                    return attributeId;
                 }
-                return mPosition.mAttributePath->mValue.mAttributeId;
             }
 
             // if the entry is invalid and we are wildcard-expanding, this is not a valid value so
@@ -189,13 +187,13 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttribute(std::optio
     // Advance the existing attribute id if it can be advanced.
     VerifyOrReturnValue(mPosition.mAttributePath->mValue.HasWildcardAttributeId(), std::nullopt);
 
-    if (mAttributeIndex < mAttributes.size())
+    if (mAttributeIndex < attributes.size())
     {
         if (entry != nullptr)
         {
-            entry->emplace(mAttributes[mAttributeIndex]);
+            entry->emplace(attributes[mAttributeIndex]);
         }
-        return mAttributes[mAttributeIndex].attributeId;
+        return attributes[mAttributeIndex].attributeId;
     }
 
     return std::nullopt;
@@ -211,16 +209,17 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
         mClusterIndex = kInvalidIndex;
     }
 
+    // all clusters ON THE CURRENT endpoint
+    Span<const DataModel::ServerClusterEntry> clusters = mMetadata.ServerClusters(mPosition.mOutputPath.mEndpointId);
+
     if (mClusterIndex == kInvalidIndex)
     {
         // start a new iteration on the current endpoint
-        mClusters = mDataModelProvider->ServerClustersIgnoreError(mPosition.mOutputPath.mEndpointId);
-
         if (mPosition.mOutputPath.mClusterId != kInvalidClusterId)
         {
             // Position on the correct cluster if we have a start point
             mClusterIndex = 0;
-            while ((mClusterIndex < mClusters.size()) && (mClusters[mClusterIndex].clusterId != mPosition.mOutputPath.mClusterId))
+            while ((mClusterIndex < clusters.size()) && (clusters[mClusterIndex].clusterId != mPosition.mOutputPath.mClusterId))
             {
                 mClusterIndex++;
             }
@@ -241,7 +240,7 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
                 const ClusterId clusterId = mPosition.mAttributePath->mValue.mClusterId;
 
                 bool found = false;
-                for (auto & entry : mClusters)
+                for (auto & entry : clusters)
                 {
                     if (entry.clusterId == clusterId)
                     {
@@ -266,23 +265,24 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
     }
 
     VerifyOrReturnValue(mPosition.mAttributePath->mValue.HasWildcardClusterId(), std::nullopt);
-    VerifyOrReturnValue(mClusterIndex < mClusters.size(), std::nullopt);
+    VerifyOrReturnValue(mClusterIndex < clusters.size(), std::nullopt);
 
-    return mClusters[mClusterIndex].clusterId;
+    return clusters[mClusterIndex].clusterId;
 }
 
 std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
 {
+    // all endpoints
+    Span<const DataModel::EndpointEntry> endpoints = mMetadata.Endpoints();
+
     if (mEndpointIndex == kInvalidIndex)
     {
         // index is missing, have to start a new iteration
-        mEndpoints = mDataModelProvider->EndpointsIgnoreError();
-
         if (mPosition.mOutputPath.mEndpointId != kInvalidEndpointId)
         {
             // Position on the correct endpoint if we have a start point
             mEndpointIndex = 0;
-            while ((mEndpointIndex < mEndpoints.size()) && (mEndpoints[mEndpointIndex].id != mPosition.mOutputPath.mEndpointId))
+            while ((mEndpointIndex < endpoints.size()) && (endpoints[mEndpointIndex].id != mPosition.mOutputPath.mEndpointId))
             {
                 mEndpointIndex++;
             }
@@ -305,9 +305,9 @@ std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
     }
 
     VerifyOrReturnValue(mPosition.mAttributePath->mValue.HasWildcardEndpointId(), std::nullopt);
-    VerifyOrReturnValue(mEndpointIndex < mEndpoints.size(), std::nullopt);
+    VerifyOrReturnValue(mEndpointIndex < endpoints.size(), std::nullopt);
 
-    return mEndpoints[mEndpointIndex].id;
+    return endpoints[mEndpointIndex].id;
 }
 
 } // namespace app
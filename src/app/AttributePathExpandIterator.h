@@ -19,11 +19,11 @@
 
 #include <app/AttributePathParams.h>
 #include <app/ConcreteAttributePath.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/data-model-provider/Provider.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/LinkedList.h>
-#include <lib/support/ReadOnlyBuffer.h>
 #include <lib/support/Span.h>
 
 #include <limits>
@@ -134,16 +134,13 @@ public:
 private:
     static constexpr size_t kInvalidIndex = std::numeric_limits<size_t>::max();
 
-    DataModel::Provider * mDataModelProvider;
+    // Endpoint/cluster/attribute lists are shared with other iterations over the same provider, so
+    // lists are looked up again on every step rather than held across steps.
+    DataModel::MetadataSnapshot & mMetadata;
     Position & mPosition;
 
-    ReadOnlyBuffer<DataModel::EndpointEntry> mEndpoints; // all endpoints
-    size_t mEndpointIndex = kInvalidIndex;
-
-    ReadOnlyBuffer<DataModel::ServerClusterEntry> mClusters; // all clusters ON THE CURRENT endpoint
-    size_t mClusterIndex = kInvalidIndex;
-
-    ReadOnlyBuffer<DataModel::AttributeEntry> mAttributes; // all attributes ON THE CURRENT cluster
+    size_t mEndpointIndex  = kInvalidIndex;
+    size_t mClusterIndex   = kInvalidIndex;
     size_t mAttributeIndex = kInvalidIndex;
 
     /// Move to the next endpoint/cluster/attribute triplet that is valid given
@@ -18,6 +18,7 @@
 
 #include <app/CASESessionManager.h>
 #include <lib/address_resolve/AddressResolve.h>
+#include <protocols/secure_channel/CASEEphemeralKeypairPool.h>
 
 namespace chip {
 
@@ -26,11 +27,25 @@ CHIP_ERROR CASESessionManager::Init(chip::System::Layer * systemLayer, const CAS
     ReturnErrorOnFailure(params.sessionInitParams.Validate());
     mConfig = params;
     params.sessionInitParams.exchangeMgr->GetReliableMessageMgr()->RegisterSessionUpdateDelegate(this);
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    if (!mUsingEphemeralKeypairPool)
+    {
+        ReturnErrorOnFailure(CASEEphemeralKeypairPool::Instance().Init());
+        mUsingEphemeralKeypairPool = true;
+    }
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
     return AddressResolve::Resolver::Instance().Init(systemLayer);
 }
 
 void CASESessionManager::Shutdown()
 {
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    if (mUsingEphemeralKeypairPool)
+    {
+        CASEEphemeralKeypairPool::Instance().Shutdown();
+        mUsingEphemeralKeypairPool = false;
+    }
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
     AddressResolve::Resolver::Instance().Shutdown();
 }
 
@@ -208,6 +208,9 @@ private:
                                       const Optional<AddressResolve::ResolveResult> & fallbackResolveResult = NullOptional);
 
     CASESessionManagerConfig mConfig;
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    bool mUsingEphemeralKeypairPool = false;
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
 };
 
 } // namespace chip
@@ -19,6 +19,8 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+
+#include <algorithm>
 #include <tuple>
 
 namespace chip {
@@ -26,6 +28,9 @@ namespace app {
 
 namespace {
 
+// With StorageLayout::kFlat, the attribute data buffer is compacted once at least this much, and at least half of it, is unused.
+constexpr size_t kMinUnusedFlatAttributeDataToCompact = 1024;
+
 // Determine how much space a StatusIB takes up on the wire.
 uint32_t SizeOfStatusIB(const StatusIB & aStatus)
 {
@@ -70,26 +75,31 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
                                                                  const StatusIB & aStatus)
 {
     AttributeState state;
-    bool endpointIsNew = false;
+    uint32_t elementSize = 0;
+    bool endpointIsNew   = false;
 
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
+    //
+    // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
+    // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
+    // we can appropriately notify our clients of the addition of a new endpoint.
+    //
+    if (mStorageLayout == StorageLayout::kFlat)
     {
-        //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
-        // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
-        // we can appropriately notify our clients of the addition of a new endpoint.
-        //
-        endpointIsNew = true;
+        endpointIsNew = !std::binary_search(mFlatEndpoints.begin(), mFlatEndpoints.end(), aPath.mEndpointId);
+    }
+    else
+    {
+        endpointIsNew = (mCache.find(aPath.mEndpointId) == mCache.end());
     }
 
     if (apData)
     {
-        uint32_t elementSize = 0;
         ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
 
         if constexpr (CanEnableDataCaching)
         {
-            if (mCacheData)
+            // With StorageLayout::kFlat, UpdateFlatAttribute() copies the data straight into its shared buffer instead.
+            if (mCacheData && mStorageLayout == StorageLayout::kTree)
             {
                 Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
                 backingBuffer.Calloc(elementSize);
@@ -114,7 +124,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
         //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
+        GetOrAddClusterDataVersions(aPath.mEndpointId, aPath.mClusterId).mCommittedDataVersion.ClearValue();
 
         // This commits a pending data version if the last report path is valid and it is different from the current path.
         if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
@@ -135,7 +145,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            GetOrAddClusterDataVersions(aPath.mEndpointId, aPath.mClusterId).mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
@@ -159,6 +169,15 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         }
     }
 
+    if (mStorageLayout == StorageLayout::kFlat)
+    {
+        ReturnErrorOnFailure(UpdateFlatAttribute(aPath, apData, elementSize, aStatus));
+    }
+    else
+    {
+        mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    }
+
     //
     // if the endpoint didn't exist previously, let's track the insertion
     // so that we can inform our callback of a new endpoint being added appropriately.
@@ -168,8 +187,6 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
-
     if (mCacheData)
     {
         mChangedAttributeSet.insert(aPath);
@@ -178,6 +195,161 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
     return CHIP_NO_ERROR;
 }
 
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateFlatAttribute(const ConcreteDataAttributePath & aPath,
+                                                                         TLV::TLVReader * apData, uint32_t elementSize,
+                                                                         const StatusIB & aStatus)
+{
+    FlatAttributeState state;
+    state.mClusterKey  = PackClusterKey(aPath.mEndpointId, aPath.mClusterId);
+    state.mAttributeId = aPath.mAttributeId;
+    state.mDataOffset  = 0;
+    state.mStatus      = aStatus;
+
+    if (apData == nullptr)
+    {
+        state.mKind = mCacheData ? FlatAttributeState::Kind::kStatus : FlatAttributeState::Kind::kSizeOnly;
+        state.mSize = SizeOfStatusIB(aStatus);
+    }
+    else if (!mCacheData)
+    {
+        state.mKind = FlatAttributeState::Kind::kSizeOnly;
+        state.mSize = elementSize;
+    }
+    else
+    {
+        // New data always goes at the end of the buffer; the space used by the data it replaces is reclaimed by compaction.
+        const size_t offset = mFlatAttributeData.size();
+        VerifyOrReturnError(offset + elementSize <= UINT32_MAX, CHIP_ERROR_NO_MEMORY);
+        mFlatAttributeData.resize(offset + elementSize);
+
+        TLV::TLVWriter writer;
+        writer.Init(mFlatAttributeData.data() + offset, elementSize);
+        CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), *apData);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = writer.Finalize();
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            mFlatAttributeData.resize(offset);
+            return err;
+        }
+
+        state.mKind       = FlatAttributeState::Kind::kData;
+        state.mDataOffset = static_cast<uint32_t>(offset);
+        state.mSize       = elementSize;
+    }
+
+    // As with the nested maps, adding an attribute adds its cluster and endpoint.
+    GetOrAddClusterDataVersions(aPath.mEndpointId, aPath.mClusterId);
+
+    const size_t index = FlatAttributeLowerBound(state.mClusterKey, state.mAttributeId);
+    if (index < mFlatAttributes.size() && mFlatAttributes[index].mClusterKey == state.mClusterKey &&
+        mFlatAttributes[index].mAttributeId == state.mAttributeId)
+    {
+        ReleaseFlatAttributeData(mFlatAttributes[index]);
+        mFlatAttributes[index] = state;
+        CompactFlatAttributeDataIfNeeded();
+    }
+    else
+    {
+        mFlatAttributes.insert(mFlatAttributes.begin() + static_cast<ptrdiff_t>(index), state);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+template <bool CanEnableDataCaching>
+typename ClusterStateCacheT<CanEnableDataCaching>::ClusterDataVersions &
+ClusterStateCacheT<CanEnableDataCaching>::GetOrAddClusterDataVersions(EndpointId endpointId, ClusterId clusterId)
+{
+    if (mStorageLayout == StorageLayout::kTree)
+    {
+        return mCache[endpointId][clusterId];
+    }
+
+    const uint64_t clusterKey = PackClusterKey(endpointId, clusterId);
+    const size_t index        = FlatClusterLowerBound(clusterKey);
+    if (index == mFlatClusters.size() || mFlatClusters[index].mKey != clusterKey)
+    {
+        auto endpoint = std::lower_bound(mFlatEndpoints.begin(), mFlatEndpoints.end(), endpointId);
+        if (endpoint == mFlatEndpoints.end() || *endpoint != endpointId)
+        {
+            mFlatEndpoints.insert(endpoint, endpointId);
+        }
+
+        FlatClusterState cluster;
+        cluster.mKey = clusterKey;
+        mFlatClusters.insert(mFlatClusters.begin() + static_cast<ptrdiff_t>(index), cluster);
+    }
+
+    return mFlatClusters[index];
+}
+
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::EraseFlatAttributes(size_t first, size_t last)
+{
+    for (size_t i = first; i < last; i++)
+    {
+        ReleaseFlatAttributeData(mFlatAttributes[i]);
+    }
+    mFlatAttributes.erase(mFlatAttributes.begin() + static_cast<ptrdiff_t>(first),
+                          mFlatAttributes.begin() + static_cast<ptrdiff_t>(last));
+    CompactFlatAttributeDataIfNeeded();
+}
+
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::ReleaseFlatAttributeData(const FlatAttributeState & attribute)
+{
+    if (attribute.mKind == FlatAttributeState::Kind::kData)
+    {
+        mFlatAttributeDataUnused += attribute.mSize;
+    }
+}
+
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::CompactFlatAttributeDataIfNeeded()
+{
+    // Waiting for at least half of the buffer to be unused keeps the cost of compaction proportional to the amount of data
+    // written to the cache.
+    const size_t unused = mFlatAttributeDataUnused;
+    const size_t size   = mFlatAttributeData.size();
+    if (unused == 0 || (unused < size && (unused < kMinUnusedFlatAttributeDataToCompact || unused * 2 < size)))
+    {
+        return;
+    }
+
+    std::vector<uint8_t> compacted;
+    compacted.reserve(size - unused);
+    for (auto & attribute : mFlatAttributes)
+    {
+        if (attribute.mKind == FlatAttributeState::Kind::kData)
+        {
+            const uint8_t * data  = mFlatAttributeData.data() + attribute.mDataOffset;
+            attribute.mDataOffset = static_cast<uint32_t>(compacted.size());
+            compacted.insert(compacted.end(), data, data + attribute.mSize);
+        }
+    }
+
+    mFlatAttributeData.swap(compacted);
+    mFlatAttributeDataUnused = 0;
+}
+
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::ShrinkFlatStorage()
+{
+    // Only a fraction of the paths are new after the first report, so this rarely needs to reallocate after that.
+    if (mFlatAttributes.capacity() - mFlatAttributes.size() > mFlatAttributes.size() / 4)
+    {
+        mFlatAttributes.shrink_to_fit();
+    }
+    if (mFlatClusters.capacity() - mFlatClusters.size() > mFlatClusters.size() / 4)
+    {
+        mFlatClusters.shrink_to_fit();
+    }
+}
+
 template <bool CanEnableDataCaching>
 CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const EventHeader & aEventHeader, TLV::TLVReader * apData,
                                                                       const StatusIB * apStatus)
@@ -212,7 +384,19 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
             eventData.first  = aEventHeader;
             eventData.second = std::move(handle);
 
-            mEventDataCache.insert(std::move(eventData));
+            if (mStorageLayout == StorageLayout::kFlat)
+            {
+                // Events mostly arrive in event number order, so this is usually an append.
+                auto position = std::lower_bound(mFlatEventData.begin(), mFlatEventData.end(), eventData, EventDataCompare());
+                if (position == mFlatEventData.end() || position->first.mEventNumber != aEventHeader.mEventNumber)
+                {
+                    mFlatEventData.insert(position, std::move(eventData));
+                }
+            }
+            else
+            {
+                mEventDataCache.insert(std::move(eventData));
+            }
         }
         mHighestReceivedEventNumber.SetValue(aEventHeader.mEventNumber);
     }
@@ -250,7 +434,7 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
+    auto & lastClusterInfo = GetOrAddClusterDataVersions(mLastReportDataPath.mEndpointId, mLastReportDataPath.mClusterId);
     if (lastClusterInfo.mPendingDataVersion.HasValue())
     {
         lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
@@ -285,6 +469,11 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
         mCallback.OnEndpointAdded(this, endpoint);
     }
 
+    // Everything has been reported, so there is no need to hold on to these until the next report.
+    mChangedAttributeSet.clear();
+    mAddedEndpoints.clear();
+    ShrinkFlatStorage();
+
     mCallback.OnReportEnd();
 }
 
@@ -292,6 +481,17 @@ template <>
 CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
 {
     CHIP_ERROR err;
+
+    if (mStorageLayout == StorageLayout::kFlat)
+    {
+        const FlatAttributeState * attribute = FindFlatAttribute(path);
+        VerifyOrReturnError(attribute != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(attribute->mKind != FlatAttributeState::Kind::kStatus, CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+        VerifyOrReturnError(attribute->mKind == FlatAttributeState::Kind::kData, CHIP_ERROR_KEY_NOT_FOUND);
+
+        reader.Init(mFlatAttributeData.data() + attribute->mDataOffset, attribute->mSize);
+        return reader.Next();
+    }
     auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
     ReturnErrorOnFailure(err);
 
@@ -390,10 +590,71 @@ ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointI
     return &attributeState->second;
 }
 
+template <bool CanEnableDataCaching>
+const typename ClusterStateCacheT<CanEnableDataCaching>::FlatClusterState *
+ClusterStateCacheT<CanEnableDataCaching>::FindFlatCluster(EndpointId endpointId, ClusterId clusterId) const
+{
+    const uint64_t clusterKey = PackClusterKey(endpointId, clusterId);
+    const size_t index        = FlatClusterLowerBound(clusterKey);
+    if (index == mFlatClusters.size() || mFlatClusters[index].mKey != clusterKey)
+    {
+        return nullptr;
+    }
+    return &mFlatClusters[index];
+}
+
+template <bool CanEnableDataCaching>
+const typename ClusterStateCacheT<CanEnableDataCaching>::FlatAttributeState *
+ClusterStateCacheT<CanEnableDataCaching>::FindFlatAttribute(const ConcreteAttributePath & path) const
+{
+    const uint64_t clusterKey = PackClusterKey(path.mEndpointId, path.mClusterId);
+    const size_t index        = FlatAttributeLowerBound(clusterKey, path.mAttributeId);
+    if (index == mFlatAttributes.size() || mFlatAttributes[index].mClusterKey != clusterKey ||
+        mFlatAttributes[index].mAttributeId != path.mAttributeId)
+    {
+        return nullptr;
+    }
+    return &mFlatAttributes[index];
+}
+
+template <bool CanEnableDataCaching>
+size_t ClusterStateCacheT<CanEnableDataCaching>::FlatClusterLowerBound(uint64_t clusterKey) const
+{
+    auto cluster = std::lower_bound(mFlatClusters.begin(), mFlatClusters.end(), clusterKey,
+                                    [](const FlatClusterState & state, uint64_t key) { return state.mKey < key; });
+    return static_cast<size_t>(cluster - mFlatClusters.begin());
+}
+
+template <bool CanEnableDataCaching>
+size_t ClusterStateCacheT<CanEnableDataCaching>::FlatAttributeLowerBound(uint64_t clusterKey, AttributeId attributeId) const
+{
+    auto attribute = std::lower_bound(mFlatAttributes.begin(), mFlatAttributes.end(), std::make_pair(clusterKey, attributeId),
+                                      [](const FlatAttributeState & state, const std::pair<uint64_t, AttributeId> & key) {
+                                          return state.mClusterKey < key.first ||
+                                              (state.mClusterKey == key.first && state.mAttributeId < key.second);
+                                      });
+    return static_cast<size_t>(attribute - mFlatAttributes.begin());
+}
+
 template <bool CanEnableDataCaching>
 const typename ClusterStateCacheT<CanEnableDataCaching>::EventData *
 ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
 {
+    if (mStorageLayout == StorageLayout::kFlat)
+    {
+        auto eventData = std::lower_bound(
+            mFlatEventData.begin(), mFlatEventData.end(), eventNumber,
+            [](const EventData & data, EventNumber number) { return data.first.mEventNumber < number; });
+        if (eventData == mFlatEventData.end() || eventData->first.mEventNumber != eventNumber)
+        {
+            err = CHIP_ERROR_KEY_NOT_FOUND;
+            return nullptr;
+        }
+
+        err = CHIP_NO_ERROR;
+        return &(*eventData);
+    }
+
     EventData compareKey;
 
     compareKey.first.mEventNumber = eventNumber;
@@ -445,6 +706,15 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteCl
                                                                 Optional<DataVersion> & aVersion) const
 {
     VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mStorageLayout == StorageLayout::kFlat)
+    {
+        const FlatClusterState * clusterState = FindFlatCluster(aPath.mEndpointId, aPath.mClusterId);
+        VerifyOrReturnError(clusterState != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        aVersion = clusterState->mCommittedDataVersion;
+        return CHIP_NO_ERROR;
+    }
+
     CHIP_ERROR err;
     auto clusterState = GetClusterState(aPath.mEndpointId, aPath.mClusterId, err);
     ReturnErrorOnFailure(err);
@@ -473,6 +743,16 @@ CHIP_ERROR ClusterStateCacheT<true>::GetStatus(const ConcreteAttributePath & pat
 {
     CHIP_ERROR err;
 
+    if (mStorageLayout == StorageLayout::kFlat)
+    {
+        const FlatAttributeState * attribute = FindFlatAttribute(path);
+        VerifyOrReturnError(attribute != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(attribute->mKind == FlatAttributeState::Kind::kStatus, CHIP_ERROR_INVALID_ARGUMENT);
+
+        status = attribute->mStatus;
+        return CHIP_NO_ERROR;
+    }
+
     auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
     ReturnErrorOnFailure(err);
 
@@ -507,61 +787,90 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEve
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
-    for (auto const & endpointIter : mCache)
+    if (mStorageLayout == StorageLayout::kFlat)
     {
-        EndpointId endpointId = endpointIter.first;
-        for (auto const & clusterIter : endpointIter.second)
+        // Both flat vectors are sorted by cluster key, so the attributes of each cluster follow those of the previous one.
+        size_t attributeIndex = 0;
+        for (const auto & clusterState : mFlatClusters)
         {
-            if (!clusterIter.second.mCommittedDataVersion.HasValue())
+            size_t clusterSize = 0;
+            for (; attributeIndex < mFlatAttributes.size() && mFlatAttributes[attributeIndex].mClusterKey <= clusterState.mKey;
+                 attributeIndex++)
+            {
+                if (mFlatAttributes[attributeIndex].mClusterKey == clusterState.mKey)
+                {
+                    clusterSize += mFlatAttributes[attributeIndex].mSize;
+                }
+            }
+
+            if (!clusterState.mCommittedDataVersion.HasValue() || clusterSize == 0)
             {
                 continue;
             }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
-            size_t clusterSize      = 0;
-            ClusterId clusterId     = clusterIter.first;
 
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
+            DataVersionFilter filter(EndpointIdOfKey(clusterState.mKey), ClusterIdOfKey(clusterState.mKey),
+                                     clusterState.mCommittedDataVersion.Value());
+            aVector.push_back(std::make_pair(filter, clusterSize));
+        }
+    }
+    else
+    {
+        for (auto const & endpointIter : mCache)
+        {
+            EndpointId endpointId = endpointIter.first;
+            for (auto const & clusterIter : endpointIter.second)
             {
-                if constexpr (CanEnableDataCaching)
+                if (!clusterIter.second.mCommittedDataVersion.HasValue())
                 {
-                    if (attributeIter.second.template Is<StatusIB>())
-                    {
-                        clusterSize += SizeOfStatusIB(attributeIter.second.template Get<StatusIB>());
-                    }
-                    else if (attributeIter.second.template Is<uint32_t>())
+                    continue;
+                }
+                DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
+                size_t clusterSize      = 0;
+                ClusterId clusterId     = clusterIter.first;
+
+                for (auto const & attributeIter : clusterIter.second.mAttributes)
+                {
+                    if constexpr (CanEnableDataCaching)
                     {
-                        clusterSize += attributeIter.second.template Get<uint32_t>();
+                        if (attributeIter.second.template Is<StatusIB>())
+                        {
+                            clusterSize += SizeOfStatusIB(attributeIter.second.template Get<StatusIB>());
+                        }
+                        else if (attributeIter.second.template Is<uint32_t>())
+                        {
+                            clusterSize += attributeIter.second.template Get<uint32_t>();
+                        }
+                        else
+                        {
+                            VerifyOrDie(attributeIter.second.template Is<AttributeData>());
+                            TLV::TLVReader bufReader;
+                            bufReader.Init(attributeIter.second.template Get<AttributeData>().Get(),
+                                           attributeIter.second.template Get<AttributeData>().AllocatedSize());
+                            ReturnOnFailure(bufReader.Next());
+                            // Skip to the end of the element.
+                            ReturnOnFailure(bufReader.Skip());
+
+                            // Compute the amount of value data
+                            clusterSize += bufReader.GetLengthRead();
+                        }
                     }
                     else
                     {
-                        VerifyOrDie(attributeIter.second.template Is<AttributeData>());
-                        TLV::TLVReader bufReader;
-                        bufReader.Init(attributeIter.second.template Get<AttributeData>().Get(),
-                                       attributeIter.second.template Get<AttributeData>().AllocatedSize());
-                        ReturnOnFailure(bufReader.Next());
-                        // Skip to the end of the element.
-                        ReturnOnFailure(bufReader.Skip());
-
-                        // Compute the amount of value data
-                        clusterSize += bufReader.GetLengthRead();
+                        clusterSize += attributeIter.second;
                     }
                 }
-                else
+
+                if (clusterSize == 0)
                 {
-                    clusterSize += attributeIter.second;
+                    // No data in this cluster, so no point in sending a dataVersion
+                    // along at all.
+                    continue;
                 }
-            }
-
-            if (clusterSize == 0)
-            {
-                // No data in this cluster, so no point in sending a dataVersion
-                // along at all.
-                continue;
-            }
 
-            DataVersionFilter filter(endpointId, clusterId, dataVersion);
+                DataVersionFilter filter(endpointId, clusterId, dataVersion);
 
-            aVector.push_back(std::make_pair(filter, clusterSize));
+                aVector.push_back(std::make_pair(filter, clusterSize));
+            }
         }
     }
 
@@ -649,12 +958,61 @@ exit:
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(EndpointId endpointId)
 {
+    if (mStorageLayout == StorageLayout::kFlat)
+    {
+        const uint64_t firstKey = PackClusterKey(endpointId, 0);
+
+        size_t firstAttribute = FlatAttributeLowerBound(firstKey, 0);
+        size_t lastAttribute  = firstAttribute;
+        while (lastAttribute < mFlatAttributes.size() && EndpointIdOfKey(mFlatAttributes[lastAttribute].mClusterKey) == endpointId)
+        {
+            lastAttribute++;
+        }
+        EraseFlatAttributes(firstAttribute, lastAttribute);
+
+        auto firstCluster = mFlatClusters.begin() + static_cast<ptrdiff_t>(FlatClusterLowerBound(firstKey));
+        auto lastCluster  = firstCluster;
+        while (lastCluster != mFlatClusters.end() && EndpointIdOfKey(lastCluster->mKey) == endpointId)
+        {
+            lastCluster++;
+        }
+        mFlatClusters.erase(firstCluster, lastCluster);
+
+        auto endpoint = std::lower_bound(mFlatEndpoints.begin(), mFlatEndpoints.end(), endpointId);
+        if (endpoint != mFlatEndpoints.end() && *endpoint == endpointId)
+        {
+            mFlatEndpoints.erase(endpoint);
+        }
+        return;
+    }
+
     mCache.erase(endpointId);
 }
 
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClusterPath & cluster)
 {
+    if (mStorageLayout == StorageLayout::kFlat)
+    {
+        // As with the nested maps, the endpoint stays in the cache.
+        const uint64_t clusterKey = PackClusterKey(cluster.mEndpointId, cluster.mClusterId);
+        const size_t clusterIndex = FlatClusterLowerBound(clusterKey);
+        if (clusterIndex == mFlatClusters.size() || mFlatClusters[clusterIndex].mKey != clusterKey)
+        {
+            return;
+        }
+        mFlatClusters.erase(mFlatClusters.begin() + static_cast<ptrdiff_t>(clusterIndex));
+
+        size_t firstAttribute = FlatAttributeLowerBound(clusterKey, 0);
+        size_t lastAttribute  = firstAttribute;
+        while (lastAttribute < mFlatAttributes.size() && mFlatAttributes[lastAttribute].mClusterKey == clusterKey)
+        {
+            lastAttribute++;
+        }
+        EraseFlatAttributes(firstAttribute, lastAttribute);
+        return;
+    }
+
     // Can't use GetEndpointState here, since that only handles const things.
     auto endpointIter = mCache.find(cluster.mEndpointId);
     if (endpointIter == mCache.end())
@@ -669,6 +1027,17 @@ void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClu
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttributePath & attribute)
 {
+    if (mStorageLayout == StorageLayout::kFlat)
+    {
+        const FlatAttributeState * attributeState = FindFlatAttribute(attribute);
+        if (attributeState != nullptr)
+        {
+            const size_t index = static_cast<size_t>(attributeState - mFlatAttributes.data());
+            EraseFlatAttributes(index, index + 1);
+        }
+        return;
+    }
+
     // Can't use GetClusterState here, since that only handles const things.
     auto endpointIter = mCache.find(attribute.mEndpointId);
     if (endpointIter == mCache.end())
@@ -98,23 +98,44 @@ public:
         virtual void OnEndpointAdded(ClusterStateCacheT * cache, EndpointId endpointId){};
     };
 
+    /*
+     * How the cache stores attribute state and events.
+     *
+     * kTree keeps attribute state in maps nested by endpoint, cluster and attribute ID, with a separate buffer for the
+     * data of each attribute, and events in a set ordered by event number.
+     *
+     * kFlat keeps attribute and cluster state in vectors sorted by path, with the data of all attributes in one shared
+     * TLV buffer, and events in a vector sorted by event number. This takes much less memory and is faster to look up
+     * for caches holding many attributes (e.g. mirroring wildcard subscriptions), but inserting a path that is not in the
+     * cache yet is linear in the number of cached paths. Also, the TLV buffer backing attribute values retrieved from the
+     * cache only remains valid until any attribute in the cache is updated or cleared.
+     */
+    enum class StorageLayout : uint8_t
+    {
+        kTree,
+        kFlat,
+    };
+
     /**
      *
      * @param [in] callback the derived callback which inherit from ReadClient::Callback
      * @param [in] highestReceivedEventNumber optional highest received event number, if cache receive the events with the number
      *             less than or equal to this value, skip those events
+     * @param [in] storageLayout how the cache stores attribute state and events
      */
-    ClusterStateCacheT(Callback & callback, Optional<EventNumber> highestReceivedEventNumber = Optional<EventNumber>::Missing()) :
-        mCallback(callback), mBufferedReader(*this)
+    ClusterStateCacheT(Callback & callback, Optional<EventNumber> highestReceivedEventNumber = Optional<EventNumber>::Missing(),
+                       StorageLayout storageLayout = StorageLayout::kTree) :
+        mCallback(callback),
+        mBufferedReader(*this), mStorageLayout(storageLayout)
     {
         mHighestReceivedEventNumber = highestReceivedEventNumber;
     }
 
     template <bool DataCachingEnabled = CanEnableDataCaching, std::enable_if_t<DataCachingEnabled, bool> = true>
     ClusterStateCacheT(Callback & callback, Optional<EventNumber> highestReceivedEventNumber = Optional<EventNumber>::Missing(),
-                       bool cacheData = true) :
+                       bool cacheData = true, StorageLayout storageLayout = StorageLayout::kTree) :
         mCallback(callback),
-        mBufferedReader(*this), mCacheData(cacheData)
+        mBufferedReader(*this), mCacheData(cacheData), mStorageLayout(storageLayout)
     {
         mHighestReceivedEventNumber = highestReceivedEventNumber;
     }
@@ -142,8 +163,8 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
-     * across any async call boundaries.
+     * valid until the cached value for that path is updated (for StorageLayout::kFlat, until any cached value is
+     * updated), so it must not be held across any async call boundaries.
      *
      * The template parameter AttributeObjectTypeT is generally expected to be a
      * ClusterName::Attributes::AttributeName::DecodableType, but any
@@ -261,8 +282,8 @@ public:
      * Retrieve the value of an attribute by updating a in-out TLVReader to be positioned
      * right at the attribute value.
      *
-     * The underlying TLV buffer only remains valid until the cached value for that path is updated, so it must
-     * not be held across any async call boundaries.
+     * The underlying TLV buffer only remains valid until the cached value for that path is updated (for
+     * StorageLayout::kFlat, until any cached value is updated), so it must not be held across any async call boundaries.
      *
      * Notable return values:
      *      - If neither data nor status for the specified path exist in the cache, CHIP_ERROR_KEY_NOT_FOUND
@@ -375,6 +396,20 @@ public:
     {
         CHIP_ERROR err;
 
+        if (mStorageLayout == StorageLayout::kFlat)
+        {
+            VerifyOrReturnError(FindFlatCluster(endpointId, clusterId) != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+            const uint64_t clusterKey = PackClusterKey(endpointId, clusterId);
+            for (size_t i = FlatAttributeLowerBound(clusterKey, 0);
+                 i < mFlatAttributes.size() && mFlatAttributes[i].mClusterKey == clusterKey; i++)
+            {
+                const ConcreteAttributePath path(endpointId, clusterId, mFlatAttributes[i].mAttributeId);
+                ReturnErrorOnFailure(func(path));
+            }
+            return CHIP_NO_ERROR;
+        }
+
         auto clusterState = GetClusterState(endpointId, clusterId, err);
         ReturnErrorOnFailure(err);
 
@@ -403,6 +438,19 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
     {
+        if (mStorageLayout == StorageLayout::kFlat)
+        {
+            for (const auto & attribute : mFlatAttributes)
+            {
+                if (ClusterIdOfKey(attribute.mClusterKey) == clusterId)
+                {
+                    const ConcreteAttributePath path(EndpointIdOfKey(attribute.mClusterKey), clusterId, attribute.mAttributeId);
+                    ReturnErrorOnFailure(func(path));
+                }
+            }
+            return CHIP_NO_ERROR;
+        }
+
         for (auto & endpointIter : mCache)
         {
             for (auto & clusterIter : endpointIter.second)
@@ -435,6 +483,17 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(IteratorFunc func) const
     {
+        if (mStorageLayout == StorageLayout::kFlat)
+        {
+            for (const auto & attribute : mFlatAttributes)
+            {
+                const ConcreteAttributePath path(EndpointIdOfKey(attribute.mClusterKey), ClusterIdOfKey(attribute.mClusterKey),
+                                                 attribute.mAttributeId);
+                ReturnErrorOnFailure(func(path));
+            }
+            return CHIP_NO_ERROR;
+        }
+
         for (const auto & [endpointId, endpointState] : mCache)
         {
             for (const auto & [clusterId, clusterState] : endpointState)
@@ -465,6 +524,16 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
+        if (mStorageLayout == StorageLayout::kFlat)
+        {
+            for (size_t i = FlatClusterLowerBound(PackClusterKey(endpointId, 0));
+                 i < mFlatClusters.size() && EndpointIdOfKey(mFlatClusters[i].mKey) == endpointId; i++)
+            {
+                ReturnErrorOnFailure(func(ClusterIdOfKey(mFlatClusters[i].mKey)));
+            }
+            return CHIP_NO_ERROR;
+        }
+
         auto endpointIter = mCache.find(endpointId);
         if (endpointIter->first == endpointId)
         {
@@ -501,6 +570,18 @@ public:
     CHIP_ERROR ForEachEventData(IteratorFunc func, EventPathParams pathFilter = EventPathParams(),
                                 EventNumber minEventNumberFilter = 0) const
     {
+        if (mStorageLayout == StorageLayout::kFlat)
+        {
+            for (const auto & item : mFlatEventData)
+            {
+                if (pathFilter.IsEventPathSupersetOf(item.first.mPath) && item.first.mEventNumber >= minEventNumberFilter)
+                {
+                    ReturnErrorOnFailure(func(item.first));
+                }
+            }
+            return CHIP_NO_ERROR;
+        }
+
         for (const auto & item : mEventDataCache)
         {
             if (pathFilter.IsEventPathSupersetOf(item.first.mPath) && item.first.mEventNumber >= minEventNumberFilter)
@@ -563,6 +644,7 @@ public:
     void ClearEventCache(bool resetTrackedEventCounters = false)
     {
         mEventDataCache.clear();
+        mFlatEventData.clear();
         if (resetTrackedEventCounters)
         {
             mHighestReceivedEventNumber.ClearValue();
@@ -597,15 +679,51 @@ private:
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
     // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
     // and we must not be in the middle of receiving reports for that cluster.
-    struct ClusterState
+    struct ClusterDataVersions
     {
-        std::map<AttributeId, AttributeState> mAttributes;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
     };
+    struct ClusterState : public ClusterDataVersions
+    {
+        std::map<AttributeId, AttributeState> mAttributes;
+    };
     using EndpointState = std::map<ClusterId, ClusterState>;
     using NodeState     = std::map<EndpointId, EndpointState>;
 
+    // For StorageLayout::kFlat, clusters are keyed by their endpoint and cluster IDs packed together, so that sorting by
+    // key sorts by endpoint and then by cluster, like NodeState does.
+    static constexpr uint64_t PackClusterKey(EndpointId endpointId, ClusterId clusterId)
+    {
+        return (static_cast<uint64_t>(endpointId) << 32) | clusterId;
+    }
+    static constexpr EndpointId EndpointIdOfKey(uint64_t clusterKey) { return static_cast<EndpointId>(clusterKey >> 32); }
+    static constexpr ClusterId ClusterIdOfKey(uint64_t clusterKey) { return static_cast<ClusterId>(clusterKey); }
+
+    struct FlatClusterState : public ClusterDataVersions
+    {
+        uint64_t mKey;
+    };
+
+    // The StorageLayout::kFlat equivalent of an AttributeState. mSize is the size of the data or status on the wire,
+    // whether or not the data itself is cached; cached data is at mDataOffset in mFlatAttributeData.
+    struct FlatAttributeState
+    {
+        enum class Kind : uint8_t
+        {
+            kData,
+            kStatus,
+            kSizeOnly,
+        };
+
+        uint64_t mClusterKey;
+        AttributeId mAttributeId;
+        uint32_t mDataOffset;
+        uint32_t mSize;
+        StatusIB mStatus;
+        Kind mKind;
+    };
+
     struct Comparator
     {
         bool operator()(const AttributePathParams & x, const AttributePathParams & y) const
@@ -647,6 +765,42 @@ private:
 
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
+    /*
+     * Lookups into the StorageLayout::kFlat state. The LowerBound variants return the index of the first entry whose key is
+     * not less than the given one.
+     */
+    const FlatClusterState * FindFlatCluster(EndpointId endpointId, ClusterId clusterId) const;
+    const FlatAttributeState * FindFlatAttribute(const ConcreteAttributePath & path) const;
+    size_t FlatClusterLowerBound(uint64_t clusterKey) const;
+    size_t FlatAttributeLowerBound(uint64_t clusterKey, AttributeId attributeId) const;
+
+    /*
+     * Returns the data versions of a cluster, adding the cluster (and its endpoint) to the cache if needed.
+     */
+    ClusterDataVersions & GetOrAddClusterDataVersions(EndpointId endpointId, ClusterId clusterId);
+
+    /*
+     * Updates the StorageLayout::kFlat state of an attribute, with the same arguments as UpdateCache(). elementSize is the
+     * size of the data in apData, if any.
+     */
+    CHIP_ERROR UpdateFlatAttribute(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, uint32_t elementSize,
+                                   const StatusIB & aStatus);
+
+    /*
+     * Erases the StorageLayout::kFlat state of the attributes at indexes [first, last) of mFlatAttributes.
+     */
+    void EraseFlatAttributes(size_t first, size_t last);
+
+    // Accounts for the data of an attribute that is being replaced or erased as unused.
+    void ReleaseFlatAttributeData(const FlatAttributeState & attribute);
+
+    // Moves the data of all attributes to the start of mFlatAttributeData, if enough of it is unused to be worth it.
+    void CompactFlatAttributeDataIfNeeded();
+
+    // Releases the spare capacity of the flat attribute and cluster vectors, if there is a lot of it. Vectors grow by doubling,
+    // so a report adding many paths can leave them up to twice as large as needed.
+    void ShrinkFlatStorage();
+
     /*
      * Updates the state of an attribute in the cache given a reader. If the reader is null, the state is updated
      * with the provided status.
@@ -719,17 +873,28 @@ private:
     CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize);
 
     Callback & mCallback;
+
+    // Only the containers for mStorageLayout are used; the others stay empty.
     NodeState mCache;
     std::set<ConcreteAttributePath> mChangedAttributeSet;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
 
     std::set<EventData, EventDataCompare> mEventDataCache;
+
+    std::vector<EndpointId> mFlatEndpoints;             // sorted
+    std::vector<FlatClusterState> mFlatClusters;        // sorted by mKey
+    std::vector<FlatAttributeState> mFlatAttributes;    // sorted by mClusterKey, then mAttributeId
+    std::vector<uint8_t> mFlatAttributeData;            // TLV data of the attributes in mFlatAttributes
+    size_t mFlatAttributeDataUnused = 0;                // bytes of mFlatAttributeData no attribute refers to anymore
+    std::vector<EventData> mFlatEventData;              // sorted by event number
+
     Optional<EventNumber> mHighestReceivedEventNumber;
     std::map<ConcreteEventPath, StatusIB> mEventStatusCache;
     BufferedReadCallback mBufferedReader;
     ConcreteClusterPath mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     const bool mCacheData                   = CanEnableDataCaching;
+    const StorageLayout mStorageLayout      = StorageLayout::kTree;
 };
 
 using ClusterStateCache       = ClusterStateCacheT<true>;
@@ -308,6 +308,8 @@ void InteractionModelEngine::Shutdown()
     {
         ChipLogProgress(InteractionModel, "Shutting down data model provider %p", mDataModelProvider);
         LogErrorOnFailure(mDataModelProvider->Shutdown());
+        // The metadata lists are allocated from the platform memory, which may be shut down before the provider is destroyed.
+        mDataModelProvider->GetMetadataSnapshot().Invalidate();
         mDataModelProviderNeedsStartup = true;
     }
 
@@ -1975,6 +1977,7 @@ DataModel::Provider * InteractionModelEngine::SetDataModelProvider(DataModel::Pr
                 ChipLogError(InteractionModel, "Failure on interaction model shutdown: %" CHIP_ERROR_FORMAT, err.Format());
             }
         }
+        oldModel->GetMetadataSnapshot().Invalidate();
     }
 
     mDataModelProvider = model;
@@ -651,7 +651,8 @@ void ReadHandler::MoveToState(const HandlerState aTargetState)
     {
         if (ShouldReportUnscheduled())
         {
-            TEMPORARY_RETURN_IGNORED mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().ScheduleRun();
+            reporting::Engine & reportingEngine = mManagementCallback.GetInteractionModelEngine()->GetReportingEngine();
+            TEMPORARY_RETURN_IGNORED reportingEngine.ScheduleRunForHandler(*this);
         }
         else
         {
@@ -45,6 +45,7 @@
 #include <lib/core/TLVDebug.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/LinkedList.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeHolder.h>
@@ -79,8 +80,10 @@ class TestInteractionModelEngine;
  *  @brief The read handler is responsible for processing a read request, asking the attribute/event store
  *         for the relevant data, and sending a reply.
  *
+ *         The list node links the handler into the reporting engine queue of handlers waiting for a run.
+ *
  */
-class ReadHandler : public Messaging::ExchangeDelegate
+class ReadHandler : public Messaging::ExchangeDelegate, public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
 {
 public:
     using SubjectDescriptor = Access::SubjectDescriptor;
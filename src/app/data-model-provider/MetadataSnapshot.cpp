@@ -0,0 +1,70 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/data-model-provider/MetadataSnapshot.h>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+Span<const EndpointEntry> MetadataSnapshot::Endpoints()
+{
+    if (!mHasEndpoints)
+    {
+        mEndpoints    = mTree.EndpointsIgnoreError();
+        mHasEndpoints = true;
+    }
+    return mEndpoints;
+}
+
+Span<const ServerClusterEntry> MetadataSnapshot::ServerClusters(EndpointId endpointId)
+{
+    if (mClustersEndpointId != endpointId)
+    {
+        mClusters           = mTree.ServerClustersIgnoreError(endpointId);
+        mClustersEndpointId = endpointId;
+    }
+    return mClusters;
+}
+
+Span<const AttributeEntry> MetadataSnapshot::Attributes(const ConcreteClusterPath & path)
+{
+    if (mAttributesClusterPath != path)
+    {
+        mAttributes            = mTree.AttributesIgnoreError(path);
+        mAttributesClusterPath = path;
+    }
+    return mAttributes;
+}
+
+void MetadataSnapshot::Invalidate()
+{
+    mVersion++;
+
+    mHasEndpoints = false;
+    mEndpoints    = ReadOnlyBuffer<EndpointEntry>();
+
+    mClustersEndpointId.reset();
+    mClusters = ReadOnlyBuffer<ServerClusterEntry>();
+
+    mAttributesClusterPath.reset();
+    mAttributes = ReadOnlyBuffer<AttributeEntry>();
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
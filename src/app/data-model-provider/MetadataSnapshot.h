@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteClusterPath.h>
+#include <app/data-model-provider/MetadataTypes.h>
+#include <app/data-model-provider/ProviderMetadataTree.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/ReadOnlyBuffer.h>
+#include <lib/support/Span.h>
+
+#include <optional>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+/// Keeps the endpoint, server cluster and attribute lists last fetched from a
+/// ProviderMetadataTree, so that iterations over the metadata (e.g. wildcard
+/// path expansion, which restarts for every report chunk) can share them instead
+/// of fetching and allocating them again.
+///
+/// The snapshot holds:
+///   - the list of all endpoints
+///   - the server clusters of a single endpoint
+///   - the attributes of a single cluster
+///
+/// Requesting the list of another endpoint or cluster replaces the previous one.
+/// Spans returned by the methods below remain valid until the next call for a
+/// different endpoint/cluster or until `Invalidate` is called, so callers should
+/// not keep them across operations that may use the same snapshot.
+///
+/// Lists are NOT refreshed automatically: whoever owns the snapshot is expected
+/// to `Invalidate` it whenever the metadata tree changes (see
+/// `Provider::GetMetadataSnapshot`).
+class MetadataSnapshot
+{
+public:
+    MetadataSnapshot(ProviderMetadataTree & tree) : mTree(tree) {}
+
+    MetadataSnapshot(const MetadataSnapshot &)             = delete;
+    MetadataSnapshot & operator=(const MetadataSnapshot &) = delete;
+
+    Span<const EndpointEntry> Endpoints();
+    Span<const ServerClusterEntry> ServerClusters(EndpointId endpointId);
+    Span<const AttributeEntry> Attributes(const ConcreteClusterPath & path);
+
+    /// Drops all the lists, so that they are fetched again on the next use.
+    void Invalidate();
+
+    /// Changes every time the snapshot is invalidated.
+    uint32_t Version() const { return mVersion; }
+
+private:
+    ProviderMetadataTree & mTree;
+    uint32_t mVersion = 0;
+
+    bool mHasEndpoints = false;
+    ReadOnlyBuffer<EndpointEntry> mEndpoints;
+
+    std::optional<EndpointId> mClustersEndpointId;
+    ReadOnlyBuffer<ServerClusterEntry> mClusters;
+
+    std::optional<ConcreteClusterPath> mAttributesClusterPath;
+    ReadOnlyBuffer<AttributeEntry> mAttributes;
+};
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
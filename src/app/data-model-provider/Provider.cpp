@@ -17,6 +17,8 @@
 #include "platform/LockTracker.h"
 #include <app/data-model-provider/Provider.h>
 
+#include <clusters/shared/GlobalIds.h>
+
 namespace chip::app::DataModel {
 
 void Provider::RegisterAttributeChangeListener(AttributeChangeListener & listener)
@@ -67,6 +69,12 @@ void Provider::NotifyAttributeChanged(const ConcreteAttributePath & path, Attrib
 {
     assertChipStackLockedByCurrentThread();
 
+    // A changed attribute list means the cluster metadata changed
+    if (path.mAttributeId == Clusters::Globals::Attributes::AttributeList::Id)
+    {
+        mMetadataSnapshot.Invalidate();
+    }
+
     // Register this iteration on the stack of active iterators.
     // This allows UnregisterAttributeChangeListener to update us if needed.
     ActiveIterator iter;
@@ -88,6 +96,8 @@ void Provider::NotifyEndpointChanged(EndpointId endpointId, EndpointChangeType t
 {
     assertChipStackLockedByCurrentThread();
 
+    mMetadataSnapshot.Invalidate();
+
     // Register this iteration on the stack of active iterators.
     // This allows UnregisterAttributeChangeListener to update us if needed.
     ActiveIterator iter;
@@ -105,4 +115,15 @@ void Provider::NotifyEndpointChanged(EndpointId endpointId, EndpointChangeType t
     mActiveIterators = iter.nextIterator;
 }
 
+MetadataSnapshot & Provider::GetMetadataSnapshot()
+{
+    std::optional<unsigned> generation = MetadataStructureGeneration();
+    if (!generation.has_value() || (generation != mMetadataSnapshotGeneration))
+    {
+        mMetadataSnapshot.Invalidate();
+        mMetadataSnapshotGeneration = generation;
+    }
+    return mMetadataSnapshot;
+}
+
 } // namespace chip::app::DataModel
@@ -27,9 +27,12 @@
 
 #include <app/data-model-provider/ActionReturnStatus.h>
 #include <app/data-model-provider/Context.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/OperationTypes.h>
 #include <app/data-model-provider/ProviderMetadataTree.h>
 
+#include <optional>
+
 namespace chip {
 namespace app {
 namespace DataModel {
@@ -128,6 +131,23 @@ public:
     void NotifyAttributeChanged(const ConcreteAttributePath & path, AttributeChangeType type);
     void NotifyEndpointChanged(EndpointId endpointId, EndpointChangeType type);
 
+    /// Returns the snapshot of endpoint/cluster/attribute lists shared by iterations
+    /// over the metadata of this provider (e.g. AttributePathExpandIterator).
+    ///
+    /// The snapshot is invalidated:
+    ///   - on NotifyEndpointChanged
+    ///   - on NotifyAttributeChanged for an `AttributeList` attribute
+    ///   - whenever `MetadataStructureGeneration` changes.
+    ///
+    /// Providers that do not implement `MetadataStructureGeneration` get an invalidated
+    /// snapshot on every call, so lists are then only shared within a single iteration.
+    MetadataSnapshot & GetMetadataSnapshot();
+
+protected:
+    /// Returns a value that changes whenever `Endpoints`, `ServerClusters` or `Attributes`
+    /// may return different content, or std::nullopt if the provider does not track this.
+    virtual std::optional<unsigned> MetadataStructureGeneration() { return std::nullopt; }
+
 private:
     /// Represents an active iteration over the listener list.
     /// Since listeners can be unregistered during notification, and notifications
@@ -144,6 +164,9 @@ private:
 
     AttributeChangeListener * mAttributeChangeListenersHead = nullptr;
     ActiveIterator * mActiveIterators                       = nullptr; // Head of the stack of active iterators
+
+    MetadataSnapshot mMetadataSnapshot{ *this };
+    std::optional<unsigned> mMetadataSnapshotGeneration;
 };
 
 } // namespace DataModel
@@ -0,0 +1,205 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <app/data-model-provider/MetadataSnapshot.h>
+#include <app/data-model-provider/Provider.h>
+#include <clusters/shared/GlobalIds.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::DataModel;
+
+using chip::Protocols::InteractionModel::Status;
+
+constexpr EndpointId kEndpointCount         = 3;
+constexpr ClusterId kClustersPerEndpoint    = 2;
+constexpr AttributeId kAttributesPerCluster = 4;
+
+// Provider with a fixed tree that counts the metadata fetches
+class CountingProvider : public Provider
+{
+public:
+    std::optional<unsigned> generation;
+
+    unsigned endpointFetches  = 0;
+    unsigned clusterFetches   = 0;
+    unsigned attributeFetches = 0;
+
+    CHIP_ERROR Endpoints(ReadOnlyBufferBuilder<EndpointEntry> & builder) override
+    {
+        endpointFetches++;
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(kEndpointCount));
+        for (EndpointId id = 1; id <= kEndpointCount; id++)
+        {
+            ReturnErrorOnFailure(builder.Append({ id, kInvalidEndpointId, EndpointCompositionPattern::kFullFamily }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR DeviceTypes(EndpointId endpointId, ReadOnlyBufferBuilder<DeviceTypeEntry> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ClientClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ClusterId> & builder) override { return CHIP_NO_ERROR; }
+    CHIP_ERROR ServerClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ServerClusterEntry> & builder) override
+    {
+        clusterFetches++;
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(kClustersPerEndpoint));
+        for (ClusterId id = 1; id <= kClustersPerEndpoint; id++)
+        {
+            ReturnErrorOnFailure(builder.Append({ endpointId * 100u + id, 0, BitFlags<ClusterQualityFlags>() }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR EventInfo(const ConcreteEventPath & path, EventEntry & eventInfo) override { return CHIP_NO_ERROR; }
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<AttributeEntry> & builder) override
+    {
+        attributeFetches++;
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(kAttributesPerCluster));
+        for (AttributeId id = 1; id <= kAttributesPerCluster; id++)
+        {
+            ReturnErrorOnFailure(builder.Append(AttributeEntry(path.mClusterId * 100u + id, BitMask<AttributeQualityFlags>(),
+                                                               Access::Privilege::kView, std::nullopt)));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR GeneratedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<AcceptedCommandEntry> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ActionReturnStatus ReadAttribute(const ReadAttributeRequest & request, AttributeValueEncoder & encoder) override
+    {
+        return Status::Success;
+    }
+    ActionReturnStatus WriteAttribute(const WriteAttributeRequest & request, AttributeValueDecoder & decoder) override
+    {
+        return Status::Success;
+    }
+    void ListAttributeWriteNotification(const ConcreteAttributePath & aPath, ListWriteOperation opType,
+                                        FabricIndex accessingFabric) override
+    {}
+    std::optional<ActionReturnStatus> InvokeCommand(const InvokeRequest & request, chip::TLV::TLVReader & input_arguments,
+                                                    CommandHandler * handler) override
+    {
+        return Status::Success;
+    }
+
+protected:
+    std::optional<unsigned> MetadataStructureGeneration() override { return generation; }
+};
+
+class TestMetadataSnapshot : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestMetadataSnapshot, TestListsAreShared)
+{
+    CountingProvider provider;
+    provider.generation = 1;
+
+    MetadataSnapshot & snapshot = provider.GetMetadataSnapshot();
+
+    Span<const EndpointEntry> endpoints = snapshot.Endpoints();
+    ASSERT_EQ(endpoints.size(), static_cast<size_t>(kEndpointCount));
+    EXPECT_EQ(endpoints[2].id, 3u);
+    EXPECT_EQ(provider.GetMetadataSnapshot().Endpoints().data(), endpoints.data());
+    EXPECT_EQ(provider.endpointFetches, 1u);
+
+    Span<const ServerClusterEntry> clusters = snapshot.ServerClusters(2);
+    ASSERT_EQ(clusters.size(), static_cast<size_t>(kClustersPerEndpoint));
+    EXPECT_EQ(clusters[0].clusterId, 201u);
+    EXPECT_EQ(snapshot.ServerClusters(2).size(), static_cast<size_t>(kClustersPerEndpoint));
+    EXPECT_EQ(provider.clusterFetches, 1u);
+
+    // Only the last endpoint is kept
+    EXPECT_EQ(snapshot.ServerClusters(3)[0].clusterId, 301u);
+    EXPECT_EQ(snapshot.ServerClusters(2)[0].clusterId, 201u);
+    EXPECT_EQ(provider.clusterFetches, 3u);
+
+    Span<const AttributeEntry> attributes = snapshot.Attributes(ConcreteClusterPath(2, 201));
+    ASSERT_EQ(attributes.size(), static_cast<size_t>(kAttributesPerCluster));
+    EXPECT_EQ(attributes[3].attributeId, 20104u);
+    EXPECT_EQ(snapshot.Attributes(ConcreteAttributePath(2, 201, 20101)).size(), static_cast<size_t>(kAttributesPerCluster));
+    EXPECT_EQ(provider.attributeFetches, 1u);
+
+    EXPECT_EQ(snapshot.Attributes(ConcreteClusterPath(3, 201))[0].attributeId, 20101u);
+    EXPECT_EQ(provider.attributeFetches, 2u);
+    EXPECT_EQ(provider.endpointFetches, 1u);
+}
+
+TEST_F(TestMetadataSnapshot, TestInvalidation)
+{
+    CountingProvider provider;
+    provider.generation = 1;
+
+    MetadataSnapshot & snapshot = provider.GetMetadataSnapshot();
+    const uint32_t version      = snapshot.Version();
+    (void) snapshot.Endpoints();
+    (void) snapshot.Attributes(ConcreteClusterPath(1, 101));
+
+    // Value changes do not affect metadata
+    provider.NotifyAttributeChanged(ConcreteAttributePath(1, 101, 10101), AttributeChangeType::kReportable);
+    (void) provider.GetMetadataSnapshot().Endpoints();
+    (void) provider.GetMetadataSnapshot().Attributes(ConcreteClusterPath(1, 101));
+    EXPECT_EQ(snapshot.Version(), version);
+    EXPECT_EQ(provider.endpointFetches, 1u);
+    EXPECT_EQ(provider.attributeFetches, 1u);
+
+    provider.NotifyAttributeChanged(ConcreteAttributePath(1, 101, Clusters::Globals::Attributes::AttributeList::Id),
+                                    AttributeChangeType::kReportable);
+    EXPECT_NE(snapshot.Version(), version);
+    (void) provider.GetMetadataSnapshot().Attributes(ConcreteClusterPath(1, 101));
+    EXPECT_EQ(provider.attributeFetches, 2u);
+
+    provider.NotifyEndpointChanged(2, EndpointChangeType::kRemoved);
+    (void) provider.GetMetadataSnapshot().Endpoints();
+    EXPECT_EQ(provider.endpointFetches, 2u);
+
+    provider.generation = 2;
+    (void) provider.GetMetadataSnapshot().Endpoints();
+    (void) provider.GetMetadataSnapshot().Endpoints();
+    EXPECT_EQ(provider.endpointFetches, 3u);
+}
+
+TEST_F(TestMetadataSnapshot, TestNoGeneration)
+{
+    CountingProvider provider;
+
+    // Lists are shared through a snapshot, but every new snapshot fetches them again
+    MetadataSnapshot & snapshot = provider.GetMetadataSnapshot();
+    (void) snapshot.Endpoints();
+    (void) snapshot.Endpoints();
+    EXPECT_EQ(provider.endpointFetches, 1u);
+
+    (void) provider.GetMetadataSnapshot().Endpoints();
+    EXPECT_EQ(provider.endpointFetches, 2u);
+}
+
+} // namespace
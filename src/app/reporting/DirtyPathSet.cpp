@@ -0,0 +1,301 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathSet.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+#include <type_traits>
+
+namespace chip::app::reporting {
+
+// Paths are moved around with memmove and the heap storage is resized with MemoryRealloc.
+static_assert(std::is_trivially_copyable<AttributePathParamsWithGeneration>::value);
+
+namespace {
+
+bool KeyLess(const AttributePathParams & aPath, EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId)
+{
+    if (aPath.mEndpointId != aEndpointId)
+    {
+        return aPath.mEndpointId < aEndpointId;
+    }
+    if (aPath.mClusterId != aClusterId)
+    {
+        return aPath.mClusterId < aClusterId;
+    }
+    return aPath.mAttributeId < aAttributeId;
+}
+
+} // namespace
+
+DirtyPathSetBase::~DirtyPathSetBase()
+{
+    if (mHeapInitialCapacity != 0)
+    {
+        Platform::MemoryFree(mEntries);
+    }
+}
+
+size_t DirtyPathSetBase::LowerBound(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId) const
+{
+    size_t low  = 0;
+    size_t high = mCount;
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+        if (KeyLess(mEntries[mid], aEndpointId, aClusterId, aAttributeId))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+AttributePathParamsWithGeneration * DirtyPathSetBase::Find(EndpointId aEndpointId, ClusterId aClusterId,
+                                                           AttributeId aAttributeId) const
+{
+    size_t index = LowerBound(aEndpointId, aClusterId, aAttributeId);
+    VerifyOrReturnValue(index < mCount, nullptr);
+
+    AttributePathParamsWithGeneration & path = mEntries[index];
+    VerifyOrReturnValue(path.mEndpointId == aEndpointId && path.mClusterId == aClusterId && path.mAttributeId == aAttributeId,
+                        nullptr);
+    return &path;
+}
+
+template <typename Function>
+Loop DirtyPathSetBase::ForEachCoveringPath(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId,
+                                           Function && aFunction) const
+{
+    const EndpointId endpoints[]   = { aEndpointId, kInvalidEndpointId };
+    const ClusterId clusters[]     = { aClusterId, kInvalidClusterId };
+    const AttributeId attributes[] = { aAttributeId, kInvalidAttributeId };
+
+    // Components that already are wildcards only have one candidate.
+    const size_t endpointCount  = (aEndpointId == kInvalidEndpointId) ? 1 : 2;
+    const size_t clusterCount   = (aClusterId == kInvalidClusterId) ? 1 : 2;
+    const size_t attributeCount = (aAttributeId == kInvalidAttributeId) ? 1 : 2;
+
+    for (size_t e = 0; e < endpointCount; e++)
+    {
+        for (size_t c = 0; c < clusterCount; c++)
+        {
+            for (size_t a = 0; a < attributeCount; a++)
+            {
+                AttributePathParamsWithGeneration * path = Find(endpoints[e], clusters[c], attributes[a]);
+                if (path != nullptr && aFunction(*path) == Loop::Break)
+                {
+                    return Loop::Break;
+                }
+            }
+        }
+    }
+    return Loop::Finish;
+}
+
+bool DirtyPathSetBase::IsDirtyAfter(const ConcreteAttributePath & aPath, AttributeGeneration aGeneration) const
+{
+    VerifyOrReturnValue(mCount > 0, false);
+
+    return Loop::Break ==
+        ForEachCoveringPath(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId, [&](const auto & dirtyPath) {
+               return dirtyPath.mGeneration.After(aGeneration) ? Loop::Break : Loop::Continue;
+           });
+}
+
+bool DirtyPathSetBase::MergeOverlappedPath(const AttributePathParams & aPath, AttributeGeneration aGeneration)
+{
+    if (Loop::Break ==
+        ForEachCoveringPath(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId, [&](auto & path) {
+            if (path.HasWildcardListIndex() || path.mListIndex == aPath.mListIndex)
+            {
+                path.mGeneration = aGeneration;
+                return Loop::Break;
+            }
+            if (path.mEndpointId == aPath.mEndpointId && path.mClusterId == aPath.mClusterId &&
+                path.mAttributeId == aPath.mAttributeId)
+            {
+                // Same attribute, different list index: the set keeps one path per attribute, so cover both.
+                path.mListIndex  = kInvalidListIndex;
+                path.mGeneration = aGeneration;
+                return Loop::Break;
+            }
+            return Loop::Continue;
+        }))
+    {
+        return true;
+    }
+
+    VerifyOrReturnValue(RemoveSubsetsOf(aPath) > 0, false);
+    InsertSorted(aPath, aGeneration);
+    return true;
+}
+
+size_t DirtyPathSetBase::RemoveSubsetsOf(const AttributePathParams & aPath)
+{
+    // The only possible subset of a concrete attribute path has the same key, which MergeOverlappedPath already handles.
+    VerifyOrReturnValue(aPath.HasWildcardEndpointId() || aPath.HasWildcardClusterId() || aPath.HasWildcardAttributeId(), 0);
+
+    size_t begin = 0;
+    size_t end   = mCount;
+
+    // Subsets of a path with a concrete endpoint are all under that endpoint, and under its cluster if that is concrete too.
+    if (!aPath.HasWildcardEndpointId())
+    {
+        const bool sameCluster = !aPath.HasWildcardClusterId();
+        begin                  = LowerBound(aPath.mEndpointId, sameCluster ? aPath.mClusterId : 0, 0);
+        end                    = begin;
+        while (end < mCount && mEntries[end].mEndpointId == aPath.mEndpointId &&
+               (!sameCluster || mEntries[end].mClusterId == aPath.mClusterId))
+        {
+            end++;
+        }
+    }
+
+    size_t kept = begin;
+    for (size_t i = begin; i < end; i++)
+    {
+        if (!aPath.IsAttributePathSupersetOf(mEntries[i]))
+        {
+            mEntries[kept++] = mEntries[i];
+        }
+    }
+
+    const size_t removed = end - kept;
+    if (removed > 0)
+    {
+        memmove(&mEntries[kept], &mEntries[end], (mCount - end) * sizeof(mEntries[0]));
+        mCount -= removed;
+    }
+    return removed;
+}
+
+void DirtyPathSetBase::InsertSorted(const AttributePathParams & aPath, AttributeGeneration aGeneration)
+{
+    const size_t index = LowerBound(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
+    memmove(&mEntries[index + 1], &mEntries[index], (mCount - index) * sizeof(mEntries[0]));
+
+    mEntries[index]             = aPath;
+    mEntries[index].mGeneration = aGeneration;
+    mCount++;
+}
+
+template <typename SameGroup, typename Widen>
+bool DirtyPathSetBase::CollapseRuns(SameGroup && aSameGroup, Widen && aWiden)
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < mCount;)
+    {
+        AttributePathParamsWithGeneration merged = mEntries[i];
+        size_t next                              = i + 1;
+        for (; next < mCount && aSameGroup(mEntries[i], mEntries[next]); next++)
+        {
+            if (mEntries[next].mGeneration.After(merged.mGeneration))
+            {
+                merged.mGeneration = mEntries[next].mGeneration;
+            }
+        }
+        if (next - i > 1)
+        {
+            // The widened key still sorts after the rest of its run and before the next run.
+            aWiden(merged);
+        }
+        mEntries[kept++] = merged;
+        i                = next;
+    }
+
+    const bool released = kept < mCount;
+    mCount              = kept;
+    return released;
+}
+
+bool DirtyPathSetBase::MergePathsUnderSameCluster()
+{
+    // We don't support paths with a wildcard endpoint + a concrete cluster in global dirty set, so we do a simple == check
+    // here.
+    return CollapseRuns(
+        [](const AttributePathParams & first, const AttributePathParams & other) {
+            return !first.HasWildcardClusterId() && first.mEndpointId == other.mEndpointId && first.mClusterId == other.mClusterId;
+        },
+        [](AttributePathParams & path) { path.SetWildcardAttributeId(); });
+}
+
+bool DirtyPathSetBase::MergePathsUnderSameEndpoint()
+{
+    return CollapseRuns(
+        [](const AttributePathParams & first, const AttributePathParams & other) {
+            return !first.HasWildcardEndpointId() && first.mEndpointId == other.mEndpointId;
+        },
+        [](AttributePathParams & path) {
+            path.SetWildcardClusterId();
+            path.SetWildcardAttributeId();
+        });
+}
+
+bool DirtyPathSetBase::Grow()
+{
+    VerifyOrReturnValue(mHeapInitialCapacity != 0, false);
+
+    const size_t capacity = (mCapacity == 0) ? mHeapInitialCapacity : mCapacity * 2;
+    VerifyOrReturnValue(capacity > mCapacity, false);
+
+    auto * entries =
+        static_cast<AttributePathParamsWithGeneration *>(Platform::MemoryRealloc(mEntries, capacity * sizeof(mEntries[0])));
+    VerifyOrReturnValue(entries != nullptr, false);
+
+    mEntries  = entries;
+    mCapacity = capacity;
+    return true;
+}
+
+CHIP_ERROR DirtyPathSetBase::Insert(const AttributePathParams & aPath, AttributeGeneration aGeneration)
+{
+    VerifyOrReturnError(!MergeOverlappedPath(aPath, aGeneration), CHIP_NO_ERROR);
+
+    if (mCount == mCapacity && !Grow() && !MergePathsUnderSameCluster() && !MergePathsUnderSameEndpoint())
+    {
+        VerifyOrReturnError(mCapacity > 0, CHIP_ERROR_NO_MEMORY);
+
+        ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
+        mEntries[0]             = AttributePathParams();
+        mEntries[0].mGeneration = aGeneration;
+        mCount                  = 1;
+    }
+
+    VerifyOrReturnError(!MergeOverlappedPath(aPath, aGeneration), CHIP_NO_ERROR);
+    ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
+
+    if (mCount == mCapacity)
+    {
+        // This should not happen, this path should be merged into the wildcard endpoint at least.
+        ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    InsertSorted(aPath, aGeneration);
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace chip::app::reporting
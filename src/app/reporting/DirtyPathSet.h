@@ -0,0 +1,175 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/Generations.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Iterators.h>
+#include <lib/support/Pool.h>
+#include <system/SystemConfig.h>
+
+#include <stddef.h>
+
+namespace chip::app::reporting {
+
+struct AttributePathParamsWithGeneration : public AttributePathParams
+{
+    AttributePathParamsWithGeneration() = default;
+    AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
+
+    AttributeGeneration mGeneration;
+};
+
+/**
+ * The set of attribute paths marked dirty for reporting, each tagged with the dirty set generation at which it
+ * was last marked.
+ *
+ * Paths are kept sorted by (endpoint, cluster, attribute). Wildcard ids are the largest value of their type, so
+ * they sort after every concrete id under the same parent and all the paths under one endpoint or one cluster
+ * are contiguous. Every path in the set that is a superset of a given path has one of at most 8 keys (each
+ * component either equal to the given one or a wildcard), so both merging a new path and checking whether a
+ * concrete path is dirty take a bounded number of binary searches instead of a scan of the whole set.
+ *
+ * No two paths in the set share the same (endpoint, cluster, attribute); paths that only differ by their list
+ * index are merged into one path with a wildcard list index.
+ */
+class DirtyPathSetBase
+{
+public:
+    DirtyPathSetBase(const DirtyPathSetBase &)             = delete;
+    DirtyPathSetBase & operator=(const DirtyPathSetBase &) = delete;
+
+    /**
+     * If a path in the set is a superset of aPath, update its generation to aGeneration. Otherwise, if aPath is a
+     * superset of some paths in the set, replace all of them with aPath at aGeneration.
+     *
+     * Returns whether one of our paths is now a superset of aPath.
+     */
+    bool MergeOverlappedPath(const AttributePathParams & aPath, AttributeGeneration aGeneration);
+
+    /**
+     * Adds aPath to the set at aGeneration, merging it into the existing paths when they overlap.
+     *
+     * If the set is out of space, the existing paths are merged by clusters, then by endpoints, and as a last
+     * resort replaced by a single wildcard path.
+     */
+    CHIP_ERROR Insert(const AttributePathParams & aPath, AttributeGeneration aGeneration);
+
+    /**
+     * Returns whether a path in the set that is a superset of aPath was marked dirty after aGeneration.
+     */
+    bool IsDirtyAfter(const ConcreteAttributePath & aPath, AttributeGeneration aGeneration) const;
+
+    /**
+     * Replaces paths that share the same concrete cluster by a wildcard attribute path under that cluster.
+     *
+     * Returns whether we have released any paths.
+     */
+    bool MergePathsUnderSameCluster();
+
+    /**
+     * Replaces paths that share the same concrete endpoint by a wildcard cluster path under that endpoint.
+     *
+     * Returns whether we have released any paths.
+     */
+    bool MergePathsUnderSameEndpoint();
+
+    void ReleaseAll() { mCount = 0; }
+    size_t Allocated() const { return mCount; }
+
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function) const
+    {
+        for (size_t i = 0; i < mCount; i++)
+        {
+            if (function(static_cast<const AttributePathParamsWithGeneration *>(&mEntries[i])) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+protected:
+    DirtyPathSetBase(AttributePathParamsWithGeneration * apStorage, size_t aCapacity) : mEntries(apStorage), mCapacity(aCapacity) {}
+    explicit DirtyPathSetBase(size_t aInitialHeapCapacity) : mHeapInitialCapacity(aInitialHeapCapacity) {}
+    ~DirtyPathSetBase();
+
+private:
+    // Index of the first path whose key is not less than (aEndpointId, aClusterId, aAttributeId).
+    size_t LowerBound(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId) const;
+
+    // The path with exactly the given key, or nullptr.
+    AttributePathParamsWithGeneration * Find(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId) const;
+
+    // Calls aFunction with every path in the set whose (endpoint, cluster, attribute) covers the given key.
+    template <typename Function>
+    Loop ForEachCoveringPath(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId, Function && aFunction) const;
+
+    // Removes the paths that aPath is a superset of, returns how many were removed.
+    size_t RemoveSubsetsOf(const AttributePathParams & aPath);
+
+    // Inserts aPath at its sorted position; the key must not already be in the set and there must be room for it.
+    void InsertSorted(const AttributePathParams & aPath, AttributeGeneration aGeneration);
+
+    // Collapses runs of adjacent paths for which aSameGroup(first, other) holds into the first path of the run widened by
+    // aWiden, keeping the most recent generation of the run.
+    template <typename SameGroup, typename Widen>
+    bool CollapseRuns(SameGroup && aSameGroup, Widen && aWiden);
+
+    bool Grow();
+
+    AttributePathParamsWithGeneration * mEntries = nullptr;
+    size_t mCount                                = 0;
+    size_t mCapacity                             = 0;
+    // Non-zero if mEntries is allocated from the heap and may grow.
+    const size_t mHeapInitialCapacity = 0;
+};
+
+template <size_t N, ObjectPoolMem M = ObjectPoolMem::kDefault>
+class DirtyPathSet;
+
+/**
+ * Fixed capacity dirty path set.
+ */
+template <size_t N>
+class DirtyPathSet<N, ObjectPoolMem::kInline> : public DirtyPathSetBase
+{
+public:
+    DirtyPathSet() : DirtyPathSetBase(mStorage, N) {}
+
+private:
+    AttributePathParamsWithGeneration mStorage[N];
+};
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+/**
+ * Dirty path set that grows on the heap and only falls back to merging paths when an allocation fails, matching
+ * the behavior of a heap ObjectPool.  N is the initial capacity.
+ */
+template <size_t N>
+class DirtyPathSet<N, ObjectPoolMem::kHeap> : public DirtyPathSetBase
+{
+public:
+    DirtyPathSet() : DirtyPathSetBase(N) {}
+};
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace chip::app::reporting
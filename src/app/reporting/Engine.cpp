@@ -38,6 +38,7 @@
 #include <lib/support/CodeUtils.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <algorithm>
 #include <optional>
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -54,6 +55,87 @@ namespace {
 using DataModel::ReadFlags;
 using Protocols::InteractionModel::Status;
 
+/// Remembers the access checks made for attribute reads while building one report for a ReadHandler.
+///
+/// Without access restrictions, the result of a read check only depends on the subject, the endpoint,
+/// the cluster and the privilege, while a wildcard path expands to every attribute of each cluster.
+/// The cache is scoped to the subject descriptor of the ReadHandler, and forgets its results if the
+/// access control list changes while it is alive.
+class AttributeReadAccessCache : public AccessControl::EntryListener
+{
+public:
+    AttributeReadAccessCache(const SubjectDescriptor & subjectDescriptor, uint32_t & numChecksAvoided) :
+        mSubjectDescriptor(subjectDescriptor), mNumChecksAvoided(numChecksAvoided),
+        mEnabled(!GetAccessControl().IsAccessRestrictionListSupported())
+    {
+        if (mEnabled)
+        {
+            GetAccessControl().AddEntryListener(*this);
+        }
+    }
+
+    ~AttributeReadAccessCache() override
+    {
+        if (mEnabled)
+        {
+            GetAccessControl().RemoveEntryListener(*this);
+        }
+    }
+
+    const SubjectDescriptor & GetSubjectDescriptor() const { return mSubjectDescriptor; }
+
+    CHIP_ERROR Check(const RequestPath & requestPath, Privilege requestPrivilege)
+    {
+        VerifyOrReturnError(mEnabled, GetAccessControl().Check(mSubjectDescriptor, requestPath, requestPrivilege));
+
+        for (size_t i = 0; i < mCount; i++)
+        {
+            const Decision & decision = mDecisions[i];
+            if (decision.endpoint == requestPath.endpoint && decision.cluster == requestPath.cluster &&
+                decision.privilege == requestPrivilege)
+            {
+                mNumChecksAvoided++;
+                return decision.allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            }
+        }
+
+        CHIP_ERROR err = GetAccessControl().Check(mSubjectDescriptor, requestPath, requestPrivilege);
+        if (err == CHIP_NO_ERROR || err == CHIP_ERROR_ACCESS_DENIED)
+        {
+            // Oldest decision is replaced once full: paths are expanded cluster by cluster.
+            mDecisions[mNext] = { requestPath.cluster, requestPath.endpoint, requestPrivilege, err == CHIP_NO_ERROR };
+            mNext             = (mNext + 1) % MATTER_ARRAY_SIZE(mDecisions);
+            mCount            = std::min(mCount + 1, MATTER_ARRAY_SIZE(mDecisions));
+        }
+        return err;
+    }
+
+    void OnEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index,
+                        const AccessControl::Entry * entry, ChangeType changeType) override
+    {
+        mCount = 0;
+        mNext  = 0;
+    }
+
+private:
+    struct Decision
+    {
+        ClusterId cluster;
+        EndpointId endpoint;
+        Privilege privilege;
+        bool allowed;
+    };
+
+    const SubjectDescriptor mSubjectDescriptor;
+    uint32_t & mNumChecksAvoided;
+    const bool mEnabled;
+
+    // Enough for the view and the required privilege checks of a couple of clusters.
+    Decision mDecisions[4];
+    size_t mCount = 0;
+    size_t mNext  = 0;
+};
+
 /// Returns the status of ACL validation.
 ///   If the return value has a status set, that means the ACL check failed,
 ///   the read must not be performed, and the returned status (which may
@@ -62,8 +144,8 @@ using Protocols::InteractionModel::Status;
 ///
 ///   If the returned value is std::nullopt, that means the ACL check passed and the
 ///   read should proceed.
-std::optional<CHIP_ERROR> ValidateReadAttributeACL(const SubjectDescriptor & subjectDescriptor,
-                                                   const ConcreteReadAttributePath & path, Privilege requiredPrivilege)
+std::optional<CHIP_ERROR> ValidateReadAttributeACL(AttributeReadAccessCache & accessCache, const ConcreteReadAttributePath & path,
+                                                   Privilege requiredPrivilege)
 {
 
     RequestPath requestPath{ .cluster     = path.mClusterId,
@@ -71,7 +153,7 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(const SubjectDescriptor & sub
                              .requestType = RequestType::kAttributeReadRequest,
                              .entityId    = path.mAttributeId };
 
-    CHIP_ERROR err = GetAccessControl().Check(subjectDescriptor, requestPath, requiredPrivilege);
+    CHIP_ERROR err = accessCache.Check(requestPath, requiredPrivilege);
     if (err == CHIP_NO_ERROR)
     {
         return std::nullopt;
@@ -106,10 +188,12 @@ std::optional<Status> ValidateAttributeIsReadable(DataModel::Provider * dataMode
     return std::nullopt;
 }
 
-DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
+DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, AttributeReadAccessCache & accessCache,
                                                   BitFlags<ReadFlags> flags, AttributeReportIBs::Builder & reportBuilder,
                                                   const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
 {
+    const SubjectDescriptor & subjectDescriptor = accessCache.GetSubjectDescriptor();
+
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
                   path.mAttributeId);
     DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
@@ -151,7 +235,7 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     DataModel::AttributeFinder finder(dataModel);
     std::optional<DataModel::AttributeEntry> entry = finder.Find(path);
 
-    if (auto access_status = ValidateReadAttributeACL(subjectDescriptor, path, Privilege::kView); access_status.has_value())
+    if (auto access_status = ValidateReadAttributeACL(accessCache, path, Privilege::kView); access_status.has_value())
     {
         status = *access_status;
     }
@@ -163,7 +247,7 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     // entry->GetReadPrivilege() is guaranteed to have a value, since that condition is checked in the previous condition (inside
     // ValidateAttributeIsReadable()).
     // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
-    else if (auto required_privilege_status = ValidateReadAttributeACL(subjectDescriptor, path, entry->GetReadPrivilege().value());
+    else if (auto required_privilege_status = ValidateReadAttributeACL(accessCache, path, entry->GetReadPrivilege().value());
              required_privilege_status.has_value())
     {
         status = *required_privilege_status;
@@ -306,7 +390,6 @@ CHIP_ERROR Engine::Init(EventManagement * apEventManagement)
 {
     VerifyOrReturnError(apEventManagement != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
     mpEventManagement   = apEventManagement;
 
     return CHIP_NO_ERROR;
@@ -317,8 +400,9 @@ void Engine::Shutdown()
     // Flush out the event buffer synchronously
     ScheduleUrgentEventDeliverySync();
 
-    mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
+    mNumReportsInFlight  = 0;
+    mScanAllReadHandlers = false;
+    mReadyHandlers.Clear();
     mGlobalDirtySet.ReleaseAll();
 }
 
@@ -394,6 +478,8 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         uint32_t attributesRead = 0;
 #endif
 
+        AttributeReadAccessCache accessCache(apReadHandler->GetSubjectDescriptor(), mNumAccessChecksAvoided);
+
         // For each path included in the interested path of the read handler...
         for (RollbackAttributePathExpandIterator iterator(mpImEngine->GetDataModelProvider(),
                                                           apReadHandler->AttributeIterationPosition());
@@ -401,23 +487,10 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration.After(apReadHandler->mPreviousReportsBeginGeneration))
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
-
-                if (!concretePathDirty)
+                // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                // started a report that it completed: those paths already got reported.
+                if (!mGlobalDirtySet.IsDirtyAfter(readPath, apReadHandler->mPreviousReportsBeginGeneration))
                 {
                     // This attribute is not dirty, we just skip this one.
                     continue;
@@ -450,8 +523,8 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             flags.Set(ReadFlags::kFabricFiltered, apReadHandler->IsFabricFiltered());
             flags.Set(ReadFlags::kAllowsLargePayload, apReadHandler->AllowsLargePayload());
             DataModel::ActionReturnStatus status =
-                RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), flags,
-                                    attributeReportIBs, pathForRetrieval, &encodeState);
+                RetrieveClusterData(mpImEngine->GetDataModelProvider(), accessCache, flags, attributeReportIBs, pathForRetrieval,
+                                    &encodeState);
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -849,8 +922,8 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     SuccessOrExitAction(
         err, ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
-    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
-                  mCurReadHandlerIdx, hasMoreChunks ? "more messages" : "no more messages");
+    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %p, RE has %s", mNumReportsInFlight,
+                  apReadHandler, hasMoreChunks ? "more messages" : "no more messages");
 
 exit:
     if (err != CHIP_NO_ERROR || (apReadHandler->IsType(ReadHandler::InteractionType::Read) && !hasMoreChunks) ||
@@ -875,6 +948,21 @@ void Engine::Run(System::Layer * aSystemLayer, void * apAppState)
 }
 
 CHIP_ERROR Engine::ScheduleRun()
+{
+    mScanAllReadHandlers = true;
+    return ScheduleWorkIfNeeded();
+}
+
+CHIP_ERROR Engine::ScheduleRunForHandler(ReadHandler & aReadHandler)
+{
+    if (!aReadHandler.IsInList())
+    {
+        mReadyHandlers.PushBack(&aReadHandler);
+    }
+    return ScheduleWorkIfNeeded();
+}
+
+CHIP_ERROR Engine::ScheduleWorkIfNeeded()
 {
     if (IsRunScheduled())
     {
@@ -903,46 +991,65 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
-    uint32_t numReadHandled = 0;
+    if (mScanAllReadHandlers)
+    {
+        mScanAllReadHandlers = false;
+        mpImEngine->mReadHandlers.ForEachActiveObject([this](ReadHandler * handler) {
+            if (!handler->IsInList())
+            {
+                mReadyHandlers.PushBack(handler);
+            }
+            return Loop::Continue;
+        });
+    }
 
-    // We may be deallocating read handlers as we go.  Track how many we had
-    // initially, so we make sure to go through all of them.
-    size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
-    while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
+    // Only the handlers queued so far are serviced by this run; handlers that get queued while we are sending reports
+    // wait for the next run.
+    IntrusiveList<ReadHandler, IntrusiveMode::AutoUnlink> pendingHandlers(std::move(mReadyHandlers));
+    size_t numReadHandled = 0;
+    bool hasSentReport    = false;
+
+    while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && !pendingHandlers.Empty())
     {
-        ReadHandler * readHandler =
-            mpImEngine->ActiveHandlerAt(mCurReadHandlerIdx % (uint32_t) mpImEngine->mReadHandlers.Allocated());
-        VerifyOrDie(readHandler != nullptr);
+        ReadHandler * readHandler = &(*pendingHandlers.begin());
+        pendingHandlers.Remove(readHandler);
+        numReadHandled++;
 
-        if (readHandler->ShouldReportUnscheduled() || mpImEngine->GetReportScheduler()->IsReportableNow(readHandler))
+        if (!readHandler->ShouldReportUnscheduled() && !mpImEngine->GetReportScheduler()->IsReportableNow(readHandler))
         {
+            // The report scheduler will queue the handler again once it becomes reportable.
+            mNumReadHandlersNotReportable++;
+            continue;
+        }
 
-            mRunningReadHandler = readHandler;
-            CHIP_ERROR err      = BuildAndSendSingleReportData(readHandler);
-            mRunningReadHandler = nullptr;
-            if (err != CHIP_NO_ERROR)
-            {
-                return;
-            }
+        // This may close and free readHandler.
+        CHIP_ERROR err = BuildAndSendSingleReportData(readHandler);
+        if (err != CHIP_NO_ERROR)
+        {
+            break;
         }
+        hasSentReport = true;
+    }
 
-        numReadHandled++;
-        // If readHandler removed itself from our list, we also decremented
-        // mCurReadHandlerIdx to account for that removal, so it's safe to
-        // increment here.
-        mCurReadHandlerIdx++;
+    // Keep the handlers we did not get to ahead of the ones queued during this run.
+    while (!mReadyHandlers.Empty())
+    {
+        ReadHandler * readHandler = &(*mReadyHandlers.begin());
+        mReadyHandlers.Remove(readHandler);
+        pendingHandlers.PushBack(readHandler);
     }
+    mReadyHandlers = std::move(pendingHandlers);
 
-    //
-    // If our tracker has exceeded the bounds of the handler list, reset it back to 0.
-    // This isn't strictly necessary, but does make it easier to debug issues in this code if they
-    // do arise.
-    //
-    if (mCurReadHandlerIdx >= mpImEngine->mReadHandlers.Allocated())
+    const size_t numAllocated = mpImEngine->mReadHandlers.Allocated();
+    if (numAllocated > numReadHandled)
     {
-        mCurReadHandlerIdx = 0;
+        mNumReadHandlersSkipped += static_cast<uint32_t>(numAllocated - numReadHandled);
     }
 
+    // Handlers only become clean by sending a report, so unless the last handler went away there is nothing new to learn
+    // from scanning them when we did not send anything.
+    VerifyOrReturn(mGlobalDirtySet.Allocated() > 0 && (hasSentReport || numAllocated == 0));
+
     bool allReadClean = true;
 
     mpImEngine->mReadHandlers.ForEachActiveObject([&allReadClean](ReadHandler * handler) {
@@ -965,137 +1072,12 @@ void Engine::Run()
 
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->IsAttributePathSupersetOf(aAttributePath))
-        {
-            path->mGeneration = GetDirtySetGeneration();
-            return Loop::Break;
-        }
-        if (aAttributePath.IsAttributePathSupersetOf(*path))
-        {
-            // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
-            // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
-            // want.
-            // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-}
-
-bool Engine::ClearTombPaths()
-{
-    bool pathReleased = false;
-    mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->mGeneration.IsZero())
-        {
-            mGlobalDirtySet.ReleaseObject(path);
-            pathReleased = true;
-        }
-        return Loop::Continue;
-    });
-    return pathReleased;
-}
-
-bool Engine::MergeDirtyPathsUnderSameCluster()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardClusterId() || outerPath->mGeneration.IsZero())
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            // We don't support paths with a wildcard endpoint + a concrete cluster in global dirty set, so we do a simple == check
-            // here.
-            if (innerPath->mEndpointId != outerPath->mEndpointId || innerPath->mClusterId != outerPath->mClusterId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration.After(outerPath->mGeneration))
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration.Clear();
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-
-    return ClearTombPaths();
-}
-
-bool Engine::MergeDirtyPathsUnderSameEndpoint()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardEndpointId() || outerPath->mGeneration.IsZero())
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mEndpointId != outerPath->mEndpointId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration.After(outerPath->mGeneration))
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardClusterId();
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration.Clear();
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-    return ClearTombPaths();
+    return mGlobalDirtySet.MergeOverlappedPath(aAttributePath, GetDirtySetGeneration());
 }
 
 CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
 {
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-
-    if (mGlobalDirtySet.Exhausted() && !MergeDirtyPathsUnderSameCluster() && !MergeDirtyPathsUnderSameEndpoint())
-    {
-        ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
-        mGlobalDirtySet.ReleaseAll();
-        auto object         = mGlobalDirtySet.CreateObject();
-        object->mGeneration = GetDirtySetGeneration();
-    }
-
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-    ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
-
-    auto object = mGlobalDirtySet.CreateObject();
-    if (object == nullptr)
-    {
-        // This should not happen, this path should be merged into the wildcard endpoint at least.
-        ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
-        return CHIP_ERROR_NO_MEMORY;
-    }
-    *object             = aAttributePath;
-    object->mGeneration = GetDirtySetGeneration();
-
-    return CHIP_NO_ERROR;
+    return mGlobalDirtySet.Insert(aAttributePath, GetDirtySetGeneration());
 }
 
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
@@ -1154,8 +1136,8 @@ void Engine::OnReportConfirm()
     if (mNumReportsInFlight == CHIP_IM_MAX_REPORTS_IN_FLIGHT)
     {
         // We could have other things waiting to go now that this report is no
-        // longer in flight.
-        TEMPORARY_RETURN_IGNORED ScheduleRun();
+        // longer in flight.  They are still queued, so there is no need to consider every handler.
+        TEMPORARY_RETURN_IGNORED ScheduleWorkIfNeeded();
     }
     mNumReportsInFlight--;
     ChipLogDetail(DataManagement, "<RE> OnReportConfirm: NumReports = %" PRIu32, mNumReportsInFlight);
@@ -29,10 +29,12 @@
 #include <app/EventReporter.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/reporting/DirtyPathSet.h>
 #include <app/reporting/Generations.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
@@ -92,41 +94,53 @@ public:
     void OnReportConfirm();
 
     /**
-     * Main work-horse function that executes the run-loop asynchronously on the CHIP thread
+     * Main work-horse function that executes the run-loop asynchronously on the CHIP thread.
+     *
+     * The next run considers every ReadHandler.  Prefer ScheduleRunForHandler when the ReadHandler that needs to report is
+     * known.
      */
     CHIP_ERROR ScheduleRun();
 
+    /**
+     * Queues aReadHandler for the next run and schedules that run.  The run only considers the queued ReadHandlers, so
+     * ReadHandlers with nothing to report are not visited.
+     */
+    CHIP_ERROR ScheduleRunForHandler(ReadHandler & aReadHandler);
+
     /**
      * Application marks mutated change path and would be sent out in later report.
      */
     CHIP_ERROR SetDirty(const AttributePathParams & aAttributePathParams);
 
     /*
-     * Resets the tracker that tracks the currently serviced read handler.
-     * apReadHandler can be non-null to indicate that the reset is due to a
-     * specific ReadHandler being deallocated.
+     * Removes a ReadHandler that is being deallocated from the queue of ReadHandlers waiting for a run.
      */
     void ResetReadHandlerTracker(ReadHandler * apReadHandlerBeingDeleted)
     {
-        if (apReadHandlerBeingDeleted == mRunningReadHandler)
-        {
-            // Just decrement, so our increment after we finish running it will
-            // do the right thing.
-            --mCurReadHandlerIdx;
-        }
-        else
-        {
-            // No idea what to do here to make the indexing sane.  Just start at
-            // the beginning.  We need to do better here; see
-            // https://github.com/project-chip/connectedhomeip/issues/13809
-            mCurReadHandlerIdx = 0;
-        }
+        VerifyOrReturn(apReadHandlerBeingDeleted != nullptr);
+        apReadHandlerBeingDeleted->Unlink();
     }
 
     uint32_t GetNumReportsInFlight() const { return mNumReportsInFlight; }
 
     AttributeGeneration GetDirtySetGeneration() const { return mDirtyGeneration; }
 
+    /**
+     * Number of ReadHandlers that runs did not have to visit because they were not queued, summed over all runs.
+     */
+    uint32_t GetNumReadHandlersSkipped() const { return mNumReadHandlersSkipped; }
+
+    /**
+     * Number of queued ReadHandlers that runs visited but found not reportable, summed over all runs.
+     */
+    uint32_t GetNumReadHandlersNotReportable() const { return mNumReadHandlersNotReportable; }
+
+    /**
+     * Number of attribute read access checks that report runs answered from the result of an earlier check on the same
+     * endpoint, cluster and privilege, instead of asking AccessControl again, summed over all runs.
+     */
+    uint32_t GetNumAccessChecksAvoided() const { return mNumAccessChecksAvoided; }
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     size_t GetGlobalDirtySetSize() { return mGlobalDirtySet.Allocated(); }
 #endif
@@ -146,13 +160,7 @@ private:
 
     bool IsRunScheduled() const { return mRunScheduled; }
 
-    struct AttributePathParamsWithGeneration : public AttributePathParams
-    {
-        AttributePathParamsWithGeneration() = default;
-        AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
-
-        AttributeGeneration mGeneration;
-    };
+    CHIP_ERROR ScheduleWorkIfNeeded();
 
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
@@ -212,29 +220,6 @@ private:
      */
     bool MergeOverlappedAttributePath(const AttributePathParams & aAttributePath);
 
-    /**
-     * If we are running out of ObjectPool for the global dirty set, we will try to merge the existing items by clusters.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameCluster();
-
-    /**
-     * If we are running out of ObjectPool for the global dirty set and we cannot find a slot after merging the existing items by
-     * clusters, we will try to merge the existing items by endpoints.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameEndpoint();
-
-    /**
-     * During the iterating of the paths, releasing the object in the inner loop will cause undefined behavior of the ObjectPool, so
-     * we replace the items to be cleared by a tomb first, then clear all the tombs after the iteration.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool ClearTombPaths();
-
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
     inline void BumpDirtySetGeneration() { mDirtyGeneration.Increment(); }
@@ -253,25 +238,30 @@ private:
     uint32_t mNumReportsInFlight = 0;
 
     /**
-     *  Current read handler index
-     *
+     * ReadHandlers waiting for the next run, in the order they asked for it.  A ReadHandler unlinks itself when it is
+     * destroyed.
      */
-    uint32_t mCurReadHandlerIdx = 0;
+    IntrusiveList<ReadHandler, IntrusiveMode::AutoUnlink> mReadyHandlers;
 
     /**
-     * The read handler we're calling BuildAndSendSingleReportData on right now.
+     * Set by ScheduleRun() when the next run has to consider every ReadHandler rather than only mReadyHandlers.
      */
-    ReadHandler * mRunningReadHandler = nullptr;
+    bool mScanAllReadHandlers = false;
+
+    uint32_t mNumReadHandlersSkipped       = 0;
+    uint32_t mNumReadHandlersNotReportable = 0;
+    uint32_t mNumAccessChecksAvoided       = 0;
 
     /**
      *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
+     *  It is indexed by path, so that merging a new dirty path and checking whether a path is dirty do not scan the whole set.
      *
      */
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     // For unit tests, always use inline allocation for code coverage.
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
+    DirtyPathSet<CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
 #else
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
+    DirtyPathSet<CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
 #endif
 
     /**
@@ -53,7 +53,7 @@ static_assert(AreGenerationsInOrder(0x80000000 + 0x12345, 0x12344));
 /// raw integer comparisons which would break at the 2^32-1 boundary.
 ///
 /// Note: usage of uint32_t is intentional to minimize size overhead. For example, in
-/// `struct AttributePathParamsWithGeneration` (defined in Engine.h), using 32-bit generations
+/// `struct AttributePathParamsWithGeneration` (defined in DirtyPathSet.h), using 32-bit generations
 /// keeps the structure size at 16 bytes.
 ///
 /// The size breakdown is as follows:
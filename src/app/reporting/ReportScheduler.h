@@ -147,7 +147,7 @@ public:
         void TimerFired() override
         {
             SetEngineRunScheduled(true);
-            mScheduler->ReportTimerCallback();
+            mScheduler->ReportTimerCallback(mReadHandler);
         }
 
         System::Clock::Timestamp GetMinTimestamp() const { return mMinTimestamp; }
@@ -166,7 +166,8 @@ public:
 
     virtual ~ReportScheduler() = default;
 
-    virtual void ReportTimerCallback() = 0;
+    /// @brief Called when the report timer of aReadHandler expires, to have the engine consider aReadHandler in its next run.
+    virtual void ReportTimerCallback(ReadHandler * aReadHandler) = 0;
 
     /// @brief Check whether a ReadHandler is reportable right now, taking into account its minimum and maximum intervals.
     /// @param aReadHandler read handler to check
@@ -26,11 +26,12 @@ namespace reporting {
 using namespace System::Clock;
 using ReadHandlerNode = ReportScheduler::ReadHandlerNode;
 
-/// @brief Callback called when the report timer expires to schedule an engine run regardless of the state of the ReadHandlers, as
+/// @brief Callback called when the report timer expires to schedule an engine run for the ReadHandler regardless of its state, as
 /// the engine already verifies that read handlers are reportable before sending a report
-void ReportSchedulerImpl::ReportTimerCallback()
+void ReportSchedulerImpl::ReportTimerCallback(ReadHandler * aReadHandler)
 {
-    TEMPORARY_RETURN_IGNORED InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+    VerifyOrReturn(nullptr != aReadHandler);
+    TEMPORARY_RETURN_IGNORED InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRunForHandler(*aReadHandler);
 }
 
 ReportSchedulerImpl::ReportSchedulerImpl(TimerDelegate * aTimerDelegate) : ReportScheduler(aTimerDelegate)
@@ -133,7 +133,7 @@ public:
      */
     virtual bool IsReportScheduled(ReadHandler * aReadHandler);
 
-    void ReportTimerCallback() override;
+    void ReportTimerCallback(ReadHandler * aReadHandler) override;
 
 protected:
     /**
@@ -182,7 +182,8 @@ void SynchronizedReportSchedulerImpl::TimerFired()
     // If there are no handlers registered, no need to do anything.
     VerifyOrReturn(mNodesPool.Allocated());
 
-    mNodesPool.ForEachActiveObject([now, &firedEarly](ReadHandlerNode * node) {
+    Engine & reportingEngine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    mNodesPool.ForEachActiveObject([now, &firedEarly, &reportingEngine](ReadHandlerNode * node) {
         if (node->GetMinTimestamp() <= now && node->CanStartReporting())
         {
             // Since this handler can now report whenever it wants to, mark it as allowed to report if any other handler is
@@ -196,6 +197,7 @@ void SynchronizedReportSchedulerImpl::TimerFired()
             // moment, which becomes false if we find a handler that is reportable
             firedEarly = false;
             node->SetEngineRunScheduled(true);
+            TEMPORARY_RETURN_IGNORED reportingEngine.ScheduleRunForHandler(*node->GetReadHandler());
             ChipLogProgress(DataManagement, "Handler: %p with min: 0x" ChipLogFormatX64 " and max: 0x" ChipLogFormatX64 "", (node),
                             ChipLogValueX64(node->GetMinTimestamp().count()), ChipLogValueX64(node->GetMaxTimestamp().count()));
         }
@@ -213,11 +215,6 @@ void SynchronizedReportSchedulerImpl::TimerFired()
         ReturnOnFailure(CalculateNextReportTimeout(timeout, nullptr, now));
         TEMPORARY_RETURN_IGNORED ScheduleReport(timeout, nullptr, now);
     }
-    else
-    {
-        // If we have a reportable handler, we can schedule an engine run
-        TEMPORARY_RETURN_IGNORED InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
-    }
 }
 
 } // namespace reporting
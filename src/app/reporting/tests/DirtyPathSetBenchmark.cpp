@@ -0,0 +1,144 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the cost of the reporting engine dirty set operations as a
+ *      function of the number of dirty paths:
+ *
+ *        - insert_ns: DirtyPathSet::Insert() of a new path (what SetDirty does).
+ *        - lookup_ns: DirtyPathSet::IsDirtyAfter() of a concrete path (what is
+ *          done for every path a ReadHandler is interested in).
+ *        - linear_lookup_ns: the same query answered by scanning every dirty
+ *          path, as the engine did before the set was indexed.
+ *
+ *      The paths mimic a bridge: many endpoints, a few clusters each, a few
+ *      attributes per cluster, inserted in a scrambled order.
+ */
+
+#include <app/reporting/DirtyPathSet.h>
+#include <benchmarks/BenchmarkHelpers.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+namespace {
+
+constexpr size_t kPathCounts[] = { 100, 1000, 10000 };
+constexpr size_t kMaxPaths     = 10000;
+constexpr size_t kLookups      = 100000;
+
+const ResultWriter gResults("dirty-path-set", "paths");
+
+// Large enough that no benchmark run has to merge paths.
+DirtyPathSet<kMaxPaths, ObjectPoolMem::kInline> gDirtySet;
+
+ConcreteAttributePath PathForIndex(size_t index)
+{
+    // 4 attributes in each of 4 clusters per endpoint.
+    return ConcreteAttributePath(static_cast<EndpointId>(1 + index / 16), static_cast<ClusterId>(0x0100 + (index / 4) % 4),
+                                 static_cast<AttributeId>(index % 4));
+}
+
+double NanosecondsPerOperation(SteadyClock::time_point start, size_t operations)
+{
+    return std::chrono::duration<double, std::nano>(SteadyClock::now() - start).count() / static_cast<double>(operations);
+}
+
+bool LinearIsDirtyAfter(const ConcreteAttributePath & path, AttributeGeneration generation)
+{
+    return gDirtySet.ForEachActiveObject([&](const AttributePathParamsWithGeneration * dirtyPath) {
+        return (dirtyPath->IsAttributePathSupersetOf(path) && dirtyPath->mGeneration.After(generation)) ? Loop::Break
+                                                                                                        : Loop::Continue;
+    }) == Loop::Break;
+}
+
+void RunBenchmark(size_t pathCount)
+{
+    gDirtySet.ReleaseAll();
+
+    AttributeGeneration generation(1);
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < pathCount; i++)
+    {
+        const ConcreteAttributePath path = PathForIndex(ScrambledIndex(i, pathCount));
+        generation.Increment();
+        LogErrorOnFailure(gDirtySet.Insert(AttributePathParams(path.mEndpointId, path.mClusterId, path.mAttributeId), generation));
+    }
+    const double insertNs = NanosecondsPerOperation(start, pathCount);
+    VerifyOrDie(gDirtySet.Allocated() == pathCount);
+
+    // Half of the lookups hit a dirty path, half miss on an endpoint that is not dirty.
+    const AttributeGeneration since(1);
+    size_t hits = 0;
+    start       = SteadyClock::now();
+    for (size_t i = 0; i < kLookups; i++)
+    {
+        const size_t index = ScrambledIndex(i, 2 * pathCount);
+        hits += gDirtySet.IsDirtyAfter(PathForIndex(index), since) ? 1 : 0;
+    }
+    const double lookupNs = NanosecondsPerOperation(start, kLookups);
+    VerifyOrDie(hits == kLookups / 2);
+
+    // The linear scan is much slower, so use fewer lookups to keep the run time reasonable.
+    const size_t linearLookups = kLookups / 100;
+    size_t linearHits          = 0;
+    start                      = SteadyClock::now();
+    for (size_t i = 0; i < linearLookups; i++)
+    {
+        const size_t index = ScrambledIndex(i, 2 * pathCount);
+        linearHits += LinearIsDirtyAfter(PathForIndex(index), since) ? 1 : 0;
+    }
+    const double linearLookupNs = NanosecondsPerOperation(start, linearLookups);
+
+    // Both lookups must agree.
+    for (size_t i = 0; i < linearLookups; i++)
+    {
+        const ConcreteAttributePath path = PathForIndex(ScrambledIndex(i, 2 * pathCount));
+        VerifyOrDie(gDirtySet.IsDirtyAfter(path, since) == LinearIsDirtyAfter(path, since));
+    }
+    VerifyOrDie(linearHits > 0);
+
+    gResults.Print(pathCount, "insert_ns", Better::kLower, insertNs, 1);
+    gResults.Print(pathCount, "lookup_ns", Better::kLower, lookupNs, 1);
+    gResults.Print(pathCount, "linear_lookup_ns", Better::kLower, linearLookupNs, 1);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+    // Inserting a new path logs at detail level, keep that out of the measurements.
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+
+    gResults.PrintHeader();
+    for (size_t pathCount : kPathCounts)
+    {
+        RunBenchmark(pathCount);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -69,6 +69,7 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Register(ServerClusterRegistration &
 
     entry.next     = mRegistrations;
     mRegistrations = &entry;
+    mGeneration++;
 
     return CHIP_NO_ERROR;
 }
@@ -100,6 +101,7 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
             }
 
             current->next = nullptr; // Make sure current does not look like part of a list.
+            mGeneration++;
             if (mContext.has_value())
             {
                 current->serverClusterInterface->Shutdown(clusterShutdownType);
@@ -217,6 +217,9 @@ public:
 
     ServerClusterInstances AllServerClusterInstances();
 
+    /// Changes every time a registration is added or removed.
+    unsigned Generation() const { return mGeneration; }
+
 protected:
     ServerClusterRegistration * mRegistrations = nullptr;
 
@@ -226,6 +229,8 @@ protected:
 
     // Managing context for this registry
     std::optional<ServerClusterContext> mContext;
+
+    unsigned mGeneration = 0;
 };
 
 } // namespace app
@@ -329,6 +329,8 @@ struct CommonCaseDeviceServerInitParams : public ServerInitParams
         {
             mGroupDataProvider.SetStorageDelegate(this->persistentStorageDelegate);
             mGroupDataProvider.SetSessionKeystore(this->sessionKeystore);
+            // Like the OpCertStore above, this provider is never finished, so its storage cache is held until exit.
+            mGroupDataProvider.SetStorageCacheEnabled(CHIP_CONFIG_GROUP_DATA_STORAGE_CACHE);
             ReturnErrorOnFailure(mGroupDataProvider.Init());
             this->groupDataProvider = &mGroupDataProvider;
         }
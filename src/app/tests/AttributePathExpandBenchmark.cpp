@@ -0,0 +1,202 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures wildcard attribute path expansion on a large bridge, the way
+ *      a priming report does it: every report chunk creates a new
+ *      AttributePathExpandIterator that resumes from the saved position.
+ *      For each mode (uncached: the provider reports no metadata generation,
+ *      so lists are fetched again by every iterator; snapshot: iterators
+ *      share the provider's metadata snapshot):
+ *
+ *        - <mode>_paths_per_s: expanded paths per second.
+ *        - <mode>_fetches_per_expansion: Endpoints/ServerClusters/Attributes
+ *          calls made to the provider for one full expansion.
+ */
+
+#include <app/AttributePathExpandIterator.h>
+#include <app/data-model-provider/Provider.h>
+#include <benchmarks/BenchmarkHelpers.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+#include <string>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::app;
+using namespace chip::app::DataModel;
+
+namespace {
+
+constexpr EndpointId kEndpointCounts[] = { 50, 500 };
+constexpr size_t kClustersPerEndpoint  = 6;
+constexpr size_t kAttributesPerCluster = 12;
+constexpr size_t kPathsPerChunk        = 40;
+constexpr size_t kExpansions           = 20;
+constexpr ClusterId kFirstClusterId    = 0x0003;
+constexpr ClusterId kClusterIdStep     = 0x0020;
+
+const ResultWriter gResults("attribute-path-expand", "endpoints");
+
+// Bridge-like provider that builds its metadata lists on every call, as the codegen provider does.
+class BridgeProvider final : public Provider
+{
+public:
+    BridgeProvider(EndpointId endpointCount, bool reportGeneration) :
+        mEndpointCount(endpointCount), mReportGeneration(reportGeneration)
+    {}
+
+    size_t fetches = 0;
+
+    CHIP_ERROR Endpoints(ReadOnlyBufferBuilder<EndpointEntry> & builder) override
+    {
+        fetches++;
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(mEndpointCount));
+        for (EndpointId id = 0; id < mEndpointCount; id++)
+        {
+            ReturnErrorOnFailure(builder.Append({ id, kInvalidEndpointId, EndpointCompositionPattern::kFullFamily }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR DeviceTypes(EndpointId endpointId, ReadOnlyBufferBuilder<DeviceTypeEntry> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ClientClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ClusterId> & builder) override { return CHIP_NO_ERROR; }
+    CHIP_ERROR ServerClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ServerClusterEntry> & builder) override
+    {
+        fetches++;
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(kClustersPerEndpoint));
+        for (size_t i = 0; i < kClustersPerEndpoint; i++)
+        {
+            const ClusterId clusterId = static_cast<ClusterId>(kFirstClusterId + i * kClusterIdStep);
+            ReturnErrorOnFailure(builder.Append({ clusterId, 0, BitFlags<ClusterQualityFlags>() }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR EventInfo(const ConcreteEventPath & path, EventEntry & eventInfo) override { return CHIP_NO_ERROR; }
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<AttributeEntry> & builder) override
+    {
+        fetches++;
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(kAttributesPerCluster));
+        for (size_t i = 0; i < kAttributesPerCluster; i++)
+        {
+            ReturnErrorOnFailure(builder.Append(AttributeEntry(static_cast<AttributeId>(i), BitMask<AttributeQualityFlags>(),
+                                                               Access::Privilege::kView, std::nullopt)));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR GeneratedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<AcceptedCommandEntry> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ActionReturnStatus ReadAttribute(const ReadAttributeRequest & request, AttributeValueEncoder & encoder) override
+    {
+        return Protocols::InteractionModel::Status::UnsupportedRead;
+    }
+    ActionReturnStatus WriteAttribute(const WriteAttributeRequest & request, AttributeValueDecoder & decoder) override
+    {
+        return Protocols::InteractionModel::Status::UnsupportedWrite;
+    }
+    void ListAttributeWriteNotification(const ConcreteAttributePath & aPath, ListWriteOperation opType,
+                                        FabricIndex accessingFabric) override
+    {}
+    std::optional<ActionReturnStatus> InvokeCommand(const InvokeRequest & request, TLV::TLVReader & input_arguments,
+                                                    CommandHandler * handler) override
+    {
+        return Protocols::InteractionModel::Status::UnsupportedCommand;
+    }
+
+protected:
+    std::optional<unsigned> MetadataStructureGeneration() override
+    {
+        return mReportGeneration ? std::make_optional(0u) : std::nullopt;
+    }
+
+private:
+    const EndpointId mEndpointCount;
+    const bool mReportGeneration;
+};
+
+// Expands a wildcard path fully, in chunks of kPathsPerChunk paths. Returns the number of paths.
+size_t ExpandInChunks(Provider & provider)
+{
+    SingleLinkedListNode<AttributePathParams> wildcard;
+    AttributePathExpandIterator::Position position = AttributePathExpandIterator::Position::StartIterating(&wildcard);
+
+    size_t paths = 0;
+    while (true)
+    {
+        AttributePathExpandIterator iterator(&provider, position);
+        ConcreteAttributePath path;
+        size_t chunkPaths = 0;
+        while (chunkPaths < kPathsPerChunk && iterator.Next(path))
+        {
+            chunkPaths++;
+        }
+        paths += chunkPaths;
+        if (chunkPaths < kPathsPerChunk)
+        {
+            return paths;
+        }
+    }
+}
+
+void RunBenchmark(EndpointId endpointCount, bool reportGeneration, const char * modeName)
+{
+    BridgeProvider provider(endpointCount, reportGeneration);
+
+    size_t paths                  = 0;
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kExpansions; i++)
+    {
+        paths += ExpandInChunks(provider);
+    }
+    const double seconds = SecondsSince(start);
+
+    VerifyOrDie(paths == kExpansions * endpointCount * kClustersPerEndpoint * kAttributesPerCluster);
+
+    const std::string mode(modeName);
+    gResults.Print(endpointCount, mode + "_paths_per_s", Better::kHigher, static_cast<double>(paths) / seconds);
+    gResults.Print(endpointCount, mode + "_fetches_per_expansion", Better::kLower,
+                   static_cast<double>(provider.fetches) / static_cast<double>(kExpansions), 1);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    gResults.PrintHeader();
+    for (EndpointId endpointCount : kEndpointCounts)
+    {
+        RunBenchmark(endpointCount, /* reportGeneration = */ false, "uncached");
+        RunBenchmark(endpointCount, /* reportGeneration = */ true, "snapshot");
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compares the ClusterStateCache storage layouts for a controller that
+ *      mirrors wildcard subscriptions to many devices, with one cache per
+ *      device. For each layout (tree, flat):
+ *
+ *        - <layout>_heap_bytes_per_attribute: heap used by the caches, per
+ *          cached attribute (glibc only; 0 elsewhere).
+ *        - <layout>_prime_attributes_per_s: attributes added per second by
+ *          the priming reports of the subscriptions.
+ *        - <layout>_lookups_per_s: Get() of attribute values across all the
+ *          caches, per second.
+ */
+
+#include <app/ClusterStateCache.h>
+#include <benchmarks/BenchmarkHelpers.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::app;
+
+namespace {
+
+constexpr size_t kDeviceCounts[]       = { 1, 50, 200 };
+constexpr size_t kEndpointsPerDevice   = 8;
+constexpr size_t kClustersPerEndpoint  = 10;
+constexpr size_t kAttributesPerCluster = 15;
+constexpr size_t kAttributesPerDevice  = kEndpointsPerDevice * kClustersPerEndpoint * kAttributesPerCluster;
+constexpr size_t kLookups              = 1000000;
+constexpr ClusterId kFirstClusterId    = 0x0003;
+constexpr ClusterId kClusterIdStep     = 0x0020;
+
+const ResultWriter gResults("cluster-state-cache", "devices");
+
+class NullCacheCallback final : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+// Includes the large blocks that malloc maps separately, such as the vectors of big caches.
+size_t HeapBytesInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+ConcreteAttributePath AttributePath(size_t index)
+{
+    const size_t attribute = index % kAttributesPerCluster;
+    const size_t cluster   = (index / kAttributesPerCluster) % kClustersPerEndpoint;
+    const size_t endpoint  = index / (kAttributesPerCluster * kClustersPerEndpoint);
+    return ConcreteAttributePath(static_cast<EndpointId>(endpoint),
+                                 static_cast<ClusterId>(kFirstClusterId + cluster * kClusterIdStep),
+                                 static_cast<AttributeId>(attribute));
+}
+
+// Feeds all the attributes of a device to a cache, as the priming report of a wildcard subscription does.
+void PrimeCache(ClusterStateCache & cache)
+{
+    ReadClient::Callback & callback = cache.GetBufferedCallback();
+
+    callback.OnReportBegin();
+    for (size_t i = 0; i < kAttributesPerDevice; i++)
+    {
+        uint8_t buf[32];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        // Mostly integers, with some short strings.
+        if (i % 3 == 2)
+        {
+            VerifyOrDie(writer.PutString(TLV::AnonymousTag(), "label-01") == CHIP_NO_ERROR);
+        }
+        else
+        {
+            VerifyOrDie(writer.Put(TLV::AnonymousTag(), static_cast<uint32_t>(i)) == CHIP_NO_ERROR);
+        }
+        VerifyOrDie(writer.Finalize() == CHIP_NO_ERROR);
+
+        TLV::TLVReader reader;
+        reader.Init(buf, writer.GetLengthWritten());
+        VerifyOrDie(reader.Next() == CHIP_NO_ERROR);
+
+        ConcreteDataAttributePath path(AttributePath(i));
+        path.mDataVersion.SetValue(1);
+        callback.OnAttributeData(path, &reader, StatusIB());
+    }
+    callback.OnReportEnd();
+}
+
+void RunBenchmark(size_t deviceCount, ClusterStateCache::StorageLayout storageLayout, const char * layoutName)
+{
+    NullCacheCallback callback;
+    std::vector<std::unique_ptr<ClusterStateCache>> caches;
+    caches.reserve(deviceCount);
+
+    const size_t heapBefore       = HeapBytesInUse();
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < deviceCount; i++)
+    {
+        caches.push_back(std::make_unique<ClusterStateCache>(callback, Optional<EventNumber>::Missing(), storageLayout));
+        PrimeCache(*caches.back());
+    }
+    const double primeSeconds = SecondsSince(start);
+    const size_t heapBytes    = HeapBytesInUse() - heapBefore;
+
+    const size_t attributeCount = deviceCount * kAttributesPerDevice;
+    size_t found                = 0;
+    start                       = SteadyClock::now();
+    for (size_t i = 0; i < kLookups; i++)
+    {
+        const size_t index = ScrambledIndex(i, attributeCount);
+        TLV::TLVReader reader;
+        found += (caches[index / kAttributesPerDevice]->Get(AttributePath(index % kAttributesPerDevice), reader) == CHIP_NO_ERROR);
+    }
+    const double lookupSeconds = SecondsSince(start);
+    VerifyOrDie(found == kLookups);
+
+    const std::string layout(layoutName);
+    gResults.Print(deviceCount, layout + "_heap_bytes_per_attribute", Better::kLower,
+                   static_cast<double>(heapBytes) / static_cast<double>(attributeCount), 1);
+    gResults.Print(deviceCount, layout + "_prime_attributes_per_s", Better::kHigher,
+                   static_cast<double>(attributeCount) / primeSeconds);
+    gResults.Print(deviceCount, layout + "_lookups_per_s", Better::kHigher, static_cast<double>(kLookups) / lookupSeconds);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    gResults.PrintHeader();
+    for (size_t deviceCount : kDeviceCounts)
+    {
+        RunBenchmark(deviceCount, ClusterStateCache::StorageLayout::kTree, "tree");
+        RunBenchmark(deviceCount, ClusterStateCache::StorageLayout::kFlat, "flat");
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
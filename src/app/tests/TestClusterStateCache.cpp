@@ -541,11 +541,11 @@ CacheValidator::CacheValidator(AttributeInstructionListType & instructionList,
     }
 }
 
-void RunAndValidateSequence(AttributeInstructionListType list)
+void RunAndValidateSequence(AttributeInstructionListType list, ClusterStateCache::StorageLayout storageLayout)
 {
     ForwardedDataCallbackValidator dataCallbackValidator;
     CacheValidator client(list, dataCallbackValidator);
-    ClusterStateCache cache(client);
+    ClusterStateCache cache(client, Optional<EventNumber>::Missing(), storageLayout);
 
     // In order for the cache to track our data versions, we need to claim to it
     // that we are dealing with a wildcard path.  And we need to do that before
@@ -771,63 +771,124 @@ void RunAndValidateSequence(AttributeInstructionListType list)
  * E1:A1 --- Endpoint 1, Attribute A, Version 1
  *
  */
-TEST_F(TestClusterStateCache, TestCache)
+void RunAndValidateSequences(ClusterStateCache::StorageLayout storageLayout)
 {
+    auto runAndValidateSequence = [storageLayout](AttributeInstructionListType list) {
+        RunAndValidateSequence(std::move(list), storageLayout);
+    };
+
     ChipLogProgress(DataManagement, "Validating various sequences of attribute data IBs...");
 
     //
     // Validate a range of types and ensure that they can be successfully decoded.
     //
     ChipLogProgress(DataManagement, "E1:A1 --> E1:A1");
-    RunAndValidateSequence({ AttributeInstruction(
+    runAndValidateSequence({ AttributeInstruction(
 
         AttributeInstruction::kAttributeA, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E1:B1 --> E1:B1");
-    RunAndValidateSequence({ AttributeInstruction(
+    runAndValidateSequence({ AttributeInstruction(
 
         AttributeInstruction::kAttributeB, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E1:C1 --> E1:C1");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeC, 1, AttributeInstruction::kData) });
+    runAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeC, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E1:D1 --> E1:D1");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
+    runAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     //
     // Validate that a newer version of a data item over-rides the
     // previous copy.
     //
     ChipLogProgress(DataManagement, "E1:D1 E1:D2 --> E1:D2");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
+    runAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     //
     // Validate that a newer StatusIB over-rides a previous data value.
     //
     ChipLogProgress(DataManagement, "E1:D1 E1:D2s --> E1:D2s");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
+    runAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus) });
 
     //
     // Validate that a newer data value over-rides a previous status value.
     //
     ChipLogProgress(DataManagement, "E1:D1s E1:D2 --> E1:D2");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus),
+    runAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus),
                              AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     //
     // Validate data across different endpoints.
     //
     ChipLogProgress(DataManagement, "E0:D1 E1:D2 --> E0:D1 E1:D2");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 0, AttributeInstruction::kData),
+    runAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E0:A1 E0:B2 E0:A3 E0:B4 --> E0:A3 E0:B4");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
+    runAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+TEST_F(TestClusterStateCache, TestCache)
+{
+    RunAndValidateSequences(ClusterStateCache::StorageLayout::kTree);
+}
+
+TEST_F(TestClusterStateCache, TestCacheFlatStorage)
+{
+    RunAndValidateSequences(ClusterStateCache::StorageLayout::kFlat);
+}
+
+class EventCacheCallback final : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+TEST_F(TestClusterStateCache, TestEventCacheFlatStorage)
+{
+    EventCacheCallback callback;
+    ClusterStateCache cache(callback, Optional<EventNumber>::Missing(), ClusterStateCache::StorageLayout::kFlat);
+
+    for (EventNumber eventNumber = 1; eventNumber <= 3; eventNumber++)
+    {
+        uint8_t buf[32];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        EXPECT_SUCCESS(writer.Put(TLV::AnonymousTag(), static_cast<uint32_t>(eventNumber * 10)));
+        EXPECT_SUCCESS(writer.Finalize());
+
+        TLV::TLVReader reader;
+        reader.Init(buf, writer.GetLengthWritten());
+        EXPECT_SUCCESS(reader.Next());
+
+        EventHeader header;
+        header.mPath        = ConcreteEventPath(1, Clusters::UnitTesting::Id, 0);
+        header.mEventNumber = eventNumber;
+        cache.GetBufferedCallback().OnEventData(header, &reader, nullptr);
+    }
+
+    EventNumber expectedEventNumber = 1;
+    EXPECT_SUCCESS(cache.ForEachEventData([&expectedEventNumber](const EventHeader & header) {
+        EXPECT_EQ(header.mEventNumber, expectedEventNumber);
+        expectedEventNumber++;
+        return CHIP_NO_ERROR;
+    }));
+    EXPECT_EQ(expectedEventNumber, 4u);
+
+    TLV::TLVReader reader;
+    uint32_t value = 0;
+    EXPECT_SUCCESS(cache.Get(static_cast<EventNumber>(2), reader));
+    EXPECT_SUCCESS(reader.Get(value));
+    EXPECT_EQ(value, 20u);
+    EXPECT_EQ(cache.Get(static_cast<EventNumber>(4), reader), CHIP_ERROR_KEY_NOT_FOUND);
+
+    cache.ClearEventCache();
+    EXPECT_EQ(cache.Get(static_cast<EventNumber>(2), reader), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
 } // namespace
@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathSet.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+constexpr size_t kCapacity = 4;
+
+class TestDirtyPathSet : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+bool Contains(const DirtyPathSetBase & set, const AttributePathParams & expected)
+{
+    return set.ForEachActiveObject([&](const AttributePathParamsWithGeneration * path) {
+        return (static_cast<const AttributePathParams &>(*path) == expected) ? Loop::Break : Loop::Continue;
+    }) == Loop::Break;
+}
+
+bool IsSorted(const DirtyPathSetBase & set)
+{
+    const AttributePathParamsWithGeneration * previous = nullptr;
+    return set.ForEachActiveObject([&](const AttributePathParamsWithGeneration * path) {
+        if (previous != nullptr &&
+            (previous->mEndpointId > path->mEndpointId ||
+             (previous->mEndpointId == path->mEndpointId &&
+              (previous->mClusterId > path->mClusterId ||
+               (previous->mClusterId == path->mClusterId && previous->mAttributeId >= path->mAttributeId)))))
+        {
+            return Loop::Break;
+        }
+        previous = path;
+        return Loop::Continue;
+    }) == Loop::Finish;
+}
+
+TEST_F(TestDirtyPathSet, TestIsDirtyAfter)
+{
+    DirtyPathSet<kCapacity, ObjectPoolMem::kInline> set;
+    const AttributeGeneration g1(1);
+    const AttributeGeneration g2(2);
+    const AttributeGeneration g3(3);
+
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(1, 2, 3), AttributeGeneration()));
+
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 3), g2), CHIP_NO_ERROR);
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(1, 2, 3), g1));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(1, 2, 3), g2));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(1, 2, 4), g1));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(2, 2, 3), g1));
+
+    // Each kind of wildcard covers the concrete path.
+    EXPECT_EQ(set.Insert(AttributePathParams(EndpointId(5), ClusterId(6)), g3), CHIP_NO_ERROR);
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(5, 6, 7), g2));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(5, 7, 7), g2));
+
+    EXPECT_EQ(set.Insert(AttributePathParams(8), g3), CHIP_NO_ERROR);
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(8, 1, 1), g2));
+
+    EXPECT_EQ(set.Insert(AttributePathParams(ClusterId(9), AttributeId(10)), g3), CHIP_NO_ERROR);
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(1, 9, 10), g2));
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(100, 9, 10), g2));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(100, 9, 11), g2));
+
+    EXPECT_TRUE(IsSorted(set));
+}
+
+TEST_F(TestDirtyPathSet, TestMergeOverlappedPath)
+{
+    DirtyPathSet<kCapacity, ObjectPoolMem::kInline> set;
+    const AttributeGeneration g1(1);
+    const AttributeGeneration g2(2);
+
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 1), g1), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 2), g1), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 1), g1), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 3u);
+
+    // A subset of an existing path only refreshes the generation.
+    EXPECT_TRUE(set.MergeOverlappedPath(AttributePathParams(1, 1, 2, 5), g2));
+    EXPECT_EQ(set.Allocated(), 3u);
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 2), g1));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 1), g1));
+
+    // A superset replaces every path it covers.
+    EXPECT_TRUE(set.MergeOverlappedPath(AttributePathParams(EndpointId(1), ClusterId(1)), g2));
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(1))));
+    EXPECT_TRUE(Contains(set, AttributePathParams(1, 2, 1)));
+
+    // Paths for the same attribute that only differ by list index are kept as one.
+    EXPECT_EQ(set.Insert(AttributePathParams(2, 1, 1, 3), g1), CHIP_NO_ERROR);
+    EXPECT_TRUE(set.MergeOverlappedPath(AttributePathParams(2, 1, 1, 4), g2));
+    EXPECT_TRUE(Contains(set, AttributePathParams(2, 1, 1)));
+
+    EXPECT_FALSE(set.MergeOverlappedPath(AttributePathParams(3, 1, 1), g2));
+    EXPECT_TRUE(set.MergeOverlappedPath(AttributePathParams(), g2));
+    EXPECT_EQ(set.Allocated(), 1u);
+    EXPECT_TRUE(Contains(set, AttributePathParams()));
+}
+
+TEST_F(TestDirtyPathSet, TestMergeWhenFullKeepsLatestGeneration)
+{
+    DirtyPathSet<kCapacity, ObjectPoolMem::kInline> set;
+
+    for (AttributeId i = 1; i <= kCapacity; i++)
+    {
+        EXPECT_EQ(set.Insert(AttributePathParams(1, 1, i), AttributeGeneration(i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(set.Insert(AttributePathParams(2, 1, 1), AttributeGeneration(10)), CHIP_NO_ERROR);
+
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(1))));
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 100), AttributeGeneration(static_cast<uint32_t>(kCapacity - 1))));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 100), AttributeGeneration(static_cast<uint32_t>(kCapacity))));
+    EXPECT_TRUE(IsSorted(set));
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+TEST_F(TestDirtyPathSet, TestHeapSetGrows)
+{
+    DirtyPathSet<kCapacity, ObjectPoolMem::kHeap> set;
+
+    // Insert in reverse order so that every insertion lands at the front of the set.
+    for (EndpointId endpoint = 100; endpoint > 0; endpoint--)
+    {
+        EXPECT_EQ(set.Insert(AttributePathParams(endpoint, 1, 1), AttributeGeneration(endpoint)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(set.Allocated(), 100u);
+    EXPECT_TRUE(IsSorted(set));
+
+    for (EndpointId endpoint = 1; endpoint <= 100; endpoint++)
+    {
+        ConcreteAttributePath path(endpoint, 1, 1);
+        EXPECT_TRUE(set.IsDirtyAfter(path, AttributeGeneration(static_cast<uint32_t>(endpoint - 1))));
+        EXPECT_FALSE(set.IsDirtyAfter(path, AttributeGeneration(endpoint)));
+    }
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace
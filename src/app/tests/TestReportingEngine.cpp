@@ -32,6 +32,7 @@
 #include <app/reporting/tests/MockReportScheduler.h>
 #include <app/tests/AppTestContext.h>
 #include <app/tests/test-interaction-model-api.h>
+#include <app/util/MatterCallbacks.h>
 #include <data-model-providers/codegen/Instance.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/ErrorStr.h>
@@ -94,10 +95,16 @@ public:
     template <typename... Args>
     static bool VerifyDirtySetContent(const Args &... args);
     static bool InsertToDirtySet(const AttributePathParams & aPath);
+    static void GenerateReadRequest(System::PacketBufferHandle & aPayload);
 
     void TestBuildAndSendSingleReportData();
+    void TestBuildAndSendSingleReportDataCachesDenial();
+    void TestBuildAndSendSingleReportDataAfterAclChange();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestReadyHandlerQueue();
+    void TestReadyHandlerQueueWhenReportsInFlight();
+    void TestReadHandlersSkipped();
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -131,6 +138,56 @@ public:
     }
 };
 
+class TestAccessControlDelegate : public AccessControl::Delegate
+{
+public:
+    CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                     Privilege requestPrivilege) override
+    {
+        mNumChecks++;
+        return mAllowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+    }
+
+    // Deleting any entry revokes the access of every subject.
+    CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex) override
+    {
+        mAllowed = false;
+        return CHIP_NO_ERROR;
+    }
+
+    bool mAllowed       = true;
+    uint32_t mNumChecks = 0;
+};
+
+class TestDeviceTypeResolver : public AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+};
+
+/// Counts the attributes read successfully and, if requested, deletes an access control entry
+/// right before the given attribute is read.
+class TestDataModelCallbacks : public DataModelCallbacks
+{
+public:
+    void AttributeOperation(OperationType operation, OperationOrder order, const ConcreteAttributePath & path) override
+    {
+        VerifyOrReturn(operation == OperationType::Read);
+
+        if (order == OperationOrder::Post)
+        {
+            mNumReads++;
+        }
+        else if (path.mAttributeId == mDeleteEntryBeforeAttribute)
+        {
+            EXPECT_SUCCESS(GetAccessControl().DeleteEntry(nullptr, kUndefinedFabricIndex, 0));
+        }
+    }
+
+    AttributeId mDeleteEntryBeforeAttribute = kInvalidAttributeId;
+    uint32_t mNumReads                      = 0;
+};
+
 template <typename... Args>
 bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 {
@@ -169,27 +226,16 @@ bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 
 bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
 {
-    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    VerifyOrReturnError(path != nullptr, false);
-    *path             = aPath;
-    path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
-    return true;
+    auto & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    return engine.mGlobalDirtySet.Insert(aPath, engine.GetDirtySetGeneration()) == CHIP_NO_ERROR;
 }
 
-TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
+void TestReportingEngine::GenerateReadRequest(System::PacketBufferHandle & aPayload)
 {
     System::PacketBufferTLVWriter writer;
-    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
     ReadRequestMessage::Builder readRequestBuilder;
-    DummyDelegate dummy;
-
-    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
-                                                          app::reporting::GetDefaultReportScheduler()),
-              CHIP_NO_ERROR);
-    TestExchangeDelegate delegate;
-    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(&delegate);
 
-    writer.Init(std::move(readRequestbuf));
+    writer.Init(System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize));
     EXPECT_EQ(readRequestBuilder.Init(&writer), CHIP_NO_ERROR);
     AttributePathIBs::Builder & attributePathListBuilder = readRequestBuilder.CreateAttributeRequests();
     EXPECT_EQ(readRequestBuilder.GetError(), CHIP_NO_ERROR);
@@ -215,15 +261,124 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
     EXPECT_EQ(readRequestBuilder.GetError(), CHIP_NO_ERROR);
     EXPECT_SUCCESS(readRequestBuilder.IsFabricFiltered(false).EndOfReadRequestMessage());
     EXPECT_EQ(readRequestBuilder.GetError(), CHIP_NO_ERROR);
-    EXPECT_EQ(writer.Finalize(&readRequestbuf), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(&aPayload), CHIP_NO_ERROR);
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
+{
+    System::PacketBufferHandle readRequestbuf;
+    DummyDelegate dummy;
+
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+    TestExchangeDelegate delegate;
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(&delegate);
+
+    GenerateReadRequest(readRequestbuf);
     app::ReadHandler readHandler(dummy, exchangeCtx, chip::app::ReadHandler::InteractionType::Read,
                                  app::reporting::GetDefaultReportScheduler());
     readHandler.OnInitialRequest(std::move(readRequestbuf));
 
-    EXPECT_EQ(InteractionModelEngine::GetInstance()->GetReportingEngine().BuildAndSendSingleReportData(&readHandler),
+    auto & engine                = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    const uint32_t checksAvoided = engine.GetNumAccessChecksAvoided();
+
+    EXPECT_EQ(engine.BuildAndSendSingleReportData(&readHandler), CHIP_NO_ERROR);
+
+    // Both attributes are in the same cluster, so the checks for the second one are answered by the ones of the
+    // first one (unless access restrictions, which depend on the attribute, are in use).
+    if (!GetAccessControl().IsAccessRestrictionListSupported())
+    {
+        EXPECT_GT(engine.GetNumAccessChecksAvoided(), checksAvoided);
+    }
+
+    DrainAndServiceIO();
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportDataCachesDenial)
+{
+    System::PacketBufferHandle readRequestbuf;
+    DummyDelegate dummy;
+    TestAccessControlDelegate accessControlDelegate;
+    TestDeviceTypeResolver deviceTypeResolver;
+    TestDataModelCallbacks callbacks;
+
+    GetAccessControl().Finish();
+    EXPECT_SUCCESS(GetAccessControl().Init(&accessControlDelegate, deviceTypeResolver));
+    accessControlDelegate.mAllowed    = false;
+    DataModelCallbacks * oldCallbacks = DataModelCallbacks::SetInstance(&callbacks);
+
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+    TestExchangeDelegate delegate;
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(&delegate);
+
+    GenerateReadRequest(readRequestbuf);
+    app::ReadHandler readHandler(dummy, exchangeCtx, chip::app::ReadHandler::InteractionType::Read,
+                                 app::reporting::GetDefaultReportScheduler());
+    readHandler.OnInitialRequest(std::move(readRequestbuf));
+
+    auto & engine                    = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    const uint32_t checksAvoided     = engine.GetNumAccessChecksAvoided();
+    accessControlDelegate.mNumChecks = 0;
+
+    EXPECT_EQ(engine.BuildAndSendSingleReportData(&readHandler), CHIP_NO_ERROR);
+
+    // Neither attribute may be read, and the denial for the first one also answers for the second one.
+    EXPECT_EQ(callbacks.mNumReads, 0u);
+    if (!GetAccessControl().IsAccessRestrictionListSupported())
+    {
+        EXPECT_EQ(accessControlDelegate.mNumChecks, 1u);
+        EXPECT_EQ(engine.GetNumAccessChecksAvoided(), checksAvoided + 1);
+    }
+
+    DrainAndServiceIO();
+    DataModelCallbacks::SetInstance(oldCallbacks);
+    // The delegate does not outlive the test.
+    GetAccessControl().Finish();
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportDataAfterAclChange)
+{
+    System::PacketBufferHandle readRequestbuf;
+    DummyDelegate dummy;
+    TestAccessControlDelegate accessControlDelegate;
+    TestDeviceTypeResolver deviceTypeResolver;
+    TestDataModelCallbacks callbacks;
+
+    GetAccessControl().Finish();
+    EXPECT_SUCCESS(GetAccessControl().Init(&accessControlDelegate, deviceTypeResolver));
+    DataModelCallbacks * oldCallbacks = DataModelCallbacks::SetInstance(&callbacks);
+
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
+    TestExchangeDelegate delegate;
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(&delegate);
+
+    GenerateReadRequest(readRequestbuf);
+    app::ReadHandler readHandler(dummy, exchangeCtx, chip::app::ReadHandler::InteractionType::Read,
+                                 app::reporting::GetDefaultReportScheduler());
+    readHandler.OnInitialRequest(std::move(readRequestbuf));
+
+    auto & engine                    = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    accessControlDelegate.mNumChecks = 0;
+
+    // Access is revoked once the first attribute is read: the decision remembered for it must not be
+    // reused for the second attribute of the same cluster.
+    callbacks.mDeleteEntryBeforeAttribute = kTestFieldId2;
+    EXPECT_EQ(engine.BuildAndSendSingleReportData(&readHandler), CHIP_NO_ERROR);
 
+    EXPECT_FALSE(accessControlDelegate.mAllowed);
+    EXPECT_EQ(callbacks.mNumReads, 1u);
+    EXPECT_GE(accessControlDelegate.mNumChecks, 2u);
+
+    callbacks.mDeleteEntryBeforeAttribute = kInvalidAttributeId;
     DrainAndServiceIO();
+    DataModelCallbacks::SetInstance(oldCallbacks);
+    // The delegate does not outlive the test.
+    GetAccessControl().Finish();
 }
 
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
@@ -232,10 +387,8 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
+    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    EXPECT_TRUE(InsertToDirtySet(AttributePathParams(1, 1, 1)));
 
     {
         AttributePathParams testClusterInfo;
@@ -259,6 +412,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = 1;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(EndpointId(1), ClusterId(1))));
     }
 
     {
@@ -266,7 +420,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = kInvalidClusterId;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mClusterId == kInvalidClusterId && clusterInfo->mAttributeId == kInvalidAttributeId);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
     }
 
     {
@@ -275,8 +429,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = kInvalidClusterId;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mEndpointId == kInvalidEndpointId && clusterInfo->mClusterId == kInvalidClusterId &&
-                    clusterInfo->mAttributeId == kInvalidAttributeId);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
     }
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
@@ -359,6 +512,138 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestReadyHandlerQueue)
+{
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    DummyDelegate dummy;
+    TestExchangeDelegate delegate;
+    const uint32_t notReportable = engine.GetNumReadHandlersNotReportable();
+
+    {
+        app::ReadHandler readHandler1(dummy, NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read,
+                                      app::reporting::GetDefaultReportScheduler());
+        app::ReadHandler readHandler2(dummy, NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read,
+                                      app::reporting::GetDefaultReportScheduler());
+
+        // A handler is queued once however many times it asks for a run.
+        EXPECT_EQ(engine.ScheduleRunForHandler(readHandler1), CHIP_NO_ERROR);
+        EXPECT_EQ(engine.ScheduleRunForHandler(readHandler2), CHIP_NO_ERROR);
+        EXPECT_EQ(engine.ScheduleRunForHandler(readHandler1), CHIP_NO_ERROR);
+        EXPECT_TRUE(engine.IsRunScheduled());
+        EXPECT_TRUE(engine.mReadyHandlers.Contains(&readHandler1));
+        EXPECT_TRUE(engine.mReadyHandlers.Contains(&readHandler2));
+
+        // A handler being deallocated leaves the queue.
+        engine.ResetReadHandlerTracker(&readHandler2);
+        EXPECT_FALSE(engine.mReadyHandlers.Contains(&readHandler2));
+
+        // The handler has not received its request yet, so it is not reportable and the run drops it from the queue.
+        DrainAndServiceIO();
+        EXPECT_FALSE(engine.IsRunScheduled());
+        EXPECT_TRUE(engine.mReadyHandlers.Empty());
+        EXPECT_EQ(engine.GetNumReadHandlersNotReportable(), notReportable + 1);
+
+        EXPECT_EQ(engine.ScheduleRunForHandler(readHandler1), CHIP_NO_ERROR);
+    }
+
+    // A handler destroyed while queued unlinks itself.
+    EXPECT_TRUE(engine.mReadyHandlers.Empty());
+    DrainAndServiceIO();
+
+    engine.Shutdown();
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestReadyHandlerQueueWhenReportsInFlight)
+{
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    DummyDelegate dummy;
+    TestExchangeDelegate delegate;
+    const uint32_t notReportable = engine.GetNumReadHandlersNotReportable();
+
+    {
+        app::ReadHandler readHandler1(dummy, NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read,
+                                      app::reporting::GetDefaultReportScheduler());
+        app::ReadHandler readHandler2(dummy, NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read,
+                                      app::reporting::GetDefaultReportScheduler());
+        app::ReadHandler readHandler3(dummy, NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read,
+                                      app::reporting::GetDefaultReportScheduler());
+
+        // No handler can be serviced while the in-flight limit is reached: the run leaves them all queued, in order.
+        engine.mNumReportsInFlight = CHIP_IM_MAX_REPORTS_IN_FLIGHT;
+        EXPECT_EQ(engine.ScheduleRunForHandler(readHandler1), CHIP_NO_ERROR);
+        EXPECT_EQ(engine.ScheduleRunForHandler(readHandler2), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+        EXPECT_FALSE(engine.IsRunScheduled());
+        EXPECT_EQ(&(*engine.mReadyHandlers.begin()), &readHandler1);
+        EXPECT_TRUE(engine.mReadyHandlers.Contains(&readHandler2));
+        EXPECT_EQ(engine.GetNumReadHandlersNotReportable(), notReportable);
+
+        // A handler queued later waits behind the ones that were held back.
+        EXPECT_EQ(engine.ScheduleRunForHandler(readHandler3), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+        auto it = engine.mReadyHandlers.begin();
+        EXPECT_EQ(&(*it), &readHandler1);
+        EXPECT_EQ(&(*(++it)), &readHandler2);
+        EXPECT_EQ(&(*(++it)), &readHandler3);
+
+        // A confirmed report resumes the queued handlers without considering every handler.
+        engine.OnReportConfirm();
+        EXPECT_TRUE(engine.IsRunScheduled());
+        EXPECT_FALSE(engine.mScanAllReadHandlers);
+        DrainAndServiceIO();
+        EXPECT_TRUE(engine.mReadyHandlers.Empty());
+        EXPECT_EQ(engine.GetNumReadHandlersNotReportable(), notReportable + 3);
+    }
+
+    engine.Shutdown();
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestReadHandlersSkipped)
+{
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+
+    Engine & engine     = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    auto & readHandlers = InteractionModelEngine::GetInstance()->GetReadHandlerPool();
+    DummyDelegate dummy;
+    TestExchangeDelegate delegate;
+
+    ReadHandler * handlers[3];
+    for (ReadHandler *& handler : handlers)
+    {
+        handler = readHandlers.CreateObject(dummy, NewExchangeToAlice(&delegate), chip::app::ReadHandler::InteractionType::Read,
+                                            app::reporting::GetDefaultReportScheduler());
+        ASSERT_NE(handler, nullptr);
+    }
+    DrainAndServiceIO();
+    const uint32_t skipped = engine.GetNumReadHandlersSkipped();
+
+    // A run for one handler does not visit the two others.
+    EXPECT_EQ(engine.ScheduleRunForHandler(*handlers[1]), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(engine.GetNumReadHandlersSkipped(), skipped + 2);
+
+    // A run that considers every handler skips none.
+    EXPECT_EQ(engine.ScheduleRun(), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(engine.GetNumReadHandlersSkipped(), skipped + 2);
+
+    for (ReadHandler * handler : handlers)
+    {
+        readHandlers.ReleaseObject(handler);
+    }
+    engine.Shutdown();
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
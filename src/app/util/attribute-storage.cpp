@@ -27,6 +27,7 @@
 #include <app/util/attribute-storage-detail.h>
 #include <app/util/config.h>
 #include <app/util/ember-io-storage.h>
+#include <app/util/ember-lookup-index.h>
 #include <app/util/ember-strings.h>
 #include <app/util/endpoint-config-api.h>
 #include <app/util/generic-callbacks.h>
@@ -71,10 +72,6 @@ uint8_t attributeData[ACTUAL_ATTRIBUTE_SIZE];
 // Loads the attributes from built-in default and storage.
 static void emAfLoadAttributeDefaults(EndpointId endpoint, Optional<ClusterId> = NullOptional);
 
-static bool emAfMatchCluster(const EmberAfCluster * cluster, const EmberAfAttributeSearchRecord * attRecord);
-static bool emAfMatchAttribute(const EmberAfCluster * cluster, const EmberAfAttributeMetadata * am,
-                               const EmberAfAttributeSearchRecord * attRecord);
-
 // If server == true, returns the number of server clusters,
 // otherwise number of client clusters on the endpoint at the given index.
 static uint8_t emberAfClusterCountByIndex(uint16_t endpointIndex, bool server);
@@ -94,6 +91,21 @@ uint16_t emberEndpointCount = 0;
 /// ember metadata (e.g. changing dynamic endpoints or enabling/disabling endpoints)
 unsigned emberMetadataStructureGeneration = 0;
 
+// Endpoint id to emAfEndpoints index lookups. Rebuilt whenever endpoints are defined or cleared.
+Compatibility::Internal::EndpointLookupIndex<MAX_ENDPOINT_COUNT> endpointLookupIndex;
+static_assert(decltype(endpointLookupIndex)::kInvalidIndex == kEmberInvalidEndpointIndex,
+              "Endpoint lookup index must use the same invalid index");
+
+#if CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE > 0
+// Locations of recently accessed attributes. Cleared whenever endpoints are defined or cleared.
+Compatibility::Internal::AttributeLookupCache<CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE> attributeLookupCache;
+#endif
+
+#if CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE > 0
+// Cluster and attribute lookups in the endpoint types of defined endpoints. Rebuilt whenever endpoints are defined or cleared.
+Compatibility::Internal::MetadataLookupIndex<CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE> metadataLookupIndex;
+#endif
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -154,16 +166,74 @@ uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
+    return endpointLookupIndex.Find(emAfEndpoints, emberAfEndpointCount(), endpoint, ignoreDisabledEndpoints);
+}
+
+// Must be called whenever an endpoint is defined or cleared in emAfEndpoints.
+void OnEndpointDefinitionsChanged()
+{
+    endpointLookupIndex.Rebuild(emAfEndpoints, MAX_ENDPOINT_COUNT);
+#if CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE > 0
+    metadataLookupIndex.Rebuild(emAfEndpoints, MAX_ENDPOINT_COUNT);
+#endif
+#if CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE > 0
+    attributeLookupCache.Clear();
+#endif
+}
+
+// Finds an attribute of an enabled endpoint.
+Status LocateAttribute(const EmberAfAttributeSearchRecord * attRecord, Compatibility::Internal::AttributeLocation & location)
+{
+#if CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE > 0
+    // Cached locations stay valid as long as the endpoint is enabled at the same index.
+    if (attributeLookupCache.Find(attRecord->endpoint, attRecord->clusterId, attRecord->attributeId, location) &&
+        location.endpointIndex < emberAfEndpointCount() && emAfEndpoints[location.endpointIndex].endpoint == attRecord->endpoint &&
+        emberAfEndpointIndexIsEnabled(location.endpointIndex))
+    {
+        return Status::Success;
+    }
+#endif
+
+    uint16_t ep = findIndexFromEndpoint(attRecord->endpoint, true /* ignoreDisabledEndpoints */);
+    if (ep == kEmberInvalidEndpointIndex)
     {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
+
+    // Fixed endpoints store their attributes one after the other in attributeData.
+    // Dynamic endpoints are external and don't factor into storage size.
+    uint16_t attributeOffsetIndex = 0;
+    if (ep < emberAfFixedEndpointCount())
+    {
+        for (uint16_t i = 0; i < ep; i++)
         {
-            return epi;
+            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[i].endpointType->endpointSize);
         }
     }
-    return kEmberInvalidEndpointIndex;
+
+    const EmberAfAttributeMetadata * am = nullptr;
+
+    Status status;
+#if CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE > 0
+    if (!metadataLookupIndex.FindServerAttribute(emAfEndpoints[ep].endpointType, attRecord->clusterId, attRecord->attributeId,
+                                                 status, &am, attributeOffsetIndex))
+#endif
+    {
+        status = Compatibility::Internal::FindServerAttribute(emAfEndpoints[ep].endpointType, attRecord->clusterId,
+                                                              attRecord->attributeId, &am, attributeOffsetIndex);
+    }
+    if (status != Status::Success)
+    {
+        return status;
+    }
+
+    location.metadata      = am;
+    location.endpointIndex = ep;
+    location.storageOffset = attributeOffsetIndex;
+#if CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE > 0
+    attributeLookupCache.Insert(attRecord->endpoint, attRecord->clusterId, attRecord->attributeId, location);
+#endif
+    return Status::Success;
 }
 
 // Returns the index of a given endpoint.  Considers disabled endpoints.
@@ -270,6 +340,8 @@ void emberAfEndpointConfigure()
         }
     }
 #endif
+
+    OnEndpointDefinitionsChanged();
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
@@ -361,6 +433,7 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, EndpointId id
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
     emAfEndpoints[index].dataVersions   = dataVersionStorage.data();
+    OnEndpointDefinitionsChanged();
 #if CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
     MutableCharSpan targetSpan(emAfEndpoints[index].endpointUniqueId);
     if (CopyCharSpanToMutableCharSpan(endpointUniqueId, targetSpan) != CHIP_NO_ERROR)
@@ -410,6 +483,7 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index, MatterClusterShutdownType
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false, shutdownType);
         emAfEndpoints[index].endpoint = kInvalidEndpointId;
+        OnEndpointDefinitionsChanged();
     }
 
     emberMetadataStructureGeneration++;
@@ -616,34 +690,6 @@ static Status typeSensitiveMemCopy(ClusterId clusterId, uint8_t * dest, uint8_t
     return Status::Success;
 }
 
-/**
- * @brief Matches a cluster based on cluster id and direction.
- *
- *   This function assumes that the passed cluster's endpoint already
- *   matches the endpoint of the EmberAfAttributeSearchRecord.
- *
- * Clusters match if:
- *   1. Cluster ids match AND
- *   2. Cluster is a server cluster (because there are no client attributes).
- */
-bool emAfMatchCluster(const EmberAfCluster * cluster, const EmberAfAttributeSearchRecord * attRecord)
-{
-    return (cluster->clusterId == attRecord->clusterId && (cluster->mask & MATTER_CLUSTER_FLAG_SERVER));
-}
-
-/**
- * @brief Matches an attribute based on attribute id.
- *   This function assumes that the passed cluster already matches the
- *   clusterId and direction of the passed EmberAfAttributeSearchRecord.
- *
- * Attributes match if attr ids match.
- */
-bool emAfMatchAttribute(const EmberAfCluster * cluster, const EmberAfAttributeMetadata * am,
-                        const EmberAfAttributeSearchRecord * attRecord)
-{
-    return (am->attributeId == attRecord->attributeId);
-}
-
 // When reading non-string attributes, this function returns an error when destination
 // buffer isn't large enough to accommodate the attribute type.  For strings, the
 // function will copy at most readLength bytes.  This means the resulting string
@@ -662,121 +708,75 @@ Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord,
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
-
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    Compatibility::Internal::AttributeLocation location;
+    Status status = LocateAttribute(attRecord, location);
+    if (status != Status::Success)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
-
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
-            {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
-                    {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
-                            {
-                                *metadata = am;
-                            }
-
-                            uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
-                            uint8_t *src, *dst;
-                            if (write)
-                            {
-                                src = buffer;
-                                dst = attributeLocation;
-                                if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                         am->attributeId))
-                                {
-                                    return Status::UnsupportedAccess;
-                                }
-                            }
-                            else
-                            {
-                                if (buffer == nullptr)
-                                {
-                                    return Status::Success;
-                                }
-
-                                src = attributeLocation;
-                                dst = buffer;
-                                if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
-                                {
-                                    return Status::UnsupportedAccess;
-                                }
-                            }
+        return status;
+    }
 
-                            // Is the attribute externally stored?
-                            if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
-                            {
-                                if (write)
-                                {
-                                    return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                 buffer);
-                                }
-
-                                if (readLength < emberAfAttributeSize(am))
-                                {
-                                    // Prevent a potential buffer overflow
-                                    return Status::ResourceExhausted;
-                                }
-
-                                return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
-                                                                            emberAfAttributeSize(am));
-                            }
+    const EmberAfAttributeMetadata * am = location.metadata;
 
-                            // Internal storage is only supported for fixed endpoints
-                            if (!isDynamicEndpoint)
-                            {
-                                return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                            }
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (location.endpointIndex >= emberAfFixedEndpointCount());
 
-                            return Status::Failure;
-                        }
-
-                        // Not the attribute we are looking for
-                        // Increase the index if attribute is not externally stored
-                        if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
-                        {
-                            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                        }
-                    }
+    // If passed metadata location is not null, populate
+    if (metadata != nullptr)
+    {
+        *metadata = am;
+    }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
-                }
+    uint8_t * attributeLocation = attributeData + location.storageOffset;
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+        {
+            return Status::UnsupportedAccess;
+        }
+    }
+    else
+    {
+        if (buffer == nullptr)
+        {
+            return Status::Success;
+        }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
-            }
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+        {
+            return Status::UnsupportedAccess;
+        }
+    }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
+    // Is the attribute externally stored?
+    if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
+    {
+        if (write)
+        {
+            return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer);
         }
 
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
+        if (readLength < emberAfAttributeSize(am))
         {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
+            // Prevent a potential buffer overflow
+            return Status::ResourceExhausted;
         }
+
+        return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                    emberAfAttributeSize(am));
+    }
+
+    // Internal storage is only supported for fixed endpoints
+    if (!isDynamicEndpoint)
+    {
+        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
     }
-    return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+
+    return Status::Failure;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
@@ -792,6 +792,14 @@ const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
 const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endpointType, ClusterId clusterId,
                                                 EmberAfClusterMask mask, uint8_t * index)
 {
+#if CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE > 0
+    const EmberAfCluster * indexedCluster = nullptr;
+    if (metadataLookupIndex.FindCluster(endpointType, clusterId, mask, &indexedCluster, index))
+    {
+        return indexedCluster;
+    }
+#endif
+
     uint8_t i;
     uint8_t scopedIndex = 0;
 
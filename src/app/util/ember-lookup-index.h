@@ -0,0 +1,439 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <app/util/af-types.h>
+#include <app/util/attribute-metadata.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/CodeUtils.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+namespace chip {
+namespace app {
+namespace Compatibility {
+namespace Internal {
+
+/// Maps endpoint ids to their index in an array of endpoint definitions (i.e. `emAfEndpoints`) with a hash
+/// table, instead of a scan of the whole array.
+///
+/// The index has to be rebuilt whenever an endpoint is defined or cleared. Enabling or disabling endpoints
+/// does not require a rebuild, as lookups check whether the endpoint they find is enabled.
+template <size_t kCapacity>
+class EndpointLookupIndex
+{
+public:
+    /// Same value as kEmberInvalidEndpointIndex.
+    static constexpr uint16_t kInvalidIndex = 0xFFFF;
+
+    static_assert(kCapacity < kInvalidIndex, "Endpoint indexes must fit in a uint16_t");
+
+    void Rebuild(const EmberAfDefinedEndpoint * endpoints, uint16_t endpointCount)
+    {
+        std::fill(mSlots, mSlots + kSlotCount, kEmptySlot);
+
+        // Endpoints are added in array order, so that endpoints with the same id are found in array order.
+        for (uint16_t i = 0; i < endpointCount && i < kCapacity; i++)
+        {
+            if (endpoints[i].endpoint == kInvalidEndpointId)
+            {
+                continue;
+            }
+
+            size_t slot = Slot(endpoints[i].endpoint);
+            while (mSlots[slot] != kEmptySlot)
+            {
+                slot = (slot + 1) & (kSlotCount - 1);
+            }
+            mSlots[slot] = static_cast<uint16_t>(i + 1);
+        }
+    }
+
+    /// Returns the index of the first endpoint with the given id among the first `endpointCount` ones of
+    /// `endpoints`, or kInvalidIndex if there is none. Skips disabled endpoints if `ignoreDisabledEndpoints`.
+    uint16_t Find(const EmberAfDefinedEndpoint * endpoints, uint16_t endpointCount, EndpointId endpoint,
+                  bool ignoreDisabledEndpoints) const
+    {
+        for (size_t slot = Slot(endpoint); mSlots[slot] != kEmptySlot; slot = (slot + 1) & (kSlotCount - 1))
+        {
+            const uint16_t index = static_cast<uint16_t>(mSlots[slot] - 1);
+            if (endpoints[index].endpoint != endpoint)
+            {
+                continue;
+            }
+            if (index >= endpointCount)
+            {
+                // Any other endpoint with this id comes later in the array.
+                break;
+            }
+            if (!ignoreDisabledEndpoints || endpoints[index].bitmask.Has(EmberAfEndpointOptions::isEnabled))
+            {
+                return index;
+            }
+        }
+        return kInvalidIndex;
+    }
+
+private:
+    static constexpr size_t SlotBits(size_t minSlots)
+    {
+        size_t bits = 1;
+        while ((static_cast<size_t>(1) << bits) < minSlots)
+        {
+            bits++;
+        }
+        return bits;
+    }
+
+    // The table is at most half full, which keeps probe sequences short and guarantees empty slots.
+    static constexpr size_t kSlotBits  = SlotBits(2 * kCapacity);
+    static constexpr size_t kSlotCount = static_cast<size_t>(1) << kSlotBits;
+
+    static size_t Slot(EndpointId endpoint) { return (static_cast<uint32_t>(endpoint) * 0x9E3779B1u) >> (32 - kSlotBits); }
+
+    // Slots hold endpoint indexes plus one, so that a zero-initialized index is empty.
+    static constexpr uint16_t kEmptySlot = 0;
+
+    uint16_t mSlots[kSlotCount] = {};
+};
+
+/// Where an attribute was found in the endpoint definitions.
+struct AttributeLocation
+{
+    const EmberAfAttributeMetadata * metadata = nullptr;
+    /// Index of the endpoint in the endpoint definitions.
+    uint16_t endpointIndex = 0;
+    /// Offset of the attribute value in the attribute storage, only meaningful for attributes that ember stores itself.
+    uint16_t storageOffset = 0;
+};
+
+/// Remembers the location of recently accessed attributes, so that repeated accesses to the same attributes
+/// skip the search through the clusters and attributes of their endpoint.
+///
+/// The cache is direct-mapped: each attribute path has a single slot, which the last path stored there owns.
+/// Users must clear the cache whenever the endpoint definitions change.
+template <size_t kSize>
+class AttributeLookupCache
+{
+public:
+    static_assert(kSize > 0 && (kSize & (kSize - 1)) == 0, "The cache size must be a power of two");
+
+    bool Find(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId, AttributeLocation & location) const
+    {
+        const Entry & entry = mEntries[Slot(endpoint, clusterId, attributeId)];
+        if (entry.location.metadata == nullptr || entry.endpoint != endpoint || entry.clusterId != clusterId ||
+            entry.attributeId != attributeId)
+        {
+            return false;
+        }
+        location = entry.location;
+        return true;
+    }
+
+    void Insert(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId, const AttributeLocation & location)
+    {
+        Entry & entry     = mEntries[Slot(endpoint, clusterId, attributeId)];
+        entry.endpoint    = endpoint;
+        entry.clusterId   = clusterId;
+        entry.attributeId = attributeId;
+        entry.location    = location;
+    }
+
+    void Clear()
+    {
+        for (Entry & entry : mEntries)
+        {
+            entry.location.metadata = nullptr;
+        }
+    }
+
+private:
+    struct Entry
+    {
+        ClusterId clusterId     = 0;
+        AttributeId attributeId = 0;
+        EndpointId endpoint     = kInvalidEndpointId;
+        AttributeLocation location;
+    };
+
+    static size_t Slot(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+    {
+        // Multiplicative hashing; clusters of an endpoint usually share their attribute ids, so mix all three.
+        uint32_t hash = (clusterId * 0x9E3779B1u) ^ (attributeId * 0x85EBCA77u) ^ (endpoint * 0xC2B2AE3Du);
+        return (hash ^ (hash >> 16)) & (kSize - 1);
+    }
+
+    Entry mEntries[kSize];
+};
+
+/// Maps the clusters of endpoint types and the attributes of their server clusters to their position with a
+/// hash table, so that cluster and attribute lookups do not scan the endpoint type.
+///
+/// An endpoint type is either fully indexed or not at all: if the index runs out of its kCapacity entries, the
+/// endpoint types that do not fit are not indexed and lookups in them are not answered, so that callers fall
+/// back to a scan. Entries are keyed by the address of the metadata, so the index has to be rebuilt whenever an
+/// endpoint is defined or cleared.
+template <size_t kCapacity>
+class MetadataLookupIndex
+{
+public:
+    void Rebuild(const EmberAfDefinedEndpoint * endpoints, uint16_t endpointCount)
+    {
+        std::fill(mSlots, mSlots + kSlotCount, Entry());
+        mCount = 0;
+
+        for (uint16_t i = 0; i < endpointCount; i++)
+        {
+            const EmberAfEndpointType * endpointType = endpoints[i].endpointType;
+            // Endpoints of a bridge commonly share their endpoint type.
+            if (endpoints[i].endpoint != kInvalidEndpointId && endpointType != nullptr &&
+                Find(Kind::kEndpointType, endpointType, 0) == nullptr)
+            {
+                AddEndpointType(endpointType);
+            }
+        }
+    }
+
+    /// Looks up a cluster as emberAfFindClusterInType() does, for a mask of MATTER_CLUSTER_FLAG_SERVER or
+    /// MATTER_CLUSTER_FLAG_CLIENT. Returns false if the index cannot answer, and otherwise sets `cluster` (to null if
+    /// the endpoint type has no such cluster) and, if the cluster was found and `index` is not null, `*index`.
+    bool FindCluster(const EmberAfEndpointType * endpointType, ClusterId clusterId, EmberAfClusterMask mask,
+                     const EmberAfCluster ** cluster, uint8_t * index) const
+    {
+        Kind kind;
+        if (mask == MATTER_CLUSTER_FLAG_SERVER)
+        {
+            kind = Kind::kServerCluster;
+        }
+        else if (mask == MATTER_CLUSTER_FLAG_CLIENT)
+        {
+            kind = Kind::kClientCluster;
+        }
+        else
+        {
+            return false;
+        }
+        VerifyOrReturnValue(Find(Kind::kEndpointType, endpointType, 0) != nullptr, false);
+
+        const Entry * entry = Find(kind, endpointType, clusterId);
+        *cluster            = (entry != nullptr) ? &endpointType->cluster[entry->clusterIndex] : nullptr;
+        if (entry != nullptr && index != nullptr)
+        {
+            *index = static_cast<uint8_t>(entry->index);
+        }
+        return true;
+    }
+
+    /// Same as FindServerAttribute(), but returns false instead of scanning when the index cannot answer.
+    bool FindServerAttribute(const EmberAfEndpointType * endpointType, ClusterId clusterId, AttributeId attributeId,
+                             Protocols::InteractionModel::Status & status, const EmberAfAttributeMetadata ** metadata,
+                             uint16_t & storageOffset) const
+    {
+        VerifyOrReturnValue(Find(Kind::kEndpointType, endpointType, 0) != nullptr, false);
+
+        const Entry * clusterEntry = Find(Kind::kServerCluster, endpointType, clusterId);
+        if (clusterEntry == nullptr)
+        {
+            status = Protocols::InteractionModel::Status::UnsupportedCluster;
+            return true;
+        }
+
+        const EmberAfCluster * cluster = &endpointType->cluster[clusterEntry->clusterIndex];
+        const Entry * attributeEntry   = Find(Kind::kAttribute, cluster, attributeId);
+        if (attributeEntry == nullptr)
+        {
+            status = Protocols::InteractionModel::Status::UnsupportedAttribute;
+            return true;
+        }
+
+        *metadata     = &cluster->attributes[attributeEntry->index];
+        storageOffset = static_cast<uint16_t>(storageOffset + clusterEntry->storageOffset + attributeEntry->storageOffset);
+        status        = Protocols::InteractionModel::Status::Success;
+        return true;
+    }
+
+private:
+    enum class Kind : uint8_t
+    {
+        kEmpty = 0,
+        // Marks an endpoint type whose clusters and attributes are all in the index.
+        kEndpointType,
+        kServerCluster,
+        kClientCluster,
+        // An attribute of a server cluster, keyed by the address of the cluster.
+        kAttribute,
+    };
+
+    struct Entry
+    {
+        const void * owner   = nullptr;
+        uint32_t id          = 0;
+        Kind kind            = Kind::kEmpty;
+        uint8_t clusterIndex = 0;
+        // Clusters: index among the clusters of the same direction. Attributes: index in the cluster.
+        uint16_t index = 0;
+        // Clusters: storage of the preceding clusters of the endpoint type. Attributes: storage of the preceding
+        // attributes of the cluster.
+        uint16_t storageOffset = 0;
+    };
+
+    void AddEndpointType(const EmberAfEndpointType * endpointType)
+    {
+        uint16_t serverIndex   = 0;
+        uint16_t clientIndex   = 0;
+        uint16_t clusterOffset = 0;
+        for (uint8_t i = 0; i < endpointType->clusterCount; i++)
+        {
+            const EmberAfCluster * cluster = &endpointType->cluster[i];
+            if (cluster->mask & MATTER_CLUSTER_FLAG_SERVER)
+            {
+                const Entry clusterEntry{ endpointType, cluster->clusterId, Kind::kServerCluster, i, serverIndex++, clusterOffset };
+                VerifyOrReturn(Add(clusterEntry));
+
+                uint16_t attributeOffset = 0;
+                for (uint16_t j = 0; j < cluster->attributeCount; j++)
+                {
+                    const EmberAfAttributeMetadata * am = &cluster->attributes[j];
+                    VerifyOrReturn(Add(Entry{ cluster, am->attributeId, Kind::kAttribute, 0, j, attributeOffset }));
+                    if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                    {
+                        attributeOffset = static_cast<uint16_t>(attributeOffset + am->size);
+                    }
+                }
+            }
+            if (cluster->mask & MATTER_CLUSTER_FLAG_CLIENT)
+            {
+                const Entry clusterEntry{ endpointType, cluster->clusterId, Kind::kClientCluster, i, clientIndex++, clusterOffset };
+                VerifyOrReturn(Add(clusterEntry));
+            }
+            clusterOffset = static_cast<uint16_t>(clusterOffset + cluster->clusterSize);
+        }
+
+        // Only now can lookups in the endpoint type rely on the index.
+        Add(Entry{ endpointType, 0, Kind::kEndpointType, 0, 0, 0 });
+    }
+
+    // Adds entry unless its key is already there, in which case the first one wins, as with a scan.
+    bool Add(const Entry & entry)
+    {
+        size_t slot = Slot(entry.kind, entry.owner, entry.id);
+        for (; mSlots[slot].kind != Kind::kEmpty; slot = (slot + 1) & (kSlotCount - 1))
+        {
+            if (Matches(mSlots[slot], entry.kind, entry.owner, entry.id))
+            {
+                return true;
+            }
+        }
+        VerifyOrReturnValue(mCount < kCapacity, false);
+        mSlots[slot] = entry;
+        mCount++;
+        return true;
+    }
+
+    const Entry * Find(Kind kind, const void * owner, uint32_t id) const
+    {
+        for (size_t slot = Slot(kind, owner, id); mSlots[slot].kind != Kind::kEmpty; slot = (slot + 1) & (kSlotCount - 1))
+        {
+            if (Matches(mSlots[slot], kind, owner, id))
+            {
+                return &mSlots[slot];
+            }
+        }
+        return nullptr;
+    }
+
+    static bool Matches(const Entry & entry, Kind kind, const void * owner, uint32_t id)
+    {
+        return entry.kind == kind && entry.owner == owner && entry.id == id;
+    }
+
+    static constexpr size_t SlotBits(size_t minSlots)
+    {
+        size_t bits = 1;
+        while ((static_cast<size_t>(1) << bits) < minSlots)
+        {
+            bits++;
+        }
+        return bits;
+    }
+
+    // As for EndpointLookupIndex, the table is at most half full.
+    static constexpr size_t kSlotBits  = SlotBits(2 * kCapacity);
+    static constexpr size_t kSlotCount = static_cast<size_t>(1) << kSlotBits;
+
+    static size_t Slot(Kind kind, const void * owner, uint32_t id)
+    {
+        // Metadata is at least 4-byte aligned, and clusters of an endpoint type are about 20 to 40 bytes apart.
+        const uintptr_t address = reinterpret_cast<uintptr_t>(owner);
+        const uint32_t hash     = (static_cast<uint32_t>(address >> 2) * 0x85EBCA77u) ^ (id * 0x9E3779B1u) ^
+            (static_cast<uint32_t>(kind) * 0xC2B2AE3Du);
+        return (hash ^ (hash >> 15)) >> (32 - kSlotBits);
+    }
+
+    Entry mSlots[kSlotCount];
+    size_t mCount = 0;
+};
+
+/// Finds a server attribute in an endpoint type.
+///
+/// On success, `metadata` is set and `storageOffset` is advanced by the storage that the preceding clusters and
+/// attributes of the endpoint type use in the attribute storage.
+inline Protocols::InteractionModel::Status FindServerAttribute(const EmberAfEndpointType * endpointType, ClusterId clusterId,
+                                                               AttributeId attributeId,
+                                                               const EmberAfAttributeMetadata ** metadata,
+                                                               uint16_t & storageOffset)
+{
+    for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (cluster->clusterId != clusterId || !(cluster->mask & MATTER_CLUSTER_FLAG_SERVER))
+        {
+            // Not the cluster we are looking for
+            storageOffset = static_cast<uint16_t>(storageOffset + cluster->clusterSize);
+            continue;
+        }
+
+        for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+        {
+            const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+            if (am->attributeId == attributeId)
+            {
+                *metadata = am;
+                return Protocols::InteractionModel::Status::Success;
+            }
+
+            // Increase the offset if attribute is not externally stored
+            if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+            {
+                storageOffset = static_cast<uint16_t>(storageOffset + am->size);
+            }
+        }
+
+        // Attribute is not in the cluster.
+        return Protocols::InteractionModel::Status::UnsupportedAttribute;
+    }
+
+    // Cluster is not in the endpoint.
+    return Protocols::InteractionModel::Status::UnsupportedCluster;
+}
+
+} // namespace Internal
+} // namespace Compatibility
+} // namespace app
+} // namespace chip
@@ -0,0 +1,169 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures AccessControl::Check with the example delegate, filled with the
+ *      maximum number of entries for each configured fabric (one administer
+ *      entry with a single subject, then operate entries with several subjects
+ *      and targets). Requests come from the last fabric:
+ *
+ *        - admin_checks_per_s: subject of the administer entry.
+ *        - target_checks_per_s: subject and target of the last operate entry.
+ *        - denied_checks_per_s: unknown subject, every entry is looked at.
+ *        - pase_checks_per_s: PASE commissioning session (implicit administer).
+ */
+
+#include <access/AccessControl.h>
+#include <access/examples/ExampleAccessControlDelegate.h>
+#include <benchmarks/BenchmarkHelpers.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::Access;
+
+namespace {
+
+constexpr FabricIndex kFabricCounts[]   = { 1, 16 };
+constexpr size_t kEntriesPerFabric      = CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC;
+constexpr size_t kSubjectsPerEntry      = CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_SUBJECTS_PER_ENTRY;
+constexpr size_t kTargetsPerEntry       = CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_TARGETS_PER_ENTRY;
+constexpr size_t kChecks                = 1000000;
+constexpr NodeId kFirstNodeId           = 0x0000'0001'0000'0000;
+constexpr NodeId kUnknownNodeId         = 0x0000'0002'0000'0000;
+constexpr ClusterId kFirstTargetCluster = 0x0006;
+constexpr EndpointId kTargetEndpoint    = 1;
+
+const ResultWriter gResults("access-control", "fabrics");
+
+class NoDeviceTypeResolver : public AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+} gDeviceTypeResolver;
+
+NodeId SubjectFor(FabricIndex fabricIndex, size_t entryIndex, size_t subjectIndex)
+{
+    return kFirstNodeId + fabricIndex * 0x1000u + entryIndex * 0x10u + subjectIndex;
+}
+
+ClusterId TargetClusterFor(size_t entryIndex, size_t targetIndex)
+{
+    return static_cast<ClusterId>(kFirstTargetCluster + entryIndex * kTargetsPerEntry + targetIndex);
+}
+
+CHIP_ERROR Populate(AccessControl & accessControl, FabricIndex fabricCount)
+{
+    for (FabricIndex fabricIndex = 1; fabricIndex <= fabricCount; fabricIndex++)
+    {
+        for (size_t entryIndex = 0; entryIndex < kEntriesPerFabric; entryIndex++)
+        {
+            const bool isAdmin = (entryIndex == 0);
+
+            AccessControl::Entry entry;
+            ReturnErrorOnFailure(accessControl.PrepareEntry(entry));
+            ReturnErrorOnFailure(entry.SetFabricIndex(fabricIndex));
+            ReturnErrorOnFailure(entry.SetAuthMode(AuthMode::kCase));
+            ReturnErrorOnFailure(entry.SetPrivilege(isAdmin ? Privilege::kAdminister : Privilege::kOperate));
+            for (size_t subjectIndex = 0; subjectIndex < (isAdmin ? 1 : kSubjectsPerEntry); subjectIndex++)
+            {
+                ReturnErrorOnFailure(entry.AddSubject(nullptr, SubjectFor(fabricIndex, entryIndex, subjectIndex)));
+            }
+            for (size_t targetIndex = 0; !isAdmin && targetIndex < kTargetsPerEntry; targetIndex++)
+            {
+                AccessControl::Entry::Target target;
+                target.flags    = AccessControl::Entry::Target::kCluster | AccessControl::Entry::Target::kEndpoint;
+                target.cluster  = TargetClusterFor(entryIndex, targetIndex);
+                target.endpoint = kTargetEndpoint;
+                ReturnErrorOnFailure(entry.AddTarget(nullptr, target));
+            }
+            ReturnErrorOnFailure(accessControl.CreateEntry(nullptr, entry));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+void RunCheck(AccessControl & accessControl, FabricIndex fabricCount, const char * name, const SubjectDescriptor & subject,
+              const RequestPath & path, CHIP_ERROR expected)
+{
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kChecks; i++)
+    {
+        VerifyOrDie(accessControl.Check(subject, path, Privilege::kOperate) == expected);
+    }
+    const double seconds = SecondsSince(start);
+
+    gResults.Print(fabricCount, std::string(name) + "_checks_per_s", Better::kHigher, static_cast<double>(kChecks) / seconds);
+}
+
+void RunBenchmark(FabricIndex fabricCount)
+{
+    AccessControl accessControl;
+    VerifyOrDie(accessControl.Init(Examples::GetAccessControlDelegate(), gDeviceTypeResolver) == CHIP_NO_ERROR);
+    VerifyOrDie(Populate(accessControl, fabricCount) == CHIP_NO_ERROR);
+
+    const size_t lastEntry = kEntriesPerFabric - 1;
+
+    SubjectDescriptor subject;
+    subject.fabricIndex = fabricCount;
+    subject.authMode    = AuthMode::kCase;
+
+    RequestPath path;
+    path.cluster     = TargetClusterFor(lastEntry, kTargetsPerEntry - 1);
+    path.endpoint    = kTargetEndpoint;
+    path.requestType = RequestType::kAttributeReadRequest;
+    path.entityId    = 0;
+
+    subject.subject = SubjectFor(fabricCount, 0, 0);
+    RunCheck(accessControl, fabricCount, "admin", subject, path, CHIP_NO_ERROR);
+
+    subject.subject = SubjectFor(fabricCount, lastEntry, kSubjectsPerEntry - 1);
+    RunCheck(accessControl, fabricCount, "target", subject, path, CHIP_NO_ERROR);
+
+    subject.subject = kUnknownNodeId;
+    RunCheck(accessControl, fabricCount, "denied", subject, path, CHIP_ERROR_ACCESS_DENIED);
+
+    SubjectDescriptor pase;
+    pase.authMode        = AuthMode::kPase;
+    pase.subject         = NodeIdFromPAKEKeyId(kDefaultCommissioningPasscodeId);
+    pase.isCommissioning = true;
+    RunCheck(accessControl, fabricCount, "pase", pase, path, CHIP_NO_ERROR);
+
+    accessControl.Finish();
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+
+    gResults.PrintHeader();
+    for (FabricIndex fabricCount : kFabricCounts)
+    {
+        RunBenchmark(fabricCount);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <benchmarks/BenchmarkHelpers.h>
+
+#include <cstdio>
+
+namespace chip {
+namespace Benchmarks {
+
+namespace {
+
+const char * BetterName(Better better)
+{
+    return (better == Better::kHigher) ? "higher" : "lower";
+}
+
+} // namespace
+
+void ResultWriter::PrintHeader() const
+{
+    printf("benchmark,%s,metric,value,better\n", mParameterName);
+}
+
+void ResultWriter::Print(size_t parameter, const std::string & metric, Better better, double value, int decimals) const
+{
+    printf("%s,%zu,%s,%.*f,%s\n", mBenchmark, parameter, metric.c_str(), decimals, value, BetterName(better));
+}
+
+void ResultWriter::Print(const char * parameter, const std::string & metric, Better better, double value, int decimals) const
+{
+    printf("%s,%s,%s,%.*f,%s\n", mBenchmark, parameter, metric.c_str(), decimals, value, BetterName(better));
+}
+
+} // namespace Benchmarks
+} // namespace chip
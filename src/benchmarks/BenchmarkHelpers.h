@@ -0,0 +1,96 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Helpers shared by the stack microbenchmarks.
+ *
+ *      Every benchmark prints its results as CSV on stdout, one row per
+ *      metric:
+ *
+ *        benchmark,<parameter>,metric,value,better
+ *
+ *      preceded by a header naming the parameter. `better` is `higher` for
+ *      metrics where a larger value is an improvement (throughputs, savings)
+ *      and `lower` for costs (times, counts of operations, bytes), so that
+ *      scripts/tools/run_benchmarks.py can compare results without guessing
+ *      from the metric name.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace chip {
+namespace Benchmarks {
+
+using SteadyClock = std::chrono::steady_clock;
+
+/// Which direction of change of a metric is an improvement.
+enum class Better
+{
+    kHigher,
+    kLower,
+};
+
+/**
+ * Returns the i-th index of a walk over [0, count) in an order unrelated to the natural one, as requests from many peers or
+ * to many objects would arrive. The walk visits every index as long as count is not a multiple of 7919.
+ */
+inline size_t ScrambledIndex(size_t i, size_t count)
+{
+    return (i * 7919) % count;
+}
+
+/// Returns the time elapsed since start, in seconds.
+inline double SecondsSince(SteadyClock::time_point start)
+{
+    return std::chrono::duration<double>(SteadyClock::now() - start).count();
+}
+
+/**
+ * Prints the results of one benchmark in the CSV format described above.
+ */
+class ResultWriter
+{
+public:
+    /**
+     * @param benchmark      name of the benchmark, first column of every row
+     * @param parameterName  what the second column holds (e.g. "endpoints"), printed in the header
+     */
+    ResultWriter(const char * benchmark, const char * parameterName) : mBenchmark(benchmark), mParameterName(parameterName) {}
+
+    /// Prints the header row. Call it before the results, and again if another writer printed rows in between.
+    void PrintHeader() const;
+
+    /**
+     * Prints one result.
+     *
+     * @param decimals  number of digits printed after the decimal point
+     */
+    void Print(size_t parameter, const std::string & metric, Better better, double value, int decimals = 0) const;
+    void Print(const char * parameter, const std::string & metric, Better better, double value, int decimals = 0) const;
+
+private:
+    const char * mBenchmark;
+    const char * mParameterName;
+};
+
+} // namespace Benchmarks
+} // namespace chip
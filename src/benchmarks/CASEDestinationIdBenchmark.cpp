@@ -0,0 +1,252 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures how fast a CASE responder matches the destination identifier of a
+ *      Sigma1 with one of its fabrics, on a node with kFabricCount fabrics that all
+ *      have kEpochKeyCount IPK epoch keys:
+ *
+ *        - uncached_lookups_per_s: what CASESession does without a destination id
+ *          cache, i.e. load the IPKs of every fabric from the group data provider
+ *          and compute the destination identifier for each of them.
+ *        - cached_lookups_per_s: CASEDestinationIdCache::FindLocalNode().
+ *
+ *      Lookups either match the last key of the last fabric (the worst case for a
+ *      known initiator) or no fabric at all.
+ */
+
+#include <benchmarks/BenchmarkHelpers.h>
+#include <credentials/FabricTable.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <credentials/TestOnlyLocalCertificateAuthority.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <crypto/PersistentStorageOperationalKeystore.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/secure_channel/CASEDestinationId.h>
+
+#include <cstring>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::Credentials;
+
+namespace {
+
+constexpr size_t kFabricCount   = 5;
+constexpr size_t kEpochKeyCount = GroupDataProvider::KeySet::kEpochKeysMax;
+constexpr size_t kLookups       = 20000;
+
+const ResultWriter gResults("case-destination-id", "lookup");
+
+class Node
+{
+public:
+    CHIP_ERROR Init()
+    {
+        ReturnErrorOnFailure(mOpKeyStore.Init(&mStorage));
+        ReturnErrorOnFailure(mOpCertStore.Init(&mStorage));
+
+        FabricTable::InitParams initParams;
+        initParams.storage             = &mStorage;
+        initParams.operationalKeystore = &mOpKeyStore;
+        initParams.opCertStore         = &mOpCertStore;
+        ReturnErrorOnFailure(fabricTable.Init(initParams));
+
+        groupDataProvider.SetStorageDelegate(&mStorage);
+        groupDataProvider.SetSessionKeystore(&mSessionKeystore);
+        return groupDataProvider.Init();
+    }
+
+    CHIP_ERROR AddFabric(FabricId fabricId, NodeId nodeId)
+    {
+        TestOnlyLocalCertificateAuthority certAuthority;
+        ReturnErrorOnFailure(certAuthority.Init().GetStatus());
+
+        uint8_t csrBuf[Crypto::kMIN_CSR_Buffer_Size];
+        MutableByteSpan csrSpan(csrBuf);
+        ReturnErrorOnFailure(fabricTable.AllocatePendingOperationalKey(NullOptional, csrSpan));
+        ReturnErrorOnFailure(certAuthority.SetIncludeIcac(true).GenerateNocChain(fabricId, nodeId, csrSpan).GetStatus());
+
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        ReturnErrorOnFailure(fabricTable.AddNewPendingTrustedRootCert(certAuthority.GetRcac()));
+        ReturnErrorOnFailure(fabricTable.AddNewPendingFabricWithOperationalKeystore(
+            certAuthority.GetNoc(), certAuthority.GetIcac(), to_underlying(VendorId::TestVendor1), &fabricIndex));
+        ReturnErrorOnFailure(fabricTable.CommitPendingFabricData());
+
+        const FabricInfo * fabricInfo = fabricTable.FindFabricWithIndex(fabricIndex);
+        VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+
+        GroupDataProvider::KeySet ipkKeySet(GroupDataProvider::kIdentityProtectionKeySetId,
+                                            GroupDataProvider::SecurityPolicy::kTrustFirst, static_cast<uint8_t>(kEpochKeyCount));
+        for (size_t keyIdx = 0; keyIdx < kEpochKeyCount; ++keyIdx)
+        {
+            ipkKeySet.epoch_keys[keyIdx].start_time = static_cast<uint64_t>(keyIdx * 1000);
+            memset(ipkKeySet.epoch_keys[keyIdx].key, static_cast<int>(fabricIndex * 16 + keyIdx),
+                   sizeof(ipkKeySet.epoch_keys[keyIdx].key));
+        }
+
+        uint8_t compressedId[sizeof(uint64_t)];
+        MutableByteSpan compressedIdSpan(compressedId);
+        ReturnErrorOnFailure(fabricInfo->GetCompressedFabricIdBytes(compressedIdSpan));
+        return groupDataProvider.SetKeySet(fabricIndex, compressedIdSpan, ipkKeySet);
+    }
+
+    void Shutdown()
+    {
+        groupDataProvider.Finish();
+        fabricTable.Shutdown();
+        mOpCertStore.Finish();
+        mOpKeyStore.Finish();
+    }
+
+    FabricTable fabricTable;
+    GroupDataProviderImpl groupDataProvider;
+
+private:
+    TestPersistentStorageDelegate mStorage;
+    PersistentStorageOperationalKeystore mOpKeyStore;
+    PersistentStorageOpCertStore mOpCertStore;
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+};
+
+// Same steps as CASESession::FindLocalNodeFromDestinationId() without a destination id cache.
+CHIP_ERROR FindLocalNodeUncached(Node & node, const ByteSpan & destinationId, const ByteSpan & initiatorRandom,
+                                 FabricIndex & outFabricIndex)
+{
+    for (const FabricInfo & fabricInfo : node.fabricTable)
+    {
+        Crypto::P256PublicKey rootPubKey;
+        ReturnErrorOnFailure(node.fabricTable.FetchRootPubkey(fabricInfo.GetFabricIndex(), rootPubKey));
+        P256PublicKeySpan rootPubKeySpan{ rootPubKey.ConstBytes() };
+
+        GroupDataProvider::KeySet ipkKeySet;
+        auto ipkKeySetWiperOnScopeExit = ScopeExit([&] { ipkKeySet.ClearKeys(); });
+        CHIP_ERROR err                 = node.groupDataProvider.GetIpkKeySet(fabricInfo.GetFabricIndex(), ipkKeySet);
+        if ((err != CHIP_NO_ERROR) || (ipkKeySet.num_keys_used == 0) ||
+            (ipkKeySet.num_keys_used > GroupDataProvider::KeySet::kEpochKeysMax))
+        {
+            continue;
+        }
+
+        for (size_t keyIdx = 0; keyIdx < ipkKeySet.num_keys_used; ++keyIdx)
+        {
+            uint8_t candidateDestinationId[Crypto::kSHA256_Hash_Length];
+            MutableByteSpan candidateDestinationIdSpan(candidateDestinationId);
+            err = GenerateCaseDestinationId(ByteSpan(ipkKeySet.epoch_keys[keyIdx].key), initiatorRandom, rootPubKeySpan,
+                                            fabricInfo.GetFabricId(), fabricInfo.GetNodeId(), candidateDestinationIdSpan);
+            if ((err == CHIP_NO_ERROR) && candidateDestinationIdSpan.data_equal(destinationId))
+            {
+                outFabricIndex = fabricInfo.GetFabricIndex();
+                return CHIP_NO_ERROR;
+            }
+        }
+    }
+
+    return CHIP_ERROR_KEY_NOT_FOUND;
+}
+
+template <typename Lookup>
+double Measure(Lookup && lookup)
+{
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kLookups; i++)
+    {
+        lookup();
+    }
+    double seconds = SecondsSince(start);
+    return static_cast<double>(kLookups) / seconds;
+}
+
+void RunBenchmark(Node & node, CASEDestinationIdCache & cache, const char * name, const ByteSpan & destinationId,
+                  const ByteSpan & initiatorRandom, CHIP_ERROR expected)
+{
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    NodeId nodeId           = kUndefinedNodeId;
+    uint8_t ipk[kIPKSize];
+
+    double uncached = Measure([&] {
+        VerifyOrDie(FindLocalNodeUncached(node, destinationId, initiatorRandom, fabricIndex) == expected);
+    });
+    gResults.Print(name, "uncached_lookups_per_s", Better::kHigher, uncached);
+
+    double cached = Measure([&] {
+        MutableByteSpan ipkSpan(ipk);
+        VerifyOrDie(cache.FindLocalNode(destinationId, initiatorRandom, fabricIndex, nodeId, ipkSpan) == expected);
+    });
+    gResults.Print(name, "cached_lookups_per_s", Better::kHigher, cached);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    {
+        Node node;
+        VerifyOrDie(node.Init() == CHIP_NO_ERROR);
+        for (size_t i = 0; i < kFabricCount; i++)
+        {
+            VerifyOrDie(node.AddFabric(static_cast<FabricId>(0x1000 + i), static_cast<NodeId>(0x2000 + i)) == CHIP_NO_ERROR);
+        }
+
+        CASEDestinationIdCache cache;
+        VerifyOrDie(cache.Init(&node.fabricTable, &node.groupDataProvider) == CHIP_NO_ERROR);
+
+        // Destination identifier of the last key of the last fabric.
+        uint8_t initiatorRandom[kSigmaParamRandomNumberSize];
+        memset(initiatorRandom, 0x5a, sizeof(initiatorRandom));
+
+        const FabricInfo * lastFabric = nullptr;
+        for (const FabricInfo & fabricInfo : node.fabricTable)
+        {
+            lastFabric = &fabricInfo;
+        }
+        VerifyOrDie(lastFabric != nullptr);
+
+        Crypto::P256PublicKey rootPubKey;
+        VerifyOrDie(node.fabricTable.FetchRootPubkey(lastFabric->GetFabricIndex(), rootPubKey) == CHIP_NO_ERROR);
+
+        GroupDataProvider::KeySet ipkKeySet;
+        VerifyOrDie(node.groupDataProvider.GetIpkKeySet(lastFabric->GetFabricIndex(), ipkKeySet) == CHIP_NO_ERROR);
+
+        uint8_t destinationId[Crypto::kSHA256_Hash_Length];
+        MutableByteSpan destinationIdSpan(destinationId);
+        VerifyOrDie(GenerateCaseDestinationId(ByteSpan(ipkKeySet.epoch_keys[kEpochKeyCount - 1].key), ByteSpan(initiatorRandom),
+                                              P256PublicKeySpan{ rootPubKey.ConstBytes() }, lastFabric->GetFabricId(),
+                                              lastFabric->GetNodeId(), destinationIdSpan) == CHIP_NO_ERROR);
+        ipkKeySet.ClearKeys();
+
+        uint8_t unknownDestinationId[Crypto::kSHA256_Hash_Length];
+        memset(unknownDestinationId, 0xa5, sizeof(unknownDestinationId));
+
+        gResults.PrintHeader();
+        RunBenchmark(node, cache, "match_last", ByteSpan(destinationId), ByteSpan(initiatorRandom), CHIP_NO_ERROR);
+        RunBenchmark(node, cache, "no_match", ByteSpan(unknownDestinationId), ByteSpan(initiatorRandom), CHIP_ERROR_KEY_NOT_FOUND);
+
+        cache.Shutdown();
+        node.Shutdown();
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the validation of the peer's operational certificate chain (NOC -> ICAC -> RCAC)
+ *      that each side of a CASE handshake does, i.e. FabricTable::VerifyCredentials() with the
+ *      validation context CASESession uses:
+ *
+ *        - uncached_validations_per_s: without a verified certificate cache.
+ *        - cached_validations_per_s: with a VerifiedCertificateCache, as FabricTable provides to CASE.
+ *        - signature_verifications_per_validation / signature_verifications_saved_per_validation:
+ *          ECDSA verifications done and skipped, per validation, with the cache.
+ *
+ *      Validations are either always for the same peer (a controller reconnecting to the same
+ *      device) or cycle through kPeerCount peers of the fabric, more than the cache holds, so
+ *      that only the ICAC -> RCAC link is found in the cache. The cached metrics are only
+ *      reported when CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE is not 0.
+ */
+
+#include <benchmarks/BenchmarkHelpers.h>
+#include <credentials/CHIPCert.h>
+#include <credentials/FabricTable.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::Credentials;
+
+namespace {
+
+constexpr FabricId kFabricId  = 0xFAB1;
+constexpr size_t kValidations = 2000;
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+// More peers than the cache holds, so that the NOC of the next peer has always been evicted.
+constexpr size_t kPeerCount = 2 * VerifiedCertificateCache::kCapacity + 1;
+#else
+constexpr size_t kPeerCount = 65;
+#endif
+
+using Certificate = std::vector<uint8_t>;
+
+const ResultWriter gResults("certificate-chain", "peers");
+
+/**
+ * Issues the RCAC, the ICAC and any number of NOCs of a fabric. Unlike TestOnlyLocalCertificateAuthority, which
+ * issues a new ICAC with every NOC, all the NOCs are issued by the same ICAC, as on a real fabric.
+ */
+class FabricCertificateAuthority
+{
+public:
+    CHIP_ERROR Init()
+    {
+        ReturnErrorOnFailure(mRootKeypair.Initialize(Crypto::ECPKeyTarget::ECDSA));
+        ReturnErrorOnFailure(mIcacKeypair.Initialize(Crypto::ECPKeyTarget::ECDSA));
+
+        ASN1::ASN1UniversalTime effectiveTime;
+        CHIP_ZERO_AT(effectiveTime);
+        effectiveTime.Year  = 2021;
+        effectiveTime.Month = 1;
+        effectiveTime.Day   = 1;
+        ReturnErrorOnFailure(ASN1ToChipEpochTime(effectiveTime, mNotBefore));
+
+        ReturnErrorOnFailure(mRcacDN.AddAttribute_MatterRCACId(1));
+        ReturnErrorOnFailure(mIcacDN.AddAttribute_MatterFabricId(kFabricId));
+        ReturnErrorOnFailure(mIcacDN.AddAttribute_MatterICACId(2));
+
+        uint8_t derBuf[kMaxDERCertLength];
+        MutableByteSpan der(derBuf);
+        ReturnErrorOnFailure(NewRootX509Cert(MakeRequest(mRcacDN, mRcacDN), mRootKeypair, der));
+        ReturnErrorOnFailure(ToChipCert(der, mRcac));
+
+        der = MutableByteSpan(derBuf);
+        ReturnErrorOnFailure(NewICAX509Cert(MakeRequest(mIcacDN, mRcacDN), mIcacKeypair.Pubkey(), mRootKeypair, der));
+        return ToChipCert(der, mIcac);
+    }
+
+    CHIP_ERROR IssueNoc(NodeId nodeId, Certificate & outNoc)
+    {
+        Crypto::P256Keypair nocKeypair;
+        ReturnErrorOnFailure(nocKeypair.Initialize(Crypto::ECPKeyTarget::ECDSA));
+
+        ChipDN nocDN;
+        ReturnErrorOnFailure(nocDN.AddAttribute_MatterFabricId(kFabricId));
+        ReturnErrorOnFailure(nocDN.AddAttribute_MatterNodeId(nodeId));
+
+        uint8_t derBuf[kMaxDERCertLength];
+        MutableByteSpan der(derBuf);
+        ReturnErrorOnFailure(NewNodeOperationalX509Cert(MakeRequest(nocDN, mIcacDN), nocKeypair.Pubkey(), mIcacKeypair, der));
+        return ToChipCert(der, outNoc);
+    }
+
+    ByteSpan GetRcac() const { return ByteSpan(mRcac.data(), mRcac.size()); }
+    ByteSpan GetIcac() const { return ByteSpan(mIcac.data(), mIcac.size()); }
+
+private:
+    static constexpr uint32_t kValidity = 10 * 365 * 24 * 60 * 60;
+
+    X509CertRequestParams MakeRequest(const ChipDN & subject, const ChipDN & issuer) const
+    {
+        return X509CertRequestParams{ 0, mNotBefore, mNotBefore + kValidity, subject, issuer };
+    }
+
+    static CHIP_ERROR ToChipCert(const ByteSpan & der, Certificate & outCert)
+    {
+        uint8_t chipBuf[kMaxCHIPCertLength];
+        MutableByteSpan chipCert(chipBuf);
+        ReturnErrorOnFailure(ConvertX509CertToChipCert(der, chipCert));
+        outCert.assign(chipCert.data(), chipCert.data() + chipCert.size());
+        return CHIP_NO_ERROR;
+    }
+
+    Crypto::P256Keypair mRootKeypair;
+    Crypto::P256Keypair mIcacKeypair;
+    ChipDN mRcacDN;
+    ChipDN mIcacDN;
+    uint32_t mNotBefore = 0;
+    Certificate mRcac;
+    Certificate mIcac;
+};
+
+ValidationContext MakeCASEValidationContext()
+{
+    ValidationContext validContext;
+    validContext.Reset();
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    System::Clock::Milliseconds64 currentUnixTimeMS;
+    VerifyOrDie(System::SystemClock().GetClock_RealTimeMS(currentUnixTimeMS) == CHIP_NO_ERROR);
+    VerifyOrDie(validContext.SetEffectiveTimeFromUnixTime<CurrentChipEpochTime>(
+                    std::chrono::duration_cast<System::Clock::Seconds32>(currentUnixTimeMS)) == CHIP_NO_ERROR);
+    return validContext;
+}
+
+double Measure(const FabricCertificateAuthority & certAuthority, const std::vector<Certificate> & nocs, size_t peerCount,
+               ValidationContext & validContext)
+{
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kValidations; i++)
+    {
+        const Certificate & noc = nocs[i % peerCount];
+
+        CompressedFabricId compressedFabricId;
+        FabricId fabricId;
+        NodeId nodeId;
+        Crypto::P256PublicKey nocPubkey;
+        VerifyOrDie(FabricTable::VerifyCredentials(ByteSpan(noc.data(), noc.size()), certAuthority.GetIcac(),
+                                                   certAuthority.GetRcac(), validContext, compressedFabricId, fabricId, nodeId,
+                                                   nocPubkey) == CHIP_NO_ERROR);
+    }
+    double seconds = SecondsSince(start);
+    return static_cast<double>(kValidations) / seconds;
+}
+
+void RunBenchmark(const char * name, const FabricCertificateAuthority & certAuthority, const std::vector<Certificate> & nocs,
+                  size_t peerCount)
+{
+    ValidationContext validContext = MakeCASEValidationContext();
+    double uncached                = Measure(certAuthority, nocs, peerCount, validContext);
+    gResults.Print(name, "uncached_validations_per_s", Better::kHigher, uncached);
+
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    // Start from an empty cache, as after a change to the fabric table.
+    VerifiedCertificateCache cache;
+    validContext.mVerifiedCertificateCache = &cache;
+    double cached                          = Measure(certAuthority, nocs, peerCount, validContext);
+    gResults.Print(name, "cached_validations_per_s", Better::kHigher, cached);
+
+    VerifiedCertificateCache::Stats stats = cache.GetStats();
+    gResults.Print(name, "signature_verifications_per_validation", Better::kLower,
+                   static_cast<double>(stats.verified) / kValidations, 3);
+    gResults.Print(name, "signature_verifications_saved_per_validation", Better::kHigher,
+                   static_cast<double>(stats.saved) / kValidations, 3);
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    {
+        FabricCertificateAuthority certAuthority;
+        VerifyOrDie(certAuthority.Init() == CHIP_NO_ERROR);
+
+        std::vector<Certificate> nocs(kPeerCount);
+        for (size_t i = 0; i < kPeerCount; i++)
+        {
+            VerifyOrDie(certAuthority.IssueNoc(static_cast<NodeId>(0x1000 + i), nocs[i]) == CHIP_NO_ERROR);
+        }
+
+        gResults.PrintHeader();
+        RunBenchmark("same_peer", certAuthority, nocs, 1);
+        RunBenchmark("many_peers", certAuthority, nocs, kPeerCount);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -0,0 +1,341 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures report generation by the reporting engine for wildcard reads
+ *      of a bridge-like node, end to end: a ReadClient and the server side
+ *      share the interaction model engine and talk over the loopback transport
+ *      through CASE sessions injected with a test key. Access is granted by an
+ *      ACL entry of the example access control delegate, so every attribute
+ *      goes through AccessControl::Check.
+ *
+ *        - attributes_per_s: attribute reports received by the client per
+ *          second.
+ *        - read_ms: duration of one full wildcard read.
+ *        - messages_per_read: messages sent for one read (request, report
+ *          chunks, status responses and acks).
+ */
+
+#include <access/AccessControl.h>
+#include <access/examples/ExampleAccessControlDelegate.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/data-model-provider/Provider.h>
+#include <app/reporting/ReportSchedulerImpl.h>
+#include <benchmarks/BenchmarkHelpers.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <crypto/PersistentStorageOperationalKeystore.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <messaging/ExchangeMgr.h>
+#include <platform/DefaultTimerDelegate.h>
+#include <protocols/interaction_model/StatusCode.h>
+#include <protocols/secure_channel/MessageCounterManager.h>
+#include <transport/SessionManager.h>
+#include <transport/tests/LoopbackTransportManager.h>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::app;
+using namespace chip::app::DataModel;
+
+namespace {
+
+constexpr EndpointId kEndpointCounts[] = { 10, 100 };
+constexpr size_t kClustersPerEndpoint  = 6;
+constexpr size_t kAttributesPerCluster = 12;
+constexpr size_t kReads                = 20;
+constexpr ClusterId kFirstClusterId    = 0x0003;
+constexpr ClusterId kClusterIdStep     = 0x0020;
+constexpr FabricIndex kFabricIndex     = 1;
+constexpr NodeId kClientNodeId         = 0x0000'0000'0001'0001;
+constexpr NodeId kServerNodeId         = 0x0000'0000'0001'0002;
+constexpr uint16_t kClientSessionId    = 1;
+constexpr uint16_t kServerSessionId    = 2;
+constexpr uint16_t kClientPort         = CHIP_PORT;
+constexpr uint16_t kServerPort         = CHIP_PORT + 1;
+
+const ResultWriter gResults("reporting-engine", "endpoints");
+
+// Bridge-like provider with kClustersPerEndpoint clusters of kAttributesPerCluster unsigned attributes per endpoint.
+class BridgeProvider final : public Provider
+{
+public:
+    void SetEndpointCount(EndpointId endpointCount) { mEndpointCount = endpointCount; }
+
+    CHIP_ERROR Endpoints(ReadOnlyBufferBuilder<EndpointEntry> & builder) override
+    {
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(mEndpointCount));
+        for (EndpointId id = 0; id < mEndpointCount; id++)
+        {
+            ReturnErrorOnFailure(builder.Append({ id, kInvalidEndpointId, EndpointCompositionPattern::kFullFamily }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR DeviceTypes(EndpointId endpointId, ReadOnlyBufferBuilder<DeviceTypeEntry> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ClientClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ClusterId> & builder) override { return CHIP_NO_ERROR; }
+    CHIP_ERROR ServerClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ServerClusterEntry> & builder) override
+    {
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(kClustersPerEndpoint));
+        for (size_t i = 0; i < kClustersPerEndpoint; i++)
+        {
+            const ClusterId clusterId = static_cast<ClusterId>(kFirstClusterId + i * kClusterIdStep);
+            ReturnErrorOnFailure(builder.Append({ clusterId, 0, BitFlags<ClusterQualityFlags>() }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR EventInfo(const ConcreteEventPath & path, EventEntry & eventInfo) override { return CHIP_ERROR_NOT_FOUND; }
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<AttributeEntry> & builder) override
+    {
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(kAttributesPerCluster));
+        for (size_t i = 0; i < kAttributesPerCluster; i++)
+        {
+            ReturnErrorOnFailure(builder.Append(AttributeEntry(static_cast<AttributeId>(i), BitMask<AttributeQualityFlags>(),
+                                                               Access::Privilege::kView, std::nullopt)));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR GeneratedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<AcceptedCommandEntry> & builder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ActionReturnStatus ReadAttribute(const ReadAttributeRequest & request, AttributeValueEncoder & encoder) override
+    {
+        return encoder.Encode(static_cast<uint32_t>(request.path.mEndpointId * 1000u + request.path.mAttributeId));
+    }
+    ActionReturnStatus WriteAttribute(const WriteAttributeRequest & request, AttributeValueDecoder & decoder) override
+    {
+        return Protocols::InteractionModel::Status::UnsupportedWrite;
+    }
+    void ListAttributeWriteNotification(const ConcreteAttributePath & aPath, ListWriteOperation opType,
+                                        FabricIndex accessingFabric) override
+    {}
+    std::optional<ActionReturnStatus> InvokeCommand(const InvokeRequest & request, TLV::TLVReader & input_arguments,
+                                                    CommandHandler * handler) override
+    {
+        return Protocols::InteractionModel::Status::UnsupportedCommand;
+    }
+
+protected:
+    // The tree only changes between runs, when the provider is set again on the engine.
+    std::optional<unsigned> MetadataStructureGeneration() override { return mEndpointCount; }
+
+private:
+    EndpointId mEndpointCount = 0;
+};
+
+class CountingReadCallback : public ReadClient::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        VerifyOrDie(apData != nullptr && aStatus.IsSuccess());
+        attributes++;
+    }
+    void OnError(CHIP_ERROR aError) override { error = aError; }
+    void OnDone(ReadClient * apReadClient) override { done = true; }
+
+    size_t attributes = 0;
+    CHIP_ERROR error  = CHIP_NO_ERROR;
+    bool done         = false;
+};
+
+class NoDeviceTypeResolver : public Access::AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+} gDeviceTypeResolver;
+
+DefaultTimerDelegate gTimerDelegate;
+reporting::ReportSchedulerImpl gReportScheduler(&gTimerDelegate);
+
+// The messaging stack and the CASE sessions between the client and the server, both in the same SessionManager.
+class Node
+{
+public:
+    CHIP_ERROR Init(Testing::LoopbackTransportManager & loopback)
+    {
+        ReturnErrorOnFailure(mOpKeyStore.Init(&mStorage));
+        ReturnErrorOnFailure(mOpCertStore.Init(&mStorage));
+
+        FabricTable::InitParams initParams;
+        initParams.storage             = &mStorage;
+        initParams.operationalKeystore = &mOpKeyStore;
+        initParams.opCertStore         = &mOpCertStore;
+        ReturnErrorOnFailure(mFabricTable.Init(initParams));
+
+        ReturnErrorOnFailure(mSessionManager.Init(&loopback.GetSystemLayer(), &loopback.GetTransportMgr(), &mMessageCounterManager,
+                                                  &mStorage, &mFabricTable, mSessionKeystore));
+        ReturnErrorOnFailure(mExchangeManager.Init(&mSessionManager));
+        ReturnErrorOnFailure(mMessageCounterManager.Init(&mExchangeManager));
+
+        const Inet::IPAddress loopbackAddress = Inet::IPAddress::Loopback(Inet::IPAddressType::kIPv6);
+        ReturnErrorOnFailure(mSessionManager.InjectCaseSessionWithTestKey(
+            mClientToServer, kClientSessionId, kServerSessionId, kClientNodeId, kServerNodeId, kFabricIndex,
+            Transport::PeerAddress::UDP(loopbackAddress, kServerPort), CryptoContext::SessionRole::kInitiator));
+        return mSessionManager.InjectCaseSessionWithTestKey(
+            mServerToClient, kServerSessionId, kClientSessionId, kServerNodeId, kClientNodeId, kFabricIndex,
+            Transport::PeerAddress::UDP(loopbackAddress, kClientPort), CryptoContext::SessionRole::kResponder);
+    }
+
+    void Shutdown()
+    {
+        mClientToServer.Release();
+        mServerToClient.Release();
+        mMessageCounterManager.Shutdown();
+        mExchangeManager.Shutdown();
+        mSessionManager.Shutdown();
+        mFabricTable.Shutdown();
+        mOpCertStore.Finish();
+        mOpKeyStore.Finish();
+    }
+
+    Messaging::ExchangeManager & GetExchangeManager() { return mExchangeManager; }
+    FabricTable & GetFabricTable() { return mFabricTable; }
+    SessionHolder & GetClientToServerSession() { return mClientToServer; }
+
+private:
+    TestPersistentStorageDelegate mStorage;
+    PersistentStorageOperationalKeystore mOpKeyStore;
+    Credentials::PersistentStorageOpCertStore mOpCertStore;
+    FabricTable mFabricTable;
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+    SessionManager mSessionManager;
+    Messaging::ExchangeManager mExchangeManager;
+    secure_channel::MessageCounterManager mMessageCounterManager;
+    SessionHolder mClientToServer;
+    SessionHolder mServerToClient;
+};
+
+// Lets the client read everything, behind an administer entry that does not match it.
+CHIP_ERROR CreateAccessControlEntry(Access::Privilege privilege, NodeId subject)
+{
+    Access::AccessControl & accessControl = Access::GetAccessControl();
+
+    Access::AccessControl::Entry entry;
+    ReturnErrorOnFailure(accessControl.PrepareEntry(entry));
+    ReturnErrorOnFailure(entry.SetFabricIndex(kFabricIndex));
+    ReturnErrorOnFailure(entry.SetAuthMode(Access::AuthMode::kCase));
+    ReturnErrorOnFailure(entry.SetPrivilege(privilege));
+    ReturnErrorOnFailure(entry.AddSubject(nullptr, subject));
+    return accessControl.CreateEntry(nullptr, entry);
+}
+
+CHIP_ERROR PopulateAccessControl()
+{
+    ReturnErrorOnFailure(CreateAccessControlEntry(Access::Privilege::kAdminister, kServerNodeId));
+    return CreateAccessControlEntry(Access::Privilege::kView, kClientNodeId);
+}
+
+size_t ReadAll(Testing::LoopbackTransportManager & loopback, Node & node)
+{
+    AttributePathParams wildcard;
+    ReadPrepareParams params(node.GetClientToServerSession().Get().Value());
+    params.mpAttributePathParamsList    = &wildcard;
+    params.mAttributePathParamsListSize = 1;
+    params.mIsFabricFiltered            = false;
+
+    CountingReadCallback callback;
+    ReadClient client(InteractionModelEngine::GetInstance(), &node.GetExchangeManager(), callback,
+                      ReadClient::InteractionType::Read);
+    VerifyOrDie(client.SendRequest(params) == CHIP_NO_ERROR);
+
+    while (!callback.done)
+    {
+        loopback.GetIOContext().DriveIO();
+    }
+    VerifyOrDie(callback.error == CHIP_NO_ERROR);
+
+    return callback.attributes;
+}
+
+void RunBenchmark(Testing::LoopbackTransportManager & loopback, Node & node, BridgeProvider & provider, EndpointId endpointCount)
+{
+    provider.SetEndpointCount(endpointCount);
+    InteractionModelEngine::GetInstance()->SetDataModelProvider(&provider);
+
+    // Warm up the allocator and the metadata caches.
+    (void) ReadAll(loopback, node);
+
+    const uint32_t sentBefore     = loopback.GetLoopback().mSentMessageCount;
+    size_t attributes             = 0;
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kReads; i++)
+    {
+        attributes += ReadAll(loopback, node);
+    }
+    const double seconds = SecondsSince(start);
+    const uint32_t sent  = loopback.GetLoopback().mSentMessageCount - sentBefore;
+
+    VerifyOrDie(attributes == kReads * endpointCount * kClustersPerEndpoint * kAttributesPerCluster);
+
+    gResults.Print(endpointCount, "attributes_per_s", Better::kHigher, static_cast<double>(attributes) / seconds);
+    gResults.Print(endpointCount, "read_ms", Better::kLower, seconds * 1000 / kReads, 2);
+    gResults.Print(endpointCount, "messages_per_read", Better::kLower, static_cast<double>(sent) / kReads, 1);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+
+    // Also initializes (and on shutdown, releases) the platform memory.
+    Testing::LoopbackTransportManager loopback;
+    VerifyOrDie(loopback.Init() == CHIP_NO_ERROR);
+
+    Node node;
+    VerifyOrDie(node.Init(loopback) == CHIP_NO_ERROR);
+
+    VerifyOrDie(Access::GetAccessControl().Init(Access::Examples::GetAccessControlDelegate(), gDeviceTypeResolver) ==
+                CHIP_NO_ERROR);
+    VerifyOrDie(PopulateAccessControl() == CHIP_NO_ERROR);
+
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+    VerifyOrDie(engine->Init(&node.GetExchangeManager(), &node.GetFabricTable(), &gReportScheduler) == CHIP_NO_ERROR);
+
+    BridgeProvider provider;
+
+    // The first event loop pass prints a banner, get it out of the way of the results.
+    loopback.GetIOContext().DriveIO();
+
+    gResults.PrintHeader();
+    for (EndpointId endpointCount : kEndpointCounts)
+    {
+        RunBenchmark(loopback, node, provider, endpointCount);
+    }
+
+    loopback.DrainAndServiceIO();
+    engine->SetDataModelProvider(nullptr);
+    engine->Shutdown();
+    Access::GetAccessControl().Finish();
+    node.Shutdown();
+    loopback.Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,384 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures TLVWriter and TLVReader on payloads shaped like attribute
+ *      reports: an array of structures, each holding a path list, a data
+ *      version and a value (unsigned integer, string, octet string or
+ *      boolean).
+ *
+ *        - encode_elements_per_s / encode_mb_per_s: TLVWriter encoding the whole
+ *          array.
+ *        - decode_elements_per_s / decode_mb_per_s: TLVReader entering every
+ *          element and getting all its values.
+ *        - skip_elements_per_s: TLVReader stepping over the elements without
+ *          entering them, as done when looking for a given element.
+ *        - index_mb_per_s: TLVSkipIndex::Build() over the encoding.
+ *        - skip_indexed_elements_per_s: same as skip_elements_per_s, with the
+ *          reader using the skip index.
+ *
+ *      It also measures, on structures nested `depth` times (each level
+ *      holding an integer, the next level and a string), finding the string
+ *      of the outermost level with FindElementWithTag(), which steps over all
+ *      the nested levels:
+ *
+ *        - find_per_s: without a skip index.
+ *        - find_indexed_per_s: with a skip index.
+ */
+
+#include <benchmarks/BenchmarkHelpers.h>
+#include <lib/core/TLV.h>
+#include <lib/core/TLVSkipIndex.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <cstring>
+#include <string>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+
+namespace {
+
+constexpr size_t kElementCounts[]    = { 8, 64, 512 };
+constexpr size_t kElementsPerRun     = 1000000;
+constexpr size_t kDepths[]           = { 4, 16, 64 };
+constexpr size_t kFindsPerRun        = 200000;
+constexpr size_t kBufferSize         = 64 * 1024;
+constexpr char kStringValue[]        = "Living room lamp";
+constexpr uint8_t kBytesValue[32]    = { 0x15, 0x2a, 0x3f };
+constexpr uint8_t kPathTag           = 0;
+constexpr uint8_t kDataVersionTag    = 1;
+constexpr uint8_t kValueTag          = 2;
+constexpr uint8_t kEndpointTag       = 2;
+constexpr uint8_t kClusterTag        = 3;
+constexpr uint8_t kAttributeTag      = 4;
+constexpr uint32_t kDataVersionValue = 0x12345678;
+
+const ResultWriter gResults("tlv", "elements");
+const ResultWriter gNestedResults("tlv-nested", "depth");
+
+uint8_t gBuffer[kBufferSize];
+
+// The array, plus the structure and path list of every element.
+TLV::TLVSkipIndexWithStorage<1 + 2 * 512> gSkipIndex;
+
+CHIP_ERROR EncodeElement(TLV::TLVWriter & writer, size_t index)
+{
+    TLV::TLVType element;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, element));
+
+    TLV::TLVType path;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(kPathTag), TLV::kTLVType_List, path));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kEndpointTag), static_cast<EndpointId>(index / 64)));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kClusterTag), static_cast<ClusterId>(0x0006 + (index / 8) % 8)));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kAttributeTag), static_cast<AttributeId>(index % 8)));
+    ReturnErrorOnFailure(writer.EndContainer(path));
+
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kDataVersionTag), kDataVersionValue));
+
+    switch (index % 4)
+    {
+    case 0:
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kValueTag), static_cast<uint32_t>(index * 1000)));
+        break;
+    case 1:
+        ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(kValueTag), kStringValue));
+        break;
+    case 2:
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kValueTag), ByteSpan(kBytesValue)));
+        break;
+    default:
+        ReturnErrorOnFailure(writer.PutBoolean(TLV::ContextTag(kValueTag), (index & 4) != 0));
+        break;
+    }
+
+    return writer.EndContainer(element);
+}
+
+CHIP_ERROR Encode(size_t elementCount, size_t & encodedLength)
+{
+    TLV::TLVWriter writer;
+    writer.Init(gBuffer);
+
+    TLV::TLVType array;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, array));
+    for (size_t i = 0; i < elementCount; i++)
+    {
+        ReturnErrorOnFailure(EncodeElement(writer, i));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(array));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    encodedLength = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+// Gets every value of every element. Returns a checksum so that the reads cannot be optimized out.
+CHIP_ERROR Decode(size_t encodedLength, size_t & elementCount, uint64_t & checksum)
+{
+    TLV::TLVReader reader;
+    reader.Init(gBuffer, encodedLength);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+
+    TLV::TLVType array;
+    ReturnErrorOnFailure(reader.EnterContainer(array));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        TLV::TLVType element;
+        ReturnErrorOnFailure(reader.EnterContainer(element));
+
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_List, TLV::ContextTag(kPathTag)));
+        TLV::TLVType path;
+        ReturnErrorOnFailure(reader.EnterContainer(path));
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            uint32_t id;
+            ReturnErrorOnFailure(reader.Get(id));
+            checksum += id;
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(reader.ExitContainer(path));
+
+        uint32_t dataVersion;
+        ReturnErrorOnFailure(reader.Next(TLV::ContextTag(kDataVersionTag)));
+        ReturnErrorOnFailure(reader.Get(dataVersion));
+        checksum += dataVersion;
+
+        ReturnErrorOnFailure(reader.Next(TLV::ContextTag(kValueTag)));
+        switch (reader.GetType())
+        {
+        case TLV::kTLVType_UnsignedInteger: {
+            uint32_t value;
+            ReturnErrorOnFailure(reader.Get(value));
+            checksum += value;
+            break;
+        }
+        case TLV::kTLVType_UTF8String: {
+            CharSpan value;
+            ReturnErrorOnFailure(reader.Get(value));
+            checksum += value.size();
+            break;
+        }
+        case TLV::kTLVType_ByteString: {
+            ByteSpan value;
+            ReturnErrorOnFailure(reader.Get(value));
+            checksum += value.size();
+            break;
+        }
+        default: {
+            bool value;
+            ReturnErrorOnFailure(reader.Get(value));
+            checksum += value ? 1 : 0;
+            break;
+        }
+        }
+
+        ReturnErrorOnFailure(reader.ExitContainer(element));
+        elementCount++;
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return reader.ExitContainer(array);
+}
+
+CHIP_ERROR Skip(size_t encodedLength, size_t & elementCount, const TLV::TLVSkipIndex * skipIndex)
+{
+    TLV::TLVReader reader;
+    reader.Init(gBuffer, encodedLength);
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    reader.SetSkipIndex(skipIndex);
+#else
+    IgnoreUnusedVariable(skipIndex);
+#endif
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+
+    TLV::TLVType array;
+    ReturnErrorOnFailure(reader.EnterContainer(array));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        elementCount++;
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return reader.ExitContainer(array);
+}
+
+CHIP_ERROR EncodeNested(TLV::TLVWriter & writer, TLV::Tag tag, size_t depth)
+{
+    TLV::TLVType level;
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, level));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), static_cast<uint32_t>(depth)));
+    if (depth > 1)
+    {
+        ReturnErrorOnFailure(EncodeNested(writer, TLV::ContextTag(1), depth - 1));
+    }
+    ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(2), kStringValue));
+    return writer.EndContainer(level);
+}
+
+CHIP_ERROR EncodeNested(size_t depth, size_t & encodedLength)
+{
+    TLV::TLVWriter writer;
+    writer.Init(gBuffer);
+    ReturnErrorOnFailure(EncodeNested(writer, TLV::AnonymousTag(), depth));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    encodedLength = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FindOutermostString(size_t encodedLength, const TLV::TLVSkipIndex * skipIndex, size_t & found)
+{
+    TLV::TLVReader reader;
+    reader.Init(gBuffer, encodedLength);
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    reader.SetSkipIndex(skipIndex);
+#else
+    IgnoreUnusedVariable(skipIndex);
+#endif
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+
+    TLV::TLVType level;
+    ReturnErrorOnFailure(reader.EnterContainer(level));
+
+    TLV::TLVReader stringReader;
+    ReturnErrorOnFailure(reader.FindElementWithTag(TLV::ContextTag(2), stringReader));
+    found += stringReader.GetLength();
+    return CHIP_NO_ERROR;
+}
+
+void PrintRates(size_t elementCount, const char * operation, size_t elements, size_t bytes, double seconds)
+{
+    const std::string name(operation);
+    gResults.Print(elementCount, name + "_elements_per_s", Better::kHigher, static_cast<double>(elements) / seconds);
+    if (bytes > 0)
+    {
+        gResults.Print(elementCount, name + "_mb_per_s", Better::kHigher, static_cast<double>(bytes) / seconds / 1e6, 1);
+    }
+}
+
+void RunBenchmark(size_t elementCount)
+{
+    const size_t runs    = kElementsPerRun / elementCount;
+    size_t encodedLength = 0;
+
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < runs; i++)
+    {
+        VerifyOrDie(Encode(elementCount, encodedLength) == CHIP_NO_ERROR);
+    }
+    double seconds = SecondsSince(start);
+    PrintRates(elementCount, "encode", runs * elementCount, runs * encodedLength, seconds);
+
+    size_t decoded    = 0;
+    uint64_t checksum = 0;
+    start             = SteadyClock::now();
+    for (size_t i = 0; i < runs; i++)
+    {
+        VerifyOrDie(Decode(encodedLength, decoded, checksum) == CHIP_NO_ERROR);
+    }
+    seconds = SecondsSince(start);
+    VerifyOrDie(decoded == runs * elementCount && checksum != 0);
+    PrintRates(elementCount, "decode", decoded, runs * encodedLength, seconds);
+
+    size_t skipped = 0;
+    start          = SteadyClock::now();
+    for (size_t i = 0; i < runs; i++)
+    {
+        VerifyOrDie(Skip(encodedLength, skipped, nullptr) == CHIP_NO_ERROR);
+    }
+    seconds = SecondsSince(start);
+    VerifyOrDie(skipped == runs * elementCount);
+    PrintRates(elementCount, "skip", skipped, 0, seconds);
+
+    start = SteadyClock::now();
+    for (size_t i = 0; i < runs; i++)
+    {
+        VerifyOrDie(gSkipIndex.Build(ByteSpan(gBuffer, encodedLength)) == CHIP_NO_ERROR);
+    }
+    seconds = SecondsSince(start);
+    gResults.Print(elementCount, "index_mb_per_s", Better::kHigher, static_cast<double>(runs * encodedLength) / seconds / 1e6, 1);
+
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    skipped = 0;
+    start   = SteadyClock::now();
+    for (size_t i = 0; i < runs; i++)
+    {
+        VerifyOrDie(Skip(encodedLength, skipped, &gSkipIndex) == CHIP_NO_ERROR);
+    }
+    seconds = SecondsSince(start);
+    VerifyOrDie(skipped == runs * elementCount);
+    PrintRates(elementCount, "skip_indexed", skipped, 0, seconds);
+#endif
+}
+
+void RunNestedBenchmark(size_t depth)
+{
+    size_t encodedLength = 0;
+    VerifyOrDie(EncodeNested(depth, encodedLength) == CHIP_NO_ERROR);
+    VerifyOrDie(gSkipIndex.Build(ByteSpan(gBuffer, encodedLength)) == CHIP_NO_ERROR);
+
+    size_t found                  = 0;
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kFindsPerRun; i++)
+    {
+        VerifyOrDie(FindOutermostString(encodedLength, nullptr, found) == CHIP_NO_ERROR);
+    }
+    double seconds = SecondsSince(start);
+    VerifyOrDie(found == kFindsPerRun * strlen(kStringValue));
+    gNestedResults.Print(depth, "find_per_s", Better::kHigher, static_cast<double>(kFindsPerRun) / seconds);
+
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    found = 0;
+    start = SteadyClock::now();
+    for (size_t i = 0; i < kFindsPerRun; i++)
+    {
+        VerifyOrDie(FindOutermostString(encodedLength, &gSkipIndex, found) == CHIP_NO_ERROR);
+    }
+    seconds = SecondsSince(start);
+    VerifyOrDie(found == kFindsPerRun * strlen(kStringValue));
+    gNestedResults.Print(depth, "find_indexed_per_s", Better::kHigher, static_cast<double>(kFindsPerRun) / seconds);
+#endif
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    gResults.PrintHeader();
+    for (size_t elementCount : kElementCounts)
+    {
+        RunBenchmark(elementCount);
+    }
+
+    gNestedResults.PrintHeader();
+    for (size_t depth : kDepths)
+    {
+        RunNestedBenchmark(depth);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -1238,6 +1238,16 @@ void DeviceCommissioner::CancelCommissioningInteractions()
         ChipLogDetail(Controller, "Cancelling CASE setup for step '%s'", StageToString(mCommissioningStage));
         CancelCASECallbacks();
     }
+    CancelDeviceAttestationVerifications();
+}
+
+void DeviceCommissioner::CancelDeviceAttestationVerifications()
+{
+    // Verifiers may still be verifying the attestation information in the background: drop their results.
+    if (mDeviceAttestationVerifier != nullptr)
+    {
+        mDeviceAttestationVerifier->CancelVerifications(&mDeviceAttestationInformationVerificationCallback);
+    }
 }
 
 void DeviceCommissioner::CancelCASECallbacks()
@@ -1409,6 +1419,19 @@ void DeviceCommissioner::OnDeviceAttestationInformationVerification(
     MATTER_TRACE_SCOPE("OnDeviceAttestationInformationVerification", "DeviceCommissioner");
     DeviceCommissioner * commissioner = reinterpret_cast<DeviceCommissioner *>(context);
 
+    if (!commissioner->IsAttestationInformationCurrent(info))
+    {
+        ChipLogError(Controller, "Device attestation verification result does not match the commissioning in progress");
+        VerifyOrReturn(commissioner->mDeviceBeingCommissioned != nullptr);
+        VerifyOrReturn(commissioner->mCommissioningStage == CommissioningStage::kAttestationVerification ||
+                       commissioner->mCommissioningStage == CommissioningStage::kAttestationRevocationCheck);
+
+        // The verifier answered for other attestation information than the one this stage is waiting on: fail the stage.
+        CommissioningDelegate::CommissioningReport report;
+        report.Set<AttestationErrorInfo>(AttestationVerificationResult::kInternalError);
+        return commissioner->CommissioningStageComplete(CHIP_ERROR_FAILED_DEVICE_ATTESTATION, report);
+    }
+
     if (commissioner->mCommissioningStage == CommissioningStage::kAttestationVerification)
     {
         // Check for revoked DAC Chain before calling delegate. Enter next stage.
@@ -2073,6 +2096,8 @@ void DeviceCommissioner::CleanupCommissioning(DeviceProxy * proxy, NodeId nodeId
 
     mCommissioningCompletionStatus = completionStatus;
 
+    CancelDeviceAttestationVerifications();
+
     if (completionStatus.err == CHIP_NO_ERROR)
     {
         // CommissioningStageComplete uses mDeviceBeingCommissioned, which can
@@ -4073,6 +4098,17 @@ bool DeviceCommissioner::IsAttestationInformationMissing(const CommissioningPara
     return false;
 }
 
+bool DeviceCommissioner::IsAttestationInformationCurrent(const Credentials::DeviceAttestationVerifier::AttestationInfo & info)
+{
+    VerifyOrReturnValue(mDefaultCommissioner != nullptr, false);
+
+    // The nonce is picked for each commissioning, and the signature is the one of the device being commissioned.
+    const CommissioningParameters & params = mDefaultCommissioner->GetCommissioningParameters();
+    return params.GetAttestationNonce().HasValue() && params.GetAttestationSignature().HasValue() &&
+        info.attestationNonceBuffer.data_equal(params.GetAttestationNonce().Value()) &&
+        info.attestationSignatureBuffer.data_equal(params.GetAttestationSignature().Value());
+}
+
 CHIP_ERROR DeviceController::GetCompressedFabricIdBytes(MutableByteSpan & outBytes) const
 {
     const auto * fabricInfo = GetFabricInfo();
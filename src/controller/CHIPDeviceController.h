@@ -1127,6 +1127,7 @@ private:
                                              WriteResponseFailureCallback failureCb);
     void CancelCommissioningInteractions();
     void CancelCASECallbacks();
+    void CancelDeviceAttestationVerifications();
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
     void ContinueReadingCommissioningInfo(const CommissioningParameters & params);
@@ -1154,6 +1155,10 @@ private:
 
     bool IsAttestationInformationMissing(const CommissioningParameters & params);
 
+    // Whether an attestation verification result is about the attestation information of the current commissioning:
+    // verifiers may deliver it after that commissioning was stopped and another one started.
+    bool IsAttestationInformationCurrent(const Credentials::DeviceAttestationVerifier::AttestationInfo & info);
+
 #if CHIP_SUPPORT_THREAD_MESHCOP
     CHIP_ERROR PairThreadMeshcop(RendezvousParameters & rendezvousParams, CommissioningParameters & commissioningParams);
 
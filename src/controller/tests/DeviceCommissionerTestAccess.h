@@ -31,6 +31,8 @@ public:
     DeviceCommissionerTestAccess() = delete;
     DeviceCommissionerTestAccess(Controller::DeviceCommissioner * commissioner) : mCommissioner(commissioner) {}
 
+    Controller::AutoCommissioner & GetAutoCommissioner() { return mCommissioner->mAutoCommissioner; }
+
     CHIP_ERROR ParseICDInfo(Controller::ReadCommissioningInfo & info) { return mCommissioner->ParseICDInfo(info); }
 
     void SetAttributeCache(Platform::UniquePtr<app::ClusterStateCache> cache) { mCommissioner->mAttributeCache = std::move(cache); }
@@ -53,6 +55,13 @@ public:
         Controller::DeviceCommissioner::OnICDManagementStayActiveResponse(commissioner, data);
     }
 
+    static void OnDeviceAttestationInformationVerification(Controller::DeviceCommissioner * commissioner,
+                                                           const Credentials::DeviceAttestationVerifier::AttestationInfo & info,
+                                                           Credentials::AttestationVerificationResult result)
+    {
+        Controller::DeviceCommissioner::OnDeviceAttestationInformationVerification(commissioner, info, result);
+    }
+
 private:
     Controller::DeviceCommissioner * mCommissioner = nullptr;
 };
@@ -18,9 +18,13 @@
 
 #include <pw_unit_test/framework.h>
 
+#include <app/DeviceProxy.h>
 #include <controller/AutoCommissioner.h>
+#include <controller/CHIPDeviceController.h>
 #include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
 #include <controller/tests/AutoCommissionerTestAccess.h>
+#include <controller/tests/DeviceCommissionerTestAccess.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <cstring>
 #include <lib/core/StringBuilderAdapters.h>
@@ -688,4 +692,98 @@ TEST_F(AutoCommissionerTest, IsSecondaryNetworkSupportedCombinations)
         EXPECT_EQ(result, c.isSecondaryNetworkSupported);
     }
 }
+
+class AttestationDeviceProxy : public DeviceProxy
+{
+public:
+    void Disconnect() override {}
+    NodeId GetDeviceId() const override { return 0x12344321; }
+    Messaging::ExchangeManager * GetExchangeManager() const override { return nullptr; }
+    chip::Optional<SessionHandle> GetSecureSession() const override { return NullOptional; }
+
+protected:
+    bool IsSecureConnected() const override { return false; }
+};
+
+class AttestationPairingDelegate : public DevicePairingDelegate
+{
+public:
+    void OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error) override
+    {
+        mStatusUpdateCount++;
+        mLastStageCompleted = stageCompleted;
+        mLastError          = error;
+    }
+
+    int mStatusUpdateCount                 = 0;
+    CommissioningStage mLastStageCompleted = CommissioningStage::kError;
+    CHIP_ERROR mLastError                  = CHIP_NO_ERROR;
+};
+
+// Attestation verification results delivered to the DeviceCommissioner, for the commissioning in progress or for a
+// previous one.
+class AutoCommissionerAttestationTest : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+protected:
+    void SetUp() override
+    {
+        DeviceCommissionerTestAccess access(&mCommissioner);
+        mCommissioner.RegisterPairingDelegate(&mDelegate);
+        access.SetCommissioningStage(CommissioningStage::kAttestationVerification);
+        access.SetDeviceBeingCommissioned(&mDevice);
+
+        AutoCommissionerTestAccess(&access.GetAutoCommissioner())
+            .AccessParams()
+            .SetAttestationNonce(ByteSpan(kNonce))
+            .SetAttestationSignature(ByteSpan(kSignature));
+    }
+
+    void DeliverResult(const ByteSpan & nonce, const ByteSpan & signature)
+    {
+        Credentials::DeviceAttestationVerifier::AttestationInfo info(ByteSpan(), ByteSpan(), signature, ByteSpan(), ByteSpan(),
+                                                                     nonce, VendorId::TestVendor1, 0x8000);
+        DeviceCommissionerTestAccess::OnDeviceAttestationInformationVerification(
+            &mCommissioner, info, Credentials::AttestationVerificationResult::kSuccess);
+    }
+
+    static constexpr uint8_t kNonce[kAttestationNonceLength]                        = { 0x01 };
+    static constexpr uint8_t kSignature[Crypto::kP256_ECDSA_Signature_Length_Raw] = { 0x02 };
+    static constexpr uint8_t kPreviousNonce[kAttestationNonceLength]                = { 0x03 };
+
+    AttestationDeviceProxy mDevice;
+    AttestationPairingDelegate mDelegate;
+    DeviceCommissioner mCommissioner{};
+};
+
+TEST_F(AutoCommissionerAttestationTest, CurrentResultCompletesStage)
+{
+    DeliverResult(ByteSpan(kNonce), ByteSpan(kSignature));
+
+    EXPECT_EQ(mDelegate.mStatusUpdateCount, 1);
+    EXPECT_EQ(mDelegate.mLastStageCompleted, CommissioningStage::kAttestationVerification);
+    EXPECT_EQ(mDelegate.mLastError, CHIP_NO_ERROR);
+}
+
+// A successful result for the attestation information of a previous commissioning must not let this one proceed.
+TEST_F(AutoCommissionerAttestationTest, StaleResultFailsStage)
+{
+    DeliverResult(ByteSpan(kPreviousNonce), ByteSpan(kSignature));
+
+    EXPECT_EQ(mDelegate.mStatusUpdateCount, 1);
+    EXPECT_EQ(mDelegate.mLastStageCompleted, CommissioningStage::kAttestationVerification);
+    EXPECT_EQ(mDelegate.mLastError, CHIP_ERROR_FAILED_DEVICE_ATTESTATION);
+}
+
+TEST_F(AutoCommissionerAttestationTest, StaleResultOutsideAttestationIsIgnored)
+{
+    DeviceCommissionerTestAccess(&mCommissioner).SetCommissioningStage(CommissioningStage::kSendNOC);
+
+    DeliverResult(ByteSpan(kPreviousNonce), ByteSpan(kSignature));
+
+    EXPECT_EQ(mDelegate.mStatusUpdateCount, 0);
+}
 } // namespace
@@ -412,6 +412,12 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
     // succeeds, the current certificate is valid.
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    if (context.mVerifiedCertificateCache != nullptr)
+    {
+        ExitNow(err = context.mVerifiedCertificateCache->VerifyCertSignature(*cert, *caCert));
+    }
+#endif
     err = VerifyCertSignature(*cert, *caCert);
     SuccessOrExit(err);
 
@@ -503,6 +509,9 @@ void ValidationContext::Reset()
     mEffectiveTime  = EffectiveTime{};
     mTrustAnchor    = nullptr;
     mValidityPolicy = nullptr;
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    mVerifiedCertificateCache = nullptr;
+#endif
     mRequiredKeyUsages.ClearAll();
     mRequiredKeyPurposes.ClearAll();
     mRequiredCertType = CertType::kNotSpecified;
@@ -32,6 +32,7 @@
 
 #include "CHIPCert.h"
 #include "CertificateValidityPolicy.h"
+#include "VerifiedCertificateCache.h"
 #include <lib/support/Variant.h>
 
 namespace chip {
@@ -74,6 +75,10 @@ struct ValidationContext
 
     CertificateValidityPolicy * mValidityPolicy =
         nullptr; /**< Optional application policy to apply for certificate validity period evaluation. */
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    VerifiedCertificateCache * mVerifiedCertificateCache =
+        nullptr; /**< Optional cache of the certificate signatures already verified, e.g. the one of a FabricTable. */
+#endif
 
     void Reset();
 
@@ -780,6 +780,10 @@ public:
 CHIP_ERROR FabricTable::NotifyFabricUpdated(FabricIndex fabricIndex)
 {
     MATTER_TRACE_SCOPE("NotifyFabricUpdated", "Fabric");
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    mVerifiedCertificateCache.Invalidate();
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
     FabricTable::Delegate * delegate = mDelegateListRoot;
     while (delegate)
     {
@@ -795,6 +799,9 @@ CHIP_ERROR FabricTable::NotifyFabricUpdated(FabricIndex fabricIndex)
 CHIP_ERROR FabricTable::NotifyFabricCommitted(FabricIndex fabricIndex)
 {
     MATTER_TRACE_SCOPE("NotifyFabricCommitted", "Fabric");
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    mVerifiedCertificateCache.Invalidate();
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
 
     FabricTable::Delegate * delegate = mDelegateListRoot;
     while (delegate)
@@ -1037,6 +1044,10 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
         }
     }
 
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    mVerifiedCertificateCache.Invalidate();
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
     if (mDelegateListRoot != nullptr)
     {
         FabricTable::Delegate * delegate = mDelegateListRoot;
@@ -2084,6 +2095,9 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
 void FabricTable::RevertPendingFabricData()
 {
     MATTER_TRACE_SCOPE("RevertPendingFabricData", "Fabric");
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    mVerifiedCertificateCache.Invalidate();
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
     // Will clear pending UpdateNoc/AddNOC
     RevertPendingOpCertsExceptRoot();
 
@@ -1016,6 +1016,17 @@ public:
     static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
                                         CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                         Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    /**
+     * @brief Get the cache of certificate signatures verified against the trusted roots of this fabric table.
+     *
+     * To be set in the ValidationContext of certificate chains validated against a root of this fabric table, e.g. by
+     * CASE. The cache is cleared on every change to the fabric table.
+     */
+    Credentials::VerifiedCertificateCache & GetVerifiedCertificateCache() const { return mVerifiedCertificateCache; }
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1298,6 +1309,11 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    // Mutable: only a cache, handed out by the const GetVerifiedCertificateCache().
+    mutable Credentials::VerifiedCertificateCache mVerifiedCertificateCache;
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
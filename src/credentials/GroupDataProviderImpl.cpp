@@ -17,13 +17,17 @@
 #include <credentials/GroupDataProviderImpl.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/CommonPersistentData.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/PersistentData.h>
 #include <lib/support/Pool.h>
 #include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
 #include <stdlib.h>
+#include <string.h>
 
 namespace chip {
 namespace Credentials {
@@ -375,6 +379,20 @@ struct GroupData : public GroupDataProvider::GroupInfo, PersistableData<kPersist
         return false;
     }
 
+    // Same as Get(), given the ids of the fabric's groups in list order instead of walking the list.
+    bool LoadAt(PersistentStorageDelegate * storage, const FabricData & fabric, const GroupId * group_ids, size_t target_index)
+    {
+        fabric_index = fabric.fabric_index;
+        group_id     = group_ids[target_index];
+        index        = static_cast<uint16_t>(target_index);
+        first        = (target_index == 0);
+        if (!first)
+        {
+            prev = group_ids[target_index - 1];
+        }
+        return CHIP_NO_ERROR == Load(storage);
+    }
+
     bool Find(PersistentStorageDelegate * storage, const FabricData & fabric, chip::GroupId target_group)
     {
         fabric_index = fabric.fabric_index;
@@ -855,12 +873,26 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    ClearIndexes();
+    mStorageCache.Clear();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
-    mStorage = storage;
+    mStorageCache.SetBackingStorage(storage);
+    mStorage = mStorageCacheEnabled ? &mStorageCache : storage;
+}
+
+void GroupDataProviderImpl::SetStorageCacheEnabled(bool enabled)
+{
+    mStorageCacheEnabled = enabled;
+    ClearIndexes();
+    mStorageCache.Clear();
+    if (mStorage != nullptr)
+    {
+        mStorage = enabled ? &mStorageCache : mStorageCache.GetBackingStorage();
+    }
 }
 
 //
@@ -904,7 +936,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfo(chip::FabricIndex fabric_index, c
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
     info.count = fabric.group_count;
-    VerifyOrReturnError(group.Find(mStorage, fabric, group_id), CHIP_ERROR_NOT_FOUND);
+    VerifyOrReturnError(FindGroup(fabric, group_id, group), CHIP_ERROR_NOT_FOUND);
 
     info.Copy(group);
     return CHIP_NO_ERROR;
@@ -998,7 +1030,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index,
     GroupData group;
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
-    VerifyOrReturnError(group.Get(mStorage, fabric, index), CHIP_ERROR_NOT_FOUND);
+    VerifyOrReturnError(GetGroupAt(fabric, index, group), CHIP_ERROR_NOT_FOUND);
 
     // Target group found
     info.Copy(group);
@@ -1069,7 +1101,7 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
     EndpointData endpoint;
 
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), false);
-    VerifyOrReturnError(group.Find(mStorage, fabric, group_id), false);
+    VerifyOrReturnError(FindGroup(fabric, group_id, group), false);
     return endpoint.Find(mStorage, fabric, group, endpoint_id);
 }
 
@@ -1991,6 +2023,13 @@ GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGrou
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+    if (provider.UseSessionIndex())
+    {
+        mIndexed         = true;
+        mIndexGeneration = provider.mSessionIndexGeneration;
+        return;
+    }
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -2003,9 +2042,21 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
-    FabricData fabric(mFirstFabric);
     size_t count = 0;
 
+    if (mIndexed)
+    {
+        // The index was replaced after a write, see Next().
+        VerifyOrReturnValue(mIndexGeneration == mProvider.mSessionIndexGeneration, 0);
+        for (size_t i = 0; i < mProvider.mIndexedSessionCount; i++)
+        {
+            count += (mProvider.mIndexedSessions[i].hash == mSessionId) ? 1 : 0;
+        }
+        return count;
+    }
+
+    FabricData fabric(mFirstFabric);
+
     for (size_t i = 0; i < mFabricTotal; i++, fabric.fabric_index = fabric.next)
     {
         if (CHIP_NO_ERROR != fabric.Load(mProvider.mStorage))
@@ -2044,6 +2095,32 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+    if (mIndexed)
+    {
+        // Modifying the group tables while iterating is not supported. The storage walk would carry on over the modified
+        // records; the index it was iterating may be gone, so end the iteration instead.
+        VerifyOrReturnValue(mIndexGeneration == mProvider.mSessionIndexGeneration, false);
+
+        while (mIndexPosition < mProvider.mIndexedSessionCount)
+        {
+            const IndexedSession & session = mProvider.mIndexedSessions[mIndexPosition++];
+            if (session.hash != mSessionId)
+            {
+                continue;
+            }
+
+            const IndexedKeySet & keyset                      = mProvider.mIndexedKeySets[session.keyset];
+            const Crypto::GroupOperationalCredentials & creds = keyset.keys[session.key_index];
+            TEMPORARY_RETURN_IGNORED mGroupKeyContext.Initialize(creds.encryption_key, mSessionId, creds.privacy_key);
+            output.fabric_index    = session.fabric_index;
+            output.group_id        = session.group_id;
+            output.security_policy = keyset.policy;
+            output.keyContext      = &mGroupKeyContext;
+            return true;
+        }
+        return false;
+    }
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -2102,6 +2179,201 @@ void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
     mProvider.mGroupSessionsIterator.ReleaseObject(this);
 }
 
+const GroupDataProviderImpl::GroupOrder * GroupDataProviderImpl::GetGroupOrder(const FabricData & fabric)
+{
+    VerifyOrReturnValue(mStorageCacheEnabled, nullptr);
+    const uint32_t generation = mStorageCache.GetGeneration();
+
+    GroupOrder * order = nullptr;
+    for (auto & candidate : mGroupOrders)
+    {
+        if (candidate.fabric_index == fabric.fabric_index)
+        {
+            order = &candidate;
+            break;
+        }
+        if (order == nullptr && (candidate.fabric_index == kUndefinedFabricIndex || candidate.generation != generation))
+        {
+            // Free or stale, reusable unless the fabric already has a slot further on.
+            order = &candidate;
+        }
+    }
+    VerifyOrReturnValue(order != nullptr, nullptr);
+    if (order->fabric_index == fabric.fabric_index && order->generation == generation && order->count == fabric.group_count)
+    {
+        return order;
+    }
+
+    // (Re)build from the list, which is read from the cache.
+    order->fabric_index = kUndefinedFabricIndex;
+    auto * group_ids    = static_cast<GroupId *>(
+        Platform::MemoryRealloc(order->group_ids, sizeof(GroupId) * std::max<size_t>(fabric.group_count, 1)));
+    VerifyOrReturnValue(group_ids != nullptr, nullptr);
+    order->group_ids = group_ids;
+
+    GroupData group(fabric.fabric_index, fabric.first_group);
+    for (uint16_t i = 0; i < fabric.group_count; i++, group.group_id = group.next)
+    {
+        VerifyOrReturnValue(CHIP_NO_ERROR == group.Load(mStorage), nullptr);
+        order->group_ids[i] = group.group_id;
+    }
+
+    order->fabric_index = fabric.fabric_index;
+    order->generation   = generation;
+    order->count        = fabric.group_count;
+    return order;
+}
+
+bool GroupDataProviderImpl::FindGroup(const FabricData & fabric, GroupId group_id, GroupData & group)
+{
+    const GroupOrder * order = GetGroupOrder(fabric);
+    VerifyOrReturnValue(order != nullptr, group.Find(mStorage, fabric, group_id));
+
+    for (size_t i = 0; i < order->count; i++)
+    {
+        if (order->group_ids[i] == group_id)
+        {
+            return group.LoadAt(mStorage, fabric, order->group_ids, i);
+        }
+    }
+    return false;
+}
+
+bool GroupDataProviderImpl::GetGroupAt(const FabricData & fabric, size_t index, GroupData & group)
+{
+    const GroupOrder * order = GetGroupOrder(fabric);
+    VerifyOrReturnValue(order != nullptr, group.Get(mStorage, fabric, index));
+    VerifyOrReturnValue(index < order->count, false);
+    return group.LoadAt(mStorage, fabric, order->group_ids, index);
+}
+
+bool GroupDataProviderImpl::UseSessionIndex()
+{
+    VerifyOrReturnValue(mStorageCacheEnabled, false);
+    VerifyOrReturnValue(mSessionIndexGeneration != mStorageCache.GetGeneration(), true);
+
+    CHIP_ERROR err = BuildSessionIndex();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(NotSpecified, "Failed to index group sessions, walking storage instead: %" CHIP_ERROR_FORMAT, err.Format());
+        return false;
+    }
+    return true;
+}
+
+CHIP_ERROR GroupDataProviderImpl::BuildSessionIndex()
+{
+    // Outstanding indexed iterators notice the generation change and stop.
+    mSessionIndexGeneration = 0;
+    if (mIndexedKeySets != nullptr)
+    {
+        Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(mIndexedKeySets), sizeof(IndexedKeySet) * mIndexedKeySetCount);
+    }
+    mIndexedKeySetCount  = 0;
+    mIndexedSessionCount = 0;
+
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
+    if (CHIP_ERROR_NOT_FOUND == err)
+    {
+        fabric_list.entry_count = 0;
+    }
+
+    // Size the arrays first, then fill them, both passes being served from the cache.
+    size_t keyset_total  = 0;
+    size_t session_total = 0;
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+        keyset_total += fabric.keyset_count;
+        session_total += static_cast<size_t>(fabric.map_count) * KeySet::kEpochKeysMax;
+    }
+
+    auto * keysets = static_cast<IndexedKeySet *>(
+        Platform::MemoryRealloc(mIndexedKeySets, sizeof(IndexedKeySet) * std::max<size_t>(keyset_total, 1)));
+    VerifyOrReturnError(keysets != nullptr, CHIP_ERROR_NO_MEMORY);
+    mIndexedKeySets = keysets;
+    auto * sessions = static_cast<IndexedSession *>(
+        Platform::MemoryRealloc(mIndexedSessions, sizeof(IndexedSession) * std::max<size_t>(session_total, 1)));
+    VerifyOrReturnError(sessions != nullptr, CHIP_ERROR_NO_MEMORY);
+    mIndexedSessions = sessions;
+
+    // Like the storage walk, the sessions end at the first mapping that cannot be resolved.
+    bool complete       = true;
+    fabric.fabric_index = fabric_list.first_entry;
+    for (size_t i = 0; complete && i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+        const size_t first_keyset = mIndexedKeySetCount;
+
+        KeySetData keyset(fabric.fabric_index, fabric.first_keyset);
+        for (uint16_t j = 0; j < fabric.keyset_count && mIndexedKeySetCount < keyset_total; j++, keyset.keyset_id = keyset.next)
+        {
+            ReturnErrorOnFailure(keyset.Load(mStorage));
+            IndexedKeySet & indexed = mIndexedKeySets[mIndexedKeySetCount++];
+            indexed.fabric_index    = fabric.fabric_index;
+            indexed.keyset_id       = keyset.keyset_id;
+            indexed.policy          = keyset.policy;
+            indexed.keys_count      = std::min<uint8_t>(keyset.keys_count, KeySet::kEpochKeysMax);
+            memcpy(indexed.keys, keyset.operational_keys, sizeof(indexed.keys));
+        }
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; complete && j < fabric.map_count; j++, mapping.id = mapping.next)
+        {
+            size_t slot = first_keyset;
+            complete    = (CHIP_NO_ERROR == mapping.Load(mStorage));
+            while (complete && slot < mIndexedKeySetCount && mIndexedKeySets[slot].keyset_id != mapping.keyset_id)
+            {
+                slot++;
+            }
+            complete = complete && (slot < mIndexedKeySetCount);
+
+            for (uint8_t k = 0; complete && k < mIndexedKeySets[slot].keys_count; k++)
+            {
+                IndexedSession & session = mIndexedSessions[mIndexedSessionCount++];
+                session.hash             = mIndexedKeySets[slot].keys[k].hash;
+                session.fabric_index     = fabric.fabric_index;
+                session.group_id         = mapping.group_id;
+                session.keyset           = static_cast<uint16_t>(slot);
+                session.key_index        = k;
+            }
+        }
+    }
+
+    mSessionIndexGeneration = mStorageCache.GetGeneration();
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::ClearIndexes()
+{
+    for (auto & order : mGroupOrders)
+    {
+        if (order.group_ids != nullptr)
+        {
+            Platform::MemoryFree(order.group_ids);
+        }
+        order = GroupOrder();
+    }
+
+    if (mIndexedKeySets != nullptr)
+    {
+        Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(mIndexedKeySets), sizeof(IndexedKeySet) * mIndexedKeySetCount);
+        Platform::MemoryFree(mIndexedKeySets);
+        mIndexedKeySets = nullptr;
+    }
+    if (mIndexedSessions != nullptr)
+    {
+        Platform::MemoryFree(mIndexedSessions);
+        mIndexedSessions = nullptr;
+    }
+    mIndexedKeySetCount     = 0;
+    mIndexedSessionCount    = 0;
+    mSessionIndexGeneration = 0;
+}
+
 namespace {
 
 GroupDataProvider * gGroupsProvider = nullptr;
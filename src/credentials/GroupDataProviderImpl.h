@@ -17,6 +17,7 @@
 #pragma once
 
 #include <credentials/GroupDataProvider.h>
+#include <credentials/GroupDataStorageCache.h>
 #include <crypto/SessionKeystore.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/Pool.h>
@@ -24,6 +25,9 @@
 namespace chip {
 namespace Credentials {
 
+struct FabricData;
+struct GroupData;
+
 class GroupDataProviderImpl : public GroupDataProvider
 {
 public:
@@ -41,7 +45,6 @@ public:
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
         GroupDataProvider(maxGroupsPerFabric, maxGroupKeysPerFabric)
     {}
-    ~GroupDataProviderImpl() override {}
 
     /**
      * @brief Set the storage implementation used for non-volatile storage of configuration data.
@@ -51,6 +54,22 @@ public:
      */
     void SetStorageDelegate(PersistentStorageDelegate * storage);
 
+    /**
+     * @brief Serve the group tables from a write-through RAM copy of their storage records instead of reading
+     *        storage on every lookup and iterator step. Records are loaded on first use and updated by every
+     *        mutation made through this provider, so nothing else may modify the provider's keys in the storage
+     *        delegate while the cache is enabled. Disabled by default; the RAM used grows with the number of
+     *        groups, endpoints and key sets configured.
+     *
+     *        The cache memory is released by Finish(), not by the destructor, which may run after
+     *        Platform::MemoryShutdown().
+     *
+     * @param enabled Whether reads go through the cache. Disabling the cache releases its memory.
+     */
+    void SetStorageCacheEnabled(bool enabled);
+    bool IsStorageCacheEnabled() const { return mStorageCacheEnabled; }
+    const GroupDataStorageCache::Stats & GetStorageCacheStats() const { return mStorageCache.GetStats(); }
+
     void SetSessionKeystore(Crypto::SessionKeystore * keystore) { mSessionKeystore = keystore; }
     Crypto::SessionKeystore * GetSessionKeystore() const { return mSessionKeystore; }
 
@@ -271,10 +290,60 @@ protected:
         uint16_t mKeyIndex       = 0;
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
+        // Set if iterating the session index of mProvider, see UseSessionIndex().
+        bool mIndexed             = false;
+        uint32_t mIndexGeneration = 0;
+        size_t mIndexPosition     = 0;
         GroupKeyContext mGroupKeyContext;
     };
 
-    PersistentStorageDelegate * mStorage       = nullptr;
+    //
+    // RAM indexes, only used while the storage cache is enabled. They are built from the cached records on first use and
+    // are stale as soon as anything is written through the cache (GroupDataStorageCache::GetGeneration() changes), so
+    // only read-only operations use them and mutations keep walking the records.
+    //
+
+    // Ids of the groups of a fabric in list order, so that finding a group loads one record instead of walking the list.
+    struct GroupOrder
+    {
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        uint32_t generation      = 0;
+        uint16_t count           = 0;
+        GroupId * group_ids      = nullptr;
+    };
+
+    // Decoded key set, so that finding the keys of a session does not decode the key set and re-derive its privacy keys.
+    struct IndexedKeySet
+    {
+        FabricIndex fabric_index;
+        KeysetId keyset_id;
+        SecurityPolicy policy;
+        uint8_t keys_count;
+        Crypto::GroupOperationalCredentials keys[KeySet::kEpochKeysMax];
+    };
+
+    // One (group, key) pair of every fabric, in the order the group session iterator visits them.
+    struct IndexedSession
+    {
+        uint16_t hash;
+        FabricIndex fabric_index;
+        GroupId group_id;
+        uint16_t keyset;
+        uint8_t key_index;
+    };
+
+    const GroupOrder * GetGroupOrder(const FabricData & fabric);
+    bool FindGroup(const FabricData & fabric, GroupId group_id, GroupData & group);
+    bool GetGroupAt(const FabricData & fabric, size_t index, GroupData & group);
+    // Returns whether the session index is up to date, building it if needed.
+    bool UseSessionIndex();
+    CHIP_ERROR BuildSessionIndex();
+    void ClearIndexes();
+
+    // Either the storage delegate set by SetStorageDelegate() or mStorageCache in front of it.
+    PersistentStorageDelegate * mStorage = nullptr;
+    GroupDataStorageCache mStorageCache;
+    bool mStorageCacheEnabled                  = false;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
     ObjectPool<GroupKeyIteratorImpl, kIteratorsMax> mGroupKeyIterators;
@@ -283,6 +352,13 @@ protected:
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
     bool mAuxAclNotificationNeeded = false;
+
+    GroupOrder mGroupOrders[CHIP_CONFIG_MAX_FABRICS];
+    IndexedKeySet * mIndexedKeySets   = nullptr;
+    size_t mIndexedKeySetCount        = 0;
+    IndexedSession * mIndexedSessions = nullptr;
+    size_t mIndexedSessionCount       = 0;
+    uint32_t mSessionIndexGeneration  = 0;
 };
 
 } // namespace Credentials
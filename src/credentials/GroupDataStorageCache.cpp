@@ -0,0 +1,270 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <credentials/GroupDataStorageCache.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+void GroupDataStorageCache::SetBackingStorage(PersistentStorageDelegate * storage)
+{
+    Clear();
+    mBackingStorage = storage;
+}
+
+void GroupDataStorageCache::Clear()
+{
+    mGeneration++;
+
+    VerifyOrReturn(mSlots != nullptr);
+
+    for (size_t i = 0; i < mSlotCount; i++)
+    {
+        FreeRecord(mSlots[i]);
+    }
+    Platform::MemoryFree(mSlots);
+    mSlots     = nullptr;
+    mSlotCount = 0;
+    mCount     = 0;
+}
+
+uint32_t GroupDataStorageCache::Hash(const char * key, size_t keyLength)
+{
+    // 32-bit FNV-1a: storage keys are short strings that mostly differ in their last few characters.
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < keyLength; i++)
+    {
+        hash ^= static_cast<uint8_t>(key[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void GroupDataStorageCache::FreeRecord(Record * record)
+{
+    VerifyOrReturn(record != nullptr);
+    Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(record), sizeof(Record) + record->keyLength + 1 + record->valueSize);
+    Platform::MemoryFree(record);
+}
+
+GroupDataStorageCache::Record ** GroupDataStorageCache::FindSlot(const char * key, size_t keyLength, uint32_t hash) const
+{
+    const size_t mask = mSlotCount - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask)
+    {
+        Record * record = mSlots[i];
+        if (record == nullptr ||
+            (record->hash == hash && record->keyLength == keyLength && memcmp(record->Key(), key, keyLength) == 0))
+        {
+            return &mSlots[i];
+        }
+    }
+}
+
+bool GroupDataStorageCache::Grow()
+{
+    const size_t slotCount = (mSlotCount == 0) ? kInitialSlotCount : mSlotCount * 2;
+    auto ** slots          = static_cast<Record **>(Platform::MemoryCalloc(slotCount, sizeof(Record *)));
+    VerifyOrReturnValue(slots != nullptr, false);
+
+    const size_t mask = slotCount - 1;
+    for (size_t i = 0; i < mSlotCount; i++)
+    {
+        Record * record = mSlots[i];
+        if (record != nullptr)
+        {
+            size_t slot = record->hash & mask;
+            while (slots[slot] != nullptr)
+            {
+                slot = (slot + 1) & mask;
+            }
+            slots[slot] = record;
+        }
+    }
+
+    Platform::MemoryFree(mSlots);
+    mSlots     = slots;
+    mSlotCount = slotCount;
+    return true;
+}
+
+void GroupDataStorageCache::Store(const char * key, const void * value, uint16_t size, bool present)
+{
+    const size_t keyLength = strlen(key);
+    if (keyLength > PersistentStorageDelegate::kKeyLengthMax || ((mCount + 1) * 2 > mSlotCount && !Grow()))
+    {
+        Invalidate(key);
+        return;
+    }
+
+    const uint32_t hash = Hash(key, keyLength);
+    Record ** slot      = FindSlot(key, keyLength, hash);
+
+    // Rewriting a record of the same size, by far the most common update, reuses it without touching the allocator.
+    // Otherwise a new record is allocated rather than reallocated, so that no copy of the old value is left behind
+    // on the heap unwiped.
+    Record * record = *slot;
+    if (record == nullptr || record->valueSize != size)
+    {
+        record = static_cast<Record *>(Platform::MemoryAlloc(sizeof(Record) + keyLength + 1 + size));
+        if (record == nullptr)
+        {
+            // Drop the stale record, if any.
+            RemoveSlot(static_cast<size_t>(slot - mSlots));
+            return;
+        }
+    }
+
+    if (*slot == nullptr)
+    {
+        mCount++;
+    }
+    else if (*slot != record)
+    {
+        FreeRecord(*slot);
+    }
+    *slot             = record;
+    record->hash      = hash;
+    record->keyLength = static_cast<uint16_t>(keyLength);
+    record->valueSize = size;
+    record->present   = present;
+    memcpy(record->Key(), key, keyLength + 1);
+    if (size > 0)
+    {
+        memcpy(record->Value(), value, size);
+    }
+}
+
+void GroupDataStorageCache::Invalidate(const char * key)
+{
+    VerifyOrReturn(mCount > 0);
+
+    const size_t keyLength = strlen(key);
+    Record ** slot         = FindSlot(key, keyLength, Hash(key, keyLength));
+    if (*slot != nullptr)
+    {
+        RemoveSlot(static_cast<size_t>(slot - mSlots));
+    }
+}
+
+void GroupDataStorageCache::RemoveSlot(size_t slot)
+{
+    VerifyOrReturn(mSlots[slot] != nullptr);
+    FreeRecord(mSlots[slot]);
+    mSlots[slot] = nullptr;
+    mCount--;
+
+    // Backward shift deletion: move up every following record of the run whose home slot is not between the hole
+    // and its current slot, so that lookups never stop early at the hole.
+    const size_t mask = mSlotCount - 1;
+    size_t hole       = slot;
+    for (size_t i = (slot + 1) & mask; mSlots[i] != nullptr; i = (i + 1) & mask)
+    {
+        const size_t home = mSlots[i]->hash & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            mSlots[hole] = mSlots[i];
+            mSlots[i]    = nullptr;
+            hole         = i;
+        }
+    }
+}
+
+CHIP_ERROR GroupDataStorageCache::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError((buffer != nullptr) || (size == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mCount > 0)
+    {
+        const size_t keyLength = strlen(key);
+        Record * record        = *FindSlot(key, keyLength, Hash(key, keyLength));
+        if (record != nullptr)
+        {
+            mStats.hits++;
+            VerifyOrReturnError(record->present, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+            const uint16_t valueSize = record->valueSize;
+            VerifyOrReturnError(size != 0 || valueSize != 0, CHIP_NO_ERROR);
+            VerifyOrReturnError(buffer != nullptr, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+            size = std::min(size, valueSize);
+            memcpy(buffer, record->Value(), size);
+            return size < valueSize ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+        }
+    }
+
+    mStats.misses++;
+    CHIP_ERROR err = mBackingStorage->SyncGetKeyValue(key, buffer, size);
+    if (err == CHIP_NO_ERROR)
+    {
+        Store(key, buffer, size, true);
+    }
+    else if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        Store(key, nullptr, 0, false);
+    }
+    // A truncated read does not tell us the whole value, and other errors may be transient: leave those uncached.
+    return err;
+}
+
+CHIP_ERROR GroupDataStorageCache::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mGeneration++;
+    CHIP_ERROR err = mBackingStorage->SyncSetKeyValue(key, value, size);
+    if (err == CHIP_NO_ERROR)
+    {
+        Store(key, value, size, true);
+    }
+    else
+    {
+        // The write may have partially happened, we no longer know what storage holds.
+        Invalidate(key);
+    }
+    return err;
+}
+
+CHIP_ERROR GroupDataStorageCache::SyncDeleteKeyValue(const char * key)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mGeneration++;
+    CHIP_ERROR err = mBackingStorage->SyncDeleteKeyValue(key);
+    if (err == CHIP_NO_ERROR || err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        Store(key, nullptr, 0, false);
+    }
+    else
+    {
+        Invalidate(key);
+    }
+    return err;
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,126 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * Write-through RAM copy of the records that GroupDataProviderImpl keeps in persistent storage.
+ *
+ * Every record is read from the backing storage the first time it is needed and then served from a hash table
+ * keyed by its storage key. Keys that are not in storage are remembered too, since the provider probes for
+ * missing records (e.g. fabrics without groups) as often as it reads existing ones. Writes and deletes go to the
+ * backing storage first and only update the cached copy once the backing storage has accepted them; a failed
+ * write drops the cached copy so the next read goes back to storage.
+ *
+ * The cache assumes that it is the only writer of the keys it serves. Records live on the heap and are only
+ * released by Clear(), which must be called before Platform::MemoryShutdown(): the destructor does not release
+ * them, since providers are commonly destroyed after the platform memory is shut down. Records hold group keys
+ * and are wiped before being released.
+ */
+class GroupDataStorageCache : public PersistentStorageDelegate
+{
+public:
+    struct Stats
+    {
+        // Reads answered from RAM.
+        uint32_t hits = 0;
+        // Reads that had to go to the backing storage.
+        uint32_t misses = 0;
+    };
+
+    GroupDataStorageCache()           = default;
+    ~GroupDataStorageCache() override = default;
+
+    GroupDataStorageCache(const GroupDataStorageCache &)             = delete;
+    GroupDataStorageCache & operator=(const GroupDataStorageCache &) = delete;
+
+    /**
+     * @brief Sets the storage that records are read from and written through to. Drops every cached record.
+     */
+    void SetBackingStorage(PersistentStorageDelegate * storage);
+    PersistentStorageDelegate * GetBackingStorage() const { return mBackingStorage; }
+
+    /**
+     * @brief Releases every cached record. The next read of each key goes to the backing storage.
+     */
+    void Clear();
+
+    /**
+     * @brief Changes whenever the cached records may have changed: on every write or delete, and when the cache is
+     *        cleared. Lets users keep data derived from the records and tell when it is stale.
+     */
+    uint32_t GetGeneration() const { return mGeneration; }
+
+    size_t GetRecordCount() const { return mCount; }
+    const Stats & GetStats() const { return mStats; }
+    void ResetStats() { mStats = Stats(); }
+
+    // PersistentStorageDelegate overrides.
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+
+private:
+    // A cached record is a single allocation: this header, the NUL terminated key, then the value.
+    struct Record
+    {
+        uint32_t hash;
+        uint16_t keyLength;
+        uint16_t valueSize;
+        // False if the key is known not to be in the backing storage.
+        bool present;
+
+        char * Key() { return reinterpret_cast<char *>(this + 1); }
+        uint8_t * Value() { return reinterpret_cast<uint8_t *>(Key() + keyLength + 1); }
+    };
+
+    static constexpr size_t kInitialSlotCount = 64;
+
+    static uint32_t Hash(const char * key, size_t keyLength);
+    // Wipes and releases record, which may be null.
+    static void FreeRecord(Record * record);
+
+    // Returns the slot holding key, or the empty slot where it would be inserted.
+    Record ** FindSlot(const char * key, size_t keyLength, uint32_t hash) const;
+    // Stores (or replaces) the cached copy of key. Failing to allocate leaves the key uncached, which is always safe.
+    void Store(const char * key, const void * value, uint16_t size, bool present);
+    // Drops the cached copy of key, if any.
+    void Invalidate(const char * key);
+    // Empties slot, moving back the records that follow it in its probe run.
+    void RemoveSlot(size_t slot);
+    bool Grow();
+
+    PersistentStorageDelegate * mBackingStorage = nullptr;
+    // Open addressing with linear probing; mSlotCount is a power of two and at most half of the slots are used.
+    Record ** mSlots  = nullptr;
+    size_t mSlotCount = 0;
+    size_t mCount     = 0;
+    // Starts at 1 so that 0 never matches.
+    uint32_t mGeneration = 1;
+    Stats mStats;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,148 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedCertificateCache.h>
+
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
+#include <lib/support/CodeUtils.h>
+
+#include <mutex>
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+using namespace chip::Crypto;
+
+VerifiedCertificateCache::VerifiedCertificateCache()
+{
+    SuccessOrDie(System::Mutex::Init(mLock));
+    memset(mEntries, 0, sizeof(mEntries));
+}
+
+CHIP_ERROR VerifiedCertificateCache::VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer)
+{
+    uint8_t linkHash[kSHA256_Hash_Length];
+
+    // Let the uncached verification report certificates that cannot be verified at all.
+    if (!cert.mCertFlags.Has(CertFlags::kTBSHashPresent) || ComputeLinkHash(cert, signer, linkHash) != CHIP_NO_ERROR)
+    {
+        return Credentials::VerifyCertSignature(cert, signer);
+    }
+
+    {
+        std::lock_guard<System::Mutex> lock(mLock);
+        Entry * entry = FindLocked(linkHash);
+        if (entry != nullptr)
+        {
+            entry->lastUsed = NextUseLocked();
+            mStats.saved++;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    // Verify outside of the lock: concurrent validations of the same link may both verify it, which is harmless.
+    ReturnErrorOnFailure(Credentials::VerifyCertSignature(cert, signer));
+
+    std::lock_guard<System::Mutex> lock(mLock);
+    mStats.verified++;
+    if (FindLocked(linkHash) == nullptr)
+    {
+        AddLocked(linkHash);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void VerifiedCertificateCache::Invalidate()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    memset(mEntries, 0, sizeof(mEntries));
+    mUseCounter = 0;
+}
+
+VerifiedCertificateCache::Stats VerifiedCertificateCache::GetStats()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    return mStats;
+}
+
+void VerifiedCertificateCache::ResetStats()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    mStats = Stats();
+}
+
+CHIP_ERROR VerifiedCertificateCache::ComputeLinkHash(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                                     uint8_t (&outLinkHash)[kSHA256_Hash_Length])
+{
+    Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(cert.mTBSHash)));
+    ReturnErrorOnFailure(hash.AddData(cert.mSignature));
+    ReturnErrorOnFailure(hash.AddData(signer.mPublicKey));
+
+    MutableByteSpan linkHashSpan(outLinkHash);
+    return hash.Finish(linkHashSpan);
+}
+
+VerifiedCertificateCache::Entry * VerifiedCertificateCache::FindLocked(const uint8_t (&linkHash)[kSHA256_Hash_Length])
+{
+    for (Entry & entry : mEntries)
+    {
+        if (entry.lastUsed != 0 && memcmp(entry.linkHash, linkHash, sizeof(linkHash)) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void VerifiedCertificateCache::AddLocked(const uint8_t (&linkHash)[kSHA256_Hash_Length])
+{
+    // Take an unused entry if there is one, and evict the least recently used one otherwise.
+    Entry * victim = &mEntries[0];
+    for (Entry & entry : mEntries)
+    {
+        if (entry.lastUsed < victim->lastUsed)
+        {
+            victim = &entry;
+        }
+    }
+
+    memcpy(victim->linkHash, linkHash, sizeof(linkHash));
+    victim->lastUsed = NextUseLocked();
+}
+
+uint32_t VerifiedCertificateCache::NextUseLocked()
+{
+    // Rather than wrap to 0, which marks unused entries, forget the order in which the entries were used.
+    if (mUseCounter == UINT32_MAX)
+    {
+        mUseCounter = 1;
+        for (Entry & entry : mEntries)
+        {
+            entry.lastUsed = (entry.lastUsed != 0) ? mUseCounter : 0;
+        }
+    }
+    return ++mUseCounter;
+}
+
+} // namespace Credentials
+} // namespace chip
+
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
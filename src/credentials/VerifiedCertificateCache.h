@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemMutex.h>
+
+namespace chip {
+namespace Credentials {
+
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
+/**
+ * Remembers the certificate signatures that were successfully verified, so that validating a certificate chain
+ * again does not redo the ECDSA verification of its links.
+ *
+ * An entry is the SHA-256 hash of the TBS hash and signature of a certificate followed by the public key of the
+ * certificate that signed it, so it only ever matches the exact same certificate signed by the exact same key. Only the
+ * signature check is remembered: ChipCertificateSet::ValidateCert() still checks the validity period, against the
+ * validity policy of the ValidationContext, and the usages of every certificate of the chain.
+ *
+ * Holds up to CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE entries, evicting the least recently used one. May be used
+ * from any thread.
+ */
+class VerifiedCertificateCache
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE;
+
+    struct Stats
+    {
+        uint32_t verified = 0; ///< Signatures verified, i.e. not found in the cache.
+        uint32_t saved    = 0; ///< Signature verifications skipped thanks to the cache.
+    };
+
+    VerifiedCertificateCache();
+    ~VerifiedCertificateCache() { Invalidate(); }
+
+    VerifiedCertificateCache(const VerifiedCertificateCache &)             = delete;
+    VerifiedCertificateCache & operator=(const VerifiedCertificateCache &) = delete;
+
+    /**
+     * Same as Credentials::VerifyCertSignature(), skipping the verification if @p cert was already verified against
+     * @p signer.
+     */
+    CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer);
+
+    /**
+     * Forgets all the verified signatures.
+     */
+    void Invalidate();
+
+    Stats GetStats();
+    void ResetStats();
+
+private:
+    struct Entry
+    {
+        uint8_t linkHash[Crypto::kSHA256_Hash_Length];
+        uint32_t lastUsed; ///< 0 for an unused entry.
+    };
+
+    static CHIP_ERROR ComputeLinkHash(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                      uint8_t (&outLinkHash)[Crypto::kSHA256_Hash_Length]);
+    Entry * FindLocked(const uint8_t (&linkHash)[Crypto::kSHA256_Hash_Length]);
+    void AddLocked(const uint8_t (&linkHash)[Crypto::kSHA256_Hash_Length]);
+    uint32_t NextUseLocked();
+
+    System::Mutex mLock;
+    Entry mEntries[kCapacity];
+    uint32_t mUseCounter = 0;
+    Stats mStats;
+};
+
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,444 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include "BatchedDACVerifier.h"
+
+#include <credentials/CertificationDeclaration.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <algorithm>
+#include <mutex>
+#include <string.h>
+
+using namespace chip::Crypto;
+
+namespace chip {
+namespace Credentials {
+
+namespace {
+
+// Takes an unused entry if there is one, and the least recently used one otherwise.
+template <typename Entry, size_t N>
+Entry & PickEntryToReplace(Entry (&entries)[N])
+{
+    Entry * victim = &entries[0];
+    for (Entry & entry : entries)
+    {
+        if (entry.lastUsed < victim->lastUsed)
+        {
+            victim = &entry;
+        }
+    }
+    return *victim;
+}
+
+} // namespace
+
+/**
+ * A verification request, with a copy of the attestation information, which the caller only guarantees to be valid
+ * during the call to VerifyAttestationInformation().
+ */
+class BatchedDACVerifier::PendingVerification
+{
+public:
+    PendingVerification(BatchedDACVerifier & verifier, Platform::ScopedMemoryBuffer<uint8_t> && buffer,
+                        const AttestationInfo & info, Callback::Callback<OnAttestationInformationVerification> * onCompletion) :
+        mVerifier(&verifier), mBuffer(std::move(buffer)), mInfo(CopyInfo(info, mBuffer.Get())), mOnCompletion(onCompletion),
+        mOnVerified(OnVerified, this)
+    {}
+
+    CHIP_ERROR Init() { return System::Mutex::Init(mLock); }
+
+    static size_t GetCopySize(const AttestationInfo & info)
+    {
+        return info.attestationElementsBuffer.size() + info.attestationChallengeBuffer.size() +
+            info.attestationSignatureBuffer.size() + info.paiDerBuffer.size() + info.dacDerBuffer.size() +
+            info.attestationNonceBuffer.size();
+    }
+
+    void Verify() { mVerifier->DefaultDACVerifier::VerifyAttestationInformation(mInfo, &mOnVerified); }
+
+    void Deliver() { mOnCompletion->mCall(mOnCompletion->mContext, mInfo, mResult); }
+
+    Callback::Callback<OnAttestationInformationVerification> * GetOnCompletion() const { return mOnCompletion; }
+
+    // Held by the background worker from the time it starts the verification until its result is handed over, so that
+    // a cancellation waits for it.
+    System::Mutex mLock;
+    // Cleared under mLock once the verification is cancelled.
+    BatchedDACVerifier * mVerifier;
+    PendingVerification * mNext            = nullptr; ///< In the list of pending verifications.
+    PendingVerification * mNextUndelivered = nullptr; ///< In the list of undelivered results.
+
+private:
+    static ByteSpan CopySpan(const ByteSpan & span, uint8_t *& next)
+    {
+        ByteSpan copy(next, span.size());
+        if (!span.empty())
+        {
+            memcpy(next, span.data(), span.size());
+            next += span.size();
+        }
+        return copy;
+    }
+
+    static AttestationInfo CopyInfo(const AttestationInfo & info, uint8_t * buffer)
+    {
+        uint8_t * next                = buffer;
+        ByteSpan attestationElements  = CopySpan(info.attestationElementsBuffer, next);
+        ByteSpan attestationChallenge = CopySpan(info.attestationChallengeBuffer, next);
+        ByteSpan attestationSignature = CopySpan(info.attestationSignatureBuffer, next);
+        ByteSpan paiDer               = CopySpan(info.paiDerBuffer, next);
+        ByteSpan dacDer               = CopySpan(info.dacDerBuffer, next);
+        ByteSpan attestationNonce     = CopySpan(info.attestationNonceBuffer, next);
+        return AttestationInfo(attestationElements, attestationChallenge, attestationSignature, paiDer, dacDer, attestationNonce,
+                               info.vendorId, info.productId);
+    }
+
+    static void OnVerified(void * context, const AttestationInfo & info, AttestationVerificationResult result)
+    {
+        reinterpret_cast<PendingVerification *>(context)->mResult = result;
+    }
+
+    Platform::ScopedMemoryBuffer<uint8_t> mBuffer;
+    AttestationInfo mInfo;
+    Callback::Callback<OnAttestationInformationVerification> * mOnCompletion;
+    Callback::Callback<OnAttestationInformationVerification> mOnVerified;
+    AttestationVerificationResult mResult = AttestationVerificationResult::kInternalError;
+};
+
+BatchedDACVerifier::BatchedDACVerifier(const AttestationTrustStore * paaRootStore) :
+    BatchedDACVerifier(paaRootStore, nullptr)
+{}
+
+BatchedDACVerifier::BatchedDACVerifier(const AttestationTrustStore * paaRootStore,
+                                       DeviceAttestationRevocationDelegate * revocationDelegate) :
+    DefaultDACVerifier(paaRootStore, revocationDelegate)
+{
+    SuccessOrDie(System::Mutex::Init(mLock));
+}
+
+BatchedDACVerifier::~BatchedDACVerifier()
+{
+    CancelVerifications(nullptr);
+}
+
+void BatchedDACVerifier::VerifyAttestationInformation(const DeviceAttestationVerifier::AttestationInfo & info,
+                                                      Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    VerifyOrReturn(onCompletion != nullptr);
+
+    CHIP_ERROR err                = CHIP_ERROR_NO_MEMORY;
+    PendingVerification * pending = nullptr;
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+
+    // Allocate at least one byte, so that the copied spans have a valid pointer even when all of them are empty.
+    if (buffer.Alloc(std::max<size_t>(PendingVerification::GetCopySize(info), 1)))
+    {
+        pending = Platform::New<PendingVerification>(*this, std::move(buffer), info, onCompletion);
+    }
+    if (pending != nullptr)
+    {
+        err = pending->Init();
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        pending->mNext = mPending;
+        mPending       = pending;
+        if (mPendingCount++ == 0)
+        {
+            err = DeviceLayer::SystemLayer().StartTimer(kDeliveryRetryInterval, OnDeliveryRetryTimer, this);
+        }
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(VerifyWork, reinterpret_cast<intptr_t>(pending));
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        // Verify synchronously, as the DefaultDACVerifier does.
+        ChipLogError(NotSpecified, "Unable to queue attestation verification: %" CHIP_ERROR_FORMAT, err.Format());
+        if (pending != nullptr)
+        {
+            Remove(pending);
+            Platform::Delete(pending);
+        }
+        DefaultDACVerifier::VerifyAttestationInformation(info, onCompletion);
+    }
+}
+
+void BatchedDACVerifier::CancelVerifications(Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    PendingVerification * pending = mPending;
+    while (pending != nullptr)
+    {
+        PendingVerification * next = pending->mNext;
+        if (onCompletion == nullptr || pending->GetOnCompletion() == onCompletion)
+        {
+            // A result that was not scheduled back to the Matter thread has no other owner. Otherwise the work that
+            // is still queued deletes it, as soon as this lock is released.
+            bool undelivered = false;
+            {
+                // Waits for a background worker verifying it.
+                std::lock_guard<System::Mutex> lock(pending->mLock);
+                pending->mVerifier = nullptr;
+                Remove(pending);
+
+                std::lock_guard<System::Mutex> verifierLock(mLock);
+                for (PendingVerification ** link = &mUndelivered; *link != nullptr; link = &(*link)->mNextUndelivered)
+                {
+                    if (*link == pending)
+                    {
+                        *link       = pending->mNextUndelivered;
+                        undelivered = true;
+                        break;
+                    }
+                }
+            }
+            if (undelivered)
+            {
+                Platform::Delete(pending);
+            }
+        }
+        pending = next;
+    }
+}
+
+void BatchedDACVerifier::VerifyWork(intptr_t arg)
+{
+    auto * pending = reinterpret_cast<PendingVerification *>(arg);
+    {
+        std::lock_guard<System::Mutex> lock(pending->mLock);
+        BatchedDACVerifier * verifier = pending->mVerifier;
+        if (verifier != nullptr)
+        {
+            pending->Verify();
+
+            CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(CompleteWork, arg);
+            if (err != CHIP_NO_ERROR)
+            {
+                // The callback may only be called on the Matter thread: leave the result to the retry timer.
+                ChipLogError(NotSpecified, "Unable to deliver attestation verification result: %" CHIP_ERROR_FORMAT, err.Format());
+
+                std::lock_guard<System::Mutex> verifierLock(verifier->mLock);
+                pending->mNextUndelivered = verifier->mUndelivered;
+                verifier->mUndelivered    = pending;
+            }
+            return;
+        }
+    }
+
+    // Cancelled before being verified: nothing else refers to it.
+    Platform::Delete(pending);
+}
+
+void BatchedDACVerifier::CompleteWork(intptr_t arg)
+{
+    auto * pending                = reinterpret_cast<PendingVerification *>(arg);
+    BatchedDACVerifier * verifier = nullptr;
+    {
+        // Also waits for the background worker to let go of it.
+        std::lock_guard<System::Mutex> lock(pending->mLock);
+        verifier = pending->mVerifier;
+    }
+
+    if (verifier == nullptr)
+    {
+        // Cancelled: the result is dropped.
+        Platform::Delete(pending);
+        return;
+    }
+    verifier->Complete(pending);
+}
+
+void BatchedDACVerifier::OnDeliveryRetryTimer(System::Layer * systemLayer, void * appState)
+{
+    auto * verifier = static_cast<BatchedDACVerifier *>(appState);
+    verifier->CompleteUndelivered();
+
+    // Armed for as long as there are verifications pending.
+    if (verifier->mPendingCount > 0)
+    {
+        RETURN_SAFELY_IGNORED systemLayer->StartTimer(kDeliveryRetryInterval, OnDeliveryRetryTimer, verifier);
+    }
+}
+
+void BatchedDACVerifier::Remove(PendingVerification * pending)
+{
+    PendingVerification ** link = &mPending;
+    while (*link != pending)
+    {
+        VerifyOrReturn(*link != nullptr);
+        link = &(*link)->mNext;
+    }
+    *link = pending->mNext;
+
+    if (--mPendingCount == 0)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(OnDeliveryRetryTimer, this);
+    }
+}
+
+void BatchedDACVerifier::Complete(PendingVerification * pending)
+{
+    // The callback may cancel other verifications or verify more devices: be done with the list first.
+    Remove(pending);
+    pending->Deliver();
+    Platform::Delete(pending);
+}
+
+void BatchedDACVerifier::CompleteUndelivered()
+{
+    // One at a time, as the callbacks may cancel the other verifications.
+    while (true)
+    {
+        PendingVerification * pending;
+        {
+            std::lock_guard<System::Mutex> lock(mLock);
+            pending = mUndelivered;
+            VerifyOrReturn(pending != nullptr);
+            mUndelivered = pending->mNextUndelivered;
+        }
+        {
+            // The background worker that queued it may still be letting go of it.
+            std::lock_guard<System::Mutex> lock(pending->mLock);
+        }
+        Complete(pending);
+    }
+}
+
+void BatchedDACVerifier::ClearVerifiedIssuers()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    for (IssuerEntry & entry : mIssuers)
+    {
+        entry.lastUsed = 0;
+    }
+}
+
+BatchedDACVerifier::Stats BatchedDACVerifier::GetStats()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    return mStats;
+}
+
+void BatchedDACVerifier::ResetStats()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    mStats = Stats();
+}
+
+bool BatchedDACVerifier::GetVerifiedIssuer(const ByteSpan & paiDerBuffer, VerifiedIssuer & outIssuer,
+                                           MutableByteSpan & outPaaDerBuffer)
+{
+    uint8_t paiHash[kSHA256_Hash_Length];
+    VerifyOrReturnValue(Hash_SHA256(paiDerBuffer.data(), paiDerBuffer.size(), paiHash) == CHIP_NO_ERROR, false);
+
+    std::lock_guard<System::Mutex> lock(mLock);
+    for (IssuerEntry & entry : mIssuers)
+    {
+        if (entry.lastUsed != 0 && memcmp(entry.paiHash, paiHash, sizeof(paiHash)) == 0)
+        {
+            VerifyOrReturnValue(outPaaDerBuffer.size() >= entry.paaDerLength, false);
+            memcpy(outPaaDerBuffer.data(), entry.paaDer, entry.paaDerLength);
+            outPaaDerBuffer.reduce_size(entry.paaDerLength);
+            outIssuer = entry.issuer;
+
+            entry.lastUsed = ++mUseCounter;
+            mStats.issuersSaved++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void BatchedDACVerifier::OnIssuerVerified(const ByteSpan & paiDerBuffer, const VerifiedIssuer & issuer,
+                                          const ByteSpan & paaDerBuffer)
+{
+    uint8_t paiHash[kSHA256_Hash_Length];
+    VerifyOrReturn(paaDerBuffer.size() <= kMaxDERCertLength);
+    VerifyOrReturn(Hash_SHA256(paiDerBuffer.data(), paiDerBuffer.size(), paiHash) == CHIP_NO_ERROR);
+
+    std::lock_guard<System::Mutex> lock(mLock);
+    mStats.issuersVerified++;
+
+    // Devices of a same product line verified in parallel may all have missed their PAI in the cache: keep one entry.
+    for (IssuerEntry & entry : mIssuers)
+    {
+        VerifyOrReturn(entry.lastUsed == 0 || memcmp(entry.paiHash, paiHash, sizeof(paiHash)) != 0);
+    }
+
+    IssuerEntry & entry = PickEntryToReplace(mIssuers);
+    memcpy(entry.paiHash, paiHash, sizeof(paiHash));
+    entry.issuer = issuer;
+    memcpy(entry.paaDer, paaDerBuffer.data(), paaDerBuffer.size());
+    entry.paaDerLength = paaDerBuffer.size();
+    entry.lastUsed     = ++mUseCounter;
+}
+
+CHIP_ERROR BatchedDACVerifier::VerifyCertificationDeclarationCmsSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                          const Crypto::P256PublicKey & verifyingKey,
+                                                                          ByteSpan & certDeclBuffer)
+{
+    uint8_t cmsHash[kSHA256_Hash_Length];
+    bool cmsHashValid = false;
+    {
+        Hash_SHA256_stream hash;
+        MutableByteSpan cmsHashSpan(cmsHash);
+        cmsHashValid = hash.Begin() == CHIP_NO_ERROR && hash.AddData(cmsEnvelopeBuffer) == CHIP_NO_ERROR &&
+            hash.AddData(ByteSpan(verifyingKey.ConstBytes(), verifyingKey.Length())) == CHIP_NO_ERROR &&
+            hash.Finish(cmsHashSpan) == CHIP_NO_ERROR;
+    }
+
+    if (cmsHashValid)
+    {
+        std::lock_guard<System::Mutex> lock(mLock);
+        for (CdEntry & entry : mCds)
+        {
+            if (entry.lastUsed != 0 && memcmp(entry.cmsHash, cmsHash, sizeof(cmsHash)) == 0)
+            {
+                entry.lastUsed = ++mUseCounter;
+                mStats.cdSignaturesSaved++;
+                return CMS_ExtractCDContent(cmsEnvelopeBuffer, certDeclBuffer);
+            }
+        }
+    }
+
+    // Verify outside of the lock, so that the verifications of other CDs are not serialized behind this one.
+    ReturnErrorOnFailure(DefaultDACVerifier::VerifyCertificationDeclarationCmsSignature(cmsEnvelopeBuffer, verifyingKey,
+                                                                                         certDeclBuffer));
+
+    std::lock_guard<System::Mutex> lock(mLock);
+    mStats.cdSignaturesVerified++;
+    VerifyOrReturnError(cmsHashValid, CHIP_NO_ERROR);
+    for (CdEntry & entry : mCds)
+    {
+        VerifyOrReturnError(entry.lastUsed == 0 || memcmp(entry.cmsHash, cmsHash, sizeof(cmsHash)) != 0, CHIP_NO_ERROR);
+    }
+
+    CdEntry & entry = PickEntryToReplace(mCds);
+    memcpy(entry.cmsHash, cmsHash, sizeof(cmsHash));
+    entry.lastUsed = ++mUseCounter;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <credentials/attestation_verifier/DefaultDeviceAttestationVerifier.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <system/SystemMutex.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * @brief
+ *   This class is based upon the DefaultDACVerifier, for commissioners that verify the attestation of many
+ * devices at once, e.g. on a factory line.
+ *
+ *   VerifyAttestationInformation() copies the attestation information and returns right away. The verification
+ * itself is done through PlatformManager::ScheduleBackgroundWork(), so that as many devices are verified in
+ * parallel as there are background workers, and its result is delivered on the Matter thread through the given
+ * callback, which must stay valid until then or until CancelVerifications() is called for it. A result that could
+ * not be queued back to the Matter thread is delivered within kDeliveryRetryInterval.
+ *
+ *   The devices of a same product line share their PAI, PAA and Certification Declaration (CD). The checks of a
+ * PAI and of its PAA that do not involve the DAC, and the CMS signature verification of a CD, are only done for
+ * the first of those devices and remembered for up to CHIP_CONFIG_BATCHED_DAC_VERIFIER_CACHE_SIZE PAIs and CDs.
+ * The DAC -> PAI -> PAA chain of every device is still validated.
+ *
+ *   The attestation trust store must be usable from the background workers. Neither it nor the CD trust store
+ * may be changed while verifications are pending, and ClearVerifiedIssuers() must be called after removing a
+ * PAA from the attestation trust store.
+ */
+class BatchedDACVerifier : public DefaultDACVerifier
+{
+public:
+    static constexpr size_t kCacheSize                             = CHIP_CONFIG_BATCHED_DAC_VERIFIER_CACHE_SIZE;
+    static constexpr System::Clock::Timeout kDeliveryRetryInterval = System::Clock::Milliseconds32(500);
+
+    struct Stats
+    {
+        uint32_t issuersVerified      = 0; ///< PAIs (and their PAA) checked.
+        uint32_t issuersSaved         = 0; ///< PAI and PAA checks skipped thanks to the cache.
+        uint32_t cdSignaturesVerified = 0; ///< CD signatures verified.
+        uint32_t cdSignaturesSaved    = 0; ///< CD signature verifications skipped thanks to the cache.
+    };
+
+    BatchedDACVerifier(const AttestationTrustStore * paaRootStore);
+    BatchedDACVerifier(const AttestationTrustStore * paaRootStore, DeviceAttestationRevocationDelegate * revocationDelegate);
+
+    /**
+     * Drops the results of the pending verifications, see CancelVerifications(). Must be called on the Matter thread,
+     * but not from a completion callback.
+     */
+    ~BatchedDACVerifier() override;
+
+    void VerifyAttestationInformation(const DeviceAttestationVerifier::AttestationInfo & info,
+                                      Callback::Callback<OnAttestationInformationVerification> * onCompletion) override;
+
+    /**
+     * @brief Number of verifications whose result has not been delivered yet. Must be called on the Matter thread.
+     */
+    size_t GetPendingCount() const { return mPendingCount; }
+
+    /**
+     * @brief Drop the results of the pending verifications that would be delivered to the given callback, e.g. before it
+     *        is destroyed. Must be called on the Matter thread, and waits for those being verified in the background.
+     *
+     * @param onCompletion The callback whose results are dropped, or nullptr to drop all of them.
+     */
+    void CancelVerifications(Callback::Callback<OnAttestationInformationVerification> * onCompletion) override;
+
+    /**
+     * @brief Forget the verified PAIs, e.g. after a PAA was removed from the attestation trust store.
+     */
+    void ClearVerifiedIssuers();
+
+    Stats GetStats();
+    void ResetStats();
+
+protected:
+    bool GetVerifiedIssuer(const ByteSpan & paiDerBuffer, VerifiedIssuer & outIssuer, MutableByteSpan & outPaaDerBuffer) override;
+    void OnIssuerVerified(const ByteSpan & paiDerBuffer, const VerifiedIssuer & issuer, const ByteSpan & paaDerBuffer) override;
+    CHIP_ERROR VerifyCertificationDeclarationCmsSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                          const Crypto::P256PublicKey & verifyingKey,
+                                                          ByteSpan & certDeclBuffer) override;
+
+private:
+    class PendingVerification;
+
+    struct IssuerEntry
+    {
+        uint8_t paiHash[Crypto::kSHA256_Hash_Length];
+        VerifiedIssuer issuer;
+        uint8_t paaDer[kMaxDERCertLength];
+        size_t paaDerLength = 0;
+        uint64_t lastUsed = 0; ///< 0 for an unused entry.
+    };
+
+    struct CdEntry
+    {
+        uint8_t cmsHash[Crypto::kSHA256_Hash_Length]; ///< Hash of the CMS envelope and of the key it was verified with.
+        uint64_t lastUsed = 0;                        ///< 0 for an unused entry.
+    };
+
+    static void VerifyWork(intptr_t arg);
+    static void CompleteWork(intptr_t arg);
+    static void OnDeliveryRetryTimer(System::Layer * systemLayer, void * appState);
+    void Remove(PendingVerification * pending);
+    void Complete(PendingVerification * pending);
+    void CompleteUndelivered();
+
+    System::Mutex mLock;
+    IssuerEntry mIssuers[kCacheSize];
+    CdEntry mCds[kCacheSize];
+    uint64_t mUseCounter = 0;
+    Stats mStats;
+    // Verifications whose result could not be scheduled back to the Matter thread, delivered by the retry timer.
+    PendingVerification * mUndelivered = nullptr;
+
+    // Only used on the Matter thread.
+    PendingVerification * mPending = nullptr;
+    size_t mPendingCount           = 0;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -440,8 +440,10 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     Platform::ScopedMemoryBuffer<uint8_t> paaCert;
     MutableByteSpan paaDerBuffer;
     AttestationCertVidPid dacVidPid;
-    AttestationCertVidPid paiVidPid;
-    AttestationCertVidPid paaVidPid;
+    VerifiedIssuer issuer;
+    AttestationCertVidPid & paiVidPid = issuer.paiVidPid;
+    AttestationCertVidPid & paaVidPid = issuer.paaVidPid;
+    bool issuerVerified               = false;
 
     VerifyOrExit(!info.attestationElementsBuffer.empty() && !info.attestationChallengeBuffer.empty() &&
                      !info.attestationSignatureBuffer.empty() && !info.dacDerBuffer.empty() && !info.attestationNonceBuffer.empty(),
@@ -453,10 +455,19 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     // Ensure PAI is present
     VerifyOrExit(!info.paiDerBuffer.empty(), attestationError = AttestationVerificationResult::kPaiMissing);
 
+    VerifyOrExit(paaCert.Alloc(kMaxDERCertLength), attestationError = AttestationVerificationResult::kNoMemory);
+    paaDerBuffer = MutableByteSpan(paaCert.Get(), kMaxDERCertLength);
+
+    // A PAI that already passed all the checks below along with its PAA only needs the checks involving the DAC.
+    issuerVerified = GetVerifiedIssuer(info.paiDerBuffer, issuer, paaDerBuffer);
+
     // Validate Proper Certificate Format
     {
-        VerifyOrExit(VerifyAttestationCertificateFormat(info.paiDerBuffer, AttestationCertType::kPAI) == CHIP_NO_ERROR,
-                     attestationError = AttestationVerificationResult::kPaiFormatInvalid);
+        if (!issuerVerified)
+        {
+            VerifyOrExit(VerifyAttestationCertificateFormat(info.paiDerBuffer, AttestationCertType::kPAI) == CHIP_NO_ERROR,
+                         attestationError = AttestationVerificationResult::kPaiFormatInvalid);
+        }
         VerifyOrExit(VerifyAttestationCertificateFormat(info.dacDerBuffer, AttestationCertType::kDAC) == CHIP_NO_ERROR,
                      attestationError = AttestationVerificationResult::kDacFormatInvalid);
     }
@@ -465,8 +476,11 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     {
         VerifyOrExit(ExtractVIDPIDFromX509Cert(info.dacDerBuffer, dacVidPid) == CHIP_NO_ERROR,
                      attestationError = AttestationVerificationResult::kDacFormatInvalid);
-        VerifyOrExit(ExtractVIDPIDFromX509Cert(info.paiDerBuffer, paiVidPid) == CHIP_NO_ERROR,
-                     attestationError = AttestationVerificationResult::kPaiFormatInvalid);
+        if (!issuerVerified)
+        {
+            VerifyOrExit(ExtractVIDPIDFromX509Cert(info.paiDerBuffer, paiVidPid) == CHIP_NO_ERROR,
+                         attestationError = AttestationVerificationResult::kPaiFormatInvalid);
+        }
         VerifyOrExit(paiVidPid.mVendorId.HasValue() && paiVidPid.mVendorId == dacVidPid.mVendorId,
                      attestationError = AttestationVerificationResult::kDacVendorIdMismatch);
         VerifyOrExit(dacVidPid.mProductId.HasValue(), attestationError = AttestationVerificationResult::kDacProductIdMismatch);
@@ -506,18 +520,23 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     }
 
     // Find PAA and validate it.
+    if (issuerVerified)
+    {
+        if (AreVerboseLogsEnabled())
+        {
+            LogCertDebugData(AttestationChainElement::kPAA, paaDerBuffer);
+        }
+    }
+    else
     {
         uint8_t paiAkidBuf[Crypto::kAuthorityKeyIdentifierLength];
         MutableByteSpan paiAkid(paiAkidBuf);
-        constexpr size_t paaCertAllocatedLen = kMaxDERCertLength;
-        CHIP_ERROR err                       = CHIP_NO_ERROR;
+        CHIP_ERROR err = CHIP_NO_ERROR;
 
         VerifyOrExit(ExtractAKIDFromX509Cert(info.paiDerBuffer, paiAkid) == CHIP_NO_ERROR,
                      attestationError = AttestationVerificationResult::kPaiFormatInvalid);
 
-        VerifyOrExit(paaCert.Alloc(paaCertAllocatedLen), attestationError = AttestationVerificationResult::kNoMemory);
-
-        paaDerBuffer = MutableByteSpan(paaCert.Get(), paaCertAllocatedLen);
+        paaDerBuffer = MutableByteSpan(paaCert.Get(), kMaxDERCertLength);
         err          = mAttestationTrustStore->GetProductAttestationAuthorityCert(paiAkid, paaDerBuffer);
         if (err == CHIP_ERROR_NOT_IMPLEMENTED)
         {
@@ -584,11 +603,18 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
             .paaVendorId  = paaVidPid.mVendorId.ValueOr(VendorId::NotSpecified),
         };
 
-        MutableByteSpan paaSKID(deviceInfo.paaSKID);
-        VerifyOrExit(ExtractSKIDFromX509Cert(paaDerBuffer, paaSKID) == CHIP_NO_ERROR,
-                     attestationError = AttestationVerificationResult::kPaaFormatInvalid);
-        VerifyOrExit(paaSKID.size() == sizeof(deviceInfo.paaSKID),
-                     attestationError = AttestationVerificationResult::kPaaFormatInvalid);
+        if (!issuerVerified)
+        {
+            MutableByteSpan paaSKID(issuer.paaSKID);
+            VerifyOrExit(ExtractSKIDFromX509Cert(paaDerBuffer, paaSKID) == CHIP_NO_ERROR,
+                         attestationError = AttestationVerificationResult::kPaaFormatInvalid);
+            VerifyOrExit(paaSKID.size() == sizeof(issuer.paaSKID),
+                         attestationError = AttestationVerificationResult::kPaaFormatInvalid);
+
+            // The PAI chains up to the PAA: nothing left to check about them for the next devices they issued.
+            OnIssuerVerified(info.paiDerBuffer, issuer, paaDerBuffer);
+        }
+        memcpy(deviceInfo.paaSKID, issuer.paaSKID, sizeof(deviceInfo.paaSKID));
 
         VerifyOrExit(DeconstructAttestationElements(info.attestationElementsBuffer, certificationDeclarationSpan,
                                                     attestationNonceSpan, timestampDeconstructed, firmwareInfoSpan,
@@ -641,7 +667,8 @@ AttestationVerificationResult DefaultDACVerifier::ValidateCertificationDeclarati
         ChipLogProgress(NotSpecified, "Allowing CD signed by test key");
     }
 
-    VerifyOrReturnError(CMS_Verify(cmsEnvelopeBuffer, verifyingKey, certDeclBuffer) == CHIP_NO_ERROR,
+    VerifyOrReturnError(VerifyCertificationDeclarationCmsSignature(cmsEnvelopeBuffer, verifyingKey, certDeclBuffer) ==
+                            CHIP_NO_ERROR,
                         AttestationVerificationResult::kCertificationDeclarationInvalidSignature);
 
     // certDeclBuffer is populated by CMS_Verify so we need to do this check after the signature check
@@ -764,6 +791,13 @@ AttestationVerificationResult DefaultDACVerifier::ValidateCertificateDeclaration
     return AttestationVerificationResult::kSuccess;
 }
 
+CHIP_ERROR DefaultDACVerifier::VerifyCertificationDeclarationCmsSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                         const Crypto::P256PublicKey & verifyingKey,
+                                                                         ByteSpan & certDeclBuffer)
+{
+    return CMS_Verify(cmsEnvelopeBuffer, verifyingKey, certDeclBuffer);
+}
+
 CHIP_ERROR DefaultDACVerifier::VerifyNodeOperationalCSRInformation(const ByteSpan & nocsrElementsBuffer,
                                                                    const ByteSpan & attestationChallengeBuffer,
                                                                    const ByteSpan & attestationSignatureBuffer,
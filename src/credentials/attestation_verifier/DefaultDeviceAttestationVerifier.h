@@ -92,6 +92,46 @@ public:
 protected:
     DefaultDACVerifier() {}
 
+    /**
+     * What VerifyAttestationInformation() learns about a PAI and its PAA, independently of the DAC they are checked with.
+     */
+    struct VerifiedIssuer
+    {
+        Crypto::AttestationCertVidPid paiVidPid;
+        Crypto::AttestationCertVidPid paaVidPid;
+        uint8_t paaSKID[Crypto::kSubjectKeyIdentifierLength] = { 0 };
+    };
+
+    /**
+     * @brief Look up a PAI previously passed to OnIssuerVerified(), so that VerifyAttestationInformation() skips the
+     *        checks of the PAI and of its PAA that do not involve the DAC (the certificate chain is always validated).
+     *
+     * The default implementation remembers nothing.
+     *
+     * @param[in]  paiDerBuffer     The PAI certificate, in DER format.
+     * @param[out] outIssuer        What is known about the PAI and its PAA.
+     * @param[in,out] outPaaDerBuffer Buffer of kMaxDERCertLength bytes, resized to the PAA certificate in DER format.
+     *
+     * @return true if the PAI was found, false otherwise, in which case the outputs are left untouched.
+     */
+    virtual bool GetVerifiedIssuer(const ByteSpan & paiDerBuffer, VerifiedIssuer & outIssuer, MutableByteSpan & outPaaDerBuffer)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Called by VerifyAttestationInformation() once a PAI and its PAA passed all their checks, including the
+     *        validation of a certificate chain made of them.
+     */
+    virtual void OnIssuerVerified(const ByteSpan & paiDerBuffer, const VerifiedIssuer & issuer, const ByteSpan & paaDerBuffer) {}
+
+    /**
+     * @brief Verify the CMS signature of a Certification Declaration, see CMS_Verify().
+     */
+    virtual CHIP_ERROR VerifyCertificationDeclarationCmsSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                  const Crypto::P256PublicKey & verifyingKey,
+                                                                  ByteSpan & certDeclBuffer);
+
     CsaCdKeysTrustStore mCdKeysTrustStore;
     const AttestationTrustStore * mAttestationTrustStore;
     DeviceAttestationRevocationDelegate * mRevocationDelegate = nullptr;
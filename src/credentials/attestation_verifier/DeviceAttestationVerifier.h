@@ -397,6 +397,14 @@ public:
     virtual void CheckForRevokedDACChain(const AttestationInfo & info,
                                          Callback::Callback<OnAttestationInformationVerification> * onCompletion) = 0;
 
+    /**
+     * @brief Drop the results of the pending verifications that would be delivered to the given callback, e.g. before it
+     *        is destroyed. Does nothing by default, for verifiers that deliver their results synchronously.
+     *
+     * @param[in] onCompletion The callback whose results are dropped, or nullptr to drop all of them.
+     */
+    virtual void CancelVerifications(Callback::Callback<OnAttestationInformationVerification> * onCompletion) {}
+
     /**
      * @brief Get the trust store used for the attestation verifier.
      *
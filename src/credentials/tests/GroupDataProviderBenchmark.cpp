@@ -0,0 +1,199 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures GroupDataProviderImpl lookups on a large configuration (16 fabrics
+ *      with 255 groups each, one endpoint and one key set mapping per group), with
+ *      and without the storage cache:
+ *
+ *        - get_group_info: GetGroupInfo() of a group (what the Groups cluster does).
+ *        - has_endpoint: HasEndpoint() of a group endpoint (what is done for every
+ *          incoming group message).
+ *        - group_sessions: a full IterateGroupSessions() pass for one session id
+ *          (what is done to find the keys to decrypt an incoming group message).
+ *
+ *      For each, both the number of operations per second and the number of reads
+ *      reaching the storage delegate per operation are reported. The storage used
+ *      here is in RAM, so the time saved on a device is larger than measured.
+ */
+
+#include <benchmarks/BenchmarkHelpers.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::Credentials;
+
+namespace {
+
+constexpr FabricIndex kFabricCount = 16;
+constexpr uint16_t kGroupsPerFabric = 255;
+constexpr size_t kLookups           = 10000;
+constexpr size_t kSessionLookups    = 20;
+constexpr EndpointId kEndpoint      = 1;
+
+const ResultWriter gResults("group-data-provider", "groups");
+
+class CountingStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        mReads++;
+        return TestPersistentStorageDelegate::SyncGetKeyValue(key, buffer, size);
+    }
+
+    size_t mReads = 0;
+};
+
+CountingStorageDelegate gStorage;
+Crypto::DefaultSessionKeystore gSessionKeystore;
+
+GroupId GroupIdForIndex(size_t index)
+{
+    return static_cast<GroupId>(kMinApplicationGroupId + index);
+}
+
+KeysetId KeysetIdForFabric(FabricIndex fabricIndex)
+{
+    return static_cast<KeysetId>(0x100 + fabricIndex);
+}
+
+void Populate(GroupDataProviderImpl & provider)
+{
+    for (FabricIndex fabricIndex = 1; fabricIndex <= kFabricCount; fabricIndex++)
+    {
+        const uint8_t compressedFabricId[] = { 0x87, 0xe1, 0xb0, 0x04, 0xe2, 0x35, 0xa1, fabricIndex };
+        GroupDataProvider::KeySet keySet(KeysetIdForFabric(fabricIndex), GroupDataProvider::SecurityPolicy::kTrustFirst, 1);
+        keySet.epoch_keys[0].start_time = 1;
+        memset(keySet.epoch_keys[0].key, fabricIndex, sizeof(keySet.epoch_keys[0].key));
+        VerifyOrDie(provider.SetKeySet(fabricIndex, ByteSpan(compressedFabricId), keySet) == CHIP_NO_ERROR);
+
+        for (uint16_t i = 0; i < kGroupsPerFabric; i++)
+        {
+            const GroupId groupId = GroupIdForIndex(i);
+            VerifyOrDie(provider.SetGroupInfoAt(fabricIndex, i, GroupDataProvider::GroupInfo(groupId, "Group")) == CHIP_NO_ERROR);
+            VerifyOrDie(provider.AddEndpoint(fabricIndex, groupId, kEndpoint) == CHIP_NO_ERROR);
+            VerifyOrDie(provider.SetGroupKeyAt(fabricIndex, i, GroupDataProvider::GroupKey(groupId, KeysetIdForFabric(fabricIndex))) ==
+                        CHIP_NO_ERROR);
+        }
+    }
+}
+
+struct Result
+{
+    double perSecond;
+    double readsPerOperation;
+};
+
+template <typename Operation>
+Result Measure(size_t operations, Operation && operation)
+{
+    const size_t reads            = gStorage.mReads;
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < operations; i++)
+    {
+        operation(i);
+    }
+    const double seconds = SecondsSince(start);
+    return Result{ static_cast<double>(operations) / seconds,
+                   static_cast<double>(gStorage.mReads - reads) / static_cast<double>(operations) };
+}
+
+void RunBenchmark(GroupDataProviderImpl & provider, uint16_t sessionId, const char * prefix)
+{
+    const size_t totalGroups = static_cast<size_t>(kFabricCount) * kGroupsPerFabric;
+
+    const Result groupInfo = Measure(kLookups, [&](size_t i) {
+        const size_t index = ScrambledIndex(i, totalGroups);
+        GroupDataProvider::GroupInfo info;
+        VerifyOrDie(provider.GetGroupInfo(static_cast<FabricIndex>(1 + index / kGroupsPerFabric),
+                                          GroupIdForIndex(index % kGroupsPerFabric), info) == CHIP_NO_ERROR);
+    });
+
+    const Result hasEndpoint = Measure(kLookups, [&](size_t i) {
+        const size_t index = ScrambledIndex(i, totalGroups);
+        VerifyOrDie(provider.HasEndpoint(static_cast<FabricIndex>(1 + index / kGroupsPerFabric),
+                                         GroupIdForIndex(index % kGroupsPerFabric), kEndpoint));
+    });
+
+    const Result groupSessions = Measure(kSessionLookups, [&](size_t) {
+        auto * iterator = provider.IterateGroupSessions(sessionId);
+        VerifyOrDie(iterator != nullptr);
+        GroupDataProvider::GroupSession session;
+        size_t count = 0;
+        while (iterator->Next(session))
+        {
+            count++;
+        }
+        iterator->Release();
+        VerifyOrDie(count == kGroupsPerFabric);
+    });
+
+    const std::string name(prefix);
+    gResults.Print(totalGroups, name + "get_group_info_per_s", Better::kHigher, groupInfo.perSecond);
+    gResults.Print(totalGroups, name + "get_group_info_storage_reads", Better::kLower, groupInfo.readsPerOperation, 1);
+    gResults.Print(totalGroups, name + "has_endpoint_per_s", Better::kHigher, hasEndpoint.perSecond);
+    gResults.Print(totalGroups, name + "has_endpoint_storage_reads", Better::kLower, hasEndpoint.readsPerOperation, 1);
+    gResults.Print(totalGroups, name + "group_sessions_per_s", Better::kHigher, groupSessions.perSecond, 1);
+    gResults.Print(totalGroups, name + "group_sessions_storage_reads", Better::kLower, groupSessions.readsPerOperation, 1);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+
+    GroupDataProviderImpl uncached(kGroupsPerFabric, 1);
+    uncached.SetStorageDelegate(&gStorage);
+    uncached.SetSessionKeystore(&gSessionKeystore);
+    VerifyOrDie(uncached.Init() == CHIP_NO_ERROR);
+    Populate(uncached);
+
+    GroupDataProviderImpl cached(kGroupsPerFabric, 1);
+    cached.SetStorageCacheEnabled(true);
+    cached.SetStorageDelegate(&gStorage);
+    cached.SetSessionKeystore(&gSessionKeystore);
+    VerifyOrDie(cached.Init() == CHIP_NO_ERROR);
+
+    // Any session id of the last fabric, whose groups are the furthest from the start of the fabric list.
+    Crypto::SymmetricKeyContext * keyContext = uncached.GetKeyContext(kFabricCount, GroupIdForIndex(0));
+    VerifyOrDie(keyContext != nullptr);
+    const uint16_t sessionId = keyContext->GetKeyHash();
+    keyContext->Release();
+
+    gResults.PrintHeader();
+    RunBenchmark(uncached, sessionId, "");
+    // The first pass fills the cache from storage.
+    RunBenchmark(cached, sessionId, "cold_cached_");
+    RunBenchmark(cached, sessionId, "cached_");
+
+    cached.Finish();
+    uncached.Finish();
+    Platform::MemoryShutdown();
+    return 0;
+}
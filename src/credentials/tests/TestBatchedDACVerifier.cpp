@@ -0,0 +1,371 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/attestation_verifier/BatchedDACVerifier.h>
+#include <credentials/attestation_verifier/DefaultDeviceAttestationVerifier.h>
+#include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <credentials/tests/CHIPAttCert_test_vectors.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::DeviceLayer;
+
+namespace {
+
+// Attestation information of a device with the FFF1/8000 development DAC, as in TestDeviceAttestationCredentials.
+const uint8_t kAttestationElements[] = {
+    0x15, 0x30, 0x01, 0xeb, 0x30, 0x81, 0xe8, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x07, 0x02, 0xa0, 0x81, 0xda,
+    0x30, 0x81, 0xd7, 0x02, 0x01, 0x03, 0x31, 0x0d, 0x30, 0x0b, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01,
+    0x30, 0x45, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x07, 0x01, 0xa0, 0x38, 0x04, 0x36, 0x15, 0x24, 0x00, 0x01,
+    0x25, 0x01, 0xf1, 0xff, 0x36, 0x02, 0x05, 0x00, 0x80, 0x18, 0x25, 0x03, 0x34, 0x12, 0x2c, 0x04, 0x13, 0x5a, 0x49, 0x47, 0x32,
+    0x30, 0x31, 0x34, 0x31, 0x5a, 0x42, 0x33, 0x33, 0x30, 0x30, 0x30, 0x31, 0x2d, 0x32, 0x34, 0x24, 0x05, 0x00, 0x24, 0x06, 0x00,
+    0x25, 0x07, 0x94, 0x26, 0x24, 0x08, 0x00, 0x18, 0x31, 0x7c, 0x30, 0x7a, 0x02, 0x01, 0x03, 0x80, 0x14, 0x62, 0xfa, 0x82, 0x33,
+    0x59, 0xac, 0xfa, 0xa9, 0x96, 0x3e, 0x1c, 0xfa, 0x14, 0x0a, 0xdd, 0xf5, 0x04, 0xf3, 0x71, 0x60, 0x30, 0x0b, 0x06, 0x09, 0x60,
+    0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x04,
+    0x46, 0x30, 0x44, 0x02, 0x20, 0x43, 0xa6, 0x3f, 0x2b, 0x94, 0x3d, 0xf3, 0x3c, 0x38, 0xb3, 0xe0, 0x2f, 0xca, 0xa7, 0x5f, 0xe3,
+    0x53, 0x2a, 0xeb, 0xbf, 0x5e, 0x63, 0xf5, 0xbb, 0xdb, 0xc0, 0xb1, 0xf0, 0x1d, 0x3c, 0x4f, 0x60, 0x02, 0x20, 0x4c, 0x1a, 0xbf,
+    0x5f, 0x18, 0x07, 0xb8, 0x18, 0x94, 0xb1, 0x57, 0x6c, 0x47, 0xe4, 0x72, 0x4e, 0x4d, 0x96, 0x6c, 0x61, 0x2e, 0xd3, 0xfa, 0x25,
+    0xc1, 0x18, 0xc3, 0xf2, 0xb3, 0xf9, 0x03, 0x69, 0x30, 0x02, 0x20, 0xe0, 0x42, 0x1b, 0x91, 0xc6, 0xfd, 0xcd, 0xb4, 0x0e, 0x2a,
+    0x4d, 0x2c, 0xf3, 0x1d, 0xb2, 0xb4, 0xe1, 0x8b, 0x41, 0x1b, 0x1d, 0x3a, 0xd4, 0xd1, 0x2a, 0x9d, 0x90, 0xaa, 0x8e, 0x52, 0xfa,
+    0xe2, 0x26, 0x03, 0xfd, 0xc6, 0x5b, 0x28, 0xd0, 0xf1, 0xff, 0x3e, 0x00, 0x01, 0x00, 0x17, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65,
+    0x5f, 0x76, 0x65, 0x6e, 0x64, 0x6f, 0x72, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x31, 0xd0, 0xf1, 0xff, 0x3e,
+    0x00, 0x03, 0x00, 0x18, 0x76, 0x65, 0x6e, 0x64, 0x6f, 0x72, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x33, 0x5f,
+    0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x18
+};
+const uint8_t kAttestationChallenge[] = { 0x7a, 0x49, 0x53, 0x05, 0xd0, 0x77, 0x79, 0xa4,
+                                          0x94, 0xdd, 0x39, 0xa0, 0x85, 0x1b, 0x66, 0x0d };
+const uint8_t kAttestationSignature[] = { 0x79, 0x82, 0x53, 0x5d, 0x24, 0xcf, 0xe1, 0x4a, 0x71, 0xab, 0x04, 0x24, 0xcf,
+                                          0x0b, 0xac, 0xf1, 0xe3, 0x45, 0x48, 0x7e, 0xd5, 0x0f, 0x1a, 0xc0, 0xbc, 0x25,
+                                          0x9e, 0xcc, 0xfb, 0x39, 0x08, 0x1e, 0x61, 0xa9, 0x26, 0x7e, 0x74, 0xf8, 0x55,
+                                          0xda, 0x53, 0x63, 0x83, 0x74, 0xa0, 0x16, 0x71, 0xcf, 0x3d, 0x7d, 0xb8, 0xcc,
+                                          0x17, 0x0b, 0x38, 0x03, 0x45, 0xe6, 0x0b, 0xc8, 0x6f, 0xdf, 0x45, 0x9e };
+const uint8_t kAttestationNonce[]     = { 0xe0, 0x42, 0x1b, 0x91, 0xc6, 0xfd, 0xcd, 0xb4, 0x0e, 0x2a, 0x4d,
+                                          0x2c, 0xf3, 0x1d, 0xb2, 0xb4, 0xe1, 0x8b, 0x41, 0x1b, 0x1d, 0x3a,
+                                          0xd4, 0xd1, 0x2a, 0x9d, 0x90, 0xaa, 0x8e, 0x52, 0xfa, 0xe2 };
+
+constexpr System::Clock::Timeout kVerificationTimeout = System::Clock::Seconds16(30);
+
+// The attestation information of one device, in buffers of its own, which it clobbers once submitted.
+struct DeviceAttestation
+{
+    uint8_t elements[sizeof(kAttestationElements)];
+    uint8_t challenge[sizeof(kAttestationChallenge)];
+    uint8_t signature[sizeof(kAttestationSignature)];
+    uint8_t nonce[sizeof(kAttestationNonce)];
+    uint8_t pai[kMaxDERCertLength];
+    uint8_t dac[kMaxDERCertLength];
+
+    DeviceAttestationVerifier::AttestationInfo Fill()
+    {
+        memcpy(elements, kAttestationElements, sizeof(elements));
+        memcpy(challenge, kAttestationChallenge, sizeof(challenge));
+        memcpy(signature, kAttestationSignature, sizeof(signature));
+        memcpy(nonce, kAttestationNonce, sizeof(nonce));
+        memcpy(pai, TestCerts::sTestCert_PAI_FFF1_8000_Cert.data(), TestCerts::sTestCert_PAI_FFF1_8000_Cert.size());
+        memcpy(dac, TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert.data(), TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert.size());
+
+        return DeviceAttestationVerifier::AttestationInfo(
+            ByteSpan(elements), ByteSpan(challenge), ByteSpan(signature),
+            ByteSpan(pai, TestCerts::sTestCert_PAI_FFF1_8000_Cert.size()),
+            ByteSpan(dac, TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert.size()), ByteSpan(nonce), static_cast<VendorId>(0xFFF1),
+            0x8000);
+    }
+
+    void Clobber()
+    {
+        memset(elements, 0, sizeof(elements));
+        memset(challenge, 0, sizeof(challenge));
+        memset(signature, 0, sizeof(signature));
+        memset(nonce, 0, sizeof(nonce));
+        memset(pai, 0, sizeof(pai));
+        memset(dac, 0, sizeof(dac));
+    }
+};
+
+struct VerificationResults
+{
+    size_t expected         = 0;
+    size_t received         = 0;
+    size_t success          = 0;
+    size_t signatureInvalid = 0;
+    bool timedOut           = false;
+};
+
+void OnAttestationInformationVerification(void * context, const DeviceAttestationVerifier::AttestationInfo & info,
+                                          AttestationVerificationResult result)
+{
+    auto * results = static_cast<VerificationResults *>(context);
+
+#if CHIP_STACK_LOCK_TRACKING_ENABLED
+    EXPECT_TRUE(PlatformMgr().IsChipStackLockedByCurrentThread());
+#endif
+    // The copy of the attestation information is what is handed back.
+    EXPECT_TRUE(info.attestationNonceBuffer.data_equal(ByteSpan(kAttestationNonce)));
+
+    results->received++;
+    if (result == AttestationVerificationResult::kSuccess)
+    {
+        results->success++;
+    }
+    else if (result == AttestationVerificationResult::kAttestationSignatureInvalid)
+    {
+        results->signatureInvalid++;
+    }
+
+    if (results->received == results->expected)
+    {
+        EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+    }
+}
+
+void OnVerificationTimeout(System::Layer * systemLayer, void * context)
+{
+    static_cast<VerificationResults *>(context)->timedOut = true;
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+}
+
+void RunUntilVerified(VerificationResults & results)
+{
+    EXPECT_EQ(SystemLayer().StartTimer(kVerificationTimeout, OnVerificationTimeout, &results), CHIP_NO_ERROR);
+    PlatformMgr().RunEventLoop();
+    SystemLayer().CancelTimer(OnVerificationTimeout, &results);
+}
+
+// Waits for the background workers to be done, then runs what they left for the Matter thread.
+void RunLeftoverWork()
+{
+    EXPECT_EQ(PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().ScheduleWork([](intptr_t) { EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR); }),
+              CHIP_NO_ERROR);
+    PlatformMgr().RunEventLoop();
+}
+
+} // namespace
+
+struct TestBatchedDACVerifier : public ::testing::Test
+{
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    }
+    static void TearDownTestSuite()
+    {
+        PlatformMgr().Shutdown();
+        Platform::MemoryShutdown();
+    }
+};
+
+TEST_F(TestBatchedDACVerifier, TestVerifyDevicesOfSameProduct)
+{
+    constexpr size_t kDeviceCount = 5;
+
+    BatchedDACVerifier verifier(GetTestAttestationTrustStore());
+    VerificationResults results;
+    results.expected = kDeviceCount;
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> onVerification(
+        OnAttestationInformationVerification, &results);
+
+    // The devices are all submitted before any result comes back, the last one with a bad attestation signature.
+    DeviceAttestation devices[kDeviceCount];
+    for (size_t i = 0; i < kDeviceCount; i++)
+    {
+        DeviceAttestationVerifier::AttestationInfo info = devices[i].Fill();
+        if (i == kDeviceCount - 1)
+        {
+            devices[i].signature[10] ^= 0xFF;
+        }
+        verifier.VerifyAttestationInformation(info, &onVerification);
+        devices[i].Clobber();
+    }
+    EXPECT_EQ(verifier.GetPendingCount(), kDeviceCount);
+    EXPECT_EQ(results.received, 0u);
+
+    RunUntilVerified(results);
+
+    EXPECT_FALSE(results.timedOut);
+    EXPECT_EQ(verifier.GetPendingCount(), 0u);
+    EXPECT_EQ(results.received, kDeviceCount);
+    EXPECT_EQ(results.success, kDeviceCount - 1);
+    EXPECT_EQ(results.signatureInvalid, 1u);
+
+    // Only the first device had its PAI, PAA and CD checked. The last one failed before its CD was looked at.
+    BatchedDACVerifier::Stats stats = verifier.GetStats();
+    EXPECT_EQ(stats.issuersVerified, 1u);
+    EXPECT_EQ(stats.issuersSaved, kDeviceCount - 1);
+    EXPECT_EQ(stats.cdSignaturesVerified, 1u);
+    EXPECT_EQ(stats.cdSignaturesSaved, kDeviceCount - 2);
+
+    // Without the verified PAI, it is checked again, but the CD signature still is not.
+    verifier.ClearVerifiedIssuers();
+    verifier.ResetStats();
+    results          = VerificationResults();
+    results.expected = 1;
+
+    DeviceAttestation device;
+    verifier.VerifyAttestationInformation(device.Fill(), &onVerification);
+    RunUntilVerified(results);
+
+    EXPECT_FALSE(results.timedOut);
+    EXPECT_EQ(results.success, 1u);
+
+    stats = verifier.GetStats();
+    EXPECT_EQ(stats.issuersVerified, 1u);
+    EXPECT_EQ(stats.issuersSaved, 0u);
+    EXPECT_EQ(stats.cdSignaturesVerified, 0u);
+    EXPECT_EQ(stats.cdSignaturesSaved, 1u);
+}
+
+TEST_F(TestBatchedDACVerifier, TestUnknownPaa)
+{
+    // A PAI whose PAA is not trusted is not remembered.
+    const ByteSpan emptyPaaStore[] = { ByteSpan() };
+    ArrayAttestationTrustStore emptyTrustStore(emptyPaaStore, 0);
+    BatchedDACVerifier verifier(&emptyTrustStore);
+
+    VerificationResults results;
+    results.expected = 2;
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> onVerification(
+        OnAttestationInformationVerification, &results);
+
+    DeviceAttestation devices[2];
+    for (DeviceAttestation & device : devices)
+    {
+        verifier.VerifyAttestationInformation(device.Fill(), &onVerification);
+    }
+    RunUntilVerified(results);
+
+    EXPECT_FALSE(results.timedOut);
+    EXPECT_EQ(results.received, 2u);
+    EXPECT_EQ(results.success, 0u);
+
+    BatchedDACVerifier::Stats stats = verifier.GetStats();
+    EXPECT_EQ(stats.issuersVerified, 0u);
+    EXPECT_EQ(stats.issuersSaved, 0u);
+}
+
+TEST_F(TestBatchedDACVerifier, TestVerifyDevicesInBackground)
+{
+    constexpr size_t kDeviceCount = 16;
+
+    ASSERT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+
+    BatchedDACVerifier verifier(GetTestAttestationTrustStore());
+    VerificationResults results;
+    results.expected = kDeviceCount;
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> onVerification(
+        OnAttestationInformationVerification, &results);
+
+    // One device in four has a bad attestation signature.
+    DeviceAttestation devices[kDeviceCount];
+    for (size_t i = 0; i < kDeviceCount; i++)
+    {
+        DeviceAttestationVerifier::AttestationInfo info = devices[i].Fill();
+        if (i % 4 == 3)
+        {
+            devices[i].signature[10] ^= 0xFF;
+        }
+        verifier.VerifyAttestationInformation(info, &onVerification);
+        devices[i].Clobber();
+    }
+
+    RunUntilVerified(results);
+
+    EXPECT_FALSE(results.timedOut);
+    EXPECT_EQ(verifier.GetPendingCount(), 0u);
+    EXPECT_EQ(results.received, kDeviceCount);
+    EXPECT_EQ(results.success, kDeviceCount * 3 / 4);
+    EXPECT_EQ(results.signatureInvalid, kDeviceCount / 4);
+
+    // Devices verified at the same time may all miss the cache, but every valid device is accounted for once. A device
+    // with an invalid signature only uses the cache when it hits it, as its signature is checked before its chain.
+    BatchedDACVerifier::Stats stats = verifier.GetStats();
+    EXPECT_GE(stats.issuersVerified, 1u);
+    EXPECT_GE(stats.issuersVerified + stats.issuersSaved, kDeviceCount * 3 / 4);
+    EXPECT_LE(stats.issuersVerified + stats.issuersSaved, kDeviceCount);
+    EXPECT_GE(stats.cdSignaturesVerified, 1u);
+    EXPECT_EQ(stats.cdSignaturesVerified + stats.cdSignaturesSaved, kDeviceCount * 3 / 4);
+
+    RunLeftoverWork();
+}
+
+TEST_F(TestBatchedDACVerifier, TestCancelVerifications)
+{
+    ASSERT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+
+    BatchedDACVerifier verifier(GetTestAttestationTrustStore());
+    VerificationResults cancelledResults;
+    VerificationResults results;
+    results.expected = 2;
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> onCancelledVerification(
+        OnAttestationInformationVerification, &cancelledResults);
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> onVerification(
+        OnAttestationInformationVerification, &results);
+
+    DeviceAttestation devices[4];
+    for (size_t i = 0; i < 4; i++)
+    {
+        verifier.VerifyAttestationInformation(devices[i].Fill(), (i % 2 == 0) ? &onCancelledVerification : &onVerification);
+    }
+
+    // Some of them may already be verified in the background.
+    verifier.CancelVerifications(&onCancelledVerification);
+    EXPECT_EQ(verifier.GetPendingCount(), 2u);
+
+    RunUntilVerified(results);
+    RunLeftoverWork();
+
+    EXPECT_FALSE(results.timedOut);
+    EXPECT_EQ(results.success, 2u);
+    EXPECT_EQ(cancelledResults.received, 0u);
+    EXPECT_EQ(verifier.GetPendingCount(), 0u);
+}
+
+TEST_F(TestBatchedDACVerifier, TestDestroyWithVerificationsPending)
+{
+    constexpr size_t kDeviceCount = 8;
+
+    ASSERT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+
+    VerificationResults results;
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> onVerification(
+        OnAttestationInformationVerification, &results);
+
+    {
+        BatchedDACVerifier verifier(GetTestAttestationTrustStore());
+        DeviceAttestation devices[kDeviceCount];
+        for (DeviceAttestation & device : devices)
+        {
+            verifier.VerifyAttestationInformation(device.Fill(), &onVerification);
+        }
+        EXPECT_EQ(verifier.GetPendingCount(), kDeviceCount);
+    }
+
+    // The results of the destroyed verifier are dropped.
+    RunLeftoverWork();
+    EXPECT_EQ(results.received, 0u);
+}
@@ -856,6 +856,70 @@ TEST_F(TestChipCert, TestChipCert_CertValidTime)
     certSet.Release();
 }
 
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+TEST_F(TestChipCert, TestChipCert_CertValidationWithVerifiedCertificateCache)
+{
+    ChipCertificateSet certSet;
+    ValidationContext validContext;
+    VerifiedCertificateCache cache;
+
+    ASSERT_EQ(certSet.Init(kStandardCertsCount), CHIP_NO_ERROR);
+    ASSERT_EQ(LoadTestCertSet01(certSet), CHIP_NO_ERROR);
+
+    validContext.Reset();
+    ASSERT_EQ(SetCurrentTime(validContext, 2021, 1, 1), CHIP_NO_ERROR);
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kClientAuth);
+    validContext.mVerifiedCertificateCache = &cache;
+
+    // The Node -> ICA and ICA -> Root signatures are only verified the first time.
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().verified, 2u);
+    EXPECT_EQ(cache.GetStats().saved, 0u);
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().verified, 2u);
+    EXPECT_EQ(cache.GetStats().saved, 2u);
+
+    // Validity periods are still checked, against the validity policy.
+    Credentials::StrictCertificateValidityPolicyExample strictCertificateValidityPolicy;
+    ASSERT_EQ(SetCurrentTime(validContext, 2020, 1, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_ERROR_CERT_NOT_VALID_YET);
+    ClearTimeSource(validContext);
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    validContext.mValidityPolicy = &strictCertificateValidityPolicy;
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_ERROR_CERT_EXPIRED);
+    validContext.mValidityPolicy = nullptr;
+    ASSERT_EQ(SetCurrentTime(validContext, 2021, 1, 1), CHIP_NO_ERROR);
+
+    // The same certificate with another signature is not found in the cache.
+    {
+        ByteSpan nodeCert;
+        ASSERT_EQ(GetTestCert(TestCert::kNode01_01, sNullLoadFlag, nodeCert), CHIP_NO_ERROR);
+        uint8_t badNodeCertBuf[kMaxCHIPCertLength];
+        ASSERT_LE(nodeCert.size(), sizeof(badNodeCertBuf));
+        memcpy(badNodeCertBuf, nodeCert.data(), nodeCert.size());
+        // The signature is the last element of the certificate structure.
+        badNodeCertBuf[nodeCert.size() - 2] ^= 0x01;
+
+        ChipCertificateSet badCertSet;
+        ASSERT_EQ(badCertSet.Init(kStandardCertsCount), CHIP_NO_ERROR);
+        ASSERT_EQ(LoadTestCert(badCertSet, TestCert::kRoot01, sNullLoadFlag, sTrustAnchorFlag), CHIP_NO_ERROR);
+        ASSERT_EQ(LoadTestCert(badCertSet, TestCert::kICA01, sNullLoadFlag, sGenTBSHashFlag), CHIP_NO_ERROR);
+        ASSERT_EQ(badCertSet.LoadCert(ByteSpan(badNodeCertBuf, nodeCert.size()), sGenTBSHashFlag), CHIP_NO_ERROR);
+        EXPECT_NE(badCertSet.ValidateCert(badCertSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+        EXPECT_NE(badCertSet.ValidateCert(badCertSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    }
+
+    // Once invalidated, the signatures are verified again.
+    cache.Invalidate();
+    cache.ResetStats();
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().verified, 2u);
+    EXPECT_EQ(cache.GetStats().saved, 0u);
+}
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
 TEST_F(TestChipCert, TestChipCert_ValidateChipRCAC)
 {
     struct RCACTestCase
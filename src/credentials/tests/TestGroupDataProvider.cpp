@@ -282,6 +282,206 @@ TEST_F(TestGroupDataProvider, TestStorageDelegate)
     EXPECT_EQ(CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, delegate.SyncGetKeyValue(kKey1, out, size));
 }
 
+TEST_F(TestGroupDataProvider, TestStorageCache)
+{
+    chip::TestPersistentStorageDelegate delegate;
+    GroupDataStorageCache cache;
+    cache.SetBackingStorage(&delegate);
+
+    char out[128];
+    uint16_t size = static_cast<uint16_t>(sizeof(out));
+
+    // Missing keys are remembered
+    EXPECT_EQ(CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, cache.SyncGetKeyValue(kKey1, out, size));
+    EXPECT_EQ(CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, cache.SyncGetKeyValue(kKey1, out, size));
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+    EXPECT_FALSE(cache.SyncDoesKeyExist(kKey1));
+
+    // Writes go through to the backing storage
+    EXPECT_EQ(cache.SyncSetKeyValue(kKey1, kValue1, static_cast<uint16_t>(kSize1)), CHIP_NO_ERROR);
+    EXPECT_TRUE(delegate.HasKey(kKey1));
+    EXPECT_TRUE(cache.SyncDoesKeyExist(kKey1));
+
+    cache.ResetStats();
+    size = static_cast<uint16_t>(sizeof(out));
+    EXPECT_EQ(cache.SyncGetKeyValue(kKey1, out, size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, kSize1);
+    EXPECT_FALSE(memcmp(out, kValue1, kSize1));
+    EXPECT_EQ(cache.GetStats().misses, 0u);
+
+    // Short reads behave like the backing storage
+    size = 3;
+    EXPECT_EQ(cache.SyncGetKeyValue(kKey1, out, size), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(size, 3u);
+    EXPECT_FALSE(memcmp(out, kValue1, 3));
+
+    // Values of a different size replace the cached copy
+    EXPECT_EQ(cache.SyncSetKeyValue(kKey1, kValue2, static_cast<uint16_t>(kSize2)), CHIP_NO_ERROR);
+    size = static_cast<uint16_t>(sizeof(out));
+    EXPECT_EQ(cache.SyncGetKeyValue(kKey1, out, size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, kSize2);
+    EXPECT_FALSE(memcmp(out, kValue2, kSize2));
+
+    // A failed write drops the cached copy, the next read goes back to storage
+    delegate.SetRejectWrites(true);
+    EXPECT_NE(cache.SyncSetKeyValue(kKey1, kValue1, static_cast<uint16_t>(kSize1)), CHIP_NO_ERROR);
+    delegate.SetRejectWrites(false);
+    cache.ResetStats();
+    size = static_cast<uint16_t>(sizeof(out));
+    EXPECT_EQ(cache.SyncGetKeyValue(kKey1, out, size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, kSize2);
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+
+    EXPECT_EQ(cache.SyncDeleteKeyValue(kKey1), CHIP_NO_ERROR);
+    EXPECT_FALSE(delegate.HasKey(kKey1));
+    size = static_cast<uint16_t>(sizeof(out));
+    EXPECT_EQ(CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, cache.SyncGetKeyValue(kKey1, out, size));
+
+    // Enough keys to grow the table several times, then drop every other one through failed writes
+    char key[PersistentStorageDelegate::kKeyLengthMax + 1];
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        snprintf(key, sizeof(key), "k/%u", i);
+        EXPECT_EQ(cache.SyncSetKeyValue(key, &i, sizeof(i)), CHIP_NO_ERROR);
+    }
+    delegate.SetRejectWrites(true);
+    for (uint16_t i = 0; i < 1000; i += 2)
+    {
+        snprintf(key, sizeof(key), "k/%u", i);
+        EXPECT_NE(cache.SyncSetKeyValue(key, &i, sizeof(i)), CHIP_NO_ERROR);
+    }
+    delegate.SetRejectWrites(false);
+    EXPECT_EQ(cache.GetRecordCount(), 501u);
+
+    cache.ResetStats();
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        uint16_t value      = 0;
+        uint16_t valueSize  = sizeof(value);
+        snprintf(key, sizeof(key), "k/%u", i);
+        EXPECT_EQ(cache.SyncGetKeyValue(key, &value, valueSize), CHIP_NO_ERROR);
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_EQ(cache.GetStats().hits, 500u);
+    EXPECT_EQ(cache.GetStats().misses, 500u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetRecordCount(), 0u);
+}
+
+TEST_F(TestGroupDataProvider, TestStorageCacheEnabled)
+{
+    chip::TestPersistentStorageDelegate delegate;
+    GroupDataProviderImpl cached(kMaxGroupsPerFabric, kMaxGroupKeysPerFabric);
+    cached.SetStorageCacheEnabled(true);
+    cached.SetStorageDelegate(&delegate);
+    cached.SetSessionKeystore(&sSessionKeystore);
+    ASSERT_EQ(cached.Init(), CHIP_NO_ERROR);
+    EXPECT_TRUE(cached.IsStorageCacheEnabled());
+
+    EXPECT_SUCCESS(cached.SetGroupInfoAt(kFabric1, 0, kGroupInfo1_1));
+    EXPECT_SUCCESS(cached.SetGroupInfoAt(kFabric1, 1, kGroupInfo1_2));
+    EXPECT_SUCCESS(cached.AddEndpoint(kFabric1, kGroup1, kEndpointId0));
+    EXPECT_SUCCESS(cached.AddEndpoint(kFabric1, kGroup1, kEndpointId2));
+    EXPECT_SUCCESS(cached.AddEndpoint(kFabric1, kGroup2, kEndpointId1));
+    EXPECT_SUCCESS(cached.SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1));
+    EXPECT_SUCCESS(cached.SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1));
+
+    // Reads are served from RAM once every record has been seen
+    GroupInfo group;
+    EXPECT_SUCCESS(cached.GetGroupInfo(kFabric1, kGroup2, group));
+    EXPECT_EQ(group, kGroupInfo1_2);
+    const uint32_t misses = cached.GetStorageCacheStats().misses;
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_SUCCESS(cached.GetGroupInfo(kFabric1, kGroup2, group));
+        EXPECT_TRUE(cached.HasEndpoint(kFabric1, kGroup1, kEndpointId0));
+        EXPECT_FALSE(cached.HasEndpoint(kFabric2, kGroup1, kEndpointId0));
+    }
+    EXPECT_EQ(cached.GetStorageCacheStats().misses - misses, 1u);
+
+    // Mutations are written through: a provider without cache over the same storage sees them
+    EXPECT_SUCCESS(cached.RemoveEndpoint(kFabric1, kGroup1, kEndpointId0));
+    EXPECT_FALSE(cached.HasEndpoint(kFabric1, kGroup1, kEndpointId0));
+
+    GroupDataProviderImpl uncached(kMaxGroupsPerFabric, kMaxGroupKeysPerFabric);
+    uncached.SetStorageDelegate(&delegate);
+    uncached.SetSessionKeystore(&sSessionKeystore);
+    ASSERT_EQ(uncached.Init(), CHIP_NO_ERROR);
+    EXPECT_FALSE(uncached.IsStorageCacheEnabled());
+    EXPECT_SUCCESS(uncached.GetGroupInfo(kFabric1, kGroup1, group));
+    EXPECT_EQ(group, kGroupInfo1_1);
+    EXPECT_FALSE(uncached.HasEndpoint(kFabric1, kGroup1, kEndpointId0));
+    EXPECT_TRUE(uncached.HasEndpoint(kFabric1, kGroup1, kEndpointId2));
+    EXPECT_TRUE(uncached.HasEndpoint(kFabric1, kGroup2, kEndpointId1));
+
+    GroupKey mapping;
+    EXPECT_SUCCESS(uncached.GetGroupKeyAt(kFabric1, 0, mapping));
+    EXPECT_EQ(mapping, kGroup1Keyset1);
+
+    // Groups looked up through the group order index
+    EXPECT_SUCCESS(cached.GetGroupInfoAt(kFabric1, 1, group));
+    EXPECT_EQ(group, kGroupInfo1_2);
+    EXPECT_SUCCESS(cached.SetGroupInfoAt(kFabric1, 2, kGroupInfo1_3));
+    EXPECT_SUCCESS(cached.GetGroupInfoAt(kFabric1, 2, group));
+    EXPECT_EQ(group, kGroupInfo1_3);
+    EXPECT_SUCCESS(cached.GetGroupInfo(kFabric1, kGroup3, group));
+    EXPECT_EQ(group, kGroupInfo1_3);
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, cached.GetGroupInfoAt(kFabric1, 3, group));
+
+    // Group sessions iterated from the session index match the ones iterated from storage, also after a write
+    Crypto::SymmetricKeyContext * keyContext = cached.GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(keyContext, nullptr);
+    const uint16_t sessionId = keyContext->GetKeyHash();
+    keyContext->Release();
+
+    auto collect = [sessionId](GroupDataProvider & provider) {
+        std::set<std::tuple<FabricIndex, GroupId, SecurityPolicy>> found;
+        GroupSession session;
+        auto it = provider.IterateGroupSessions(sessionId);
+        VerifyOrReturnValue(it != nullptr, found);
+        const size_t count = it->Count();
+        while (it->Next(session))
+        {
+            EXPECT_NE(session.keyContext, nullptr);
+            found.emplace(session.fabric_index, session.group_id, session.security_policy);
+        }
+        it->Release();
+        EXPECT_EQ(count, found.size());
+        return found;
+    };
+
+    EXPECT_EQ(collect(cached).size(), 1u);
+    EXPECT_EQ(collect(cached), collect(uncached));
+    EXPECT_SUCCESS(cached.SetGroupKeyAt(kFabric1, 1, kGroup2Keyset1));
+    EXPECT_EQ(collect(cached).size(), 2u);
+    EXPECT_EQ(collect(cached), collect(uncached));
+
+    // An indexed iteration stops if the group tables change under it
+    GroupSession session;
+    auto it = cached.IterateGroupSessions(sessionId);
+    ASSERT_NE(it, nullptr);
+    EXPECT_TRUE(it->Next(session));
+    EXPECT_SUCCESS(cached.RemoveGroupKeyAt(kFabric1, 1));
+    auto refreshed = cached.IterateGroupSessions(sessionId);
+    ASSERT_NE(refreshed, nullptr);
+    refreshed->Release();
+    EXPECT_FALSE(it->Next(session));
+    it->Release();
+
+    EXPECT_SUCCESS(cached.RemoveFabric(kFabric1));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, uncached.GetGroupInfo(kFabric1, kGroup1, group));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, cached.GetGroupInfo(kFabric1, kGroup1, group));
+
+    cached.SetStorageCacheEnabled(false);
+    EXPECT_FALSE(cached.IsStorageCacheEnabled());
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, cached.GetGroupInfo(kFabric1, kGroup1, group));
+
+    uncached.Finish();
+    cached.Finish();
+}
+
 TEST_F(TestGroupDataProvider, TestGroupInfo)
 {
     GroupDataProvider * provider = GetGroupDataProvider();
@@ -789,6 +789,56 @@ CHIP_ERROR AES_CTR_crypt(const uint8_t * input, size_t input_length, const Aes12
     return AES_CCM_encrypt(input, input_length, nullptr, 0, key, nonce, nonce_length, output, tag, kTagLen);
 }
 
+#if !(CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL)
+// Backends without per-key state: the cipher only remembers the key and uses the one-shot functions.
+void Aes128CcmCipher::Init(const Aes128KeyHandle & key)
+{
+    Release();
+    mKey = &key;
+}
+
+void Aes128CcmCipher::Release()
+{
+    mKey = nullptr;
+}
+
+CHIP_ERROR Aes128CcmCipher::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                    size_t tag_length) const
+{
+    VerifyOrReturnError(mKey != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR Aes128CcmCipher::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                    uint8_t * plaintext) const
+{
+    VerifyOrReturnError(mKey != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length, plaintext);
+}
+
+// Backends without per-key state: the context only remembers the key and uses the one-shot function.
+void HmacSha256Context::Init(const ByteSpan & key)
+{
+    Release();
+    mKey = key;
+}
+
+void HmacSha256Context::Release()
+{
+    mKey = ByteSpan();
+}
+
+CHIP_ERROR HmacSha256Context::Compute(const uint8_t * message, size_t message_length, uint8_t * out_buffer,
+                                      size_t out_length) const
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    HMAC_sha hmac;
+    return hmac.HMAC_SHA256(mKey.data(), mKey.size(), message, message_length, out_buffer, out_length);
+}
+#endif // !(CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL)
+
 CHIP_ERROR GenerateCompressedFabricId(const Crypto::P256PublicKey & root_public_key, uint64_t fabric_id,
                                       MutableByteSpan & out_compressed_fabric_id)
 {
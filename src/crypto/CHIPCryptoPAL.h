@@ -907,6 +907,62 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext);
 
+/**
+ * @brief AES-CCM-128 bound to a single key, for encrypting or decrypting many messages with it
+ *
+ * Encrypt() and Decrypt() produce exactly the same results as AES_CCM_encrypt() and AES_CCM_decrypt() called with
+ * the key given to Init(). Backends that support it set up the key once (e.g. allocate a cipher context and expand
+ * the AES key schedule) and then only process the message on each call, which is much cheaper than the one-shot
+ * functions for the short messages exchanged on a session. This is done for kAES_CCM128_Nonce_Length nonces
+ * and kAES_CCM128_Tag_Length tags, the sizes used by Matter messages; other sizes, and backends without such support,
+ * go through the one-shot functions.
+ *
+ * The key handle is referenced, not copied: it must outlive the cipher, or Release() must be called before the key
+ * is destroyed. A cipher must not be used from several threads at once. If the backend state cannot be allocated,
+ * messages go through the one-shot functions.
+ */
+class Aes128CcmCipher
+{
+public:
+    Aes128CcmCipher() = default;
+    ~Aes128CcmCipher() { Release(); }
+
+    Aes128CcmCipher(const Aes128CcmCipher &)             = delete;
+    Aes128CcmCipher & operator=(const Aes128CcmCipher &) = delete;
+
+    /**
+     * @brief Bind the cipher to a key, releasing the backend state kept for any previous key
+     */
+    void Init(const Aes128KeyHandle & key);
+
+    /**
+     * @brief Release the backend state and forget the key. Safe to call on a cipher that is not initialized.
+     */
+    void Release();
+
+    bool IsInitialized() const { return mKey != nullptr; }
+
+    /**
+     * @brief Same as AES_CCM_encrypt(), with the key given to Init()
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length) const;
+
+    /**
+     * @brief Same as AES_CCM_decrypt(), with the key given to Init()
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                       uint8_t * plaintext) const;
+
+private:
+    const Aes128KeyHandle * mKey = nullptr;
+    // Backend state kept for mKey in each direction, if the backend keeps any. Created by the first message in that
+    // direction, since session keys are only ever used in one.
+    mutable void * mEncryptContext = nullptr;
+    mutable void * mDecryptContext = nullptr;
+};
+
 /**
  * @brief A function that implements AES-CTR encryption/decryption
  *
@@ -1160,6 +1216,50 @@ public:
                                    uint8_t * out_buffer, size_t out_length);
 };
 
+/**
+ * @brief HMAC-SHA-256 bound to a single key, for authenticating many messages with it
+ *
+ * Compute() produces exactly the same results as HMAC_sha::HMAC_SHA256() called with the key given to Init(). Backends
+ * that support it process the key once (hashing the inner and outer padded key blocks) and then only hash the message
+ * on each call, which saves two of the SHA-256 blocks and the context setup of the one-shot function. Backends without
+ * such support go through the one-shot function.
+ *
+ * The key is referenced, not copied: it must outlive the context, or Release() must be called before the key is
+ * destroyed. A context must not be used from several threads at once. If the backend state cannot be allocated,
+ * messages go through the one-shot function.
+ */
+class HmacSha256Context
+{
+public:
+    HmacSha256Context() = default;
+    ~HmacSha256Context() { Release(); }
+
+    HmacSha256Context(const HmacSha256Context &)             = delete;
+    HmacSha256Context & operator=(const HmacSha256Context &) = delete;
+
+    /**
+     * @brief Bind the context to a key, releasing the backend state kept for any previous key
+     */
+    void Init(const ByteSpan & key);
+
+    /**
+     * @brief Release the backend state and forget the key. Safe to call on a context that is not initialized.
+     */
+    void Release();
+
+    bool IsInitialized() const { return mKey.data() != nullptr; }
+
+    /**
+     * @brief Same as HMAC_sha::HMAC_SHA256(), with the key given to Init()
+     */
+    CHIP_ERROR Compute(const uint8_t * message, size_t message_length, uint8_t * out_buffer, size_t out_length) const;
+
+private:
+    ByteSpan mKey;
+    // Backend state keyed with mKey, if the backend keeps any. Created by the first message.
+    mutable void * mContext = nullptr;
+};
+
 /**
  * @brief A cryptographically secure random number generator based on NIST SP800-90A
  * @param out_buffer Buffer into which to write random bytes
@@ -403,6 +403,186 @@ exit:
     return error;
 }
 
+namespace {
+
+// Whether a message can go through the contexts set up for Aes128CcmCipher, which are keyed for the nonce and tag sizes
+// of Matter messages. Everything else, including the empty message corner cases, is left to the one-shot functions.
+bool UsesCipherContext(const uint8_t * input, size_t input_length, const uint8_t * output, const uint8_t * nonce,
+                       size_t nonce_length, const uint8_t * tag, size_t tag_length)
+{
+    return input != nullptr && input_length > 0 && CanCastTo<int>(input_length) && output != nullptr && nonce != nullptr &&
+        nonce_length == kAES_CCM128_Nonce_Length && tag != nullptr && tag_length == kAES_CCM128_Tag_Length;
+}
+
+#if CHIP_CRYPTO_BORINGSSL
+using CcmContext = EVP_AEAD_CTX;
+
+// The same AEAD context seals and opens, the direction does not matter.
+CcmContext * NewCcmContext(const Aes128KeyHandle & key, int /* encrypt */)
+{
+    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+    return EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), key.As<Symmetric128BitsKeyByteArray>(),
+                            sizeof(Symmetric128BitsKeyByteArray), kAES_CCM128_Tag_Length);
+}
+
+void FreeCcmContext(void * context)
+{
+    EVP_AEAD_CTX_free(static_cast<CcmContext *>(context));
+}
+#else
+using CcmContext = EVP_CIPHER_CTX;
+
+// An OpenSSL CCM context only works in the direction it was keyed for. The nonce and tag lengths are part of the key
+// setup, so they have to be set before the key; each message then only sets its nonce, which is all OpenSSL needs to
+// start a new message with the same key.
+CcmContext * NewCcmContext(const Aes128KeyHandle & key, int encrypt)
+{
+    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnValue(context != nullptr, nullptr);
+    if (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, encrypt) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(kAES_CCM128_Nonce_Length), nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(kAES_CCM128_Tag_Length), nullptr) != 1 ||
+        EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, encrypt) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+    return context;
+}
+
+void FreeCcmContext(void * context)
+{
+    // Also clears the expanded key.
+    EVP_CIPHER_CTX_free(static_cast<CcmContext *>(context));
+}
+#endif // CHIP_CRYPTO_BORINGSSL
+
+// Returns the context of one direction of a cipher, creating it on first use.
+CcmContext * GetCcmContext(void *& context, const Aes128KeyHandle & key, int encrypt)
+{
+    if (context == nullptr)
+    {
+        context = NewCcmContext(key, encrypt);
+    }
+    return static_cast<CcmContext *>(context);
+}
+
+} // namespace
+
+void Aes128CcmCipher::Init(const Aes128KeyHandle & key)
+{
+    Release();
+    mKey = &key;
+}
+
+void Aes128CcmCipher::Release()
+{
+    if (mEncryptContext != nullptr)
+    {
+        FreeCcmContext(mEncryptContext);
+        mEncryptContext = nullptr;
+    }
+    if (mDecryptContext != nullptr)
+    {
+        FreeCcmContext(mDecryptContext);
+        mDecryptContext = nullptr;
+    }
+    mKey = nullptr;
+}
+
+CHIP_ERROR Aes128CcmCipher::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                    size_t tag_length) const
+{
+    VerifyOrReturnError(mKey != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CcmContext * context = GetCcmContext(mEncryptContext, *mKey, 1);
+    if (context == nullptr || !UsesCipherContext(plaintext, plaintext_length, ciphertext, nonce, nonce_length, tag, tag_length))
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag,
+                               tag_length);
+    }
+
+#if CHIP_CRYPTO_BORINGSSL
+    size_t written_tag_len = 0;
+    VerifyOrReturnError(EVP_AEAD_CTX_seal_scatter(context, ciphertext, tag, &written_tag_len, tag_length, nonce, nonce_length,
+                                                  plaintext, plaintext_length, nullptr, 0, aad, aad_length) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(written_tag_len == tag_length, CHIP_ERROR_INTERNAL);
+#else
+    int bytesWritten = 0;
+
+    VerifyOrReturnError(EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad),
+                                              static_cast<int>(aad_length)) == 1,
+                            CHIP_ERROR_INTERNAL);
+    }
+    VerifyOrReturnError(EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                                          static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten == static_cast<int>(plaintext_length), CHIP_ERROR_INTERNAL);
+    // CCM has no final block: this only completes the message.
+    VerifyOrReturnError(EVP_EncryptFinal_ex(context, Uint8::to_uchar(ciphertext) + plaintext_length, &bytesWritten) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten == 0, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag)) == 1,
+                        CHIP_ERROR_INTERNAL);
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Aes128CcmCipher::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                    uint8_t * plaintext) const
+{
+    VerifyOrReturnError(mKey != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CcmContext * context = GetCcmContext(mDecryptContext, *mKey, 0);
+    if (context == nullptr || !UsesCipherContext(ciphertext, ciphertext_length, plaintext, nonce, nonce_length, tag, tag_length))
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                               plaintext);
+    }
+
+#if CHIP_CRYPTO_BORINGSSL
+    VerifyOrReturnError(EVP_AEAD_CTX_open_gather(context, plaintext, nonce, nonce_length, ciphertext, ciphertext_length, tag,
+                                                 tag_length, aad, aad_length) == 1,
+                        CHIP_ERROR_INTERNAL);
+#else
+    int bytesOutput = 0;
+
+    // The expected tag can only be set once the nonce has started a new message.
+    VerifyOrReturnError(EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                            const_cast<void *>(static_cast<const void *>(tag))) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad),
+                                              static_cast<int>(aad_length)) == 1,
+                            CHIP_ERROR_INTERNAL);
+    }
+    // Fails, without any output, if the tag does not match.
+    VerifyOrReturnError(EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                                          static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
@@ -655,6 +835,65 @@ CHIP_ERROR HMAC_sha::HMAC_SHA256(const Hmac128KeyHandle & key, const uint8_t * m
                        out_buffer, out_length);
 }
 
+void HmacSha256Context::Init(const ByteSpan & key)
+{
+    Release();
+    mKey = key;
+}
+
+void HmacSha256Context::Release()
+{
+    if (mContext != nullptr)
+    {
+        // Also clears the padded key blocks.
+        HMAC_CTX_free(static_cast<HMAC_CTX *>(mContext));
+        mContext = nullptr;
+    }
+    mKey = ByteSpan();
+}
+
+CHIP_ERROR HmacSha256Context::Compute(const uint8_t * message, size_t message_length, uint8_t * out_buffer,
+                                      size_t out_length) const
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Same argument checks as the one-shot function, so that both report the same errors.
+    VerifyOrReturnError(!mKey.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(message != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(message_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(out_length >= kSHA256_Hash_Length, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(out_buffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mContext == nullptr)
+    {
+        VerifyOrReturnError(CanCastTo<boringssl_size_t_openssl_int>(mKey.size()), CHIP_ERROR_INVALID_ARGUMENT);
+        HMAC_CTX * context = HMAC_CTX_new();
+        if (context != nullptr &&
+            HMAC_Init_ex(context, Uint8::to_const_uchar(mKey.data()), static_cast<boringssl_size_t_openssl_int>(mKey.size()),
+                         EVP_sha256(), nullptr) != 1)
+        {
+            HMAC_CTX_free(context);
+            context = nullptr;
+        }
+        mContext = context;
+    }
+
+    if (mContext == nullptr)
+    {
+        HMAC_sha hmac;
+        return hmac.HMAC_SHA256(mKey.data(), mKey.size(), message, message_length, out_buffer, out_length);
+    }
+
+    // Without a key or digest, HMAC_Init_ex() starts a new message from the padded key blocks of the previous call.
+    HMAC_CTX * context       = static_cast<HMAC_CTX *>(mContext);
+    unsigned int mac_out_len = static_cast<unsigned int>(CHIP_CRYPTO_HASH_LEN_BYTES);
+    VerifyOrReturnError(HMAC_Init_ex(context, nullptr, 0, nullptr, nullptr) == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(HMAC_Update(context, Uint8::to_const_uchar(message), message_length) == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(HMAC_Final(context, Uint8::to_uchar(out_buffer), &mac_out_len) == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR PBKDF2_sha256::pbkdf2_sha256(const uint8_t * password, size_t plen, const uint8_t * salt, size_t slen,
                                         unsigned int iteration_count, uint32_t key_length, uint8_t * output)
 {
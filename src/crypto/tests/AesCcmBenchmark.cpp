@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures AES-CCM-128 message throughput, as messages per second that are
+ *      encrypted and then decrypted, for payload sizes typical of Matter
+ *      messages (from a status response to a large subscription report):
+ *
+ *        - one_shot_msgs_per_s: AES_CCM_encrypt() and AES_CCM_decrypt(), which
+ *          set up the cipher for every message.
+ *        - cipher_msgs_per_s: Aes128CcmCipher, which secure sessions use to set
+ *          up the cipher once per session key.
+ */
+
+#include <benchmarks/BenchmarkHelpers.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr size_t kPayloadSizes[] = { 32, 128, 512, 1024 };
+constexpr size_t kMaxPayloadSize = 1024;
+constexpr size_t kMessages       = 100000;
+// A message header with a source node id, used as additional authenticated data.
+constexpr size_t kAadSize = 16;
+
+const ResultWriter gResults("aes-ccm", "payload_bytes");
+
+uint8_t gPlaintext[kMaxPayloadSize];
+uint8_t gCiphertext[kMaxPayloadSize];
+uint8_t gDecrypted[kMaxPayloadSize];
+uint8_t gAad[kAadSize];
+
+// Runs kMessages encrypt/decrypt round trips with successive nonces, as a session does, and returns messages per second.
+template <typename Encrypt, typename Decrypt>
+double MeasureRoundTrips(size_t payloadSize, Encrypt && encrypt, Decrypt && decrypt)
+{
+    uint8_t nonce[kAES_CCM128_Nonce_Length] = {};
+    uint8_t tag[kAES_CCM128_Tag_Length];
+
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kMessages; i++)
+    {
+        memcpy(&nonce[1], &i, sizeof(uint32_t));
+        VerifyOrDie(encrypt(payloadSize, nonce, tag) == CHIP_NO_ERROR);
+        VerifyOrDie(decrypt(payloadSize, nonce, tag) == CHIP_NO_ERROR);
+    }
+    const double seconds = SecondsSince(start);
+
+    VerifyOrDie(memcmp(gDecrypted, gPlaintext, payloadSize) == 0);
+    return static_cast<double>(kMessages) / seconds;
+}
+
+void RunBenchmark(const Aes128KeyHandle & key, size_t payloadSize)
+{
+    const double oneShot = MeasureRoundTrips(
+        payloadSize,
+        [&](size_t size, const uint8_t * nonce, uint8_t * tag) {
+            return AES_CCM_encrypt(gPlaintext, size, gAad, sizeof(gAad), key, nonce, kAES_CCM128_Nonce_Length, gCiphertext, tag,
+                                   kAES_CCM128_Tag_Length);
+        },
+        [&](size_t size, const uint8_t * nonce, const uint8_t * tag) {
+            return AES_CCM_decrypt(gCiphertext, size, gAad, sizeof(gAad), tag, kAES_CCM128_Tag_Length, key, nonce,
+                                   kAES_CCM128_Nonce_Length, gDecrypted);
+        });
+
+    // Sessions use one cipher per direction.
+    Aes128CcmCipher encryptCipher;
+    Aes128CcmCipher decryptCipher;
+    encryptCipher.Init(key);
+    decryptCipher.Init(key);
+    const double cipher = MeasureRoundTrips(
+        payloadSize,
+        [&](size_t size, const uint8_t * nonce, uint8_t * tag) {
+            return encryptCipher.Encrypt(gPlaintext, size, gAad, sizeof(gAad), nonce, kAES_CCM128_Nonce_Length, gCiphertext, tag,
+                                         kAES_CCM128_Tag_Length);
+        },
+        [&](size_t size, const uint8_t * nonce, const uint8_t * tag) {
+            return decryptCipher.Decrypt(gCiphertext, size, gAad, sizeof(gAad), tag, kAES_CCM128_Tag_Length, nonce,
+                                         kAES_CCM128_Nonce_Length, gDecrypted);
+        });
+
+    gResults.Print(payloadSize, "one_shot_msgs_per_s", Better::kHigher, oneShot);
+    gResults.Print(payloadSize, "cipher_msgs_per_s", Better::kHigher, cipher);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < sizeof(gPlaintext); i++)
+    {
+        gPlaintext[i] = static_cast<uint8_t>(i);
+    }
+    for (size_t i = 0; i < sizeof(gAad); i++)
+    {
+        gAad[i] = static_cast<uint8_t>(0xa0 + i);
+    }
+
+    Symmetric128BitsKeyByteArray keyMaterial;
+    memset(keyMaterial, 0x5a, sizeof(keyMaterial));
+    DefaultSessionKeystore keystore;
+    Aes128KeyHandle key;
+    VerifyOrDie(keystore.CreateKey(keyMaterial, key) == CHIP_NO_ERROR);
+
+    gResults.PrintHeader();
+    for (size_t payloadSize : kPayloadSizes)
+    {
+        RunBenchmark(key, payloadSize);
+    }
+
+    keystore.DestroyKey(key);
+    Platform::MemoryShutdown();
+    return 0;
+}
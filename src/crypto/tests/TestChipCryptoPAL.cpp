@@ -547,6 +547,116 @@ TEST_F(TestChipCryptoPAL, TestAES_CCM_128InPlaceDecryption)
     EXPECT_GT(numOfTestsRan, 0);
 }
 
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128CipherTestVectors)
+{
+    HeapChecker heapChecker;
+    int numOfTestVectors = MATTER_ARRAY_SIZE(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        numOfTestsRan++;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+        uint8_t * out_ct_ptr = nullptr;
+        uint8_t * out_pt_ptr = nullptr;
+        if (vector->ct_len > 0)
+        {
+            ASSERT_TRUE(out_ct.Alloc(vector->ct_len));
+            ASSERT_TRUE(out_pt.Alloc(vector->pt_len));
+            out_ct_ptr = out_ct.Get();
+            out_pt_ptr = out_pt.Get();
+        }
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+        ASSERT_TRUE(out_tag.Alloc(vector->tag_len));
+
+        TestAesKey key(vector->key, vector->key_len);
+        Aes128CcmCipher cipher;
+        cipher.Init(key.key);
+
+        // Twice, to check that the cipher can be reused.
+        for (int round = 0; round < 2; round++)
+        {
+            CHIP_ERROR err = cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce,
+                                            vector->nonce_len, out_ct_ptr, out_tag.Get(), vector->tag_len);
+            EXPECT_EQ(err, vector->result);
+            if (vector->result == CHIP_NO_ERROR)
+            {
+                EXPECT_TRUE((vector->ct_len == 0) || (memcmp(out_ct_ptr, vector->ct, vector->ct_len) == 0));
+                EXPECT_EQ(memcmp(out_tag.Get(), vector->tag, vector->tag_len), 0);
+            }
+
+            err = cipher.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                 vector->nonce, vector->nonce_len, out_pt_ptr);
+            EXPECT_EQ(err, vector->result);
+            if (vector->result == CHIP_NO_ERROR)
+            {
+                EXPECT_TRUE((vector->pt_len == 0) || (memcmp(out_pt_ptr, vector->pt, vector->pt_len) == 0));
+            }
+        }
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128CipherMatchesOneShot)
+{
+    HeapChecker heapChecker;
+    const uint8_t keyBytes[kAES_CCM128_Key_Length] = { 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+                                                       0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf };
+    const uint8_t aad[]                            = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+    TestAesKey key(keyBytes, sizeof(keyBytes));
+
+    Aes128CcmCipher cipher;
+    EXPECT_FALSE(cipher.IsInitialized());
+    cipher.Init(key.key);
+    EXPECT_TRUE(cipher.IsInitialized());
+
+    uint8_t plaintext[300];
+    uint8_t expected[sizeof(plaintext)];
+    uint8_t expectedTag[kAES_CCM128_Tag_Length];
+    uint8_t output[sizeof(plaintext)];
+    uint8_t tag[kAES_CCM128_Tag_Length];
+    uint8_t nonce[kAES_CCM128_Nonce_Length] = {};
+
+    for (size_t i = 0; i < sizeof(plaintext); i++)
+    {
+        plaintext[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    // Messages of many sizes with successive nonces, as a session sends them.
+    for (size_t length = 1; length <= sizeof(plaintext); length += 23)
+    {
+        nonce[1] = static_cast<uint8_t>(length);
+
+        EXPECT_EQ(AES_CCM_encrypt(plaintext, length, aad, sizeof(aad), key.key, nonce, sizeof(nonce), expected, expectedTag,
+                                  sizeof(expectedTag)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(cipher.Encrypt(plaintext, length, aad, sizeof(aad), nonce, sizeof(nonce), output, tag, sizeof(tag)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(output, expected, length), 0);
+        EXPECT_EQ(memcmp(tag, expectedTag, sizeof(tag)), 0);
+
+        // A message that fails to authenticate does not affect the next ones.
+        tag[0] ^= 1;
+        EXPECT_NE(cipher.Decrypt(expected, length, aad, sizeof(aad), tag, sizeof(tag), nonce, sizeof(nonce), output),
+                  CHIP_NO_ERROR);
+        tag[0] ^= 1;
+
+        // In place, as the session does.
+        memcpy(output, expected, length);
+        EXPECT_EQ(cipher.Decrypt(output, length, aad, sizeof(aad), tag, sizeof(tag), nonce, sizeof(nonce), output), CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(output, plaintext, length), 0);
+    }
+
+    cipher.Release();
+    EXPECT_FALSE(cipher.IsInitialized());
+    EXPECT_EQ(cipher.Encrypt(plaintext, 1, aad, sizeof(aad), nonce, sizeof(nonce), output, tag, sizeof(tag)),
+              CHIP_ERROR_INCORRECT_STATE);
+}
+
 TEST_F(TestChipCryptoPAL, TestAES_CCM_128EncryptInvalidNonceLen)
 {
     HeapChecker heapChecker;
@@ -1180,6 +1290,69 @@ TEST_F(TestChipCryptoPAL, TestHMAC_SHA256_RawKey_PsaFailurePropagates)
 }
 #endif
 
+TEST_F(TestChipCryptoPAL, TestHMAC_SHA256_ContextTestVectors)
+{
+    HeapChecker heapChecker;
+    int numOfTestCases     = MATTER_ARRAY_SIZE(hmac_sha256_test_vectors_raw_key);
+    int numOfTestsExecuted = 0;
+
+    for (numOfTestsExecuted = 0; numOfTestsExecuted < numOfTestCases; numOfTestsExecuted++)
+    {
+        hmac_sha256_vector v = hmac_sha256_test_vectors_raw_key[numOfTestsExecuted];
+        uint8_t out_buffer[kSHA256_Hash_Length];
+        HmacSha256Context context;
+        context.Init(ByteSpan(v.key, v.key_length));
+
+        // Twice, as the second message starts from the state kept by the first one.
+        for (int i = 0; i < 2; i++)
+        {
+            EXPECT_SUCCESS(context.Compute(v.message, v.message_length, out_buffer, sizeof(out_buffer)));
+            EXPECT_EQ(memcmp(v.output_hash, out_buffer, v.output_hash_length), 0);
+        }
+    }
+    EXPECT_EQ(numOfTestsExecuted, numOfTestCases);
+}
+
+TEST_F(TestChipCryptoPAL, TestHMAC_SHA256_ContextMatchesOneShot)
+{
+    HeapChecker heapChecker;
+    const uint8_t key1[] = { 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b };
+    const uint8_t key2[] = { 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf };
+    TestHMAC_sha mHMAC;
+
+    HmacSha256Context context;
+    EXPECT_FALSE(context.IsInitialized());
+
+    uint8_t message[200];
+    uint8_t expected[kSHA256_Hash_Length];
+    uint8_t output[kSHA256_Hash_Length];
+    for (size_t i = 0; i < sizeof(message); i++)
+    {
+        message[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    // Binding the context to another key restarts from that key.
+    for (const ByteSpan & key : { ByteSpan(key1), ByteSpan(key2) })
+    {
+        context.Init(key);
+        EXPECT_TRUE(context.IsInitialized());
+
+        for (size_t length = 1; length <= sizeof(message); length += 17)
+        {
+            EXPECT_SUCCESS(mHMAC.HMAC_SHA256(key.data(), key.size(), message, length, expected, sizeof(expected)));
+            EXPECT_SUCCESS(context.Compute(message, length, output, sizeof(output)));
+            EXPECT_EQ(memcmp(output, expected, sizeof(output)), 0);
+        }
+    }
+
+    EXPECT_EQ(context.Compute(message, 0, output, sizeof(output)), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(context.Compute(message, sizeof(message), output, sizeof(output) - 1), CHIP_ERROR_INVALID_ARGUMENT);
+
+    context.Release();
+    EXPECT_FALSE(context.IsInitialized());
+    EXPECT_EQ(context.Compute(message, sizeof(message), output, sizeof(output)), CHIP_ERROR_INCORRECT_STATE);
+}
+
 #if !(CHIP_CRYPTO_KEYSTORE_APP)
 TEST_F(TestChipCryptoPAL, TestHMAC_SHA256_KeyHandle)
 {
@@ -255,6 +255,7 @@ CHIP_ERROR CodeDrivenDataModelProvider::AddEndpoint(EndpointInterfaceRegistratio
     }
 
     ReturnErrorOnFailure(mEndpointInterfaceRegistry.Register(registration));
+    mEndpointGeneration++;
 
     if (mServerClusterContext.has_value())
     {
@@ -320,7 +321,9 @@ CHIP_ERROR CodeDrivenDataModelProvider::RemoveEndpoint(EndpointId endpointId, Cl
         }
     }
 
-    return mEndpointInterfaceRegistry.Unregister(endpointId);
+    ReturnErrorOnFailure(mEndpointInterfaceRegistry.Unregister(endpointId));
+    mEndpointGeneration++;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR CodeDrivenDataModelProvider::AddCluster(ServerClusterRegistration & entry)
@@ -197,9 +197,16 @@ public:
     CHIP_ERROR RemoveCluster(ServerClusterInterface * entry,
                              ClusterShutdownType shutdownType = ClusterShutdownType::kClusterShutdown);
 
+protected:
+    std::optional<unsigned> MetadataStructureGeneration() override
+    {
+        return mEndpointGeneration + mServerClusterRegistry.Generation();
+    }
+
 private:
     EndpointInterfaceRegistry mEndpointInterfaceRegistry;
     ServerClusterInterfaceRegistry mServerClusterRegistry;
+    unsigned mEndpointGeneration = 0; // changes on every AddEndpoint/RemoveEndpoint
     std::optional<ServerClusterContext> mServerClusterContext;
     std::optional<DataModel::InteractionModelContext> mInteractionModelContext;
     PersistentStorageDelegate & mPersistentStorageDelegate;
@@ -424,6 +424,12 @@ CHIP_ERROR CodegenDataModelProvider::ClientClusters(EndpointId endpointId, ReadO
     return CHIP_NO_ERROR;
 }
 
+std::optional<unsigned> CodegenDataModelProvider::MetadataStructureGeneration()
+{
+    // Ember endpoints are enabled/disabled and code-driven clusters registered at runtime
+    return emberAfMetadataStructureGeneration() + mRegistry.Generation();
+}
+
 const EmberAfCluster * CodegenDataModelProvider::FindServerCluster(const ConcreteClusterPath & path)
 {
     if (mPreviouslyFoundCluster.has_value() && (mPreviouslyFoundCluster->path == path) &&
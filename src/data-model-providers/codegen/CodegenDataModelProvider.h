@@ -96,6 +96,8 @@ protected:
     // It is expected to be removed or replaced with a proper implementation in the future.TODO:(#36837).
     virtual void InitDataModelForTesting();
 
+    std::optional<unsigned> MetadataStructureGeneration() override;
+
 private:
     // Context is available after startup and cleared in shutdown.
     // This has a value for as long as we assume the context is valid.
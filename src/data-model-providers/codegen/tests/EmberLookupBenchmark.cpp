@@ -0,0 +1,243 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures how fast ember attribute storage finds attributes, as attribute
+ *      reads per second, for nodes from a few endpoints to a bridge with as many
+ *      dynamic endpoints as it can have. Each read looks the attribute up twice,
+ *      for its metadata and then for its value, as the codegen data model does:
+ *
+ *        - scan_reads_per_s: scanning all the endpoints, then the clusters and
+ *          attributes of the endpoint (the lookup without the index).
+ *        - index_reads_per_s: EndpointLookupIndex, then the clusters and
+ *          attributes of the endpoint.
+ *        - metadata_index_reads_per_s: EndpointLookupIndex, then
+ *          MetadataLookupIndex for the cluster and attribute.
+ *        - cached_reads_per_s: AttributeLookupCache, falling back to the index.
+ */
+
+#include <app-common/zap-generated/attribute-type.h>
+#include <app/util/af-types.h>
+#include <app/util/attribute-metadata.h>
+#include <app/util/ember-lookup-index.h>
+#include <benchmarks/BenchmarkHelpers.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+#include <array>
+#include <utility>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::app;
+using namespace chip::app::Compatibility::Internal;
+using chip::Protocols::InteractionModel::Status;
+
+namespace {
+
+constexpr uint16_t kEndpointCounts[]     = { 4, 32, 254 };
+constexpr uint16_t kMaxEndpointCount     = 254;
+constexpr uint8_t kClustersPerEndpoint   = 12;
+constexpr uint16_t kAttributesPerCluster = 20;
+constexpr size_t kAttributesPerEndpoint  = kClustersPerEndpoint * kAttributesPerCluster;
+constexpr size_t kReads                  = 1000000;
+constexpr ClusterId kFirstClusterId      = 0x0003;
+constexpr ClusterId kClusterIdStep       = 0x0020;
+// The endpoints share their endpoint type, as bridged devices of the same kind do.
+constexpr size_t kMetadataIndexSize = kClustersPerEndpoint * (1 + kAttributesPerCluster) + 1;
+
+const ResultWriter gResults("ember-lookup", "endpoints");
+
+#if CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE > 0
+constexpr size_t kCacheSize = CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE;
+#else
+constexpr size_t kCacheSize = 16;
+#endif
+
+// Bridged device attributes, stored by the application.
+constexpr EmberAfAttributeMetadata Attribute(AttributeId id)
+{
+    return EmberAfAttributeMetadata{
+        .defaultValue  = EmberAfDefaultOrMinMaxAttributeValue(static_cast<uint32_t>(0)),
+        .attributeId   = id,
+        .size          = 4,
+        .attributeType = ZCL_INT32U_ATTRIBUTE_TYPE,
+        .mask          = MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE,
+    };
+}
+
+template <size_t... kIds>
+constexpr std::array<EmberAfAttributeMetadata, sizeof...(kIds)> MakeAttributes(std::index_sequence<kIds...>)
+{
+    return { { Attribute(kIds)... } };
+}
+
+constexpr auto gAttributes = MakeAttributes(std::make_index_sequence<kAttributesPerCluster>());
+
+EmberAfCluster gClusters[kClustersPerEndpoint];
+EmberAfEndpointType gEndpointType;
+EmberAfDefinedEndpoint gEndpoints[kMaxEndpointCount];
+
+ClusterId ClusterIdAt(size_t index)
+{
+    return static_cast<ClusterId>(kFirstClusterId + index * kClusterIdStep);
+}
+
+void DefineEndpoints()
+{
+    for (uint8_t i = 0; i < kClustersPerEndpoint; i++)
+    {
+        gClusters[i] = EmberAfCluster{ ClusterIdAt(i), gAttributes.data(), kAttributesPerCluster, 0, MATTER_CLUSTER_FLAG_SERVER,
+                                       nullptr,        nullptr,            nullptr,               nullptr, 0 };
+    }
+    gEndpointType = { gClusters, kClustersPerEndpoint, 0 };
+
+    // Endpoint ids do not follow the endpoint order, as after a bridge removed and added devices.
+    for (uint16_t i = 0; i < kMaxEndpointCount; i++)
+    {
+        gEndpoints[i].endpoint     = static_cast<EndpointId>(1 + ScrambledIndex(i, kMaxEndpointCount));
+        gEndpoints[i].endpointType = &gEndpointType;
+        gEndpoints[i].bitmask.Set(EmberAfEndpointOptions::isEnabled);
+    }
+}
+
+// The attribute search of ember attribute storage without the lookup index.
+Status ScanForAttribute(uint16_t endpointCount, EndpointId endpoint, ClusterId clusterId, AttributeId attributeId,
+                        AttributeLocation & location)
+{
+    for (uint16_t ep = 0; ep < endpointCount; ep++)
+    {
+        if (gEndpoints[ep].endpoint == endpoint && gEndpoints[ep].bitmask.Has(EmberAfEndpointOptions::isEnabled))
+        {
+            location.endpointIndex = ep;
+            location.storageOffset = 0;
+            return FindServerAttribute(gEndpoints[ep].endpointType, clusterId, attributeId, &location.metadata,
+                                       location.storageOffset);
+        }
+    }
+    return Status::UnsupportedEndpoint;
+}
+
+template <typename Lookup>
+double MeasureReads(uint16_t endpointCount, Lookup && lookup)
+{
+    const size_t attributeCount = endpointCount * kAttributesPerEndpoint;
+    size_t found                = 0;
+
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kReads; i++)
+    {
+        const size_t index         = ScrambledIndex(i, attributeCount);
+        const size_t endpointIndex = index / kAttributesPerEndpoint;
+        const ClusterId clusterId  = ClusterIdAt((index / kAttributesPerCluster) % kClustersPerEndpoint);
+        const auto attributeId     = static_cast<AttributeId>(index % kAttributesPerCluster);
+
+        for (int pass = 0; pass < 2; pass++)
+        {
+            AttributeLocation location;
+            if (lookup(gEndpoints[endpointIndex].endpoint, clusterId, attributeId, location) == Status::Success &&
+                location.endpointIndex == endpointIndex && location.metadata->attributeId == attributeId)
+            {
+                found++;
+            }
+        }
+    }
+    const double seconds = SecondsSince(start);
+
+    VerifyOrDie(found == 2 * kReads);
+    return static_cast<double>(kReads) / seconds;
+}
+
+void RunBenchmark(uint16_t endpointCount)
+{
+    EndpointLookupIndex<kMaxEndpointCount> index;
+    index.Rebuild(gEndpoints, kMaxEndpointCount);
+    AttributeLookupCache<kCacheSize> cache;
+
+    auto indexLookup = [&](EndpointId endpoint, ClusterId clusterId, AttributeId attributeId, AttributeLocation & location) {
+        uint16_t ep = index.Find(gEndpoints, endpointCount, endpoint, true /* ignoreDisabledEndpoints */);
+        VerifyOrReturnValue(ep != decltype(index)::kInvalidIndex, Status::UnsupportedEndpoint);
+        location.endpointIndex = ep;
+        location.storageOffset = 0;
+        return FindServerAttribute(gEndpoints[ep].endpointType, clusterId, attributeId, &location.metadata,
+                                   location.storageOffset);
+    };
+
+    const double scan = MeasureReads(endpointCount, [&](EndpointId endpoint, ClusterId clusterId, AttributeId attributeId,
+                                                        AttributeLocation & location) {
+        return ScanForAttribute(endpointCount, endpoint, clusterId, attributeId, location);
+    });
+
+    const double indexed = MeasureReads(endpointCount, indexLookup);
+
+    MetadataLookupIndex<kMetadataIndexSize> metadataIndex;
+    metadataIndex.Rebuild(gEndpoints, kMaxEndpointCount);
+    const double metadataIndexed = MeasureReads(endpointCount, [&](EndpointId endpoint, ClusterId clusterId,
+                                                                   AttributeId attributeId, AttributeLocation & location) {
+        uint16_t ep = index.Find(gEndpoints, endpointCount, endpoint, true /* ignoreDisabledEndpoints */);
+        VerifyOrReturnValue(ep != decltype(index)::kInvalidIndex, Status::UnsupportedEndpoint);
+        location.endpointIndex = ep;
+        location.storageOffset = 0;
+        Status status          = Status::Failure;
+        VerifyOrDie(metadataIndex.FindServerAttribute(gEndpoints[ep].endpointType, clusterId, attributeId, status,
+                                                      &location.metadata, location.storageOffset));
+        return status;
+    });
+
+    const double cached = MeasureReads(endpointCount, [&](EndpointId endpoint, ClusterId clusterId, AttributeId attributeId,
+                                                          AttributeLocation & location) {
+        // Same checks as ember attribute storage does on a cache hit.
+        if (cache.Find(endpoint, clusterId, attributeId, location) && location.endpointIndex < endpointCount &&
+            gEndpoints[location.endpointIndex].endpoint == endpoint &&
+            gEndpoints[location.endpointIndex].bitmask.Has(EmberAfEndpointOptions::isEnabled))
+        {
+            return Status::Success;
+        }
+        Status status = indexLookup(endpoint, clusterId, attributeId, location);
+        if (status == Status::Success)
+        {
+            cache.Insert(endpoint, clusterId, attributeId, location);
+        }
+        return status;
+    });
+
+    gResults.Print(endpointCount, "scan_reads_per_s", Better::kHigher, scan);
+    gResults.Print(endpointCount, "index_reads_per_s", Better::kHigher, indexed);
+    gResults.Print(endpointCount, "metadata_index_reads_per_s", Better::kHigher, metadataIndexed);
+    gResults.Print(endpointCount, "cached_reads_per_s", Better::kHigher, cached);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    DefineEndpoints();
+
+    gResults.PrintHeader();
+    for (uint16_t endpointCount : kEndpointCounts)
+    {
+        RunBenchmark(endpointCount);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
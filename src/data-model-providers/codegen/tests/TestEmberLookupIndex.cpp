@@ -0,0 +1,266 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/attribute-type.h>
+#include <app/util/af-types.h>
+#include <app/util/attribute-metadata.h>
+#include <app/util/ember-lookup-index.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/CodeUtils.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Compatibility::Internal;
+using chip::Protocols::InteractionModel::Status;
+
+namespace {
+
+constexpr EmberAfAttributeMetadata Attribute(AttributeId id, uint16_t size, EmberAfAttributeMask mask = 0)
+{
+    return EmberAfAttributeMetadata{
+        .defaultValue  = EmberAfDefaultOrMinMaxAttributeValue(static_cast<uint32_t>(0)),
+        .attributeId   = id,
+        .size          = size,
+        .attributeType = ZCL_INT32U_ATTRIBUTE_TYPE,
+        .mask          = mask,
+    };
+}
+
+constexpr EmberAfCluster Cluster(ClusterId id, const EmberAfAttributeMetadata * attributes, uint16_t attributeCount,
+                                 uint16_t clusterSize, EmberAfClusterMask mask)
+{
+    return EmberAfCluster{ id, attributes, attributeCount, clusterSize, mask, nullptr, nullptr, nullptr, nullptr, 0 };
+}
+
+const EmberAfAttributeMetadata kClusterAttributes[] = {
+    Attribute(1, 4),
+    Attribute(2, 2, MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE),
+    Attribute(3, 1),
+    Attribute(4, 8),
+};
+
+// Storage of the attributes that are not externally stored.
+constexpr uint16_t kClusterSize = 4 + 1 + 8;
+
+const EmberAfCluster kClusters[] = {
+    Cluster(0x10, kClusterAttributes, MATTER_ARRAY_SIZE(kClusterAttributes), kClusterSize, MATTER_CLUSTER_FLAG_CLIENT),
+    Cluster(0x10, kClusterAttributes, MATTER_ARRAY_SIZE(kClusterAttributes), kClusterSize, MATTER_CLUSTER_FLAG_SERVER),
+    Cluster(0x20, kClusterAttributes, MATTER_ARRAY_SIZE(kClusterAttributes), kClusterSize, MATTER_CLUSTER_FLAG_SERVER),
+};
+
+const EmberAfEndpointType kEndpointType = { kClusters, MATTER_ARRAY_SIZE(kClusters), 3 * kClusterSize };
+
+EmberAfDefinedEndpoint DefinedEndpoint(EndpointId id, bool enabled)
+{
+    EmberAfDefinedEndpoint endpoint;
+    endpoint.endpoint     = id;
+    endpoint.endpointType = &kEndpointType;
+    endpoint.bitmask.Set(EmberAfEndpointOptions::isEnabled, enabled);
+    return endpoint;
+}
+
+TEST(TestEmberLookupIndex, TestEndpointLookup)
+{
+    EmberAfDefinedEndpoint endpoints[6] = {
+        DefinedEndpoint(0, true), DefinedEndpoint(7, true),                    DefinedEndpoint(3, false),
+        DefinedEndpoint(3, true), DefinedEndpoint(kInvalidEndpointId, false), DefinedEndpoint(5, true),
+    };
+    constexpr uint16_t kEndpointCount = MATTER_ARRAY_SIZE(endpoints);
+    constexpr uint16_t kInvalidIndex  = EndpointLookupIndex<kEndpointCount>::kInvalidIndex;
+
+    EndpointLookupIndex<kEndpointCount> index;
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 0, false), kInvalidIndex);
+
+    index.Rebuild(endpoints, kEndpointCount);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 0, true), 0u);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 7, true), 1u);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 5, true), 5u);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 1, false), kInvalidIndex);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, kInvalidEndpointId, false), kInvalidIndex);
+
+    // Duplicate ids resolve to the first endpoint in array order, skipping disabled ones if asked to.
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 3, false), 2u);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 3, true), 3u);
+
+    // Enabling and disabling endpoints does not need a rebuild.
+    endpoints[1].bitmask.Clear(EmberAfEndpointOptions::isEnabled);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 7, true), kInvalidIndex);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 7, false), 1u);
+
+    // Only the first endpointCount endpoints are considered.
+    EXPECT_EQ(index.Find(endpoints, 5, 5, true), kInvalidIndex);
+    EXPECT_EQ(index.Find(endpoints, 3, 3, true), kInvalidIndex);
+
+    endpoints[5].endpoint = kInvalidEndpointId;
+    endpoints[4].endpoint = 9;
+    endpoints[4].bitmask.Set(EmberAfEndpointOptions::isEnabled);
+    index.Rebuild(endpoints, kEndpointCount);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 5, false), kInvalidIndex);
+    EXPECT_EQ(index.Find(endpoints, kEndpointCount, 9, true), 4u);
+}
+
+TEST(TestEmberLookupIndex, TestFindServerAttribute)
+{
+    const EmberAfAttributeMetadata * metadata = nullptr;
+    uint16_t offset                           = 100;
+
+    // Client clusters are skipped, but take storage.
+    EXPECT_EQ(FindServerAttribute(&kEndpointType, 0x10, 3, &metadata, offset), Status::Success);
+    EXPECT_EQ(metadata, &kClusterAttributes[2]);
+    EXPECT_EQ(offset, 100 + kClusterSize + 4);
+
+    offset = 0;
+    EXPECT_EQ(FindServerAttribute(&kEndpointType, 0x20, 4, &metadata, offset), Status::Success);
+    EXPECT_EQ(metadata, &kClusterAttributes[3]);
+    EXPECT_EQ(offset, 2 * kClusterSize + 4 + 1);
+
+    offset = 0;
+    EXPECT_EQ(FindServerAttribute(&kEndpointType, 0x20, 5, &metadata, offset), Status::UnsupportedAttribute);
+    EXPECT_EQ(FindServerAttribute(&kEndpointType, 0x30, 1, &metadata, offset), Status::UnsupportedCluster);
+}
+
+TEST(TestEmberLookupIndex, TestMetadataLookupIndex)
+{
+    // A cluster that is both client and server, as in some older endpoint types.
+    const EmberAfCluster otherClusters[] = {
+        Cluster(0x20, kClusterAttributes, 2, 4, MATTER_CLUSTER_FLAG_CLIENT | MATTER_CLUSTER_FLAG_SERVER),
+    };
+    const EmberAfEndpointType otherEndpointType = { otherClusters, MATTER_ARRAY_SIZE(otherClusters), 4 };
+
+    EmberAfDefinedEndpoint endpoints[4] = {
+        DefinedEndpoint(1, true),
+        DefinedEndpoint(2, false),
+        DefinedEndpoint(3, true),
+        DefinedEndpoint(kInvalidEndpointId, false),
+    };
+    endpoints[2].endpointType = &otherEndpointType;
+    endpoints[3].endpointType = nullptr;
+
+    MetadataLookupIndex<32> index;
+    const EmberAfCluster * cluster = nullptr;
+    uint8_t clusterIndex           = 0xFF;
+    EXPECT_FALSE(index.FindCluster(&kEndpointType, 0x10, MATTER_CLUSTER_FLAG_SERVER, &cluster, &clusterIndex));
+
+    index.Rebuild(endpoints, MATTER_ARRAY_SIZE(endpoints));
+
+    // Clusters are found with their index among the clusters of the same direction, as emberAfFindClusterInType() does.
+    ASSERT_TRUE(index.FindCluster(&kEndpointType, 0x10, MATTER_CLUSTER_FLAG_SERVER, &cluster, &clusterIndex));
+    EXPECT_EQ(cluster, &kClusters[1]);
+    EXPECT_EQ(clusterIndex, 0u);
+    ASSERT_TRUE(index.FindCluster(&kEndpointType, 0x20, MATTER_CLUSTER_FLAG_SERVER, &cluster, &clusterIndex));
+    EXPECT_EQ(cluster, &kClusters[2]);
+    EXPECT_EQ(clusterIndex, 1u);
+    ASSERT_TRUE(index.FindCluster(&kEndpointType, 0x10, MATTER_CLUSTER_FLAG_CLIENT, &cluster, nullptr));
+    EXPECT_EQ(cluster, &kClusters[0]);
+    ASSERT_TRUE(index.FindCluster(&kEndpointType, 0x20, MATTER_CLUSTER_FLAG_CLIENT, &cluster, nullptr));
+    EXPECT_EQ(cluster, nullptr);
+    ASSERT_TRUE(index.FindCluster(&otherEndpointType, 0x20, MATTER_CLUSTER_FLAG_CLIENT, &cluster, &clusterIndex));
+    EXPECT_EQ(cluster, &otherClusters[0]);
+    ASSERT_TRUE(index.FindCluster(&otherEndpointType, 0x20, MATTER_CLUSTER_FLAG_SERVER, &cluster, &clusterIndex));
+    EXPECT_EQ(cluster, &otherClusters[0]);
+
+    // Other masks are left to the scan.
+    EXPECT_FALSE(index.FindCluster(&kEndpointType, 0x10, 0, &cluster, nullptr));
+
+    // Attribute lookups give the same answers as the scan.
+    for (const EmberAfEndpointType * endpointType : { &kEndpointType, &otherEndpointType })
+    {
+        for (ClusterId clusterId : { 0x10u, 0x20u, 0x30u })
+        {
+            for (AttributeId attributeId = 0; attributeId <= 5; attributeId++)
+            {
+                const EmberAfAttributeMetadata * scannedMetadata = nullptr;
+                uint16_t scannedOffset                           = 10;
+                const Status scannedStatus =
+                    FindServerAttribute(endpointType, clusterId, attributeId, &scannedMetadata, scannedOffset);
+
+                const EmberAfAttributeMetadata * indexedMetadata = nullptr;
+                uint16_t indexedOffset                           = 10;
+                Status indexedStatus                             = Status::Failure;
+                ASSERT_TRUE(index.FindServerAttribute(endpointType, clusterId, attributeId, indexedStatus, &indexedMetadata,
+                                                      indexedOffset));
+
+                EXPECT_EQ(indexedStatus, scannedStatus);
+                if (scannedStatus == Status::Success)
+                {
+                    EXPECT_EQ(indexedMetadata, scannedMetadata);
+                    EXPECT_EQ(indexedOffset, scannedOffset);
+                }
+            }
+        }
+    }
+
+    // Endpoint types that are not used by a defined endpoint are not indexed.
+    endpoints[2].endpoint = kInvalidEndpointId;
+    index.Rebuild(endpoints, MATTER_ARRAY_SIZE(endpoints));
+    EXPECT_FALSE(index.FindCluster(&otherEndpointType, 0x20, MATTER_CLUSTER_FLAG_SERVER, &cluster, nullptr));
+    EXPECT_TRUE(index.FindCluster(&kEndpointType, 0x20, MATTER_CLUSTER_FLAG_SERVER, &cluster, nullptr));
+
+    // Nor are endpoint types that do not fit in the index: their lookups are left to the scan.
+    MetadataLookupIndex<4> smallIndex;
+    smallIndex.Rebuild(endpoints, MATTER_ARRAY_SIZE(endpoints));
+    const EmberAfAttributeMetadata * metadata = nullptr;
+    uint16_t offset                           = 0;
+    Status status                             = Status::Failure;
+    EXPECT_FALSE(smallIndex.FindCluster(&kEndpointType, 0x20, MATTER_CLUSTER_FLAG_SERVER, &cluster, nullptr));
+    EXPECT_FALSE(smallIndex.FindServerAttribute(&kEndpointType, 0x20, 1, status, &metadata, offset));
+}
+
+TEST(TestEmberLookupIndex, TestAttributeLookupCache)
+{
+    AttributeLookupCache<4> cache;
+    AttributeLocation location;
+
+    EXPECT_FALSE(cache.Find(1, 0x10, 1, location));
+
+    cache.Insert(1, 0x10, 1, AttributeLocation{ &kClusterAttributes[0], 3, 12 });
+    ASSERT_TRUE(cache.Find(1, 0x10, 1, location));
+    EXPECT_EQ(location.metadata, &kClusterAttributes[0]);
+    EXPECT_EQ(location.endpointIndex, 3u);
+    EXPECT_EQ(location.storageOffset, 12u);
+
+    EXPECT_FALSE(cache.Find(2, 0x10, 1, location));
+    EXPECT_FALSE(cache.Find(1, 0x20, 1, location));
+    EXPECT_FALSE(cache.Find(1, 0x10, 2, location));
+
+    // A small cache holds only some of many paths, but never returns the location of another path.
+    for (AttributeId attributeId = 0; attributeId < 32; attributeId++)
+    {
+        const AttributeLocation inserted{ &kClusterAttributes[attributeId % 4], 0, static_cast<uint16_t>(attributeId) };
+        cache.Insert(1, 0x20, attributeId, inserted);
+    }
+    size_t found = 0;
+    for (AttributeId attributeId = 0; attributeId < 32; attributeId++)
+    {
+        if (cache.Find(1, 0x20, attributeId, location))
+        {
+            EXPECT_EQ(location.storageOffset, attributeId);
+            found++;
+        }
+    }
+    EXPECT_GT(found, 0u);
+    EXPECT_LE(found, 4u);
+
+    cache.Clear();
+    for (AttributeId attributeId = 0; attributeId < 32; attributeId++)
+    {
+        EXPECT_FALSE(cache.Find(1, 0x20, attributeId, location));
+    }
+}
+
+} // namespace
@@ -127,6 +127,17 @@
 #define CHIP_DEVICE_CONFIG_BG_TASK_PRIORITY 1
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+ *
+ * The number of threads serving the background event queue, on platforms that support a pool
+ * of background tasks (POSIX). Background work may then run concurrently, and must not assume
+ * it is serialized with other background work.
+ */
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 1
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
  *
@@ -91,6 +91,10 @@ protected:
     CHIP_ERROR _StartEventLoopTask();
     CHIP_ERROR _StopEventLoopTask();
     CHIP_ERROR _StartChipTimer(System::Clock::Timeout duration);
+    CHIP_ERROR _PostBackgroundEvent(const ChipDeviceEvent * event);
+    void _RunBackgroundEventLoop();
+    CHIP_ERROR _StartBackgroundEventLoopTask();
+    CHIP_ERROR _StopBackgroundEventLoopTask();
     void _Shutdown();
 
 #if CHIP_STACK_LOCK_TRACKING_ENABLED
@@ -113,6 +117,20 @@ private:
     static void * EventLoopTaskMain(void * arg);
 #endif
     void ProcessDeviceEvents();
+
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    // Background events are served by a pool of CHIP_DEVICE_CONFIG_BG_TASK_COUNT threads,
+    // so that several pieces of background work (e.g. CASE crypto) can run in parallel.
+    pthread_mutex_t mBackgroundEventQueueLock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t mBackgroundEventQueueCond  = PTHREAD_COND_INITIALIZER;
+    std::queue<ChipDeviceEvent> mBackgroundEventQueue;
+    bool mShouldRunBackgroundEventLoop = false;
+
+    pthread_t mBackgroundEventLoopTasks[CHIP_DEVICE_CONFIG_BG_TASK_COUNT];
+    size_t mBackgroundEventLoopTaskCount = 0;
+
+    static void * BackgroundEventLoopTaskMain(void * arg);
+#endif
 };
 
 // Instruct the compiler to instantiate the template only when explicitly told to do so.
@@ -397,6 +397,138 @@ exit:
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    if (!(event->Type == DeviceEventType::kCallWorkFunct || event->Type == DeviceEventType::kNoOp))
+    {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    if (!mShouldRunBackgroundEventLoop)
+    {
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        // Background tasks were not started, use foreground event loop for background events
+        return _PostEvent(event);
+    }
+    mBackgroundEventQueue.push(*event);
+    pthread_cond_signal(&mBackgroundEventQueueCond);
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+    return CHIP_NO_ERROR;
+#else
+    // Use foreground event loop for background events
+    return _PostEvent(event);
+#endif
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    while (true)
+    {
+        while (mBackgroundEventQueue.empty() && mShouldRunBackgroundEventLoop)
+        {
+            pthread_cond_wait(&mBackgroundEventQueueCond, &mBackgroundEventQueueLock);
+        }
+
+        // Work that was queued before the loop was stopped still runs, since its owner
+        // may be holding resources until it does.
+        if (mBackgroundEventQueue.empty())
+        {
+            break;
+        }
+
+        const ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        Impl()->DispatchEvent(&event);
+        pthread_mutex_lock(&mBackgroundEventQueueLock);
+    }
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+#else
+    // Use foreground event loop for background events
+#endif
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    VerifyOrReturnError(mBackgroundEventLoopTaskCount == 0, CHIP_ERROR_INCORRECT_STATE);
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    mShouldRunBackgroundEventLoop = true;
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+
+    while (mBackgroundEventLoopTaskCount < MATTER_ARRAY_SIZE(mBackgroundEventLoopTasks))
+    {
+        int err = pthread_create(&mBackgroundEventLoopTasks[mBackgroundEventLoopTaskCount], nullptr, BackgroundEventLoopTaskMain,
+                                 this);
+        if (err != 0)
+        {
+            RETURN_SAFELY_IGNORED _StopBackgroundEventLoopTask();
+            return CHIP_ERROR_POSIX(err);
+        }
+        mBackgroundEventLoopTaskCount++;
+    }
+
+    return CHIP_NO_ERROR;
+#else
+    // Use foreground event loop for background events
+    return CHIP_NO_ERROR;
+#endif
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    int err = 0;
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    mShouldRunBackgroundEventLoop = false;
+    pthread_cond_broadcast(&mBackgroundEventQueueCond);
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+
+    for (size_t i = 0; i < mBackgroundEventLoopTaskCount; i++)
+    {
+        // A background task stopping the loop cannot wait for itself.
+        if (pthread_equal(pthread_self(), mBackgroundEventLoopTasks[i]))
+        {
+            pthread_detach(mBackgroundEventLoopTasks[i]);
+            continue;
+        }
+
+        int joinErr = pthread_join(mBackgroundEventLoopTasks[i], nullptr);
+        if (err == 0)
+        {
+            err = joinErr;
+        }
+    }
+    mBackgroundEventLoopTaskCount = 0;
+
+    return CHIP_ERROR_POSIX(err);
+#else
+    // Use foreground event loop for background events
+    return CHIP_NO_ERROR;
+#endif
+}
+
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->Impl()->RunBackgroundEventLoop();
+    return nullptr;
+}
+#endif
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
@@ -407,6 +539,11 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     //
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    // Background work may still reference the stack, let it complete first.
+    RETURN_SAFELY_IGNORED _StopBackgroundEventLoopTask();
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
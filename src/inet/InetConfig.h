@@ -272,6 +272,53 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE
+ *
+ *  @brief
+ *    The largest number of datagrams that the socket-based implementation of
+ *    UDP endpoints receives per read event.
+ *
+ *  @details
+ *    When this is more than 1, datagrams are received with recvmmsg(), and
+ *    each listening endpoint keeps up to this many packet buffers allocated
+ *    to receive into. When it is 1, datagrams are received one at a time
+ *    with recvmsg().
+ *
+ *    Platforms that provide recvmmsg() should only enable batching when
+ *    packet buffers are allocated from the heap
+ *    (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0): with a fixed pool,
+ *    the buffers held by each endpoint would be taken from the ones
+ *    available to the rest of the stack.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE
+ *
+ *  @brief
+ *    The largest number of datagrams that the socket-based implementation of
+ *    UDP endpoints sends per system call.
+ *
+ *  @details
+ *    When this is more than 1, UDPEndPoint::SendMsgs() sends datagrams with
+ *    sendmmsg(), and the UDP transport queues the messages sent during an
+ *    event loop turn to send them together. When it is 1, each datagram is
+ *    sent on its own with sendmsg().
+ *
+ *    Queued messages are sent after SendMessage() has returned, so errors
+ *    sending them are reported to the transport delegate by the scheduled
+ *    work instead; the reliable messaging layer then drops the exchange's
+ *    retransmission entry, as it does for an error returned by
+ *    SendMessage(). Platforms that provide sendmmsg() enable batching in
+ *    their InetPlatformConfig.h.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE
+
 /**
  *  @def HAVE_SO_BINDTODEVICE
  *
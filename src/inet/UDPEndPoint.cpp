@@ -121,6 +121,30 @@ CHIP_ERROR UDPEndPoint::SendMsg(const IPPacketInfo * pktInfo, System::PacketBuff
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR UDPEndPoint::SendMsgs(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t count, size_t & sentCount)
+{
+    sentCount = 0;
+    VerifyOrReturnError(count > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    INET_FAULT_INJECT(FaultInjection::kFault_Send, return INET_ERROR_UNKNOWN_INTERFACE;);
+    INET_FAULT_INJECT(FaultInjection::kFault_SendNonCritical, return CHIP_ERROR_NO_MEMORY;);
+
+    ReturnErrorOnFailure(SendMsgsImpl(pktInfos, msgs, count, sentCount));
+
+    CHIP_SYSTEM_FAULT_INJECT_ASYNC_EVENT();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPoint::SendMsgsImpl(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t count,
+                                     size_t & sentCount)
+{
+    ReturnErrorOnFailure(SendMsgImpl(&pktInfos[0], std::move(msgs[0])));
+    msgs[0]   = nullptr;
+    sentCount = 1;
+    return CHIP_NO_ERROR;
+}
+
 void UDPEndPoint::Free()
 {
     Close();
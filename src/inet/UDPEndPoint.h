@@ -230,6 +230,25 @@ public:
      */
     CHIP_ERROR SendMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
 
+    /**
+     * Send the first of several UDP messages with a single send operation.
+     *
+     *  Sends, in order, as many of the \c count messages in \c msgs as the implementation sends with one operation (a
+     *  single system call on platforms using sockets), each to the destination given by the matching entry of
+     *  \c pktInfos, as for SendMsg(). Sent messages are released. The caller sends the remaining messages with further
+     *  calls.
+     *
+     * @param[in]   pktInfos    Source and destination information, one for each message.
+     * @param[in]   msgs        Packet buffers containing the UDP messages.
+     * @param[in]   count       Number of messages; must not be 0.
+     * @param[out]  sentCount   Number of messages sent, from the start of \c msgs.
+     *
+     * @retval  CHIP_NO_ERROR   Success: \c sentCount messages, at least one, are queued for transmit.
+     * @retval  other           The message at \c sentCount could not be sent, for one of the reasons listed for SendMsg().
+     *                          The messages before it are queued for transmit.
+     */
+    CHIP_ERROR SendMsgs(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count, size_t & sentCount);
+
     /**
      * Close the endpoint.
      *
@@ -296,6 +315,12 @@ protected:
     virtual CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg)                     = 0;
     virtual void CloseImpl()                                                                                                  = 0;
 
+    /**
+     *  Send messages for SendMsgs(). The default implementation sends the first message with SendMsgImpl().
+     */
+    virtual CHIP_ERROR SendMsgsImpl(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count,
+                                    size_t & sentCount);
+
     /**
      * Close the endpoint and recycle its memory.
      *
@@ -167,6 +167,87 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+// Receive state of one datagram: where recvmsg/recvmmsg writes its payload, its source address and its control messages.
+struct ReceiveSlot
+{
+    struct iovec msgIOV;
+    SockAddr peerSockAddr;
+    uint8_t controlData[256];
+
+    void Prepare(struct msghdr & msgHeader, const System::PacketBufferHandle & buffer)
+    {
+        msgIOV.iov_base = buffer->Start();
+        msgIOV.iov_len  = buffer->AvailableDataLength();
+
+        memset(&peerSockAddr, 0, sizeof(peerSockAddr));
+        memset(controlData, 0, sizeof(controlData));
+        memset(&msgHeader, 0, sizeof(msgHeader));
+
+        msgHeader.msg_name       = &peerSockAddr;
+        msgHeader.msg_namelen    = sizeof(peerSockAddr);
+        msgHeader.msg_iov        = &msgIOV;
+        msgHeader.msg_iovlen     = 1;
+        msgHeader.msg_control    = controlData;
+        msgHeader.msg_controllen = sizeof(controlData);
+    }
+};
+
+// Fills in the data length of buffer and the packet info of a datagram received into it.
+CHIP_ERROR ProcessReceivedMessage(struct msghdr & msgHeader, size_t rcvLen, const System::PacketBufferHandle & buffer,
+                                  IPPacketInfo & lPacketInfo)
+{
+    VerifyOrReturnError(buffer->AvailableDataLength() >= rcvLen, CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG);
+    buffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+
+    const SockAddr & lPeerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (lPeerSockAddr.any.sa_family == AF_INET6)
+    {
+        lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
+        lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (lPeerSockAddr.any.sa_family == AF_INET)
+    {
+        lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
+        lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 } // anonymous namespace
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
@@ -277,7 +358,18 @@ CHIP_ERROR UDPEndPointImplSockets::ListenImpl()
     return layer->RequestCallbackOnPendingRead(mWatch);
 }
 
-CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+// Send state of one datagram: the message header passed to sendmsg/sendmmsg, and the payload, destination address and control
+// messages it points to.
+struct UDPEndPointImplSockets::SendSlot
+{
+    struct msghdr msgHeader;
+    struct iovec msgIOV;
+    SockAddr peerSockAddr;
+    uint8_t controlData[256];
+};
+
+CHIP_ERROR UDPEndPointImplSockets::PrepareSend(const IPPacketInfo * aPktInfo, const System::PacketBufferHandle & msg,
+                                               SendSlot & slot)
 {
     // Ensure packet buffer is not null
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
@@ -292,22 +384,22 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // For now the entire message must fit within a single buffer.
     VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
 
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
+    struct iovec & msgIOV = slot.msgIOV;
+    msgIOV.iov_base       = msg->Start();
+    msgIOV.iov_len        = msg->DataLength();
 
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
+    uint8_t * controlData = slot.controlData;
+    memset(controlData, 0, sizeof(slot.controlData));
 #endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
 
-    struct msghdr msgHeader;
+    struct msghdr & msgHeader = slot.msgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
     msgHeader.msg_iov    = &msgIOV;
     msgHeader.msg_iovlen = 1;
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
+    SockAddr & peerSockAddr = slot.peerSockAddr;
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     msgHeader.msg_name = &peerSockAddr;
     if (mAddrType == IPAddressType::kIPv6)
@@ -351,7 +443,7 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
         msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        msgHeader.msg_controllen = sizeof(slot.controlData);
 
         struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
         InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
@@ -409,9 +501,17 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     }
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+{
+    SendSlot slot;
+    ReturnErrorOnFailure(PrepareSend(aPktInfo, msg, slot));
+
     // Send IP packet.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
-    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    const ssize_t lenSent = sendmsg(mSocket, &slot.msgHeader, 0);
     if (lenSent == -1)
     {
         return CHIP_ERROR_POSIX(errno);
@@ -426,6 +526,47 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     return CHIP_NO_ERROR;
 }
 
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+CHIP_ERROR UDPEndPointImplSockets::SendMsgsImpl(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t count,
+                                                size_t & sentCount)
+{
+    SendSlot slots[INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE];
+    struct mmsghdr msgHeaders[INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE];
+
+    // Send the messages that can be prepared, up to the first that cannot, which is reported by the next call.
+    size_t prepared = 0;
+    for (; prepared < count && prepared < INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE; prepared++)
+    {
+        CHIP_ERROR err = PrepareSend(&pktInfos[prepared], msgs[prepared], slots[prepared]);
+        if (err != CHIP_NO_ERROR)
+        {
+            VerifyOrReturnError(prepared > 0, err);
+            break;
+        }
+        msgHeaders[prepared].msg_hdr = slots[prepared].msgHeader;
+        msgHeaders[prepared].msg_len = 0;
+    }
+
+    // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): PrepareSend calls ensure mSocket is valid
+    const int sent = sendmmsg(mSocket, msgHeaders, static_cast<unsigned int>(prepared), 0);
+    if (sent == -1)
+    {
+        return CHIP_ERROR_POSIX(errno);
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(sent); i++)
+    {
+        if (msgHeaders[i].msg_len != msgs[i]->DataLength())
+        {
+            return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+        }
+        msgs[i]   = nullptr;
+        sentCount = i + 1;
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+
 void UDPEndPointImplSockets::CloseImpl()
 {
     if (mSocket != kInvalidSocketFd)
@@ -434,6 +575,13 @@ void UDPEndPointImplSockets::CloseImpl()
         close(mSocket);
         mSocket = kInvalidSocketFd;
     }
+
+#if INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1
+    for (auto & buffer : mReceiveBuffers)
+    {
+        buffer = nullptr;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1
 }
 
 CHIP_ERROR UDPEndPointImplSockets::GetSocket(IPAddressType addressType)
@@ -576,6 +724,10 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     // Prevent the endpoint from being freed while in the middle of a callback.
     UDPEndPointHandle ref(this);
+
+#if INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1
+    ReceiveBatch();
+#else
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -588,24 +740,9 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     if (!lBuffer.IsNull())
     {
-        struct iovec msgIOV;
-        SockAddr lPeerSockAddr;
-        uint8_t controlData[256];
+        ReceiveSlot slot;
         struct msghdr msgHeader;
-
-        msgIOV.iov_base = lBuffer->Start();
-        msgIOV.iov_len  = lBuffer->AvailableDataLength();
-
-        memset(&lPeerSockAddr, 0, sizeof(lPeerSockAddr));
-        memset(controlData, 0, sizeof(controlData));
-        memset(&msgHeader, 0, sizeof(msgHeader));
-
-        msgHeader.msg_name       = &lPeerSockAddr;
-        msgHeader.msg_namelen    = sizeof(lPeerSockAddr);
-        msgHeader.msg_iov        = &msgIOV;
-        msgHeader.msg_iovlen     = 1;
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        slot.Prepare(msgHeader, lBuffer);
 
         ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
 
@@ -613,69 +750,9 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         {
             lStatus = CHIP_ERROR_POSIX(errno);
         }
-        else if (lBuffer->AvailableDataLength() < static_cast<size_t>(rcvLen))
-        {
-            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
-        }
         else
         {
-            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = ProcessReceivedMessage(msgHeader, static_cast<size_t>(rcvLen), lBuffer, lPacketInfo);
         }
     }
     else
@@ -695,7 +772,99 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
             OnReceiveError(this, lStatus, nullptr);
         }
     }
+#endif // INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1
+}
+
+#if INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1
+void UDPEndPointImplSockets::ReceiveBatch()
+{
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE;
+
+    // Buffers that were not filled by the previous batch are kept for the next one.
+    size_t bufferCount = 0;
+    while (bufferCount < kBatchSize)
+    {
+        System::PacketBufferHandle & buffer = mReceiveBuffers[bufferCount];
+        if (buffer.IsNull())
+        {
+            buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (buffer.IsNull())
+            {
+                break;
+            }
+        }
+        bufferCount++;
+    }
+
+    if (bufferCount == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    ReceiveSlot slots[kBatchSize];
+    struct mmsghdr msgHeaders[kBatchSize];
+    for (size_t i = 0; i < bufferCount; i++)
+    {
+        slots[i].Prepare(msgHeaders[i].msg_hdr, mReceiveBuffers[i]);
+        msgHeaders[i].msg_len = 0;
+    }
+
+    int rcvCount = recvmmsg(mSocket, msgHeaders, static_cast<unsigned int>(bufferCount), MSG_DONTWAIT, nullptr);
+    if (rcvCount == -1)
+    {
+        CHIP_ERROR lStatus = CHIP_ERROR_POSIX(errno);
+        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(rcvCount); i++)
+    {
+        // A callback may have closed the endpoint, which drops the rest of the batch.
+        if (mState != State::kListening || OnMessageReceived == nullptr)
+        {
+            break;
+        }
+
+        System::PacketBufferHandle lBuffer = std::move(mReceiveBuffers[i]);
+        IPPacketInfo lPacketInfo;
+        lPacketInfo.Clear();
+        lPacketInfo.DestPort  = mBoundPort;
+        lPacketInfo.Interface = mBoundIntfId;
+
+        CHIP_ERROR lStatus = ProcessReceivedMessage(msgHeaders[i].msg_hdr, msgHeaders[i].msg_len, lBuffer, lPacketInfo);
+        if (lStatus == CHIP_NO_ERROR)
+        {
+            lBuffer.RightSize();
+            OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+    }
+
+    // Move the buffers left over to the front, where the next batch starts.
+    size_t next = 0;
+    for (size_t i = 0; i < kBatchSize; i++)
+    {
+        if (!mReceiveBuffers[i].IsNull())
+        {
+            if (i != next)
+            {
+                mReceiveBuffers[next] = std::move(mReceiveBuffers[i]);
+            }
+            next++;
+        }
+    }
 }
+#endif // INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1
 
 #ifdef IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
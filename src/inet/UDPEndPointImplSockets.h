@@ -53,6 +53,15 @@ private:
     CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg) override;
     void CloseImpl() override;
 
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+    CHIP_ERROR SendMsgsImpl(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count,
+                            size_t & sentCount) override;
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+
+    struct SendSlot;
+    // Fills in the message header of slot to send msg as described by pktInfo.
+    CHIP_ERROR PrepareSend(const IPPacketInfo * pktInfo, const chip::System::PacketBufferHandle & msg, SendSlot & slot);
+
     CHIP_ERROR GetSocket(IPAddressType addressType);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
@@ -60,6 +69,13 @@ private:
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1
+    void ReceiveBatch();
+
+    // Buffers for the next recvmmsg(), allocated as needed and kept while the endpoint is open.
+    System::PacketBufferHandle mReceiveBuffers[INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE];
+#endif // INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
     enum class MulticastOperation
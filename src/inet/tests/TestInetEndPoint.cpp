@@ -29,6 +29,10 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include <pw_unit_test/framework.h>
 
 #include <CHIPVersion.h>
@@ -378,6 +382,90 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+// Test that a burst of datagrams is delivered whole and in order, and report the receive throughput.
+TEST_F(TestInetEndPoint, TestUDPBurstReceive)
+{
+    constexpr uint32_t kDatagramCount = 1024;
+    constexpr size_t kDatagramSize    = 100;
+
+    struct BurstState
+    {
+        uint32_t received      = 0;
+        uint32_t outOfOrder    = 0;
+        uint32_t receiveErrors = 0;
+    };
+    static BurstState sState;
+    sState = BurstState();
+
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+
+    UDPEndPointHandle testUDPEP;
+    ASSERT_EQ(gUDP.NewEndPoint(testUDPEP), CHIP_NO_ERROR);
+    CHIP_ERROR err = testUDPEP->Bind(IPAddressType::kIPv6, loopback, 0);
+    if (err != CHIP_NO_ERROR)
+    {
+        // IPv6 loopback is not available everywhere tests run.
+        testUDPEP.Release();
+        return;
+    }
+    ASSERT_EQ(testUDPEP->Listen(
+                  [](UDPEndPoint *, PacketBufferHandle && msg, const IPPacketInfo *) {
+                      uint32_t sequence = UINT32_MAX;
+                      if (msg->DataLength() == kDatagramSize)
+                      {
+                          memcpy(&sequence, msg->Start(), sizeof(sequence));
+                      }
+                      if (sequence != sState.received)
+                      {
+                          sState.outOfOrder++;
+                      }
+                      sState.received++;
+                  },
+                  [](UDPEndPoint *, CHIP_ERROR, const IPPacketInfo *) { sState.receiveErrors++; }),
+              CHIP_NO_ERROR);
+
+    int sender = socket(AF_INET6, SOCK_DGRAM, 0);
+    ASSERT_GE(sender, 0);
+    int sendBufferSize = 4 * 1024 * 1024;
+    setsockopt(sender, SOL_SOCKET, SO_SNDBUF, &sendBufferSize, sizeof(sendBufferSize));
+
+    sockaddr_in6 destination = {};
+    destination.sin6_family  = AF_INET6;
+    destination.sin6_addr    = loopback.ToIPv6();
+    destination.sin6_port    = htons(testUDPEP->GetBoundPort());
+
+    // Send in bursts that fit in the receive buffer of the endpoint socket, and drain each burst.
+    constexpr uint32_t kBurstSize = 64;
+
+    uint8_t datagram[kDatagramSize] = {};
+    auto start                      = System::SystemClock().GetMonotonicMicroseconds64();
+    for (uint32_t sent = 0; sent < kDatagramCount;)
+    {
+        for (uint32_t i = 0; i < kBurstSize; i++, sent++)
+        {
+            memcpy(datagram, &sent, sizeof(sent));
+            ASSERT_EQ(sendto(sender, datagram, sizeof(datagram), 0, reinterpret_cast<const sockaddr *>(&destination),
+                             sizeof(destination)),
+                      static_cast<ssize_t>(sizeof(datagram)));
+        }
+        for (int attempt = 0; attempt < 100 && sState.received + sState.receiveErrors < sent; attempt++)
+        {
+            ServiceEvents(10);
+        }
+    }
+    auto elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    close(sender);
+
+    EXPECT_EQ(sState.received, kDatagramCount);
+    EXPECT_EQ(sState.outOfOrder, 0u);
+    EXPECT_EQ(sState.receiveErrors, 0u);
+    ChipLogProgress(Inet, "Received %u datagrams in %u us (receive batch size %u)", static_cast<unsigned>(sState.received),
+                    static_cast<unsigned>(elapsed.count()), static_cast<unsigned>(INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE));
+
+    testUDPEP.Release();
+}
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
@@ -843,6 +843,29 @@
 #define CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS 2
 #endif // CHIP_CONFIG_MAX_GROUP_CONTROL_PEER
 
+/**
+ *  @def CHIP_CONFIG_GROUP_DECRYPT_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of (group session id, sender) pairs for which the session manager remembers which group key
+ *    decrypted the last message, so that it is tried first for the next message.  Must be at least 1.
+ */
+#ifndef CHIP_CONFIG_GROUP_DECRYPT_CACHE_SIZE
+#define CHIP_CONFIG_GROUP_DECRYPT_CACHE_SIZE 8
+#endif // CHIP_CONFIG_GROUP_DECRYPT_CACHE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_GROUP_DATA_STORAGE_CACHE
+ *
+ *  @brief
+ *    Enable the RAM storage cache of the group data provider that the server creates by default
+ *    (see GroupDataProviderImpl::SetStorageCacheEnabled()).  The cache trades RAM that grows with the
+ *    number of groups, endpoints and key sets for fewer storage reads per group lookup and group message.
+ */
+#ifndef CHIP_CONFIG_GROUP_DATA_STORAGE_CACHE
+#define CHIP_CONFIG_GROUP_DATA_STORAGE_CACHE 0
+#endif // CHIP_CONFIG_GROUP_DATA_STORAGE_CACHE
+
 /**
  *  @def CHIP_CONFIG_SLOW_CRYPTO
  *
@@ -1280,6 +1303,32 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+ *
+ * If set to 1, the example access control code answers access checks from
+ * a compiled form of the access control list, sorted by fabric, auth mode
+ * and subject, instead of letting AccessControl go through every entry.
+ * The index takes 16 bytes of RAM per subject the list can hold, and is
+ * rebuilt on the first check after the list changes.
+ */
+#ifndef CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+#define CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * Number of recent access check decisions (subject, path and privilege)
+ * kept by the example access control code when
+ * CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX is enabled. The
+ * decisions are forgotten when the access control list changes. 0 disables
+ * the cache.
+ */
+#ifndef CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_DECISION_CACHE_SIZE 8
+#endif
+
 /**
  * @def CHIP_CONFIG_ENABLE_ACL_EXTENSIONS
  *
@@ -1342,6 +1391,48 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+ *
+ * @brief
+ *   If 1, the CASE server keeps, for every fabric, its identity protection keys with an HMAC
+ *   context keyed with each of them, and the fabric part of the destination identifier message.
+ *   Matching the destination identifier of a Sigma1 then only hashes the message, instead of
+ *   loading the keys from the group data provider and setting up an HMAC for every fabric and key.
+ *   Takes about 200 bytes per fabric.
+ */
+#ifndef CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+#define CHIP_CONFIG_CASE_DESTINATION_ID_CACHE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE
+ *
+ * @brief
+ *   Number of single-use ephemeral P-256 keypairs that CASE keeps generated in advance, so that
+ *   sending Sigma1 or Sigma2 does not have to generate one.  The pool is refilled one keypair at a
+ *   time through PlatformManager::ScheduleBackgroundWork() once a keypair has been taken from it.
+ *   Takes about 100 bytes per keypair.  0 disables the pool.
+ */
+#ifndef CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE
+#define CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+ *
+ * @brief
+ *   Number of certificate signatures, i.e. certificate to issuer links, that a fabric table
+ *   remembers having verified, so that validating the same operational certificate chain again
+ *   (e.g. the ICAC and RCAC of a peer on every CASE handshake) skips their ECDSA verification.
+ *   Validity periods, key usages and the validity policy are still checked on every validation.
+ *   The cache is cleared on every change to the fabric table.  Takes about 40 bytes per entry.
+ *   0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1551,6 +1642,17 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_NUM_CD_KEY_SLOTS 5
 #endif // CHIP_CONFIG_NUM_CD_KEY_SLOTS
 
+/**
+ * @def CHIP_CONFIG_BATCHED_DAC_VERIFIER_CACHE_SIZE
+ *
+ * @brief Number of PAIs, and of Certification Declarations, that a BatchedDACVerifier remembers having verified,
+ *        so that the devices of a same product line only get their own DAC checked.  Takes about 700 bytes per PAI.
+ *
+ */
+#ifndef CHIP_CONFIG_BATCHED_DAC_VERIFIER_CACHE_SIZE
+#define CHIP_CONFIG_BATCHED_DAC_VERIFIER_CACHE_SIZE 8
+#endif // CHIP_CONFIG_BATCHED_DAC_VERIFIER_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_MAX_SUBSCRIPTION_RESUMPTION_STORAGE_CONCURRENT_ITERATORS
  *
@@ -1996,6 +2098,47 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID 0
 #endif // CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
 
+/**
+ *  @def CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of entries (a power of two) in the cache of attribute locations that ember attribute
+ *    storage keeps, so that repeated reads and writes of an attribute skip the search through the
+ *    clusters and attributes of its endpoint. Each entry takes 20 bytes on 32-bit targets.
+ *
+ *    Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE
+#define CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE 16
+#endif // CHIP_CONFIG_EMBER_ATTRIBUTE_LOOKUP_CACHE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE
+ *
+ *  @brief
+ *    Number of clusters and server attributes that ember attribute storage indexes, across the
+ *    distinct endpoint types of its endpoints, so that cluster and attribute lookups do not scan
+ *    the endpoint type. Endpoint types that do not fit are scanned. Each entry takes 32 bytes on
+ *    32-bit targets.
+ *
+ *    Set to 0 to disable the index.
+ */
+#ifndef CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE
+#define CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE 0
+#endif // CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE
+
+/**
+ *  @def CHIP_CONFIG_TLV_SKIP_INDEX
+ *
+ *  @brief
+ *    Lets a TLVReader use a TLV::TLVSkipIndex built over its buffer, so that skipping or exiting a
+ *    container jumps to its end instead of reading every nested element. Costs one pointer in
+ *    every TLVReader.
+ */
+#ifndef CHIP_CONFIG_TLV_SKIP_INDEX
+#define CHIP_CONFIG_TLV_SKIP_INDEX 0
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
+
 /**
  * @def CHIP_CONFIG_TLS_PERSISTED_ROOT_CERT_BYTES
  *
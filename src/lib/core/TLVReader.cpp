@@ -28,6 +28,7 @@
 #include <lib/core/Optional.h>
 #include <lib/core/TLVBackingStore.h>
 #include <lib/core/TLVCommon.h>
+#include <lib/core/TLVSkipIndex.h>
 #include <lib/core/TLVTags.h>
 #include <lib/core/TLVTypes.h>
 #include <lib/support/BufferWriter.h>
@@ -49,6 +50,9 @@ static const uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
 TLVReader::TLVReader() :
     ImplicitProfileId(kProfileIdNotSpecified), AppData(nullptr), mElemLenOrVal(0), mBackingStore(nullptr), mReadPoint(nullptr),
     mBufEnd(nullptr), mLenRead(0), mMaxLen(0), mContainerType(kTLVType_NotSpecified), mControlByte(kTLVControlByte_NotSpecified),
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    mSkipIndex(nullptr),
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
     mContainerOpen(false)
 {}
 
@@ -64,6 +68,9 @@ void TLVReader::Init(const uint8_t * data, size_t dataLen)
     ClearElementState();
     mContainerType = kTLVType_NotSpecified;
     SetContainerOpen(false);
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    mSkipIndex = nullptr;
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
 
     ImplicitProfileId = kProfileIdNotSpecified;
 }
@@ -83,6 +90,9 @@ CHIP_ERROR TLVReader::Init(TLVBackingStore & backingStore, uint32_t maxLen)
     ClearElementState();
     mContainerType = kTLVType_NotSpecified;
     SetContainerOpen(false);
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    mSkipIndex = nullptr;
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
 
     ImplicitProfileId = kProfileIdNotSpecified;
     AppData           = nullptr;
@@ -103,6 +113,9 @@ void TLVReader::Init(const TLVReader & aReader)
     mControlByte   = aReader.mControlByte;
     mContainerType = aReader.mContainerType;
     SetContainerOpen(aReader.IsContainerOpen());
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    mSkipIndex = aReader.mSkipIndex;
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
 
     // Initialize public data members
 
@@ -572,6 +585,9 @@ CHIP_ERROR TLVReader::OpenContainer(TLVReader & containerReader)
     containerReader.mBufEnd       = mBufEnd;
     containerReader.mLenRead      = mLenRead;
     containerReader.mMaxLen       = mMaxLen;
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    containerReader.mSkipIndex = mSkipIndex;
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
     containerReader.ClearElementState();
     containerReader.mContainerType = static_cast<TLVType>(elemType);
     containerReader.SetContainerOpen(false);
@@ -757,6 +773,13 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
     // from calling CloseContainer() with the now orphaned container reader.
     SetContainerOpen(false);
 
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    if (SkipToEndOfContainerWithIndex())
+    {
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
+
     while (true)
     {
         TLVElementType elemType = ElementType();
@@ -786,6 +809,45 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
     }
 }
 
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+/**
+ * Does what SkipToEndOfContainer() does, in a single step, when the skip index knows where the
+ * current container ends.
+ *
+ * @return false, leaving the reader untouched, if the index cannot be used.
+ */
+bool TLVReader::SkipToEndOfContainerWithIndex()
+{
+    // Offsets in the index are relative to the start of a contiguous buffer, which is where the
+    // reader started reading.
+    VerifyOrReturnValue(mSkipIndex != nullptr && mBackingStore == nullptr && mReadPoint != nullptr, false);
+
+    const TLVElementType elemType = ElementType();
+    VerifyOrReturnValue(elemType != TLVElementType::EndOfContainer, false);
+
+    const uint8_t * base = mReadPoint - mLenRead;
+    const uint8_t * end  = mReadPoint;
+
+    // When positioned on a container, the reader is at the start of its members: step over it
+    // before looking for the end of the container it is in.
+    if (TLVTypeIsContainer(elemType))
+    {
+        VerifyOrReturnValue(mSkipIndex->FindEnclosingContainerEnd(base, end, end), false);
+    }
+    VerifyOrReturnValue(mSkipIndex->FindEnclosingContainerEnd(base, end, end), false);
+    VerifyOrReturnValue(end <= mBufEnd, false);
+
+    // Leave the reader as reading the end of container marker would.
+    mLenRead += static_cast<uint32_t>(end - mReadPoint);
+    mReadPoint    = end;
+    mControlByte  = end[-1];
+    mElemTag      = AnonymousTag();
+    mElemLenOrVal = 0;
+
+    return true;
+}
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
+
 CHIP_ERROR TLVReader::ReadElement()
 {
     // Make sure we have input data. Return CHIP_END_OF_TLV if no more data is available.
@@ -56,6 +56,8 @@
 namespace chip {
 namespace TLV {
 
+class TLVSkipIndex;
+
 /**
  * Provides a memory efficient parser for data encoded in CHIP TLV format.
  *
@@ -906,6 +908,20 @@ public:
      */
     const uint8_t * GetReadPoint() const { return mReadPoint; }
 
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    /**
+     * Sets an index of the containers of the buffer being read, used to jump to the end of a
+     * container instead of reading all its elements when skipping or exiting it.
+     *
+     * The index is only used if it was built over the buffer this reader was initialized with, and
+     * is handed over to readers initialized from this one or opened on one of its containers. It is
+     * dropped when the reader is initialized again.
+     *
+     * @param[in] skipIndex The index, or nullptr to stop using one. Must outlive its use by the reader.
+     */
+    void SetSkipIndex(const TLVSkipIndex * skipIndex) { mSkipIndex = skipIndex; }
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
+
     /**
      * Advances the TLVReader object to immediately after the current TLV element.
      *
@@ -980,6 +996,9 @@ protected:
     uint32_t mMaxLen;
     TLVType mContainerType;
     uint16_t mControlByte;
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    const TLVSkipIndex * mSkipIndex;
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
 
 private:
     bool mContainerOpen;
@@ -992,6 +1011,9 @@ protected:
     void ClearElementState();
     CHIP_ERROR SkipData();
     CHIP_ERROR SkipToEndOfContainer();
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+    bool SkipToEndOfContainerWithIndex();
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
     CHIP_ERROR VerifyElement();
     Tag ReadTag(TLVTagControl tagControl, const uint8_t *& p) const;
     CHIP_ERROR EnsureData(CHIP_ERROR noDataErr);
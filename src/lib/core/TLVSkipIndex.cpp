@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/TLVSkipIndex.h>
+
+#include <lib/core/TLVReader.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace TLV {
+
+CHIP_ERROR TLVSkipIndex::Build(const ByteSpan & data)
+{
+    Clear();
+    VerifyOrReturnError(data.size() <= UINT32_MAX, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    TLVReader reader;
+    reader.Init(data);
+
+    // Containers are recorded in the order they start, so that lookups can binary search them.
+    // `current` is the innermost container the reader is in.
+    size_t count     = 0;
+    uint16_t current = kNoParent;
+    while (true)
+    {
+        CHIP_ERROR err = reader.Next();
+        if (err == CHIP_END_OF_TLV)
+        {
+            if (current == kNoParent)
+            {
+                break;
+            }
+
+            // Either the end of container marker of `current` was read or the data is truncated,
+            // in which case ExitContainer() fails.
+            Container & container  = mContainers[current];
+            const uint16_t parent  = container.parent;
+            const TLVType exitType = (parent == kNoParent) ? kTLVType_NotSpecified : static_cast<TLVType>(mContainers[parent].type);
+            err                    = reader.ExitContainer(exitType);
+            VerifyOrReturnError(err != CHIP_END_OF_TLV, CHIP_ERROR_TLV_UNDERRUN);
+            ReturnErrorOnFailure(err);
+
+            container.end = static_cast<uint32_t>(reader.GetReadPoint() - data.data());
+            current       = parent;
+            continue;
+        }
+        ReturnErrorOnFailure(err);
+
+        const TLVType type = reader.GetType();
+        if (TLVTypeIsContainer(type))
+        {
+            VerifyOrReturnError(count < std::min<size_t>(mCapacity, kNoParent), CHIP_ERROR_NO_MEMORY);
+
+            TLVType outerType;
+            ReturnErrorOnFailure(reader.EnterContainer(outerType));
+
+            Container & container = mContainers[count];
+            container.start       = static_cast<uint32_t>(reader.GetReadPoint() - data.data());
+            container.end         = 0;
+            container.parent      = current;
+            container.type        = static_cast<uint8_t>(type);
+            current               = static_cast<uint16_t>(count++);
+        }
+    }
+
+    mData    = data.data();
+    mDataLen = data.size();
+    mCount   = count;
+    return CHIP_NO_ERROR;
+}
+
+bool TLVSkipIndex::FindEnclosingContainerEnd(const uint8_t * base, const uint8_t * position, const uint8_t *& end) const
+{
+    VerifyOrReturnValue(mData != nullptr && base == mData && position >= mData && position <= mData + mDataLen, false);
+    const uint32_t offset = static_cast<uint32_t>(position - mData);
+
+    // The last container starting at or before `offset` either holds it or is nested, at any
+    // depth, in a sibling that ended before it: climb up until a container ends after `offset`.
+    const Container * found =
+        std::upper_bound(mContainers, mContainers + mCount, offset, [](uint32_t value, const Container & container) {
+            return value < container.start;
+        });
+    VerifyOrReturnValue(found != mContainers, false);
+
+    uint16_t index = static_cast<uint16_t>(found - mContainers - 1);
+    while (mContainers[index].end <= offset)
+    {
+        index = mContainers[index].parent;
+        VerifyOrReturnValue(index != kNoParent, false);
+    }
+
+    end = mData + mContainers[index].end;
+    return true;
+}
+
+} // namespace TLV
+} // namespace chip
@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *      This file defines a side index of the containers of a TLV
+ *      encoding. Once built, a TLVReader reading the same buffer can
+ *      use it to jump to the end of a container when skipping or
+ *      exiting it, instead of reading every nested element.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace TLV {
+
+/**
+ * Offsets of the containers of a TLV encoding held in a contiguous buffer.
+ *
+ * Build() reads the whole encoding once, validating it as a TLVReader would, and records where
+ * the members of every container start and where the container ends. A TLVReader given the index
+ * with TLVReader::SetSkipIndex() then skips containers (Skip(), Next(), ExitContainer(),
+ * CloseContainer(), FindElementWithTag()) in logarithmic time instead of time proportional to
+ * their content.
+ *
+ * The index is only used by readers initialized on the very buffer it was built from, and the
+ * buffer must not change while the index is in use. Encodings using implicit profile tags are not
+ * supported.
+ */
+class TLVSkipIndex
+{
+public:
+    struct Container
+    {
+        uint32_t start;  ///< Offset of the first member (right after the container head).
+        uint32_t end;    ///< Offset right after the end of container marker.
+        uint16_t parent; ///< Index of the enclosing container, or kNoParent.
+        uint8_t type;    ///< TLVType of the container.
+    };
+
+    static constexpr uint16_t kNoParent = UINT16_MAX;
+
+    /**
+     * @param storage Where to record the containers; one entry is needed per container of the
+     *                encodings given to Build(). Must outlive the index.
+     */
+    explicit TLVSkipIndex(Span<Container> storage) : mContainers(storage.data()), mCapacity(storage.size()) {}
+
+    TLVSkipIndex(const TLVSkipIndex &)             = delete;
+    TLVSkipIndex & operator=(const TLVSkipIndex &) = delete;
+
+    /**
+     * Indexes the containers of the TLV elements in @p data, replacing any previous content.
+     *
+     * @retval #CHIP_NO_ERROR        On success.
+     * @retval #CHIP_ERROR_NO_MEMORY If the storage cannot hold all the containers. The index is
+     *                               left empty.
+     * @retval other                 The error a TLVReader reports on invalid TLV. The index is
+     *                               left empty.
+     */
+    CHIP_ERROR Build(const ByteSpan & data);
+
+    /**
+     * Empties the index; readers using it fall back to reading every element.
+     */
+    void Clear()
+    {
+        mData  = nullptr;
+        mCount = 0;
+    }
+
+    size_t ContainerCount() const { return mCount; }
+
+    /**
+     * Finds the innermost container whose members include @p position.
+     *
+     * @param[in]  base     The start of the buffer read; must be the one the index was built on.
+     * @param[in]  position A position within the members of a container (possibly at its end
+     *                      of container marker).
+     * @param[out] end      On success, the position right after the end of container marker.
+     *
+     * @return false if @p base is not the indexed buffer or @p position is not within a container.
+     */
+    bool FindEnclosingContainerEnd(const uint8_t * base, const uint8_t * position, const uint8_t *& end) const;
+
+private:
+    Container * mContainers;
+    size_t mCapacity;
+    size_t mCount         = 0;
+    const uint8_t * mData = nullptr;
+    size_t mDataLen       = 0;
+};
+
+/**
+ * A TLVSkipIndex holding up to @p N containers.
+ */
+template <size_t N>
+class TLVSkipIndexWithStorage : public TLVSkipIndex
+{
+public:
+    TLVSkipIndexWithStorage() : TLVSkipIndex(Span<Container>(mStorage)) {}
+
+private:
+    Container mStorage[N];
+};
+
+} // namespace TLV
+} // namespace chip
@@ -33,6 +33,7 @@
 #include <lib/core/TLVCircularBuffer.h>
 #include <lib/core/TLVData.h>
 #include <lib/core/TLVDebug.h>
+#include <lib/core/TLVSkipIndex.h>
 #include <lib/core/TLVUtilities.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
@@ -44,6 +45,7 @@
 
 #include <system/TLVPacketBufferBackingStore.h>
 
+#include <algorithm>
 #include <stdlib.h>
 #include <string.h>
 
@@ -5540,3 +5542,191 @@ TEST_F(TestTLV, CheckUtf8ValidationOnWriteEnforcedAtSingleEntryPoint)
     writer2.Init(out);
     EXPECT_EQ(writer2.PutString(AnonymousTag(), CharSpan(invalid, sizeof(invalid))), CHIP_ERROR_INVALID_UTF8);
 }
+
+// Writes a structure with containers nested in various ways, followed by a second top-level element:
+//
+//   { 0 = 1, 1 = [ { 0 = 1, 1 = [[ "a", "b" ]] }, { 0 = 2 }, {} ], 2 = { 0 = { 0 = {} } }, 3 = "tail" }, 7
+//
+// which holds 9 containers.
+static uint32_t WriteSkipIndexEncoding(uint8_t * buf, size_t bufSize)
+{
+    TLVWriter writer;
+    writer.Init(buf, bufSize);
+
+    TLVType outer, array, element, list, nested1, nested2, nested3;
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outer), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(ContextTag(0), static_cast<uint8_t>(1)), CHIP_NO_ERROR);
+
+    EXPECT_EQ(writer.StartContainer(ContextTag(1), kTLVType_Array, array), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, element), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(ContextTag(0), static_cast<uint8_t>(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(ContextTag(1), kTLVType_List, list), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutString(AnonymousTag(), "a"), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutString(AnonymousTag(), "b"), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(list), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(element), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, element), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(ContextTag(0), static_cast<uint8_t>(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(element), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, element), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(element), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(array), CHIP_NO_ERROR);
+
+    EXPECT_EQ(writer.StartContainer(ContextTag(2), kTLVType_Structure, nested1), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(ContextTag(0), kTLVType_Structure, nested2), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(ContextTag(0), kTLVType_Structure, nested3), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(nested3), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(nested2), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(nested1), CHIP_NO_ERROR);
+
+    EXPECT_EQ(writer.PutString(ContextTag(3), "tail"), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+
+    EXPECT_EQ(writer.Put(AnonymousTag(), static_cast<uint8_t>(7)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    return writer.GetLengthWritten();
+}
+
+TEST_F(TestTLV, CheckTLVSkipIndexBuild)
+{
+    uint8_t buf[128];
+    uint32_t encodedLen = WriteSkipIndexEncoding(buf, sizeof(buf));
+
+    TLVSkipIndexWithStorage<9> index;
+    EXPECT_EQ(index.Build(ByteSpan(buf, encodedLen)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.ContainerCount(), 9u);
+
+    // Indexing an empty buffer or one without containers is fine.
+    EXPECT_EQ(index.Build(ByteSpan()), CHIP_NO_ERROR);
+    EXPECT_EQ(index.ContainerCount(), 0u);
+    EXPECT_EQ(index.Build(ByteSpan(buf + encodedLen - 2, 2)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.ContainerCount(), 0u);
+
+    TLVSkipIndexWithStorage<8> smallIndex;
+    EXPECT_EQ(smallIndex.Build(ByteSpan(buf, encodedLen)), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(smallIndex.ContainerCount(), 0u);
+
+    // Missing end of container markers.
+    EXPECT_EQ(index.Build(ByteSpan(buf, encodedLen - 3)), CHIP_ERROR_TLV_UNDERRUN);
+    EXPECT_EQ(index.ContainerCount(), 0u);
+
+    // Context tag in an array.
+    uint8_t invalid[] = { 0x16, 0x24, 0x01, 0x02, 0x18 };
+    EXPECT_EQ(index.Build(ByteSpan(invalid)), CHIP_ERROR_INVALID_TLV_TAG);
+    EXPECT_EQ(index.ContainerCount(), 0u);
+}
+
+#if CHIP_CONFIG_TLV_SKIP_INDEX
+
+// Reads WriteSkipIndexEncoding() skipping containers in all the possible ways, recording the reader position after
+// each.
+static void SkipThroughSkipIndexEncoding(const uint8_t * buf, uint32_t encodedLen, const TLVSkipIndex * index,
+                                         uint32_t (&positions)[7])
+{
+    TLVReader reader;
+    reader.Init(buf, encodedLen);
+    reader.SetSkipIndex(index);
+
+    TLVType outer;
+    EXPECT_EQ(reader.Next(kTLVType_Structure, AnonymousTag()), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+
+    // Next() over the array.
+    TLVReader tailReader;
+    EXPECT_EQ(reader.FindElementWithTag(ContextTag(3), tailReader), CHIP_NO_ERROR);
+    positions[0] = tailReader.GetLengthRead();
+    CharSpan tail;
+    EXPECT_EQ(tailReader.Get(tail), CHIP_NO_ERROR);
+    EXPECT_TRUE(tail.data_equal("tail"_span));
+
+    // Exit the first element of the array from within.
+    EXPECT_EQ(reader.Next(ContextTag(0)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(kTLVType_Array, ContextTag(1)), CHIP_NO_ERROR);
+    TLVType array, element;
+    EXPECT_EQ(reader.EnterContainer(array), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(kTLVType_Structure, AnonymousTag()), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.EnterContainer(element), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(ContextTag(0)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.ExitContainer(element), CHIP_NO_ERROR);
+    positions[1] = reader.GetLengthRead();
+    EXPECT_EQ(reader.GetContainerType(), kTLVType_Array);
+
+    // Skip() the second element, then exit the array while positioned on the third.
+    EXPECT_EQ(reader.Next(kTLVType_Structure, AnonymousTag()), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Skip(), CHIP_NO_ERROR);
+    positions[2] = reader.GetLengthRead();
+    EXPECT_EQ(reader.Next(kTLVType_Structure, AnonymousTag()), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.ExitContainer(array), CHIP_NO_ERROR);
+    positions[3] = reader.GetLengthRead();
+    EXPECT_EQ(reader.GetContainerType(), kTLVType_Structure);
+
+    // Close the nested structures from an opened container reader.
+    TLVReader nestedReader;
+    EXPECT_EQ(reader.Next(kTLVType_Structure, ContextTag(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.OpenContainer(nestedReader), CHIP_NO_ERROR);
+    EXPECT_EQ(nestedReader.Next(kTLVType_Structure, ContextTag(0)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.CloseContainer(nestedReader), CHIP_NO_ERROR);
+    positions[4] = reader.GetLengthRead();
+
+    // Exit the outer structure while positioned on a string.
+    EXPECT_EQ(reader.Next(kTLVType_UTF8String, ContextTag(3)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.ExitContainer(outer), CHIP_NO_ERROR);
+    positions[5] = reader.GetLengthRead();
+    EXPECT_EQ(reader.GetContainerType(), kTLVType_NotSpecified);
+
+    uint8_t value;
+    EXPECT_EQ(reader.Next(AnonymousTag()), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 7);
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+    positions[6] = reader.GetLengthRead();
+}
+
+TEST_F(TestTLV, CheckTLVSkipIndexReader)
+{
+    uint8_t buf[128];
+    uint32_t encodedLen = WriteSkipIndexEncoding(buf, sizeof(buf));
+
+    TLVSkipIndexWithStorage<9> index;
+    EXPECT_EQ(index.Build(ByteSpan(buf, encodedLen)), CHIP_NO_ERROR);
+
+    uint32_t expected[7];
+    SkipThroughSkipIndexEncoding(buf, encodedLen, nullptr, expected);
+
+    uint32_t positions[7];
+    SkipThroughSkipIndexEncoding(buf, encodedLen, &index, positions);
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(expected); i++)
+    {
+        EXPECT_EQ(positions[i], expected[i]);
+    }
+
+    // An index of another buffer is not used.
+    uint8_t copy[sizeof(buf)];
+    memcpy(copy, buf, encodedLen);
+    SkipThroughSkipIndexEncoding(copy, encodedLen, &index, positions);
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(expected); i++)
+    {
+        EXPECT_EQ(positions[i], expected[i]);
+    }
+
+    // The members of a container skipped with the index are not read: corrupting them after indexing goes unnoticed.
+    uint8_t * corrupted = std::find(copy, copy + encodedLen, static_cast<uint8_t>('a'));
+    ASSERT_NE(corrupted, copy + encodedLen);
+    corrupted[-2] = 0xFF;
+
+    TLVReader reader;
+    reader.Init(copy, encodedLen);
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Skip(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+    EXPECT_EQ(index.Build(ByteSpan(buf, encodedLen)), CHIP_NO_ERROR);
+    memcpy(buf, copy, encodedLen);
+    reader.Init(buf, encodedLen);
+    reader.SetSkipIndex(&index);
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Skip(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(AnonymousTag()), CHIP_NO_ERROR);
+}
+
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
@@ -0,0 +1,246 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+
+template <typename T, typename Compare>
+class IntrusiveHeap;
+
+/**
+ * Hook for objects stored in an IntrusiveHeap. An object can be in at most one heap at a time.
+ */
+class IntrusiveHeapNode
+{
+public:
+    IntrusiveHeapNode() = default;
+
+    IntrusiveHeapNode(const IntrusiveHeapNode &)             = delete;
+    IntrusiveHeapNode & operator=(const IntrusiveHeapNode &) = delete;
+
+private:
+    template <typename T, typename Compare>
+    friend class IntrusiveHeap;
+
+    IntrusiveHeapNode * mParent = nullptr;
+    IntrusiveHeapNode * mLeft   = nullptr;
+    IntrusiveHeapNode * mRight  = nullptr;
+};
+
+/**
+ * A binary min-heap whose nodes are linked through the objects themselves, so it needs no storage
+ * of its own and has no capacity limit.
+ *
+ * Insert and Remove (of any node, not only the top one) are O(log n); Top is O(1).
+ *
+ * @tparam T        object type, which must derive from IntrusiveHeapNode.
+ * @tparam Compare  functor type: Compare()(a, b) returns true if a must come out of the heap before b.
+ *
+ * The heap keeps the tree complete: the node at position n (counting from 1 in breadth-first order)
+ * is found from the root by following the bits of n after the leading one, 0 meaning left and 1 right.
+ */
+template <typename T, typename Compare>
+class IntrusiveHeap
+{
+public:
+    IntrusiveHeap() = default;
+
+    IntrusiveHeap(const IntrusiveHeap &)             = delete;
+    IntrusiveHeap & operator=(const IntrusiveHeap &) = delete;
+
+    bool Empty() const { return mRoot == nullptr; }
+    size_t Size() const { return mSize; }
+
+    /// Returns the first object to come out of the heap, or nullptr if the heap is empty.
+    T * Top() const { return static_cast<T *>(mRoot); }
+
+    bool Contains(const T & object) const
+    {
+        const IntrusiveHeapNode * node = &object;
+        return node->mParent != nullptr || node == mRoot;
+    }
+
+    void Insert(T & object)
+    {
+        IntrusiveHeapNode * node = &object;
+        VerifyOrDie(!Contains(object));
+        node->mLeft  = nullptr;
+        node->mRight = nullptr;
+
+        IntrusiveHeapNode ** link = &mRoot;
+        IntrusiveHeapNode * parent = nullptr;
+        mSize++;
+        for (size_t bit = HighestBitBelowTop(mSize); bit != 0; bit >>= 1)
+        {
+            parent = *link;
+            link   = (mSize & bit) ? &parent->mRight : &parent->mLeft;
+        }
+        node->mParent = parent;
+        *link         = node;
+
+        SiftUp(node);
+    }
+
+    void Remove(T & object)
+    {
+        IntrusiveHeapNode * node = &object;
+        VerifyOrDie(Contains(object));
+
+        // Detach the last node of the tree, and put it in place of the removed one.
+        IntrusiveHeapNode ** link = &mRoot;
+        for (size_t bit = HighestBitBelowTop(mSize); bit != 0; bit >>= 1)
+        {
+            link = (mSize & bit) ? &(*link)->mRight : &(*link)->mLeft;
+        }
+        IntrusiveHeapNode * last = *link;
+        *link                    = nullptr;
+        mSize--;
+
+        if (last != node)
+        {
+            last->mLeft   = node->mLeft;
+            last->mRight  = node->mRight;
+            last->mParent = node->mParent;
+            if (last->mLeft != nullptr)
+            {
+                last->mLeft->mParent = last;
+            }
+            if (last->mRight != nullptr)
+            {
+                last->mRight->mParent = last;
+            }
+            *LinkTo(node) = last;
+
+            SiftDown(last);
+            SiftUp(last);
+        }
+
+        node->mParent = nullptr;
+        node->mLeft   = nullptr;
+        node->mRight  = nullptr;
+    }
+
+    /// Restores the heap order after the sort key of an object in the heap changed.
+    void Update(T & object)
+    {
+        Remove(object);
+        Insert(object);
+    }
+
+private:
+    static bool Less(const IntrusiveHeapNode * a, const IntrusiveHeapNode * b)
+    {
+        return Compare()(*static_cast<const T *>(a), *static_cast<const T *>(b));
+    }
+
+    // Returns the bit just below the most significant one of position, i.e. the first step of the path to position.
+    static size_t HighestBitBelowTop(size_t position)
+    {
+        size_t bit = 1;
+        while ((position >> 1) >= bit)
+        {
+            bit <<= 1;
+        }
+        return bit >> 1;
+    }
+
+    IntrusiveHeapNode ** LinkTo(IntrusiveHeapNode * node)
+    {
+        IntrusiveHeapNode * parent = node->mParent;
+        if (parent == nullptr)
+        {
+            return &mRoot;
+        }
+        return (parent->mLeft == node) ? &parent->mLeft : &parent->mRight;
+    }
+
+    // Swaps a node with its child, so that the child takes its place in the tree.
+    void SwapWithChild(IntrusiveHeapNode * parent, IntrusiveHeapNode * child)
+    {
+        IntrusiveHeapNode ** link    = LinkTo(parent);
+        IntrusiveHeapNode * sibling  = (parent->mLeft == child) ? parent->mRight : parent->mLeft;
+        IntrusiveHeapNode * childLeft  = child->mLeft;
+        IntrusiveHeapNode * childRight = child->mRight;
+
+        if (parent->mLeft == child)
+        {
+            child->mLeft  = parent;
+            child->mRight = sibling;
+        }
+        else
+        {
+            child->mLeft  = sibling;
+            child->mRight = parent;
+        }
+        child->mParent = parent->mParent;
+        *link          = child;
+        if (sibling != nullptr)
+        {
+            sibling->mParent = child;
+        }
+
+        parent->mParent = child;
+        parent->mLeft   = childLeft;
+        parent->mRight  = childRight;
+        if (childLeft != nullptr)
+        {
+            childLeft->mParent = parent;
+        }
+        if (childRight != nullptr)
+        {
+            childRight->mParent = parent;
+        }
+    }
+
+    void SiftUp(IntrusiveHeapNode * node)
+    {
+        while (node->mParent != nullptr && Less(node, node->mParent))
+        {
+            SwapWithChild(node->mParent, node);
+        }
+    }
+
+    void SiftDown(IntrusiveHeapNode * node)
+    {
+        while (true)
+        {
+            IntrusiveHeapNode * smallest = node;
+            if (node->mLeft != nullptr && Less(node->mLeft, smallest))
+            {
+                smallest = node->mLeft;
+            }
+            if (node->mRight != nullptr && Less(node->mRight, smallest))
+            {
+                smallest = node->mRight;
+            }
+            if (smallest == node)
+            {
+                return;
+            }
+            SwapWithChild(node, smallest);
+        }
+    }
+
+    IntrusiveHeapNode * mRoot = nullptr;
+    size_t mSize              = 0;
+};
+
+} // namespace chip
@@ -0,0 +1,146 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ctime>
+#include <set>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/IntrusiveHeap.h>
+
+namespace {
+
+using namespace chip;
+
+class TestIntrusiveHeap : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        unsigned seed = static_cast<unsigned>(std::time(nullptr));
+        printf("Running " __FILE__ " using seed %d \n", seed);
+        std::srand(seed);
+    }
+};
+
+struct HeapNode : public IntrusiveHeapNode
+{
+    int key = 0;
+};
+
+struct HeapNodeCompare
+{
+    bool operator()(const HeapNode & a, const HeapNode & b) const { return a.key < b.key; }
+};
+
+using Heap = IntrusiveHeap<HeapNode, HeapNodeCompare>;
+
+TEST_F(TestIntrusiveHeap, TestOrder)
+{
+    Heap heap;
+    HeapNode nodes[10];
+    const int keys[] = { 5, 3, 8, 1, 9, 2, 7, 3, 6, 0 };
+
+    EXPECT_TRUE(heap.Empty());
+    EXPECT_EQ(heap.Top(), nullptr);
+
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(nodes); i++)
+    {
+        nodes[i].key = keys[i];
+        heap.Insert(nodes[i]);
+        EXPECT_TRUE(heap.Contains(nodes[i]));
+    }
+    EXPECT_EQ(heap.Size(), MATTER_ARRAY_SIZE(nodes));
+
+    int previous = -1;
+    while (!heap.Empty())
+    {
+        HeapNode * top = heap.Top();
+        EXPECT_GE(top->key, previous);
+        previous = top->key;
+        heap.Remove(*top);
+        EXPECT_FALSE(heap.Contains(*top));
+    }
+    EXPECT_EQ(heap.Size(), 0u);
+}
+
+TEST_F(TestIntrusiveHeap, TestUpdate)
+{
+    Heap heap;
+    HeapNode a, b, c;
+    a.key = 1;
+    b.key = 2;
+    c.key = 3;
+    heap.Insert(a);
+    heap.Insert(b);
+    heap.Insert(c);
+    EXPECT_EQ(heap.Top(), &a);
+
+    a.key = 10;
+    heap.Update(a);
+    EXPECT_EQ(heap.Top(), &b);
+
+    c.key = 0;
+    heap.Update(c);
+    EXPECT_EQ(heap.Top(), &c);
+
+    heap.Remove(c);
+    heap.Remove(b);
+    EXPECT_EQ(heap.Top(), &a);
+    heap.Remove(a);
+    EXPECT_TRUE(heap.Empty());
+}
+
+TEST_F(TestIntrusiveHeap, TestRandom)
+{
+    Heap heap;
+    HeapNode nodes[200];
+    std::multiset<int> reference;
+
+    for (int round = 0; round < 10000; round++)
+    {
+        HeapNode & node = nodes[static_cast<size_t>(std::rand()) % MATTER_ARRAY_SIZE(nodes)];
+        if (heap.Contains(node))
+        {
+            reference.erase(reference.find(node.key));
+            heap.Remove(node);
+        }
+        else
+        {
+            node.key = std::rand() % 50;
+            reference.insert(node.key);
+            heap.Insert(node);
+        }
+
+        ASSERT_EQ(heap.Size(), reference.size());
+        if (!reference.empty())
+        {
+            ASSERT_EQ(heap.Top()->key, *reference.begin());
+        }
+    }
+
+    while (!heap.Empty())
+    {
+        ASSERT_EQ(heap.Top()->key, *reference.begin());
+        reference.erase(reference.begin());
+        heap.Remove(*heap.Top());
+    }
+    EXPECT_TRUE(reference.empty());
+}
+
+} // namespace
@@ -267,6 +267,10 @@ private:
 
     void OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader, const SessionHandle & session,
                            DuplicateMessage isDuplicate, System::PacketBufferHandle && msgBuf) override;
+    void OnMessageSendFailed(const System::PacketBufferHandle & msgBuf, CHIP_ERROR err) override
+    {
+        mReliableMessageMgr.OnMessageSendFailed(msgBuf, err);
+    }
     void SendStandaloneAckIfNeeded(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                    const SessionHandle & session, MessageFlags msgFlags, System::PacketBufferHandle && msgBuf);
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
@@ -76,6 +76,11 @@ public:
         // that have elapsed between when the initial message was sent and when we received
         // acknowledgment for the message.
         std::optional<System::Clock::Milliseconds64> ackLatencyMs;
+        // When eventType is kRetransmission, this will be populated with the number of milliseconds
+        // that have elapsed between when the retransmission was scheduled to be sent and when it
+        // was actually sent. This grows when the retransmission timer fires late, or when many
+        // retransmissions come due at once.
+        std::optional<System::Clock::Milliseconds64> queueingDelayMs;
     };
 
     virtual void OnTransmitEvent(const TransmitEvent & event) = 0;
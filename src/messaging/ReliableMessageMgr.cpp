@@ -51,7 +51,7 @@ namespace Messaging {
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0), scheduleOrder(0)
 {
     ec->SetWaitingForAck(true);
 }
@@ -78,7 +78,7 @@ void ReliableMessageMgr::Shutdown()
 
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        mRetransTable.ReleaseObject(entry);
+        ReleaseRetransTableEntry(*entry);
         return Loop::Continue;
     });
 
@@ -130,6 +130,7 @@ void ReliableMessageMgr::NotifyMessageSendAnalytics(const RetransTableEntry & en
     if (eventType == ReliableMessageAnalyticsDelegate::EventType::kRetransmission)
     {
         event.retransmissionCount = entry.sendCount;
+        event.queueingDelayMs     = entry.queueingDelay;
     }
     if (eventType == ReliableMessageAnalyticsDelegate::EventType::kAcknowledged)
     {
@@ -162,11 +163,15 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
-
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired, in the order they expired.
+    //
+    // Processing an entry either releases it or reschedules it with a later schedule order. Entries rescheduled here are not
+    // processed again before the next timer fire, even if their new retrans time has already been reached (e.g. zero backoff).
+    const uint32_t scheduleOrderLimit = mNextScheduleOrder;
+    for (RetransTableEntry * entry = mRetransSchedule.Top();
+         entry != nullptr && entry->nextRetransTime <= now && static_cast<int32_t>(entry->scheduleOrder - scheduleOrderLimit) < 0;
+         entry = mRetransSchedule.Top())
+    {
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
         // Don't check whether the session in the exchange is valid, because when the session is released, the retrans entry is
@@ -212,9 +217,9 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
+            ReleaseRetransTableEntry(*entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -226,10 +231,12 @@ void ReliableMessageMgr::ExecuteActions()
                         Transport::GetSessionTypeString(session), fabricIndex, ChipLogValueX64(destination));
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
 
-        TEMPORARY_RETURN_IGNORED SendFromRetransTable(entry);
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+        entry->queueingDelay = System::SystemClock().GetMonotonicTimestamp() - entry->nextRetransTime;
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
-        return Loop::Continue;
-    });
+        TEMPORARY_RETURN_IGNORED SendFromRetransTable(entry);
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -423,6 +430,28 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
     return err;
 }
 
+void ReliableMessageMgr::OnMessageSendFailed(const System::PacketBufferHandle & msgBuf, CHIP_ERROR err)
+{
+    mRetransTable.ForEachActiveObject([&](auto * entry) {
+        if (!entry->retainedBuf.IsSameBuffer(msgBuf))
+        {
+            return Loop::Continue;
+        }
+
+        if (MapSendError(err, entry->ec->GetExchangeId(), entry->ec->IsInitiator()) != CHIP_NO_ERROR)
+        {
+            // Using same error message for all errors to reduce code size.
+            ChipLogError(ExchangeManager,
+                         "Crit-err %" CHIP_ERROR_FORMAT " when sending CHIP MessageCounter:" ChipLogFormatMessageCounter
+                         " on exchange " ChipLogFormatExchange ", send tries: %d",
+                         err.Format(), entry->retainedBuf.GetMessageCounter(), ChipLogValueExchange(&entry->ec.Get()),
+                         entry->sendCount);
+            ClearRetransTable(*entry);
+        }
+        return Loop::Break;
+    });
+}
+
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
     mRetransTable.ForEachActiveObject([&](auto * entry) {
@@ -437,11 +466,20 @@ void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransTableEntry(entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
 
+void ReliableMessageMgr::ReleaseRetransTableEntry(RetransTableEntry & entry)
+{
+    if (mRetransSchedule.Contains(entry))
+    {
+        mRetransSchedule.Remove(entry);
+    }
+    mRetransTable.ReleaseObject(&entry);
+}
+
 void ReliableMessageMgr::StartTimer()
 {
     // When do we need to next wake up to send an ACK?
@@ -455,13 +493,11 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    const RetransTableEntry * nextRetrans = mRetransSchedule.Top();
+    if (nextRetrans != nullptr && nextRetrans->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = nextRetrans->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -567,6 +603,15 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    entry.scheduleOrder            = mNextScheduleOrder++;
+    if (mRetransSchedule.Contains(entry))
+    {
+        mRetransSchedule.Update(entry);
+    }
+    else
+    {
+        mRetransSchedule.Insert(entry);
+    }
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
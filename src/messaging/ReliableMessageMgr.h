@@ -29,6 +29,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/IntrusiveHeap.h>
 #include <lib/support/Pool.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageAnalyticsDelegate.h>
@@ -56,8 +57,12 @@ public:
      *    acknowledgment back. If the acknowledgment is not received within a
      *    specific timeout, the message would be retransmitted from this table.
      *
+     *    Once it has been sent, an entry is kept in a heap ordered by
+     *    nextRetransTime, so that the next entry to retransmit is found without
+     *    going through the whole table.
+     *
      */
-    struct RetransTableEntry
+    struct RetransTableEntry : public IntrusiveHeapNode
     {
         RetransTableEntry(ReliableMessageContext * rc);
         ~RetransTableEntry();
@@ -67,9 +72,11 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
+        uint32_t scheduleOrder;                   /**< Orders entries with the same nextRetransTime, first scheduled first. */
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-        System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
-#endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+        System::Clock::Timestamp initialSentTime;        /**< Timestamp when the initial message was sent */
+        System::Clock::Milliseconds64 queueingDelay{ 0 }; /**< How late the last retransmission was sent */
+#endif                                                   // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -148,6 +155,15 @@ public:
      */
     CHIP_ERROR SendFromRetransTable(RetransTableEntry * entry);
 
+    /**
+     *  Handle a message that the transport failed to send after the send had been reported as successful. If the
+     *  message is in the retransmission table, its entry is cleared as if the send had failed right away.
+     *
+     *  @param[in]    msgBuf    The buffer of the message that failed to be sent.
+     *  @param[in]    err       The error sending the message.
+     */
+    void OnMessageSendFailed(const System::PacketBufferHandle & msgBuf, CHIP_ERROR err);
+
     /**
      *  Clear entries matching a specified ExchangeContext.
      *
@@ -165,7 +181,7 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
+     * Iterate through active exchange contexts and look up the earliest retransmission.
      * Determine how many ReliableMessageProtocol ticks we need to sleep before we
      * need to physically wake the CPU to perform an action.  Set a timer to go off
      * when we next need to wake the system.
@@ -243,6 +259,26 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Removes an entry from the retransmission schedule, if it is in it, and releases it.
+     * Unlike ClearRetransTable, this does not restart the timer.
+     */
+    void ReleaseRetransTableEntry(RetransTableEntry & entry);
+
+    // Orders entries by next retransmission time, then by the order in which they were scheduled. The latter is compared
+    // modulo 2^32, which holds as long as less than 2^31 retransmissions are scheduled during the lifetime of an entry.
+    struct RetransTimeCompare
+    {
+        bool operator()(const RetransTableEntry & a, const RetransTableEntry & b) const
+        {
+            if (a.nextRetransTime != b.nextRetransTime)
+            {
+                return a.nextRetransTime < b.nextRetransTime;
+            }
+            return static_cast<int32_t>(a.scheduleOrder - b.scheduleOrder) < 0;
+        }
+    };
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -266,6 +302,10 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    // The entries of mRetransTable that have been sent, in retransmission order.
+    IntrusiveHeap<RetransTableEntry, RetransTimeCompare> mRetransSchedule;
+    uint32_t mNextScheduleOrder = 0;
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     ReliableMessageAnalyticsDelegate * mAnalyticsDelegate = nullptr;
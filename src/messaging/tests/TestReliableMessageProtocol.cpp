@@ -222,6 +222,19 @@ public:
     MockSessionEstablishmentExchangeDispatch mMessageDispatch;
 };
 
+class CapturingLoopbackDelegate : public chip::Testing::LoopbackTransportDelegate
+{
+public:
+    void WillSendMessage(const Transport::PeerAddress & peer, const System::PacketBufferHandle & message) override
+    {
+        mPeer        = peer;
+        mLastMessage = message.Retain();
+    }
+
+    Transport::PeerAddress mPeer;
+    System::PacketBufferHandle mLastMessage;
+};
+
 struct BackoffComplianceTestVector
 {
     uint8_t sendCount;
@@ -616,6 +629,54 @@ TEST_F(TestReliableMessageProtocol, CheckFailedMessageRetainOnSend)
     EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
 }
 
+TEST_F(TestReliableMessageProtocol, CheckMessageSendFailedClearsRetrans)
+{
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    EXPECT_FALSE(buffer.IsNull());
+
+    MockSessionEstablishmentDelegate mockSender;
+    ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(exchange, nullptr);
+
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    // Drop the message, so that it stays in the retransmit table.
+    CapturingLoopbackDelegate loopbackDelegate;
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 1;
+    loopback.mDroppedMessageCount = 0;
+    loopback.SetLoopbackTransportDelegate(&loopbackDelegate);
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    loopback.SetLoopbackTransportDelegate(nullptr);
+
+    EXPECT_EQ(loopback.mDroppedMessageCount, 1u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+    ASSERT_FALSE(loopbackDelegate.mLastMessage.IsNull());
+
+    // A failure reported for another buffer does not affect the entry.
+    auto otherBuffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    GetSecureSessionManager().OnMessageSendFailed(loopbackDelegate.mPeer, otherBuffer, CHIP_ERROR_POSIX(EHOSTUNREACH));
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+
+    // A transient failure leaves the message to be retransmitted.
+    GetSecureSessionManager().OnMessageSendFailed(loopbackDelegate.mPeer, loopbackDelegate.mLastMessage,
+                                                  CHIP_ERROR_POSIX(ENOBUFS));
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+
+    // Any other failure drops the retransmission, as when SendMessage() itself fails.
+    GetSecureSessionManager().OnMessageSendFailed(loopbackDelegate.mPeer, loopbackDelegate.mLastMessage,
+                                                  CHIP_ERROR_POSIX(EHOSTUNREACH));
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    loopbackDelegate.mLastMessage = nullptr;
+    DrainAndServiceIO();
+}
+
 TEST_F(TestReliableMessageProtocol, CheckUnencryptedMessageReceiveFailure)
 {
     chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
@@ -2536,6 +2597,7 @@ TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitEven
     EXPECT_EQ(firstTransmitEvent.eventType, ReliableMessageAnalyticsDelegate::EventType::kInitialSend);
     EXPECT_EQ(firstTransmitEvent.retransmissionCount, std::nullopt);
     EXPECT_EQ(firstTransmitEvent.ackLatencyMs, std::nullopt);
+    EXPECT_EQ(firstTransmitEvent.queueingDelayMs, std::nullopt);
     // We have no way of validating the first messageCounter since this is a randomly generated value, but it should
     // remain constant for all subsequent transmit events in this test.
     const uint32_t messageCounter = firstTransmitEvent.messageCounter;
@@ -2547,6 +2609,7 @@ TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitEven
     EXPECT_EQ(secondTransmitEvent.eventType, ReliableMessageAnalyticsDelegate::EventType::kRetransmission);
     EXPECT_EQ(secondTransmitEvent.retransmissionCount, 1);
     EXPECT_EQ(secondTransmitEvent.ackLatencyMs, std::nullopt);
+    EXPECT_TRUE(secondTransmitEvent.queueingDelayMs.has_value());
     EXPECT_EQ(messageCounter, secondTransmitEvent.messageCounter);
 
     testAnalyticsDelegate.mTransmitEvents.pop();
@@ -2556,6 +2619,7 @@ TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitEven
     EXPECT_EQ(thirdTransmitEvent.eventType, ReliableMessageAnalyticsDelegate::EventType::kRetransmission);
     EXPECT_EQ(thirdTransmitEvent.retransmissionCount, 2);
     EXPECT_EQ(thirdTransmitEvent.ackLatencyMs, std::nullopt);
+    EXPECT_TRUE(thirdTransmitEvent.queueingDelayMs.has_value());
     EXPECT_EQ(messageCounter, thirdTransmitEvent.messageCounter);
 
     testAnalyticsDelegate.mTransmitEvents.pop();
@@ -2565,6 +2629,7 @@ TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitEven
     EXPECT_EQ(fourthTransmitEvent.eventType, ReliableMessageAnalyticsDelegate::EventType::kRetransmission);
     EXPECT_EQ(fourthTransmitEvent.retransmissionCount, 3);
     EXPECT_EQ(fourthTransmitEvent.ackLatencyMs, std::nullopt);
+    EXPECT_TRUE(fourthTransmitEvent.queueingDelayMs.has_value());
     EXPECT_EQ(messageCounter, fourthTransmitEvent.messageCounter);
 
     testAnalyticsDelegate.mTransmitEvents.pop();
@@ -2574,6 +2639,7 @@ TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitEven
     EXPECT_EQ(fifthTransmitEvent.eventType, ReliableMessageAnalyticsDelegate::EventType::kRetransmission);
     EXPECT_EQ(fifthTransmitEvent.retransmissionCount, 4);
     EXPECT_EQ(fifthTransmitEvent.ackLatencyMs, std::nullopt);
+    EXPECT_TRUE(fifthTransmitEvent.queueingDelayMs.has_value());
     EXPECT_EQ(messageCounter, fifthTransmitEvent.messageCounter);
 
     testAnalyticsDelegate.mTransmitEvents.pop();
@@ -2583,6 +2649,7 @@ TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitEven
     EXPECT_EQ(sixthTransmitEvent.eventType, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
     EXPECT_EQ(sixthTransmitEvent.retransmissionCount, std::nullopt);
     EXPECT_TRUE(sixthTransmitEvent.ackLatencyMs.has_value());
+    EXPECT_EQ(sixthTransmitEvent.queueingDelayMs, std::nullopt);
     auto expectedMinimumAckLatencyTime = System::Clock::Milliseconds64(kTestRetryInterval * 5);
     EXPECT_GT(sixthTransmitEvent.ackLatencyMs, expectedMinimumAckLatencyTime);
     EXPECT_EQ(messageCounter, sixthTransmitEvent.messageCounter);
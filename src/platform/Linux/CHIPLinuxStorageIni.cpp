@@ -47,22 +47,16 @@ CHIP_ERROR ChipLinuxStorageIni::Init()
     return RemoveAll();
 }
 
-CHIP_ERROR ChipLinuxStorageIni::GetDefaultSection(std::map<std::string, std::string> & section)
+CHIP_ERROR ChipLinuxStorageIni::GetEntry(const char * key, const std::string *& value)
 {
-    CHIP_ERROR retval = CHIP_NO_ERROR;
+    auto sectionIt = mConfigStore.sections.find("DEFAULT");
+    VerifyOrReturnError(sectionIt != mConfigStore.sections.end(), CHIP_ERROR_KEY_NOT_FOUND);
 
-    auto it = mConfigStore.sections.find("DEFAULT");
+    auto it = sectionIt->second.find(EscapeKey(key));
+    VerifyOrReturnError(it != sectionIt->second.end(), CHIP_ERROR_KEY_NOT_FOUND);
 
-    if (it != mConfigStore.sections.end())
-    {
-        section = mConfigStore.sections["DEFAULT"];
-    }
-    else
-    {
-        retval = CHIP_ERROR_KEY_NOT_FOUND;
-    }
-
-    return retval;
+    value = &it->second;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ChipLinuxStorageIni::AddConfig(const std::string & configFile)
@@ -75,6 +69,7 @@ CHIP_ERROR ChipLinuxStorageIni::AddConfig(const std::string & configFile)
     if (ifs.is_open())
     {
         mConfigStore.parse(ifs);
+        mDecodedBlobs.clear();
         ifs.close();
     }
     else
@@ -113,168 +108,56 @@ CHIP_ERROR ChipLinuxStorageIni::CommitConfig(const std::string & configFile)
 
 CHIP_ERROR ChipLinuxStorageIni::GetUInt16Value(const char * key, uint16_t & val)
 {
-    CHIP_ERROR retval = CHIP_NO_ERROR;
-    std::map<std::string, std::string> section;
-
-    retval = GetDefaultSection(section);
-
-    if (retval == CHIP_NO_ERROR)
-    {
-        std::string escapedKey = EscapeKey(key);
-        auto it                = section.find(escapedKey);
-
-        if (it != section.end())
-        {
-            if (!inipp::extract(section[escapedKey], val))
-            {
-                retval = CHIP_ERROR_INVALID_ARGUMENT;
-            }
-        }
-        else
-        {
-            retval = CHIP_ERROR_KEY_NOT_FOUND;
-        }
-    }
-
-    return retval;
+    const std::string * value;
+    ReturnErrorOnFailure(GetEntry(key, value));
+    VerifyOrReturnError(inipp::extract(*value, val), CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ChipLinuxStorageIni::GetUIntValue(const char * key, uint32_t & val)
 {
-    CHIP_ERROR retval = CHIP_NO_ERROR;
-    std::map<std::string, std::string> section;
-
-    retval = GetDefaultSection(section);
-
-    if (retval == CHIP_NO_ERROR)
-    {
-        std::string escapedKey = EscapeKey(key);
-        auto it                = section.find(escapedKey);
-
-        if (it != section.end())
-        {
-            if (!inipp::extract(section[escapedKey], val))
-            {
-                retval = CHIP_ERROR_INVALID_ARGUMENT;
-            }
-        }
-        else
-        {
-            retval = CHIP_ERROR_KEY_NOT_FOUND;
-        }
-    }
-
-    return retval;
+    const std::string * value;
+    ReturnErrorOnFailure(GetEntry(key, value));
+    VerifyOrReturnError(inipp::extract(*value, val), CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ChipLinuxStorageIni::GetUInt64Value(const char * key, uint64_t & val)
 {
-    CHIP_ERROR retval = CHIP_NO_ERROR;
-    std::map<std::string, std::string> section;
-
-    retval = GetDefaultSection(section);
-
-    if (retval == CHIP_NO_ERROR)
-    {
-        std::string escapedKey = EscapeKey(key);
-        auto it                = section.find(escapedKey);
-
-        if (it != section.end())
-        {
-            if (!inipp::extract(section[escapedKey], val))
-            {
-                retval = CHIP_ERROR_INVALID_ARGUMENT;
-            }
-        }
-        else
-        {
-            retval = CHIP_ERROR_KEY_NOT_FOUND;
-        }
-    }
-
-    return retval;
+    const std::string * value;
+    ReturnErrorOnFailure(GetEntry(key, value));
+    VerifyOrReturnError(inipp::extract(*value, val), CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ChipLinuxStorageIni::GetStringValue(const char * key, char * buf, size_t bufSize, size_t & outLen)
 {
-    CHIP_ERROR retval = CHIP_NO_ERROR;
-    std::map<std::string, std::string> section;
-
-    retval = GetDefaultSection(section);
+    const std::string * value;
+    ReturnErrorOnFailure(GetEntry(key, value));
 
-    if (retval == CHIP_NO_ERROR)
+    size_t len = value->size();
+    if (len > bufSize - 1)
     {
-        std::string escapedKey = EscapeKey(key);
-        auto it                = section.find(escapedKey);
-
-        if (it != section.end())
-        {
-            std::string value;
-            if (inipp::extract(section[escapedKey], value))
-            {
-                size_t len = value.size();
-
-                if (len > bufSize - 1)
-                {
-                    outLen = len;
-                    retval = CHIP_ERROR_BUFFER_TOO_SMALL;
-                }
-                else
-                {
-                    outLen      = value.copy(buf, len);
-                    buf[outLen] = '\0';
-                }
-            }
-            else
-            {
-                retval = CHIP_ERROR_INVALID_ARGUMENT;
-            }
-        }
-        else
-        {
-            retval = CHIP_ERROR_KEY_NOT_FOUND;
-        }
+        outLen = len;
+        return CHIP_ERROR_BUFFER_TOO_SMALL;
     }
 
-    return retval;
+    outLen      = value->copy(buf, len);
+    buf[outLen] = '\0';
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR ChipLinuxStorageIni::GetBinaryBlobDataAndLengths(const char * key,
-                                                            chip::Platform::ScopedMemoryBuffer<char> & encodedData,
-                                                            size_t & encodedDataLen, size_t & decodedDataLen)
+CHIP_ERROR ChipLinuxStorageIni::DecodeBinaryBlob(const std::string & encodedData, std::vector<uint8_t> & decodedData)
 {
-    size_t encodedDataPaddingLen = 0;
-    std::map<std::string, std::string> section;
-    CHIP_ERROR err = GetDefaultSection(section);
-    if (err != CHIP_NO_ERROR)
-    {
-        return err;
-    }
-
-    std::string escapedKey = EscapeKey(key);
-    auto it                = section.find(escapedKey);
-    if (it == section.end())
-    {
-        return CHIP_ERROR_KEY_NOT_FOUND;
-    }
-
-    std::string value;
-
-    // Compute the expectedDecodedLen
-    if (!inipp::extract(section[escapedKey], value))
-    {
-        return CHIP_ERROR_INVALID_ARGUMENT;
-    }
-
-    size_t len = value.size();
-    if (!encodedData.Alloc(len + 1))
+    size_t encodedDataLen = encodedData.size();
+    if (encodedDataLen > UINT16_MAX)
     {
-        return CHIP_ERROR_NO_MEMORY;
+        // We can't even pass this length into Base64Decode.
+        return CHIP_ERROR_DECODE_FAILED;
     }
-    encodedDataLen              = value.copy(encodedData.Get(), len);
-    encodedData[encodedDataLen] = '\0';
 
     // Check if encoded data was padded. Only "=" or "==" padding combinations are allowed.
+    size_t encodedDataPaddingLen = 0;
     if ((encodedDataLen > 0) && (encodedData[encodedDataLen - 1] == '='))
     {
         encodedDataPaddingLen++;
@@ -282,44 +165,39 @@ CHIP_ERROR ChipLinuxStorageIni::GetBinaryBlobDataAndLengths(const char * key,
             encodedDataPaddingLen++;
     }
 
-    decodedDataLen = ((encodedDataLen - encodedDataPaddingLen) * 3) / 4;
+    size_t expectedDecodedLen = ((encodedDataLen - encodedDataPaddingLen) * 3) / 4;
+    decodedData.resize(expectedDecodedLen);
+
+    // Cast is safe because we checked encodedDataLen above.
+    size_t decodedDataLen = Base64Decode(encodedData.data(), static_cast<uint16_t>(encodedDataLen), decodedData.data());
+    if (decodedDataLen == UINT16_MAX || decodedDataLen > expectedDecodedLen)
+    {
+        return CHIP_ERROR_DECODE_FAILED;
+    }
 
+    decodedData.resize(decodedDataLen);
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ChipLinuxStorageIni::GetBinaryBlobValue(const char * key, uint8_t * decodedData, size_t bufSize, size_t & decodedDataLen)
 {
-    CHIP_ERROR retval = CHIP_NO_ERROR;
-    chip::Platform::ScopedMemoryBuffer<char> encodedData;
-    size_t encodedDataLen;
-    size_t expectedDecodedLen = 0;
-
-    retval = GetBinaryBlobDataAndLengths(key, encodedData, encodedDataLen, expectedDecodedLen);
-
-    // Check the size
-    if (retval != CHIP_NO_ERROR)
-    {
-        return retval;
-    }
-
-    if (expectedDecodedLen > bufSize)
+    // Callers usually read a blob twice, first for its size and then for its data, so decode it once and keep it.
+    auto it = mDecodedBlobs.find(key);
+    if (it == mDecodedBlobs.end())
     {
-        decodedDataLen = expectedDecodedLen;
-        return CHIP_ERROR_BUFFER_TOO_SMALL;
-    }
+        const std::string * value;
+        ReturnErrorOnFailure(GetEntry(key, value));
 
-    if (encodedDataLen > UINT16_MAX)
-    {
-        // We can't even pass this length into Base64Decode.
-        return CHIP_ERROR_DECODE_FAILED;
+        std::vector<uint8_t> blob;
+        ReturnErrorOnFailure(DecodeBinaryBlob(*value, blob));
+        it = mDecodedBlobs.emplace(key, std::move(blob)).first;
     }
 
-    // Decode it
-    // Cast is safe because we checked encodedDataLen above.
-    decodedDataLen = Base64Decode(encodedData.Get(), static_cast<uint16_t>(encodedDataLen), decodedData);
-    if (decodedDataLen == UINT16_MAX || decodedDataLen > expectedDecodedLen)
+    decodedDataLen = it->second.size();
+    VerifyOrReturnError(decodedDataLen <= bufSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    if (decodedDataLen > 0)
     {
-        return CHIP_ERROR_DECODE_FAILED;
+        memcpy(decodedData, it->second.data(), decodedDataLen);
     }
 
     return CHIP_NO_ERROR;
@@ -327,15 +205,8 @@ CHIP_ERROR ChipLinuxStorageIni::GetBinaryBlobValue(const char * key, uint8_t * d
 
 bool ChipLinuxStorageIni::HasValue(const char * key)
 {
-    std::map<std::string, std::string> section;
-
-    if (GetDefaultSection(section) != CHIP_NO_ERROR)
-        return false;
-
-    std::string escapedKey = EscapeKey(key);
-    auto it                = section.find(escapedKey);
-
-    return it != section.end();
+    const std::string * value;
+    return GetEntry(key, value) == CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ChipLinuxStorageIni::AddEntry(const char * key, const char * value)
@@ -347,6 +218,7 @@ CHIP_ERROR ChipLinuxStorageIni::AddEntry(const char * key, const char * value)
         std::string escapedKey                       = EscapeKey(key);
         std::map<std::string, std::string> & section = mConfigStore.sections["DEFAULT"];
         section[escapedKey]                          = std::string(value);
+        mDecodedBlobs.erase(key);
     }
     else
     {
@@ -369,6 +241,7 @@ CHIP_ERROR ChipLinuxStorageIni::RemoveEntry(const char * key)
     if (it != section.end())
     {
         section.erase(it);
+        mDecodedBlobs.erase(key);
     }
     else
     {
@@ -381,6 +254,7 @@ CHIP_ERROR ChipLinuxStorageIni::RemoveEntry(const char * key)
 CHIP_ERROR ChipLinuxStorageIni::RemoveAll()
 {
     mConfigStore.clear();
+    mDecodedBlobs.clear();
 
     return CHIP_NO_ERROR;
 }
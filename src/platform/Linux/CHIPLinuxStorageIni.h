@@ -31,6 +31,8 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace chip {
 namespace DeviceLayer {
@@ -55,10 +57,14 @@ protected:
     CHIP_ERROR RemoveAll();
 
 private:
-    CHIP_ERROR GetDefaultSection(std::map<std::string, std::string> & section);
-    CHIP_ERROR GetBinaryBlobDataAndLengths(const char * key, chip::Platform::ScopedMemoryBuffer<char> & encodedData,
-                                           size_t & encodedDataLen, size_t & decodedDataLen);
+    // Finds the value of key in the default section, without copying it.
+    CHIP_ERROR GetEntry(const char * key, const std::string *& value);
+    CHIP_ERROR DecodeBinaryBlob(const std::string & encodedData, std::vector<uint8_t> & decodedData);
+
     inipp::Ini<char> mConfigStore;
+
+    // Binary blobs that were read since they were last written, decoded, by key.
+    std::unordered_map<std::string, std::vector<uint8_t>> mDecodedBlobs;
 };
 
 } // namespace Internal
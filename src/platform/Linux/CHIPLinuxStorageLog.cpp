@@ -0,0 +1,435 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file implements a key-value store kept in an append-only log
+ *         file on Linux platform.
+ *
+ *         The log starts with an 8-byte header (magic and version), followed
+ *         by records, all integers little-endian:
+ *
+ *           crc32 (4) | type (1) | reserved (1) | key length (2) | value length (4) | key | value
+ *
+ *         The CRC-32 covers the record from its type to the end of its value.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kLogHeader[]     = { 'C', 'H', 'K', 'V', 'L', 'O', 'G', 1 };
+constexpr size_t kRecordHeaderSize = 12;
+
+constexpr uint8_t kRecordTypePut    = 1;
+constexpr uint8_t kRecordTypeDelete = 2;
+
+struct Crc32Table
+{
+    constexpr Crc32Table()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : (crc >> 1);
+            }
+            entries[i] = crc;
+        }
+    }
+
+    uint32_t entries[256] = {};
+};
+
+constexpr Crc32Table kCrc32Table;
+
+uint32_t Crc32(const uint8_t * data, size_t length)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc = kCrc32Table.entries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+size_t RecordSize(size_t keyLen, size_t valueLen)
+{
+    return kRecordHeaderSize + keyLen + valueLen;
+}
+
+// Appends a record to buffer.
+void EncodeRecord(std::vector<uint8_t> & buffer, uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen)
+{
+    const size_t start = buffer.size();
+    buffer.resize(start + RecordSize(key.size(), dataLen));
+
+    uint8_t * record = buffer.data() + start;
+    record[4]        = type;
+    record[5]        = 0;
+    Encoding::LittleEndian::Put16(&record[6], static_cast<uint16_t>(key.size()));
+    Encoding::LittleEndian::Put32(&record[8], static_cast<uint32_t>(dataLen));
+    memcpy(&record[kRecordHeaderSize], key.data(), key.size());
+    if (dataLen > 0)
+    {
+        memcpy(&record[kRecordHeaderSize + key.size()], data, dataLen);
+    }
+    Encoding::LittleEndian::Put32(&record[0], Crc32(&record[4], RecordSize(key.size(), dataLen) - 4));
+}
+
+bool WriteAll(int fd, const uint8_t * data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t rv = write(fd, data, length);
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (rv <= 0)
+        {
+            return false;
+        }
+        data += rv;
+        length -= static_cast<size_t>(rv);
+    }
+    return true;
+}
+
+bool SyncParentDirectory(const std::string & path)
+{
+    const size_t separator = path.rfind('/');
+    const std::string dir  = (separator == std::string::npos) ? "." : (separator == 0 ? "/" : path.substr(0, separator));
+
+    FileDescriptor fd(open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    return fd.Get() != -1 && fsync(fd.Get()) == 0;
+}
+
+} // namespace
+
+CHIP_ERROR ChipLinuxStorageLog::Init(const char * logFile)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mInitialized)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageLog::Init: Attempt to re-initialize with KVS log file: %s, IGNORING.",
+                     StringOrNullMarker(logFile));
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(logFile != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageLog::Init: Using KVS log file: %s", logFile);
+
+    mLogPath.assign(logFile);
+    mFd = FileDescriptor(open(logFile, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open %s: %s", logFile, strerror(errno)));
+
+    ReturnErrorOnFailure(Load());
+
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Load()
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(mFd.Get(), &st) == 0, CHIP_ERROR_READ_FAILED);
+
+    std::vector<uint8_t> log(static_cast<size_t>(st.st_size));
+    size_t readSize = 0;
+    while (readSize < log.size())
+    {
+        ssize_t rv = pread(mFd.Get(), log.data() + readSize, log.size() - readSize, static_cast<off_t>(readSize));
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv > 0, CHIP_ERROR_READ_FAILED,
+                            ChipLogError(DeviceLayer, "Failed to read %s: %s", mLogPath.c_str(), strerror(errno)));
+        readSize += static_cast<size_t>(rv);
+    }
+
+    mEntries.clear();
+    mLogSize  = sizeof(kLogHeader);
+    mLiveSize = sizeof(kLogHeader);
+
+    if (log.empty())
+    {
+        // New store.
+        VerifyOrReturnError(WriteAll(mFd.Get(), kLogHeader, sizeof(kLogHeader)) && fdatasync(mFd.Get()) == 0,
+                            CHIP_ERROR_WRITE_FAILED);
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(log.size() >= sizeof(kLogHeader) && memcmp(log.data(), kLogHeader, sizeof(kLogHeader)) == 0,
+                        CHIP_ERROR_INCORRECT_STATE,
+                        ChipLogError(DeviceLayer, "%s is not a KVS log file", mLogPath.c_str()));
+
+    size_t offset = sizeof(kLogHeader);
+    while (log.size() - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * record = log.data() + offset;
+        const uint8_t type     = record[4];
+        const size_t keyLen    = Encoding::LittleEndian::Get16(&record[6]);
+        const size_t valueLen  = Encoding::LittleEndian::Get32(&record[8]);
+        if (valueLen > kMaxValueSize || log.size() - offset < RecordSize(keyLen, valueLen) ||
+            Encoding::LittleEndian::Get32(record) != Crc32(&record[4], RecordSize(keyLen, valueLen) - 4))
+        {
+            break;
+        }
+        if (type != kRecordTypePut && type != kRecordTypeDelete)
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(&record[kRecordHeaderSize]), keyLen);
+        auto it = mEntries.find(key);
+        if (it != mEntries.end())
+        {
+            mLiveSize -= RecordSize(it->first.size(), it->second.size());
+        }
+
+        if (type == kRecordTypePut)
+        {
+            const uint8_t * value = &record[kRecordHeaderSize + keyLen];
+            mEntries[key].assign(value, value + valueLen);
+            mLiveSize += RecordSize(keyLen, valueLen);
+        }
+        else
+        {
+            mEntries.erase(key);
+        }
+
+        offset += RecordSize(keyLen, valueLen);
+    }
+    mLogSize = offset;
+
+    if (offset != log.size())
+    {
+        // Whatever follows the last valid record is an append that did not complete.
+        ChipLogError(DeviceLayer, "Discarding %u bytes at the end of %s", static_cast<unsigned>(log.size() - offset),
+                     mLogPath.c_str());
+        VerifyOrReturnError(ftruncate(mFd.Get(), static_cast<off_t>(offset)) == 0 && fdatasync(mFd.Get()) == 0,
+                            CHIP_ERROR_WRITE_FAILED);
+    }
+
+    ChipLogDetail(DeviceLayer, "Loaded %u entries from %s", static_cast<unsigned>(mEntries.size()), mLogPath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mEntries.find(key);
+    VerifyOrReturnError(it != mEntries.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    outLen = it->second.size();
+    VerifyOrReturnError(outLen <= bufSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    if (outLen > 0)
+    {
+        memcpy(buf, it->second.data(), outLen);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::WriteValueBin(const char * key, const uint8_t * data, size_t dataLen)
+{
+    VerifyOrReturnError(key != nullptr && strlen(key) <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(dataLen <= kMaxValueSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(data != nullptr || dataLen == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    std::string keyString(key);
+    ReturnErrorOnFailure(AppendRecord(kRecordTypePut, keyString, data, dataLen));
+
+    auto it = mEntries.find(keyString);
+    if (it != mEntries.end())
+    {
+        mLiveSize -= RecordSize(it->first.size(), it->second.size());
+        it->second.assign(data, data + dataLen);
+    }
+    else
+    {
+        mEntries.emplace(keyString, std::vector<uint8_t>(data, data + dataLen));
+    }
+    mLiveSize += RecordSize(keyString.size(), dataLen);
+
+    CompactIfNeededLocked();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ClearValue(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mEntries.find(key);
+    VerifyOrReturnError(it != mEntries.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    ReturnErrorOnFailure(AppendRecord(kRecordTypeDelete, it->first, nullptr, 0));
+    mLiveSize -= RecordSize(it->first.size(), it->second.size());
+    mEntries.erase(it);
+
+    CompactIfNeededLocked();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ClearAll()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    VerifyOrReturnError(ftruncate(mFd.Get(), sizeof(kLogHeader)) == 0 && fdatasync(mFd.Get()) == 0, CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to clear %s: %s", mLogPath.c_str(), strerror(errno)));
+
+    mEntries.clear();
+    mLogSize     = sizeof(kLogHeader);
+    mLiveSize    = sizeof(kLogHeader);
+    mWriteFailed = false;
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxStorageLog::HasValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mEntries.find(key) != mEntries.end();
+}
+
+size_t ChipLinuxStorageLog::GetLogSize()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mLogSize;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::AppendRecord(uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen)
+{
+    VerifyOrReturnError(!mWriteFailed, CHIP_ERROR_WRITE_FAILED);
+
+    mRecordBuffer.clear();
+    EncodeRecord(mRecordBuffer, type, key, data, dataLen);
+
+    if (!WriteAll(mFd.Get(), mRecordBuffer.data(), mRecordBuffer.size()) || fdatasync(mFd.Get()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to append to %s: %s", mLogPath.c_str(), strerror(errno));
+        // Drop any part of the record that made it to the file, so that later records are not lost behind it on load.
+        if (ftruncate(mFd.Get(), static_cast<off_t>(mLogSize)) != 0)
+        {
+            // Anything appended now would follow the partial record and be discarded on load.
+            ChipLogError(DeviceLayer, "Failed to truncate %s, refusing further writes: %s", mLogPath.c_str(), strerror(errno));
+            mWriteFailed = true;
+        }
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    mLogSize += mRecordBuffer.size();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    return CompactLocked();
+}
+
+void ChipLinuxStorageLog::CompactIfNeededLocked()
+{
+    if (mLogSize < kMinCompactionSize || mLogSize < 2 * mLiveSize)
+    {
+        return;
+    }
+
+    // The change is already durable in the log, so a failed compaction only delays the next one.
+    CHIP_ERROR err = CompactLocked();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to compact %s: %" CHIP_ERROR_FORMAT, mLogPath.c_str(), err.Format());
+    }
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CompactLocked()
+{
+    std::string tmpPath = mLogPath + "-XXXXXX";
+    FileDescriptor fd(mkostemp(tmpPath.data(), O_APPEND | O_CLOEXEC));
+    VerifyOrReturnError(fd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpPath.c_str(), strerror(errno)));
+
+    std::vector<uint8_t> log;
+    log.reserve(mLiveSize);
+    log.insert(log.end(), kLogHeader, kLogHeader + sizeof(kLogHeader));
+    for (const auto & entry : mEntries)
+    {
+        EncodeRecord(log, kRecordTypePut, entry.first, entry.second.data(), entry.second.size());
+    }
+
+    if (!WriteAll(fd.Get(), log.data(), log.size()) || fdatasync(fd.Get()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to write temp file %s: %s", tmpPath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    // The rename is atomic: a crash leaves either the old log or the compacted one.
+    if (rename(tmpPath.c_str(), mLogPath.c_str()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to rename %s to %s: %s", tmpPath.c_str(), mLogPath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    // The compacted file is now the log, so switch to it even if the directory sync below fails: keeping the
+    // descriptor of the old, unlinked file would silently lose every later append.
+    mFd = std::move(fd);
+    ChipLogDetail(DeviceLayer, "Compacted %s from %u to %u bytes", mLogPath.c_str(), static_cast<unsigned>(mLogSize),
+                  static_cast<unsigned>(log.size()));
+    mLogSize     = log.size();
+    mLiveSize    = log.size();
+    mWriteFailed = false;
+
+    // Make the rename itself durable.
+    VerifyOrReturnError(SyncParentDirectory(mLogPath), CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to sync directory of %s: %s", mLogPath.c_str(), strerror(errno)));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,100 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines a key-value store kept in an append-only log file.
+ *
+ *         Every change appends one record to the log and syncs it, so a write
+ *         costs the size of the record rather than the size of the whole
+ *         store. All the values are also kept in memory, which serves reads.
+ *
+ *         When the records that later changes superseded take most of the log,
+ *         the log is compacted: the live entries are written to a temporary
+ *         file, which then replaces the log.
+ *
+ *         Records carry a CRC-32. When the log is loaded, a truncated or
+ *         corrupted record (e.g. an append that a crash interrupted) ends the
+ *         log, and is cut from the file.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/FileDescriptor.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageLog
+{
+public:
+    /// Values larger than this are rejected.
+    static constexpr size_t kMaxValueSize = UINT16_MAX;
+
+    /// The log is not compacted below this size.
+    static constexpr size_t kMinCompactionSize = 64 * 1024;
+
+    CHIP_ERROR Init(const char * logFile);
+    CHIP_ERROR ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen);
+    CHIP_ERROR WriteValueBin(const char * key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR ClearValue(const char * key);
+    CHIP_ERROR ClearAll();
+    bool HasValue(const char * key);
+
+    /// Changes are durable as soon as they are written; kept for parity with ChipLinuxStorage.
+    CHIP_ERROR Commit() { return CHIP_NO_ERROR; }
+
+    /// Rewrites the log with only the live entries. This also allows writes again after a failed append.
+    CHIP_ERROR Compact();
+
+    /// Size of the log file, in bytes.
+    size_t GetLogSize();
+
+private:
+    CHIP_ERROR Load();
+    CHIP_ERROR AppendRecord(uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR CompactLocked();
+    void CompactIfNeededLocked();
+
+    std::mutex mLock;
+    std::string mLogPath;
+    FileDescriptor mFd;
+    std::unordered_map<std::string, std::vector<uint8_t>> mEntries;
+    std::vector<uint8_t> mRecordBuffer;
+    // Size of the log file, and the size that it would have once compacted.
+    size_t mLogSize   = 0;
+    size_t mLiveSize  = 0;
+    bool mInitialized = false;
+    // Set when a partial record could not be dropped from the end of the log. Writes fail until the log is
+    // rewritten by Compact() or ClearAll().
+    bool mWriteFailed = false;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
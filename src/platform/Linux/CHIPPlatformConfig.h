@@ -72,6 +72,43 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+// Index the clusters and attributes of ember endpoint types: bridges with many dynamic endpoints look them up on
+// every read and write.
+#ifndef CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE
+#define CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE 1024
+#endif // CHIP_CONFIG_EMBER_METADATA_LOOKUP_INDEX_SIZE
+
+// Serve group lookups and group message decryption from RAM instead of reading the KVS file each time.
+#ifndef CHIP_CONFIG_GROUP_DATA_STORAGE_CACHE
+#define CHIP_CONFIG_GROUP_DATA_STORAGE_CACHE 1
+#endif // CHIP_CONFIG_GROUP_DATA_STORAGE_CACHE
+
+// Answer access checks from an index of the access control list: Linux servers can hold many more entries.
+#ifndef CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+#define CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX 1
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_COMPILED_INDEX
+
+// Let TLV readers skip containers through a skip index: Linux controllers and servers parse large reports.
+#ifndef CHIP_CONFIG_TLV_SKIP_INDEX
+#define CHIP_CONFIG_TLV_SKIP_INDEX 1
+#endif // CHIP_CONFIG_TLV_SKIP_INDEX
+
+// Match Sigma1 destination identifiers against cached per-fabric keys: Linux servers may host many fabrics.
+#ifndef CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+#define CHIP_CONFIG_CASE_DESTINATION_ID_CACHE 1
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+
+// Keep CASE ephemeral keypairs generated in advance by the background event loop: Linux servers and controllers
+// set up many sessions.
+#ifndef CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE
+#define CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE 8
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE
+
+// Skip verifying the same certificate signatures again on every CASE handshake.
+#ifndef CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE 32
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+
 // Increase C++ lambda event size to accommodate larger local captures
 // for connman-based Connectivity Manager network management
 // implementation, particularly on [I]LP64 architectures in which
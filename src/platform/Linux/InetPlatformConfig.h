@@ -44,5 +44,17 @@
 #define INET_CONFIG_NUM_UDP_ENDPOINTS 32
 #endif // INET_CONFIG_NUM_UDP_ENDPOINTS
 
+// Receive datagrams with recvmmsg(), unless each endpoint's receive buffers would come out of a fixed packet buffer pool.
+#ifndef INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE == 0
+#define INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE 8
+#endif
+#endif // INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE
+
+// Send the datagrams queued during an event loop turn with sendmmsg().
+#ifndef INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE 8
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE
+
 // On linux platform, we have sys/socket.h, so HAVE_SO_BINDTODEVICE should be set to 1
 #define HAVE_SO_BINDTODEVICE 1
@@ -23,7 +23,13 @@
 
 #pragma once
 
+#include <platform/CHIPDeviceConfig.h>
+
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+#else
 #include <platform/Linux/CHIPLinuxStorage.h>
+#endif
 
 namespace chip {
 namespace DeviceLayer {
@@ -43,7 +49,11 @@ public:
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
 private:
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG
+    DeviceLayer::Internal::ChipLinuxStorageLog mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
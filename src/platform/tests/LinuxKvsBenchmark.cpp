@@ -0,0 +1,196 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the cost of a durable put in the Linux key-value store
+ *      backends, for stores already holding a number of entries:
+ *
+ *        - ini_puts_per_s, ini_p99_put_us: ChipLinuxStorage, which rewrites
+ *          the whole INI file on each commit.
+ *        - log_puts_per_s, log_p99_put_us: ChipLinuxStorageLog, which appends
+ *          a record to its log (compactions included).
+ *
+ *      and the time to start from a store holding thousands of entries for 5
+ *      fabrics, as loading the store and reading every entry once:
+ *
+ *        - ini_startup_ms, log_startup_ms.
+ */
+
+#include <benchmarks/BenchmarkHelpers.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+constexpr size_t kEntryCounts[] = { 16, 128, 512 };
+constexpr size_t kValueSize     = 128;
+constexpr size_t kPuts          = 500;
+
+constexpr size_t kStartupEntryCounts[] = { 1000, 4000 };
+
+const ResultWriter gResults("linux-kvs", "entries");
+
+struct Result
+{
+    double putsPerSecond;
+    double p99Microseconds;
+};
+
+std::string Key(size_t index)
+{
+    char key[32];
+    snprintf(key, sizeof(key), "f/%x/k/%u", static_cast<unsigned>(index % 5), static_cast<unsigned>(index));
+    return key;
+}
+
+std::string TemporaryPath()
+{
+    char path[] = "/tmp/chip-kvs-benchmark-XXXXXX";
+    int fd      = mkstemp(path);
+    VerifyOrDie(fd != -1);
+    close(fd);
+    unlink(path);
+    return path;
+}
+
+template <typename Put>
+Result MeasurePuts(size_t entryCount, Put && put)
+{
+    std::vector<uint8_t> value(kValueSize, 0x5A);
+    for (size_t i = 0; i < entryCount; i++)
+    {
+        VerifyOrDie(put(Key(i).c_str(), value) == CHIP_NO_ERROR);
+    }
+
+    std::vector<double> latencies;
+    latencies.reserve(kPuts);
+
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kPuts; i++)
+    {
+        value[0]              = static_cast<uint8_t>(i);
+        const std::string key = Key(ScrambledIndex(i, entryCount));
+
+        SteadyClock::time_point putStart = SteadyClock::now();
+        VerifyOrDie(put(key.c_str(), value) == CHIP_NO_ERROR);
+        latencies.push_back(std::chrono::duration<double, std::micro>(SteadyClock::now() - putStart).count());
+    }
+    const double seconds = SecondsSince(start);
+
+    std::sort(latencies.begin(), latencies.end());
+    return Result{ static_cast<double>(kPuts) / seconds, latencies[latencies.size() * 99 / 100] };
+}
+
+// Both backends commit each put, as KeyValueStoreManagerImpl does.
+template <typename Storage>
+Result MeasureBackend(size_t entryCount)
+{
+    const std::string path = TemporaryPath();
+    Result result;
+    {
+        Storage storage;
+        VerifyOrDie(storage.Init(path.c_str()) == CHIP_NO_ERROR);
+        result = MeasurePuts(entryCount, [&](const char * key, const std::vector<uint8_t> & value) {
+            ReturnErrorOnFailure(storage.WriteValueBin(key, value.data(), value.size()));
+            return storage.Commit();
+        });
+    }
+    unlink(path.c_str());
+    return result;
+}
+
+template <typename Storage>
+double MeasureStartup(size_t entryCount)
+{
+    const std::string path = TemporaryPath();
+    {
+        Storage storage;
+        VerifyOrDie(storage.Init(path.c_str()) == CHIP_NO_ERROR);
+        std::vector<uint8_t> value(kValueSize, 0x5A);
+        for (size_t i = 0; i < entryCount; i++)
+        {
+            VerifyOrDie(storage.WriteValueBin(Key(i).c_str(), value.data(), value.size()) == CHIP_NO_ERROR);
+        }
+        VerifyOrDie(storage.Commit() == CHIP_NO_ERROR);
+    }
+
+    SteadyClock::time_point start = SteadyClock::now();
+    {
+        Storage storage;
+        VerifyOrDie(storage.Init(path.c_str()) == CHIP_NO_ERROR);
+
+        // Each read asks for the size first, as KeyValueStoreManagerImpl does.
+        std::vector<uint8_t> value;
+        for (size_t i = 0; i < entryCount; i++)
+        {
+            const std::string key = Key(ScrambledIndex(i, entryCount));
+            size_t size           = 0;
+            CHIP_ERROR err        = storage.ReadValueBin(key.c_str(), nullptr, 0, size);
+            VerifyOrDie(err == CHIP_ERROR_BUFFER_TOO_SMALL && size == kValueSize);
+            value.resize(size);
+            VerifyOrDie(storage.ReadValueBin(key.c_str(), value.data(), value.size(), size) == CHIP_NO_ERROR);
+        }
+    }
+    const double milliseconds = std::chrono::duration<double, std::milli>(SteadyClock::now() - start).count();
+
+    unlink(path.c_str());
+    return milliseconds;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+    // Both backends log every commit or compaction.
+    Logging::SetLogFilter(Logging::kLogCategory_Error);
+
+    gResults.PrintHeader();
+    for (size_t entryCount : kEntryCounts)
+    {
+        const Result ini = MeasureBackend<ChipLinuxStorage>(entryCount);
+        const Result log = MeasureBackend<ChipLinuxStorageLog>(entryCount);
+        gResults.Print(entryCount, "ini_puts_per_s", Better::kHigher, ini.putsPerSecond);
+        gResults.Print(entryCount, "ini_p99_put_us", Better::kLower, ini.p99Microseconds);
+        gResults.Print(entryCount, "log_puts_per_s", Better::kHigher, log.putsPerSecond);
+        gResults.Print(entryCount, "log_p99_put_us", Better::kLower, log.p99Microseconds);
+    }
+    for (size_t entryCount : kStartupEntryCounts)
+    {
+        gResults.Print(entryCount, "ini_startup_ms", Better::kLower, MeasureStartup<ChipLinuxStorage>(entryCount), 1);
+        gResults.Print(entryCount, "log_startup_ms", Better::kLower, MeasureStartup<ChipLinuxStorageLog>(entryCount), 1);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
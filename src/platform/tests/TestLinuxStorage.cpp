@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the INI key-value store
+ *      of the Linux platform.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+
+#include <string>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+class TestLinuxStorage : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        char path[] = "/tmp/chip-kvs-ini-test-XXXXXX";
+        int fd      = mkstemp(path);
+        ASSERT_NE(fd, -1);
+        close(fd);
+        unlink(path);
+        mPath = path;
+    }
+
+    void TearDown() override { unlink(mPath.c_str()); }
+
+    static std::string ReadString(ChipLinuxStorage & storage, const char * key)
+    {
+        uint8_t buf[64];
+        size_t len = 0;
+        if (storage.ReadValueBin(key, buf, sizeof(buf), len) != CHIP_NO_ERROR)
+        {
+            return "<missing>";
+        }
+        return std::string(reinterpret_cast<const char *>(buf), len);
+    }
+
+    static CHIP_ERROR WriteString(ChipLinuxStorage & storage, const char * key, const char * value)
+    {
+        return storage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), strlen(value));
+    }
+
+    std::string mPath;
+};
+
+TEST_F(TestLinuxStorage, TestBinaryBlobs)
+{
+    ChipLinuxStorage storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    EXPECT_EQ(ReadString(storage, "a"), "<missing>");
+    EXPECT_EQ(WriteString(storage, "a", "one"), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteString(storage, "b", "a longer value"), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "a"), "one");
+
+    // Too small a buffer reports the size of the value.
+    size_t len = 0;
+    EXPECT_EQ(storage.ReadValueBin("b", nullptr, 0, len), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(len, strlen("a longer value"));
+    EXPECT_EQ(ReadString(storage, "b"), "a longer value");
+
+    // Values read before are not returned once overwritten or removed.
+    EXPECT_EQ(WriteString(storage, "a", "two"), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "a"), "two");
+    EXPECT_EQ(storage.ClearValue("b"), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasValue("b"));
+    EXPECT_EQ(ReadString(storage, "b"), "<missing>");
+
+    // String values of other types are not valid blobs.
+    EXPECT_EQ(storage.WriteValueStr("c", "not*base64"), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "c"), "<missing>");
+
+    EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.ClearAll(), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "a"), "<missing>");
+}
+
+TEST_F(TestLinuxStorage, TestReload)
+{
+    {
+        ChipLinuxStorage storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "a", "one"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValue("n", static_cast<uint32_t>(42)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueStr("s", "text"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorage storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "a"), "one");
+
+    uint32_t number = 0;
+    EXPECT_EQ(storage.ReadValue("n", number), CHIP_NO_ERROR);
+    EXPECT_EQ(number, 42u);
+    EXPECT_EQ(storage.ReadValue("s", number), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(storage.ReadValue("missing", number), CHIP_ERROR_KEY_NOT_FOUND);
+
+    char buf[8];
+    size_t len = 0;
+    EXPECT_EQ(storage.ReadValueStr("s", buf, sizeof(buf), len), CHIP_NO_ERROR);
+    EXPECT_STREQ(buf, "text");
+    EXPECT_EQ(storage.ReadValueStr("s", buf, 4, len), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(len, 4u);
+}
+
+} // namespace
@@ -0,0 +1,255 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the log-structured
+ *      key-value store of the Linux platform.
+ *
+ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <algorithm>
+#include <string>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+class TestLinuxStorageLog : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        char path[] = "/tmp/chip-kvs-log-test-XXXXXX";
+        int fd      = mkstemp(path);
+        ASSERT_NE(fd, -1);
+        close(fd);
+        // Start from a missing file, as on first boot.
+        unlink(path);
+        mPath = path;
+    }
+
+    void TearDown() override { unlink(mPath.c_str()); }
+
+    size_t FileSize()
+    {
+        struct stat st;
+        VerifyOrDie(stat(mPath.c_str(), &st) == 0);
+        return static_cast<size_t>(st.st_size);
+    }
+
+    std::string ReadString(ChipLinuxStorageLog & storage, const char * key)
+    {
+        uint8_t buf[64];
+        size_t len = 0;
+        if (storage.ReadValueBin(key, buf, sizeof(buf), len) != CHIP_NO_ERROR)
+        {
+            return "<missing>";
+        }
+        return std::string(reinterpret_cast<const char *>(buf), len);
+    }
+
+    static CHIP_ERROR WriteString(ChipLinuxStorageLog & storage, const char * key, const char * value)
+    {
+        return storage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), strlen(value));
+    }
+
+    std::string mPath;
+};
+
+TEST_F(TestLinuxStorageLog, TestReadWrite)
+{
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    EXPECT_FALSE(storage.HasValue("a"));
+    EXPECT_EQ(ReadString(storage, "a"), "<missing>");
+
+    EXPECT_EQ(WriteString(storage, "a", "one"), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteString(storage, "b", "two"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValueBin("empty", nullptr, 0), CHIP_NO_ERROR);
+    EXPECT_TRUE(storage.HasValue("a"));
+    EXPECT_TRUE(storage.HasValue("empty"));
+    EXPECT_EQ(ReadString(storage, "a"), "one");
+    EXPECT_EQ(ReadString(storage, "b"), "two");
+    EXPECT_EQ(ReadString(storage, "empty"), "");
+
+    // Too small a buffer reports the size of the value.
+    uint8_t buf[2];
+    size_t len = 0;
+    EXPECT_EQ(storage.ReadValueBin("a", buf, sizeof(buf), len), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(len, 3u);
+    EXPECT_EQ(storage.ReadValueBin("a", nullptr, 0, len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    EXPECT_EQ(WriteString(storage, "a", "three"), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "a"), "three");
+
+    EXPECT_EQ(storage.ClearValue("b"), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasValue("b"));
+    EXPECT_EQ(storage.ClearValue("b"), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(storage.ReadValueBin("b", buf, sizeof(buf), len), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+TEST_F(TestLinuxStorageLog, TestReload)
+{
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "a", "one"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "b", "two"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "a", "three"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("b"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "c", "four"), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "a"), "three");
+    EXPECT_FALSE(storage.HasValue("b"));
+    EXPECT_EQ(ReadString(storage, "c"), "four");
+    EXPECT_EQ(storage.GetLogSize(), FileSize());
+}
+
+TEST_F(TestLinuxStorageLog, TestTornWriteRecovery)
+{
+    size_t goodSize = 0;
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "a", "one"), CHIP_NO_ERROR);
+        goodSize = storage.GetLogSize();
+        EXPECT_EQ(WriteString(storage, "b", "two"), CHIP_NO_ERROR);
+    }
+
+    // Cut the last record short, as a crash in the middle of its append would.
+    ASSERT_EQ(truncate(mPath.c_str(), static_cast<off_t>(FileSize() - 2)), 0);
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ReadString(storage, "a"), "one");
+        EXPECT_FALSE(storage.HasValue("b"));
+        EXPECT_EQ(FileSize(), goodSize);
+
+        // New records follow the last valid one.
+        EXPECT_EQ(WriteString(storage, "c", "three"), CHIP_NO_ERROR);
+    }
+
+    // Corrupt the value of the last record.
+    const size_t size = FileSize();
+    int fd            = open(mPath.c_str(), O_WRONLY);
+    ASSERT_NE(fd, -1);
+    EXPECT_EQ(pwrite(fd, "x", 1, static_cast<off_t>(size - 1)), 1);
+    close(fd);
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ReadString(storage, "a"), "one");
+        EXPECT_FALSE(storage.HasValue("c"));
+        EXPECT_EQ(FileSize(), goodSize);
+    }
+}
+
+TEST_F(TestLinuxStorageLog, TestNotALog)
+{
+    int fd = open(mPath.c_str(), O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR);
+    ASSERT_NE(fd, -1);
+    const char kIniFile[] = "[DEFAULT]\nkey=dmFsdWU=\n";
+    EXPECT_EQ(write(fd, kIniFile, sizeof(kIniFile) - 1), static_cast<ssize_t>(sizeof(kIniFile) - 1));
+    close(fd);
+
+    ChipLinuxStorageLog storage;
+    EXPECT_NE(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(FileSize(), sizeof(kIniFile) - 1);
+}
+
+TEST_F(TestLinuxStorageLog, TestCompaction)
+{
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    uint8_t value[256];
+    memset(value, 0xA5, sizeof(value));
+    EXPECT_EQ(WriteString(storage, "kept", "value"), CHIP_NO_ERROR);
+
+    // Overwriting the same keys makes the log grow well past the live entries, which compacts it.
+    size_t maxLogSize = 0;
+    for (int i = 0; i < 1000; i++)
+    {
+        value[0] = static_cast<uint8_t>(i);
+        EXPECT_EQ(storage.WriteValueBin((i % 2) ? "odd" : "even", value, sizeof(value)), CHIP_NO_ERROR);
+        maxLogSize = std::max(maxLogSize, storage.GetLogSize());
+    }
+    EXPECT_LT(maxLogSize, 1000 * sizeof(value));
+    EXPECT_LE(maxLogSize, ChipLinuxStorageLog::kMinCompactionSize + 512);
+    EXPECT_EQ(storage.GetLogSize(), FileSize());
+
+    const size_t sizeBefore = storage.GetLogSize();
+    EXPECT_EQ(storage.Compact(), CHIP_NO_ERROR);
+    EXPECT_LE(storage.GetLogSize(), sizeBefore);
+    EXPECT_LT(storage.GetLogSize(), 4 * sizeof(value));
+    EXPECT_EQ(storage.GetLogSize(), FileSize());
+
+    // Writes after a compaction go to the new log.
+    EXPECT_EQ(WriteString(storage, "after", "compaction"), CHIP_NO_ERROR);
+
+    ChipLinuxStorageLog reloaded;
+    ASSERT_EQ(reloaded.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(reloaded, "kept"), "value");
+    EXPECT_EQ(ReadString(reloaded, "after"), "compaction");
+
+    uint8_t buf[sizeof(value)];
+    size_t len = 0;
+    ASSERT_EQ(reloaded.ReadValueBin("odd", buf, sizeof(buf), len), CHIP_NO_ERROR);
+    EXPECT_EQ(len, sizeof(value));
+    EXPECT_EQ(buf[0], static_cast<uint8_t>(999));
+    ASSERT_EQ(reloaded.ReadValueBin("even", buf, sizeof(buf), len), CHIP_NO_ERROR);
+    EXPECT_EQ(buf[0], static_cast<uint8_t>(998));
+}
+
+TEST_F(TestLinuxStorageLog, TestClearAll)
+{
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "a", "one"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "b", "two"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearAll(), CHIP_NO_ERROR);
+        EXPECT_FALSE(storage.HasValue("a"));
+        EXPECT_EQ(WriteString(storage, "c", "three"), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasValue("a"));
+    EXPECT_FALSE(storage.HasValue("b"));
+    EXPECT_EQ(ReadString(storage, "c"), "three");
+}
+
+} // namespace
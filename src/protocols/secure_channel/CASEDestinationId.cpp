@@ -21,8 +21,11 @@
 #include <credentials/GroupDataProvider.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/Span.h>
 
+#include <string.h>
+
 #include "CASEDestinationId.h"
 
 namespace chip {
@@ -62,4 +65,189 @@ CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & init
     return err;
 }
 
+#if CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+
+void CASEDestinationIdCache::Entry::Clear()
+{
+    for (auto & hmac : hmacs)
+    {
+        hmac.Release();
+    }
+    ClearSecretData(&ipks[0][0], sizeof(ipks));
+    fabricIndex = kUndefinedFabricIndex;
+    keyCount    = 0;
+    nodeId      = kUndefinedNodeId;
+}
+
+CHIP_ERROR CASEDestinationIdCache::Init(FabricTable * fabricTable, Credentials::GroupDataProvider * groupDataProvider)
+{
+    VerifyOrReturnError(fabricTable != nullptr && groupDataProvider != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Shutdown();
+    ReturnErrorOnFailure(fabricTable->AddFabricDelegate(this));
+    mFabricTable       = fabricTable;
+    mGroupDataProvider = groupDataProvider;
+    return CHIP_NO_ERROR;
+}
+
+void CASEDestinationIdCache::Shutdown()
+{
+    if (mFabricTable != nullptr)
+    {
+        mFabricTable->RemoveFabricDelegate(this);
+    }
+    mFabricTable       = nullptr;
+    mGroupDataProvider = nullptr;
+    Invalidate();
+}
+
+void CASEDestinationIdCache::Invalidate()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.Clear();
+    }
+}
+
+void CASEDestinationIdCache::Invalidate(FabricIndex fabricIndex)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.fabricIndex == fabricIndex)
+        {
+            entry.Clear();
+        }
+    }
+}
+
+CHIP_ERROR CASEDestinationIdCache::Load(const FabricInfo & fabricInfo, Entry & entry)
+{
+    entry.Clear();
+
+    Crypto::P256PublicKey rootPubKey;
+    ReturnErrorOnFailure(mFabricTable->FetchRootPubkey(fabricInfo.GetFabricIndex(), rootPubKey));
+
+    Encoding::LittleEndian::BufferWriter bbuf(&entry.message[kSigmaParamRandomNumberSize],
+                                              sizeof(entry.message) - kSigmaParamRandomNumberSize);
+    bbuf.Put(rootPubKey.ConstBytes(), rootPubKey.Length());
+    bbuf.Put64(fabricInfo.GetFabricId());
+    bbuf.Put64(fabricInfo.GetNodeId());
+    VerifyOrReturnError(bbuf.Fit(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    Credentials::GroupDataProvider::KeySet ipkKeySet;
+    auto ipkKeySetWiperOnScopeExit = ScopeExit([&] { ipkKeySet.ClearKeys(); });
+    ReturnErrorOnFailure(mGroupDataProvider->GetIpkKeySet(fabricInfo.GetFabricIndex(), ipkKeySet));
+    VerifyOrReturnError(ipkKeySet.num_keys_used > 0 && ipkKeySet.num_keys_used <= kEpochKeysMax, CHIP_ERROR_KEY_NOT_FOUND);
+
+    for (uint8_t keyIdx = 0; keyIdx < ipkKeySet.num_keys_used; ++keyIdx)
+    {
+        memcpy(entry.ipks[keyIdx], ipkKeySet.epoch_keys[keyIdx].key, kIPKSize);
+        entry.hmacs[keyIdx].Init(ByteSpan(entry.ipks[keyIdx]));
+    }
+
+    entry.fabricIndex = fabricInfo.GetFabricIndex();
+    entry.keyCount    = ipkKeySet.num_keys_used;
+    entry.nodeId      = fabricInfo.GetNodeId();
+    return CHIP_NO_ERROR;
+}
+
+CASEDestinationIdCache::Entry * CASEDestinationIdCache::GetEntry(const FabricInfo & fabricInfo, Entry & scratch)
+{
+    Entry * entry = nullptr;
+    Entry * empty = nullptr;
+    for (auto & candidate : mEntries)
+    {
+        if (candidate.fabricIndex == fabricInfo.GetFabricIndex())
+        {
+            entry = &candidate;
+            break;
+        }
+        if (empty == nullptr && candidate.fabricIndex == kUndefinedFabricIndex)
+        {
+            empty = &candidate;
+        }
+    }
+
+    if (entry != nullptr)
+    {
+        // The fabric table does not report every change to a fabric (e.g. reverting a pending update), so check the
+        // cached fabric data before using it.
+        Crypto::P256PublicKey rootPubKey;
+        VerifyOrReturnValue(mFabricTable->FetchRootPubkey(fabricInfo.GetFabricIndex(), rootPubKey) == CHIP_NO_ERROR, nullptr);
+
+        uint8_t tail[kMessageLength - kSigmaParamRandomNumberSize];
+        Encoding::LittleEndian::BufferWriter bbuf(tail, sizeof(tail));
+        bbuf.Put(rootPubKey.ConstBytes(), rootPubKey.Length());
+        bbuf.Put64(fabricInfo.GetFabricId());
+        bbuf.Put64(fabricInfo.GetNodeId());
+        if (bbuf.Fit() && memcmp(tail, &entry->message[kSigmaParamRandomNumberSize], sizeof(tail)) == 0)
+        {
+            return entry;
+        }
+    }
+    else if (empty != nullptr)
+    {
+        entry = empty;
+    }
+    else
+    {
+        // Drop fabrics that are not in the table anymore; if none, use the scratch entry for this lookup only.
+        for (auto & candidate : mEntries)
+        {
+            if (mFabricTable->FindFabricWithIndex(candidate.fabricIndex) == nullptr)
+            {
+                candidate.Clear();
+                entry = (entry == nullptr) ? &candidate : entry;
+            }
+        }
+        entry = (entry == nullptr) ? &scratch : entry;
+    }
+
+    // Fabrics without an IPK are not kept, as the IPK may be set after the fabric is committed.
+    if (Load(fabricInfo, *entry) != CHIP_NO_ERROR)
+    {
+        entry->Clear();
+        return nullptr;
+    }
+    return entry;
+}
+
+CHIP_ERROR CASEDestinationIdCache::FindLocalNode(const ByteSpan & destinationId, const ByteSpan & initiatorRandom,
+                                                 FabricIndex & outFabricIndex, NodeId & outNodeId, MutableByteSpan & outIpk)
+{
+    VerifyOrReturnError(mFabricTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(initiatorRandom.size() == kSigmaParamRandomNumberSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(outIpk.size() >= kIPKSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    Entry scratch;
+    for (const FabricInfo & fabricInfo : *mFabricTable)
+    {
+        Entry * entry = GetEntry(fabricInfo, scratch);
+        if (entry == nullptr)
+        {
+            continue;
+        }
+
+        memcpy(entry->message, initiatorRandom.data(), kSigmaParamRandomNumberSize);
+        for (uint8_t keyIdx = 0; keyIdx < entry->keyCount; ++keyIdx)
+        {
+            uint8_t candidateDestinationId[kSHA256_Hash_Length];
+            CHIP_ERROR err = entry->hmacs[keyIdx].Compute(entry->message, sizeof(entry->message), candidateDestinationId,
+                                                          sizeof(candidateDestinationId));
+            if (err == CHIP_NO_ERROR && destinationId.data_equal(ByteSpan(candidateDestinationId)))
+            {
+                memcpy(outIpk.data(), entry->ipks[keyIdx], kIPKSize);
+                outIpk.reduce_size(kIPKSize);
+                outFabricIndex = entry->fabricIndex;
+                outNodeId      = entry->nodeId;
+                return CHIP_NO_ERROR;
+            }
+        }
+    }
+
+    return CHIP_ERROR_KEY_NOT_FOUND;
+}
+
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+
 } // namespace chip
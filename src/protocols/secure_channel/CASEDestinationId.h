@@ -34,4 +34,82 @@ inline constexpr uint16_t kIPKSize                    = Crypto::CHIP_CRYPTO_SYMM
 CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & initiatorRandom, const ByteSpan & rootPubKey,
                                      FabricId fabricId, NodeId nodeId, MutableByteSpan & outDestinationId);
 
+#if CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+
+/**
+ * Matches the destination identifier of incoming Sigma1 messages against the local fabrics.
+ *
+ * The destination identifier is an HMAC, keyed with an identity protection key (IPK) epoch key of the fabric, of the
+ * initiator random followed by the root public key, fabric id and node id. For every fabric, the cache keeps the IPK epoch
+ * keys with an HMAC context keyed with each of them, and the part of the message that does not depend on the initiator, so
+ * that matching a Sigma1 only hashes its message once per candidate key.
+ *
+ * Fabrics are loaded on first use and checked against the fabric table on every use; they are reloaded when the fabric
+ * table reports a change to them. Identity protection keys set on a fabric other than while adding it (e.g. by a
+ * controller for its own fabric) are only seen after a call to Invalidate().
+ */
+class CASEDestinationIdCache : public FabricTable::Delegate
+{
+public:
+    CASEDestinationIdCache() = default;
+    ~CASEDestinationIdCache() override { Shutdown(); }
+
+    CASEDestinationIdCache(const CASEDestinationIdCache &)             = delete;
+    CASEDestinationIdCache & operator=(const CASEDestinationIdCache &) = delete;
+
+    CHIP_ERROR Init(FabricTable * fabricTable, Credentials::GroupDataProvider * groupDataProvider);
+    void Shutdown();
+
+    /**
+     * Forgets the keys of all fabrics, so that they are loaded again from the group data provider.
+     */
+    void Invalidate();
+
+    /**
+     * Finds the first fabric and IPK epoch key, in fabric table order, for which GenerateCaseDestinationId() gives
+     * @p destinationId.
+     *
+     * @param[out] outIpk The matching IPK epoch key. Must be at least kIPKSize bytes long.
+     *
+     * @retval #CHIP_ERROR_KEY_NOT_FOUND    If no fabric matches.
+     * @retval #CHIP_ERROR_INCORRECT_STATE  If the cache is not initialized.
+     */
+    CHIP_ERROR FindLocalNode(const ByteSpan & destinationId, const ByteSpan & initiatorRandom, FabricIndex & outFabricIndex,
+                             NodeId & outNodeId, MutableByteSpan & outIpk);
+
+    // FabricTable::Delegate
+    void OnFabricRemoved(const FabricTable & fabricTable, FabricIndex fabricIndex) override { Invalidate(fabricIndex); }
+    void OnFabricCommitted(const FabricTable & fabricTable, FabricIndex fabricIndex) override { Invalidate(fabricIndex); }
+    void OnFabricUpdated(const FabricTable & fabricTable, FabricIndex fabricIndex) override { Invalidate(fabricIndex); }
+
+private:
+    static constexpr size_t kEpochKeysMax = Credentials::GroupDataProvider::KeySet::kEpochKeysMax;
+    static constexpr size_t kMessageLength =
+        kSigmaParamRandomNumberSize + Crypto::kP256_PublicKey_Length + sizeof(FabricId) + sizeof(NodeId);
+
+    struct Entry
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        uint8_t keyCount        = 0;
+        NodeId nodeId           = kUndefinedNodeId;
+        // The initiator random (set for each match), then the root public key, fabric id and node id.
+        uint8_t message[kMessageLength];
+        uint8_t ipks[kEpochKeysMax][kIPKSize];
+        Crypto::HmacSha256Context hmacs[kEpochKeysMax];
+
+        ~Entry() { Clear(); }
+        void Clear();
+    };
+
+    Entry * GetEntry(const FabricInfo & fabricInfo, Entry & scratch);
+    CHIP_ERROR Load(const FabricInfo & fabricInfo, Entry & entry);
+    void Invalidate(FabricIndex fabricIndex);
+
+    FabricTable * mFabricTable                          = nullptr;
+    Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    Entry mEntries[CHIP_CONFIG_MAX_FABRICS];
+};
+
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+
 } // namespace chip
@@ -0,0 +1,171 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/CASEEphemeralKeypairPool.h>
+
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
+
+#include <mutex>
+
+namespace chip {
+
+using namespace chip::Crypto;
+
+CASEEphemeralKeypairPool & CASEEphemeralKeypairPool::Instance()
+{
+    static CASEEphemeralKeypairPool sInstance;
+    return sInstance;
+}
+
+CASEEphemeralKeypairPool::CASEEphemeralKeypairPool()
+{
+    SuccessOrDie(System::Mutex::Init(mLock));
+}
+
+CASEEphemeralKeypairPool::~CASEEphemeralKeypairPool()
+{
+    ClearLocked();
+}
+
+CHIP_ERROR CASEEphemeralKeypairPool::Init()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    mUserCount++;
+    ScheduleRefillLocked();
+    return CHIP_NO_ERROR;
+}
+
+void CASEEphemeralKeypairPool::Shutdown()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    VerifyOrReturn(mUserCount > 0);
+    if (--mUserCount == 0)
+    {
+        // A refill that is still scheduled drops its keypair once it sees that the pool has no user.
+        ClearLocked();
+        mRefillUnavailable = false;
+    }
+}
+
+CHIP_ERROR CASEEphemeralKeypairPool::TakeKeypair(P256Keypair & keypair)
+{
+    P256SerializedKeypair serializedKeypair;
+
+    {
+        std::lock_guard<System::Mutex> lock(mLock);
+
+        VerifyOrReturnError(mUserCount > 0, CHIP_ERROR_INCORRECT_STATE);
+        if (mCount == 0)
+        {
+            mStats.missed++;
+            ScheduleRefillLocked();
+            return CHIP_ERROR_NOT_FOUND;
+        }
+
+        mCount--;
+        serializedKeypair = mKeypairs[mCount];
+        mKeypairs[mCount].Clear();
+        mStats.taken++;
+        ScheduleRefillLocked();
+    }
+
+    return keypair.Deserialize(serializedKeypair);
+}
+
+size_t CASEEphemeralKeypairPool::GetAvailableCount()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    return mCount;
+}
+
+CASEEphemeralKeypairPool::Stats CASEEphemeralKeypairPool::GetStats()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    return mStats;
+}
+
+void CASEEphemeralKeypairPool::ResetStats()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    mStats = Stats();
+}
+
+void CASEEphemeralKeypairPool::RefillWork(intptr_t context)
+{
+    reinterpret_cast<CASEEphemeralKeypairPool *>(context)->Refill();
+}
+
+void CASEEphemeralKeypairPool::ScheduleRefillLocked()
+{
+    VerifyOrReturn(mUserCount > 0 && mCount < kCapacity && !mRefillScheduled && !mRefillUnavailable);
+
+    // Only one refill is in flight at a time, so that the pool never takes more than one background worker.
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(RefillWork, reinterpret_cast<intptr_t>(this));
+    if (err == CHIP_NO_ERROR)
+    {
+        mRefillScheduled = true;
+    }
+}
+
+void CASEEphemeralKeypairPool::Refill()
+{
+    P256Keypair keypair;
+    P256SerializedKeypair serializedKeypair;
+
+    // Generate outside of the lock, so that handshakes can keep taking keypairs meanwhile.
+    CHIP_ERROR err = keypair.Initialize(ECPKeyTarget::ECDH);
+    SuccessOrExit(err);
+    err = keypair.Serialize(serializedKeypair);
+    SuccessOrExit(err);
+
+exit:
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    mRefillScheduled = false;
+    if (err != CHIP_NO_ERROR)
+    {
+        // E.g. a crypto backend that cannot export keys: CASE generates its keypairs itself.
+        ChipLogError(SecureChannel, "Disabling CASE ephemeral keypair pool: %" CHIP_ERROR_FORMAT, err.Format());
+        mRefillUnavailable = true;
+        return;
+    }
+
+    VerifyOrReturn(mUserCount > 0 && mCount < kCapacity);
+    mKeypairs[mCount] = serializedKeypair;
+    mCount++;
+    mStats.generated++;
+    ScheduleRefillLocked();
+}
+
+void CASEEphemeralKeypairPool::ClearLocked()
+{
+    for (size_t i = 0; i < mCount; i++)
+    {
+        mKeypairs[i].Clear();
+    }
+    mCount = 0;
+}
+
+} // namespace chip
+
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
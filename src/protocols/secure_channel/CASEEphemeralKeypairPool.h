@@ -0,0 +1,103 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemMutex.h>
+
+namespace chip {
+
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+
+/**
+ * Keeps up to CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE ephemeral ECDH keypairs generated in advance for CASE.
+ *
+ * Every keypair is handed out once. Taking a keypair schedules background work that generates replacements one at a
+ * time, so that the Matter thread is not held for more than one key generation when background event processing is not
+ * enabled. The pool is shared by all the CASE sessions of the process; it is filled while it has at least one user, i.e.
+ * between a call to Init() and the matching call to Shutdown().
+ *
+ * TakeKeypair() may be called from any thread, including from CASE background work.
+ */
+class CASEEphemeralKeypairPool
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE;
+
+    struct Stats
+    {
+        uint32_t generated = 0; ///< Keypairs generated by the background refill.
+        uint32_t taken     = 0; ///< Keypairs handed out by TakeKeypair().
+        uint32_t missed    = 0; ///< Calls to TakeKeypair() that found the pool empty.
+    };
+
+    static CASEEphemeralKeypairPool & Instance();
+
+    CASEEphemeralKeypairPool(const CASEEphemeralKeypairPool &)             = delete;
+    CASEEphemeralKeypairPool & operator=(const CASEEphemeralKeypairPool &) = delete;
+
+    /**
+     * Registers a user of the pool and, for the first one, schedules the pool to be filled.
+     */
+    CHIP_ERROR Init();
+
+    /**
+     * Unregisters a user of the pool. Once the last user is gone, the pooled keypairs are cleared and the pool stops
+     * refilling.
+     */
+    void Shutdown();
+
+    /**
+     * Moves a pooled keypair into @p keypair and schedules a replacement.
+     *
+     * @retval #CHIP_ERROR_NOT_FOUND       If the pool is empty; the caller should generate a keypair itself.
+     * @retval #CHIP_ERROR_INCORRECT_STATE If the pool has no user.
+     * @retval other                       If @p keypair could not load the pooled keypair.
+     */
+    CHIP_ERROR TakeKeypair(Crypto::P256Keypair & keypair);
+
+    size_t GetAvailableCount();
+    Stats GetStats();
+    void ResetStats();
+
+private:
+    CASEEphemeralKeypairPool();
+    ~CASEEphemeralKeypairPool();
+
+    static void RefillWork(intptr_t context);
+    void ScheduleRefillLocked();
+    void Refill();
+    void ClearLocked();
+
+    System::Mutex mLock;
+
+    Crypto::P256SerializedKeypair mKeypairs[kCapacity];
+    size_t mCount           = 0;
+    unsigned mUserCount     = 0;
+    bool mRefillScheduled   = false;
+    bool mRefillUnavailable = false;
+    Stats mStats;
+};
+
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+
+} // namespace chip
@@ -44,12 +44,33 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mSessionResumptionStorage  = sessionResumptionStorage;
     mCertificateValidityPolicy = certificateValidityPolicy;
     mFabrics                   = fabrics;
-    mExchangeManager           = exchangeManager;
     mGroupDataProvider         = responderGroupDataProvider;
 
     // Set up the group state provider that persists across all handshakes.
     GetSession().SetGroupDataProvider(mGroupDataProvider);
 
+#if CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+    // Without a fabric table, the session fails on Sigma1 as it would without the cache.
+    CASEDestinationIdCache * destinationIdCache = nullptr;
+    if (mFabrics != nullptr)
+    {
+        ReturnErrorOnFailure(mDestinationIdCache.Init(mFabrics, mGroupDataProvider));
+        destinationIdCache = &mDestinationIdCache;
+    }
+    GetSession().SetDestinationIdCache(destinationIdCache);
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    if (!mUsingEphemeralKeypairPool)
+    {
+        ReturnErrorOnFailure(CASEEphemeralKeypairPool::Instance().Init());
+        mUsingEphemeralKeypairPool = true;
+    }
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+
+    // Only set once nothing can fail anymore, since Shutdown() unregisters from it.
+    mExchangeManager = exchangeManager;
+
     ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
     TEMPORARY_RETURN_IGNORED mExchangeManager->RegisterUnsolicitedMessageHandlerForType(
         Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
@@ -21,6 +21,7 @@
 #include <credentials/GroupDataProvider.h>
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMgr.h>
+#include <protocols/secure_channel/CASEEphemeralKeypairPool.h>
 #include <protocols/secure_channel/CASESession.h>
 #include <system/SystemClock.h>
 
@@ -49,8 +50,20 @@ public:
             mExchangeManager = nullptr;
         }
 
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+        if (mUsingEphemeralKeypairPool)
+        {
+            CASEEphemeralKeypairPool::Instance().Shutdown();
+            mUsingEphemeralKeypairPool = false;
+        }
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+
         GetSession().Clear();
         mPinnedSecureSession.ClearValue();
+#if CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+        GetSession().SetDestinationIdCache(nullptr);
+        mDestinationIdCache.Shutdown();
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
     }
 
     CHIP_ERROR ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
@@ -96,6 +109,12 @@ private:
 
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+#if CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+    CASEDestinationIdCache mDestinationIdCache;
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    bool mUsingEphemeralKeypairPool = false;
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
 
     CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
 
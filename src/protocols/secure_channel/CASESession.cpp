@@ -42,6 +42,7 @@
 #include <platform/PlatformManager.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/CASEDestinationId.h>
+#include <protocols/secure_channel/CASEEphemeralKeypairPool.h>
 #include <protocols/secure_channel/PairingSession.h>
 #include <protocols/secure_channel/SessionResumptionStorage.h>
 #include <protocols/secure_channel/StatusReport.h>
@@ -113,6 +114,18 @@ constexpr chip::TLV::Tag AsTlvContextTag(Enum e)
 
 constexpr size_t kCaseOverheadForFutureTBEData = 128;
 
+// Takes an ephemeral ECDH keypair generated in advance if there is one, and generates one otherwise.
+CHIP_ERROR InitializeEphemeralKeypair(chip::Crypto::P256Keypair & keypair)
+{
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    if (chip::CASEEphemeralKeypairPool::Instance().TakeKeypair(keypair) == CHIP_NO_ERROR)
+    {
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    return keypair.Initialize(chip::Crypto::ECPKeyTarget::ECDH);
+}
+
 } // namespace
 
 namespace chip {
@@ -249,6 +262,11 @@ public:
         AfterWorkHandler(reinterpret_cast<intptr_t>(this));
     }
 
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    // Make the background work act as if scheduling the after work callback failed.
+    void FailScheduleAfterWorkForTest() { mFailScheduleAfterWorkForTest = true; }
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+
 private:
     // Create a work helper using the specified session, work callback, after work callback, and data (template arg).
     // Lifetime is not managed, see `Create` for that option.
@@ -269,7 +287,7 @@ private:
         VerifyOrReturn(!cancel && !helper->IsCancelled());
         // Hold strong ptr to ourselves while work is outstanding
         helper->mStrongPtr.swap(strongPtr);
-        auto status = DeviceLayer::PlatformMgr().ScheduleWork(AfterWorkHandler, reinterpret_cast<intptr_t>(helper));
+        auto status = ScheduleAfterWork(helper);
         if (status != CHIP_NO_ERROR)
         {
             ChipLogError(SecureChannel, "Failed to Schedule the AfterWorkCallback on foreground thread: %" CHIP_ERROR_FORMAT,
@@ -296,6 +314,14 @@ private:
         }
     }
 
+    static CHIP_ERROR ScheduleAfterWork(WorkHelper * helper)
+    {
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+        VerifyOrReturnError(!helper->mFailScheduleAfterWorkForTest, CHIP_ERROR_NO_MEMORY);
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+        return DeviceLayer::PlatformMgr().ScheduleWork(AfterWorkHandler, reinterpret_cast<intptr_t>(helper));
+    }
+
     // Handler for the after work callback.
     static void AfterWorkHandler(intptr_t arg)
     {
@@ -347,6 +373,10 @@ private:
     // object on the background thread.  After that, the Matter thread owns the object.
     std::atomic<bool> mScheduleAfterWorkFailed{ false };
 
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    bool mFailScheduleAfterWorkForTest = false;
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+
 public:
     // Data passed to `mWorkCallback` and `mAfterWorkCallback`.
     DATA mData;
@@ -377,6 +407,16 @@ void CASESession::Clear()
 {
     MATTER_TRACE_SCOPE("Clear", "CASESession");
     // Cancel any outstanding work.
+    if (mSendSigma2Helper)
+    {
+        mSendSigma2Helper->CancelWork();
+        mSendSigma2Helper.reset();
+    }
+    if (mHandleSigma2Helper)
+    {
+        mHandleSigma2Helper->CancelWork();
+        mHandleSigma2Helper.reset();
+    }
     if (mSendSigma3Helper)
     {
         mSendSigma3Helper->CancelWork();
@@ -480,6 +520,11 @@ CASESession::PrepareForSessionEstablishment(SessionManager & sessionManager, Fab
     mSessionResumptionStorage = sessionResumptionStorage;
     mLocalMRPConfig           = MakeOptional(mrpLocalConfig.ValueOr(GetDefaultMRPConfig()));
 
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    // The peer's ICAC and root usually are the same from one handshake to the next.
+    mValidContext.mVerifiedCertificateCache = &fabricTable->GetVerifiedCertificateCache();
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
     ChipLogDetail(SecureChannel, "Allocated SecureSession (%p) - waiting for Sigma1 msg",
                   mSecureSessionHolder.Get().Value()->AsSecureSession());
 
@@ -537,6 +582,11 @@ CHIP_ERROR CASESession::EstablishSession(SessionManager & sessionManager, Fabric
     mSessionResumptionStorage = sessionResumptionStorage;
     mLocalMRPConfig           = MakeOptional(mrpLocalConfig.ValueOr(GetDefaultMRPConfig()));
 
+#if CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+    // The peer's ICAC and root usually are the same from one handshake to the next.
+    mValidContext.mVerifiedCertificateCache = &fabricTable->GetVerifiedCertificateCache();
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE > 0
+
     SuccessOrExit(err = mExchangeCtxt.Value()->UseSuggestedResponseTimeout(kExpectedSigma1ProcessingTime));
     mPeerNodeId  = peerScopedNodeId.GetNodeId();
     mLocalNodeId = fabricInfo->GetNodeId();
@@ -746,7 +796,7 @@ CHIP_ERROR CASESession::SendSigma1()
     // Generate an ephemeral keypair
     mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
     VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
+    ReturnErrorOnFailure(InitializeEphemeralKeypair(*mEphemeralKey));
     encodeSigma1Inputs.initiatorEphPubKey = &mEphemeralKey->Pubkey();
 
     // Fill in the random value
@@ -899,17 +949,9 @@ CHIP_ERROR CASESession::HandleSigma1_and_SendSigma2(System::PacketBufferHandle &
     switch (nextStep.Get<Step>())
     {
     case Step::kSendSigma2: {
-
-        System::PacketBufferHandle msgR2;
-        EncodeSigma2Inputs encodeSigma2;
-
-        SuccessOrExit(err = PrepareSigma2(encodeSigma2));
-        SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
-
-        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
-        SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
-
-        mDelegate->OnSessionEstablishmentStarted();
+        // The ephemeral key, shared secret and signature are computed in the background;
+        // SendSigma2c() sends Sigma2 once they are ready.
+        SuccessOrExit(err = SendSigma2a());
         break;
     }
     case Step::kSendSigma2Resume: {
@@ -950,6 +992,14 @@ CHIP_ERROR CASESession::FindLocalNodeFromDestinationId(const ByteSpan & destinat
     MATTER_TRACE_SCOPE("FindLocalNodeFromDestinationId", "CASESession");
     VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
+#if CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+    if (mDestinationIdCache != nullptr)
+    {
+        MutableByteSpan ipkSpan(mIPK);
+        return mDestinationIdCache->FindLocalNode(destinationId, initiatorRandom, mFabricIndex, mLocalNodeId, ipkSpan);
+    }
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+
     bool found = false;
     for (const FabricInfo & fabricInfo : *mFabricsTable)
     {
@@ -1166,72 +1216,165 @@ CHIP_ERROR CASESession::SendSigma2Resume(System::PacketBufferHandle && msgR2Resu
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
+CHIP_ERROR CASESession::SendSigma2a()
 {
-
-    MATTER_TRACE_SCOPE("PrepareSigma2", "CASESession");
+    MATTER_TRACE_SCOPE("SendSigma2", "CASESession");
 
     VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
-    outSigma2Data.responderSessionId = GetLocalSessionId().Value();
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> icacBuf;
-    VerifyOrReturnError(icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+    auto helper = WorkHelper<SendSigma2Data>::Create(*this, &SendSigma2b, &CASESession::SendSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    {
+        auto & data = helper->mData;
+
+        data.fabricIndex = mFabricIndex;
+        data.fabricTable = nullptr;
+        data.keystore    = nullptr;
+
+        {
+            const FabricInfo * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
+            VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+            auto * keystore = mFabricsTable->GetOperationalKeystore();
+            if (!fabricInfo->HasOperationalKey() && keystore != nullptr && keystore->SupportsSignWithOpKeypairInBackground())
+            {
+                // NOTE: used to sign in background.
+                data.keystore = keystore;
+            }
+            else
+            {
+                // NOTE: used to sign in foreground.
+                data.fabricTable = mFabricsTable;
+            }
+        }
+
+        VerifyOrReturnError(data.icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.icaCert = MutableByteSpan{ data.icacBuf.Get(), kMaxCHIPCertLength };
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> nocBuf;
-    VerifyOrReturnError(nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        VerifyOrReturnError(data.nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.nocCert = MutableByteSpan{ data.nocBuf.Get(), kMaxCHIPCertLength };
 
-    MutableByteSpan icaCert{ icacBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, icaCert));
+        ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, data.icaCert));
+        ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, data.nocCert));
 
-    MutableByteSpan nocCert{ nocBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, nocCert));
+        // Prepare Sigma2 TBS Data Blob, filled in once the ephemeral keypair exists
+        size_t msgR2SignedLen = EstimateStructOverhead(data.nocCert.size(),    // responderNoc
+                                                       data.icaCert.size(),    // responderICAC
+                                                       kP256_PublicKey_Length, // responderEphPubKey
+                                                       kP256_PublicKey_Length  // InitiatorEphPubKey
+        );
 
-    // Fill in the random value
-    ReturnErrorOnFailure(DRBG_get_bytes(&outSigma2Data.responderRandom[0], sizeof(outSigma2Data.responderRandom)));
+        VerifyOrReturnError(data.msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
+        data.msgR2SignedSpan = MutableByteSpan{ data.msgR2Signed.Get(), msgR2SignedLen };
 
+        data.initiatorEphPubKey = mRemotePubKey;
+
+        ReturnErrorOnFailure(helper->ScheduleWork());
+        mSendSigma2Helper = helper;
+        mExchangeCtxt.Value()->WillSendMessage();
+        mState = State::kSendSigma2Pending;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendSigma2b(SendSigma2Data & data, bool & cancel)
+{
     // Generate an ephemeral keypair
-    mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
-    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
-    outSigma2Data.responderEphPubKey = &mEphemeralKey->Pubkey();
+    ReturnErrorOnFailure(InitializeEphemeralKeypair(data.ephemeralKey));
 
     // Generate a Shared Secret
-    ReturnErrorOnFailure(mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
+    ReturnErrorOnFailure(data.ephemeralKey.ECDH_derive_secret(data.initiatorEphPubKey, data.sharedSecret));
+
+    // Construct Sigma2 TBS Data
+    ReturnErrorOnFailure(ConstructTBSData(data.nocCert, data.icaCert,
+                                          ByteSpan(data.ephemeralKey.Pubkey(), data.ephemeralKey.Pubkey().Length()),
+                                          ByteSpan(data.initiatorEphPubKey, data.initiatorEphPubKey.Length()),
+                                          data.msgR2SignedSpan));
+
+    // Generate a signature, unless it has to be done by the fabric table in the foreground
+    if (data.keystore != nullptr)
+    {
+        ReturnErrorOnFailure(data.keystore->SignWithOpKeypair(data.fabricIndex, data.msgR2SignedSpan, data.tbsData2Signature));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendSigma2c(SendSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    System::PacketBufferHandle msgR2;
+    EncodeSigma2Inputs encodeSigma2;
+
+    VerifyOrExit(mState == State::kSendSigma2Pending, err = CHIP_ERROR_INCORRECT_STATE);
+
+    SuccessOrExit(err = status);
+    SuccessOrExit(err = PrepareSigma2(data, encodeSigma2));
+    SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
+
+    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
+    SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
+
+    mDelegate->OnSessionEstablishmentStarted();
+
+exit:
+    mSendSigma2Helper.reset();
+
+    // Processing occurred in the background, so if an error occurred, need to send status report
+    // (normally occurs in HandleSigma1_and_SendSigma2), and discard exchange and abort pending
+    // establish (normally occurs in OnMessageReceived).
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+
+    return err;
+}
+
+CHIP_ERROR CASESession::PrepareSigma2(SendSigma2Data & data, EncodeSigma2Inputs & outSigma2Data)
+{
+
+    MATTER_TRACE_SCOPE("PrepareSigma2", "CASESession");
+
+    VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
+    outSigma2Data.responderSessionId = GetLocalSessionId().Value();
+
+    // Fill in the random value
+    ReturnErrorOnFailure(DRBG_get_bytes(&outSigma2Data.responderRandom[0], sizeof(outSigma2Data.responderRandom)));
+
+    // The ephemeral keypair has done its part (ECDH) in the background; only its public key is needed from here on.
+    mResponderEphPubKey              = data.ephemeralKey.Pubkey();
+    outSigma2Data.responderEphPubKey = &mResponderEphPubKey;
+    mSharedSecret                    = data.sharedSecret;
 
     SensitiveDataFixedBuffer<kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length> msgSalt;
 
     MutableByteSpan saltSpan(msgSalt.Bytes(), msgSalt.Capacity());
     ReturnErrorOnFailure(
-        ConstructSaltSigma2(ByteSpan(outSigma2Data.responderRandom), mEphemeralKey->Pubkey(), ByteSpan(mIPK), saltSpan));
+        ConstructSaltSigma2(ByteSpan(outSigma2Data.responderRandom), mResponderEphPubKey, ByteSpan(mIPK), saltSpan));
 
     AutoReleaseSessionKey sr2k(*mSessionManager->GetSessionKeystore());
     ReturnErrorOnFailure(DeriveSigmaKey(saltSpan, ByteSpan(kKDFSR2Info), sr2k));
 
-    // Construct Sigma2 TBS Data
-    P256ECDSASignature tbsData2Signature;
+    // Generate a Signature, if it was not generated in the background
+    if (data.fabricTable != nullptr)
     {
-        size_t msgR2SignedLen = EstimateStructOverhead(kMaxCHIPCertLength,     // responderNoc
-                                                       kMaxCHIPCertLength,     // responderICAC
-                                                       kP256_PublicKey_Length, // responderEphPubKey
-                                                       kP256_PublicKey_Length  // InitiatorEphPubKey
-        );
-
-        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
-        VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
-        MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
-
-        ReturnErrorOnFailure(ConstructTBSData(nocCert, icaCert, ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
-                                              ByteSpan(mRemotePubKey, mRemotePubKey.Length()), msgR2SignedSpan));
-
-        // Generate a Signature
-        ReturnErrorOnFailure(mFabricsTable->SignWithOpKeypair(mFabricIndex, msgR2SignedSpan, tbsData2Signature));
+        ReturnErrorOnFailure(data.fabricTable->SignWithOpKeypair(data.fabricIndex, data.msgR2SignedSpan, data.tbsData2Signature));
     }
+    data.msgR2Signed.Free();
+    data.msgR2SignedSpan = MutableByteSpan{};
+
     // Construct Sigma2 TBE Data
-    size_t msgR2SignedEncLen = EstimateStructOverhead(nocCert.size(),                             // responderNoc
-                                                      icaCert.size(),                             // responderICAC
-                                                      tbsData2Signature.Length(),                 // signature
+    size_t msgR2SignedEncLen = EstimateStructOverhead(data.nocCert.size(),                        // responderNoc
+                                                      data.icaCert.size(),                        // responderICAC
+                                                      data.tbsData2Signature.Length(),            // signature
                                                       SessionResumptionStorage::kResumptionIdSize // resumptionID
     );
 
@@ -1245,28 +1388,28 @@ CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
 
     ReturnErrorOnFailure(tlvWriter.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType));
 
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2NOC, *nocCert.data() ^= 0xFF);
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2ICAC, *icaCert.data() ^= 0xFF);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2NOC, *data.nocCert.data() ^= 0xFF);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2ICAC, *data.icaCert.data() ^= 0xFF);
 
-    ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderNOC), nocCert));
-    if (!icaCert.empty())
+    ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderNOC), data.nocCert));
+    if (!data.icaCert.empty())
     {
-        ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderICAC), icaCert));
+        ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderICAC), data.icaCert));
     }
 
     // We are now done with ICAC and NOC certs so we can release the memory.
     {
-        icacBuf.Free();
-        icaCert = MutableByteSpan{};
+        data.icacBuf.Free();
+        data.icaCert = MutableByteSpan{};
 
-        nocBuf.Free();
-        nocCert = MutableByteSpan{};
+        data.nocBuf.Free();
+        data.nocCert = MutableByteSpan{};
     }
 
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2Signature, *tbsData2Signature.Bytes() ^= 0xFF);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2Signature, *data.tbsData2Signature.Bytes() ^= 0xFF);
 
-    ReturnErrorOnFailure(tlvWriter.PutBytes(AsTlvContextTag(TBEDataTags::kSignature), tbsData2Signature.ConstBytes(),
-                                            static_cast<uint32_t>(tbsData2Signature.Length())));
+    ReturnErrorOnFailure(tlvWriter.PutBytes(AsTlvContextTag(TBEDataTags::kSignature), data.tbsData2Signature.ConstBytes(),
+                                            static_cast<uint32_t>(data.tbsData2Signature.Length())));
 
     // Generate a new resumption ID
     ReturnErrorOnFailure(DRBG_get_bytes(mNewResumptionId.data(), mNewResumptionId.size()));
@@ -1447,27 +1590,18 @@ CHIP_ERROR CASESession::ParseSigma2Resume(ContiguousBufferTLVReader & tlvReader,
 CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2_and_SendSigma3", "CASESession");
-    CHIP_ERROR err = HandleSigma2(std::move(msg));
-    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
-    SuccessOrExit(err);
-
-    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
-    err = SendSigma3a();
-    if (CHIP_NO_ERROR != err)
-    {
-        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
-    }
-
-exit:
+    // The responder identity is verified in the background; HandleSigma2c() then sends Sigma3.
+    CHIP_ERROR err = HandleSigma2a(std::move(msg));
     if (CHIP_NO_ERROR != err)
     {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
         mState = State::kInitialized;
     }
     return err;
 }
 
-CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
+CHIP_ERROR CASESession::HandleSigma2a(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2", "CASESession");
     ChipLogProgress(SecureChannel, "Received Sigma2 msg");
@@ -1478,12 +1612,15 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     size_t buflen       = msg->DataLength();
     VerifyOrReturnError(buf != nullptr, CHIP_ERROR_MESSAGE_INCOMPLETE);
 
-    FabricId fabricId = kUndefinedFabricId;
+    auto helper = WorkHelper<HandleSigma2Data>::Create(*this, &HandleSigma2b, &CASESession::HandleSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    auto & data = helper->mData;
+
     {
         VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
         const auto * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
         VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        fabricId = fabricInfo->GetFabricId();
+        data.fabricId = fabricInfo->GetFabricId();
     }
 
     System::PacketBufferTLVReader tlvReader;
@@ -1495,7 +1632,8 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     //  mRemotePubKey.Length() == responderEphPubKey.size() == kP256_PublicKey_Length.
     memcpy(mRemotePubKey.Bytes(), parsedSigma2.responderEphPubKey.data(), mRemotePubKey.Length());
 
-    // Generate a Shared Secret
+    // Generate a Shared Secret. Unlike the responder's, this ECDH runs on the Matter thread: the ephemeral keypair belongs
+    // to the session, which may release it through Clear() while background work is still running.
     ReturnErrorOnFailure(mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
 
     // Generate the S2K key
@@ -1522,60 +1660,138 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     ParsedSigma2TBEData parsedSigma2TBEData;
     ReturnErrorOnFailure(ParseSigma2TBEData(decryptedDataTlvReader, parsedSigma2TBEData));
 
-    // Validate responder identity located in msgR2Decrypted
-    // Constructing responder identity
-    P256PublicKey responderPublicKey;
-    {
-        NodeId responderNodeId;
-
-        CompressedFabricId unused;
-        FabricId responderFabricId;
-        ReturnErrorOnFailure(SetEffectiveTime());
-        ReturnErrorOnFailure(mFabricsTable->VerifyCredentials(mFabricIndex, parsedSigma2TBEData.responderNOC,
-                                                              parsedSigma2TBEData.responderICAC, mValidContext, unused,
-                                                              responderFabricId, responderNodeId, responderPublicKey));
-        VerifyOrReturnError(fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-        // Verify that responderNodeId (from responderNOC) matches one that was included
-        // in the computation of the Destination Identifier when generating Sigma1.
-        VerifyOrReturnError(mPeerNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-    }
-
-    // Construct msgR2Signed and validate the signature in msgR2Decrypted.
+    // Construct msgR2Signed, whose signature is validated in the background.
     size_t msgR2SignedLen = EstimateStructOverhead(parsedSigma2TBEData.responderNOC.size(),  // resonderNOC
                                                    parsedSigma2TBEData.responderICAC.size(), // responderICAC
                                                    kP256_PublicKey_Length,                   // responderEphPubKey
                                                    kP256_PublicKey_Length                    // initiatorEphPubKey
     );
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
-    VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
-    MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
+    VerifyOrReturnError(data.msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
+    data.msgR2SignedSpan = MutableByteSpan{ data.msgR2Signed.Get(), msgR2SignedLen };
 
     ReturnErrorOnFailure(ConstructTBSData(parsedSigma2TBEData.responderNOC, parsedSigma2TBEData.responderICAC,
                                           ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()), msgR2SignedSpan));
+                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
+                                          data.msgR2SignedSpan));
+
+    // Prepare for validating the responder identity
+    {
+        MutableByteSpan fabricRCAC{ data.rootCertBuf };
+        ReturnErrorOnFailure(mFabricsTable->FetchRootCert(mFabricIndex, fabricRCAC));
+        data.fabricRCAC = fabricRCAC;
+        ReturnErrorOnFailure(SetEffectiveTime());
+    }
+
+    // Copy remaining needed data into work structure
+    {
+        data.validContext      = mValidContext;
+        data.tbsData2Signature = parsedSigma2TBEData.tbsData2Signature;
+        data.responderNodeId   = kUndefinedNodeId;
+
+        // responderNOC and responderICAC are spans into msgR2Decrypted, which is going away,
+        // so redirect them to their copies in msgR2Signed, which is staying around.
+        TLVType containerType = kTLVType_Structure;
+        ContiguousBufferTLVReader signedDataTlvReader;
+        signedDataTlvReader.Init(data.msgR2SignedSpan);
+        ReturnErrorOnFailure(signedDataTlvReader.Next(containerType, AnonymousTag()));
+        ReturnErrorOnFailure(signedDataTlvReader.EnterContainer(containerType));
+
+        ReturnErrorOnFailure(signedDataTlvReader.Next(AsTlvContextTag(TBSDataTags::kSenderNOC)));
+        ReturnErrorOnFailure(signedDataTlvReader.GetByteView(data.responderNOC));
+
+        if (!parsedSigma2TBEData.responderICAC.empty())
+        {
+            ReturnErrorOnFailure(signedDataTlvReader.Next(AsTlvContextTag(TBSDataTags::kSenderICAC)));
+            ReturnErrorOnFailure(signedDataTlvReader.GetByteView(data.responderICAC));
+        }
+
+        ReturnErrorOnFailure(signedDataTlvReader.ExitContainer(containerType));
+
+        data.responderSessionId = parsedSigma2.responderSessionId;
+        std::copy(parsedSigma2TBEData.resumptionId.begin(), parsedSigma2TBEData.resumptionId.end(), data.resumptionId.begin());
+        data.responderSessionParamStructPresent = parsedSigma2.responderSessionParamStructPresent;
+        data.responderSessionParams             = parsedSigma2.responderSessionParams;
+    }
+
+    ReturnErrorOnFailure(helper->ScheduleWork());
+    mHandleSigma2Helper = helper;
+    mExchangeCtxt.Value()->WillSendMessage();
+    mState = State::kHandleSigma2Pending;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigma2b(HandleSigma2Data & data, bool & cancel)
+{
+    // Validate responder identity located in msgR2Decrypted
+    // Constructing responder identity
+    CompressedFabricId unused;
+    FabricId responderFabricId;
+    P256PublicKey responderPublicKey;
+    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.responderNOC, data.responderICAC, data.fabricRCAC, data.validContext,
+                                                        unused, responderFabricId, data.responderNodeId, responderPublicKey));
+    VerifyOrReturnError(data.fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // Validate signature
-    ReturnErrorOnFailure(responderPublicKey.ECDSA_validate_msg_signature(msgR2SignedSpan.data(), msgR2SignedSpan.size(),
-                                                                         parsedSigma2TBEData.tbsData2Signature));
+    ReturnErrorOnFailure(responderPublicKey.ECDSA_validate_msg_signature(data.msgR2SignedSpan.data(), data.msgR2SignedSpan.size(),
+                                                                         data.tbsData2Signature));
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrExit(mState == State::kHandleSigma2Pending, err = CHIP_ERROR_INCORRECT_STATE);
+
+    SuccessOrExit(err = status);
+
+    // Verify that responderNodeId (from responderNOC) matches one that was included
+    // in the computation of the Destination Identifier when generating Sigma1.
+    VerifyOrExit(mPeerNodeId == data.responderNodeId, err = CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     ChipLogDetail(SecureChannel, "Peer " ChipLogFormatScopedNodeId " assigned session ID %d", ChipLogValueScopedNodeId(GetPeer()),
-                  parsedSigma2.responderSessionId);
-    SetPeerSessionId(parsedSigma2.responderSessionId);
+                  data.responderSessionId);
+    SetPeerSessionId(data.responderSessionId);
 
-    std::copy(parsedSigma2TBEData.resumptionId.begin(), parsedSigma2TBEData.resumptionId.end(), mNewResumptionId.begin());
+    mNewResumptionId = data.resumptionId;
 
     // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
-    ReturnErrorOnFailure(ExtractCATsFromOpCert(parsedSigma2TBEData.responderNOC, mPeerCATs));
+    SuccessOrExit(err = ExtractCATsFromOpCert(data.responderNOC, mPeerCATs));
 
-    if (parsedSigma2.responderSessionParamStructPresent)
+    if (data.responderSessionParamStructPresent)
     {
-        SetRemoteSessionParameters(parsedSigma2.responderSessionParams);
+        SetRemoteSessionParameters(data.responderSessionParams);
         mExchangeCtxt.Value()->GetSessionHandle()->AsUnauthenticatedSession()->SetRemoteSessionParameters(
             GetRemoteSessionParameters());
     }
 
-    return CHIP_NO_ERROR;
+exit:
+    mHandleSigma2Helper.reset();
+    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
+
+    if (err == CHIP_NO_ERROR)
+    {
+        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
+        err = SendSigma3a();
+        if (CHIP_NO_ERROR != err)
+        {
+            MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
+        }
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        // Abort the pending establish, which is normally done by CASESession::OnMessageReceived,
+        // but in the background processing case must be done here.
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+
+    return err;
 }
 
 CHIP_ERROR CASESession::ParseSigma2(ContiguousBufferTLVReader & tlvReader, ParsedSigma2 & outParsedSigma2)
@@ -1936,8 +2152,6 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
             data.fabricId = fabricInfo->GetFabricId();
         }
 
-        VerifyOrExit(mEphemeralKey != nullptr, err = CHIP_ERROR_INTERNAL);
-
         // Step 1
         // msgR3Encrypted will be allocated and initialised within ParseSigma3()
         Platform::ScopedMemoryBufferWithSize<uint8_t> msgR3Encrypted;
@@ -1976,8 +2190,7 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
         data.msgR3SignedSpan = MutableByteSpan{ data.msgR3Signed.Get(), msgR3SignedLen };
 
         SuccessOrExit(err = ConstructTBSData(data.initiatorNOC, data.initiatorICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                             ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
-                                             data.msgR3SignedSpan));
+                                             ByteSpan(mResponderEphPubKey, mResponderEphPubKey.Length()), data.msgR3SignedSpan));
 
         // Prepare for Step 4/5
         {
@@ -2657,6 +2870,20 @@ bool CASESession::InvokeBackgroundWorkWatchdog()
 {
     bool watchdogFired = false;
 
+    if (mSendSigma2Helper && mSendSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "SendSigma2Helper was unable to schedule the AfterWorkCallback");
+        mSendSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
+    if (mHandleSigma2Helper && mHandleSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "HandleSigma2Helper was unable to schedule the AfterWorkCallback");
+        mHandleSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
     if (mSendSigma3Helper && mSendSigma3Helper->UnableToScheduleAfterWorkCallback())
     {
         ChipLogError(SecureChannel, "SendSigma3Helper was unable to schedule the AfterWorkCallback");
@@ -2674,6 +2901,28 @@ bool CASESession::InvokeBackgroundWorkWatchdog()
     return watchdogFired;
 }
 
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+void CASESession::FailScheduleAfterWorkForTest()
+{
+    if (mSendSigma2Helper)
+    {
+        mSendSigma2Helper->FailScheduleAfterWorkForTest();
+    }
+    if (mHandleSigma2Helper)
+    {
+        mHandleSigma2Helper->FailScheduleAfterWorkForTest();
+    }
+    if (mSendSigma3Helper)
+    {
+        mSendSigma3Helper->FailScheduleAfterWorkForTest();
+    }
+    if (mHandleSigma3Helper)
+    {
+        mHandleSigma3Helper->FailScheduleAfterWorkForTest();
+    }
+}
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+
 // Helper function to map CASESession::State to SessionEstablishmentStage
 SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(State caseState)
 {
@@ -2684,9 +2933,12 @@ SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(S
     case State::kSentSigma1:
     case State::kSentSigma1Resume:
         return SessionEstablishmentStage::kSentSigma1;
+    case State::kSendSigma2Pending:
+        return SessionEstablishmentStage::kReceivedSigma1;
     case State::kSentSigma2:
     case State::kSentSigma2Resume:
         return SessionEstablishmentStage::kSentSigma2;
+    case State::kHandleSigma2Pending:
     case State::kSendSigma3Pending:
         return SessionEstablishmentStage::kReceivedSigma2;
     case State::kSentSigma3:
@@ -118,6 +118,16 @@ public:
      */
     void SetGroupDataProvider(Credentials::GroupDataProvider * groupDataProvider) { mGroupDataProvider = groupDataProvider; }
 
+#if CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+    /**
+     * @brief Set the cache used to match the destination identifier of a received Sigma1 with a local fabric
+     *
+     * @param destinationIdCache - Pointer to a cache initialized with the same fabric table and group data provider as
+     *                             this session. If nullptr, the IPKs are looked up in the group data provider for every Sigma1.
+     */
+    void SetDestinationIdCache(CASEDestinationIdCache * destinationIdCache) { mDestinationIdCache = destinationIdCache; }
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+
     /**
      * @brief
      *   Derive a secure session from the established session. The API will return error if called before session is established.
@@ -182,6 +192,8 @@ public:
         kFinishedViaResume   = 7,
         kSendSigma3Pending   = 8,
         kHandleSigma3Pending = 9,
+        kSendSigma2Pending   = 10,
+        kHandleSigma2Pending = 11,
     };
 
     State GetState() { return mState; }
@@ -242,8 +254,8 @@ protected:
     };
     struct ParsedSigma2
     {
-        // Below ByteSpans are Backed by: Sigma2 PacketBuffer passed to the method HandleSigma2()
-        // Lifetime: Valid for the lifetime of the TLVReader, which takes ownership of the Sigma2 PacketBuffer in the HandleSigma2()
+        // Below ByteSpans are Backed by: Sigma2 PacketBuffer passed to the method HandleSigma2a()
+        // Lifetime: Valid for the lifetime of the TLVReader, which takes ownership of the Sigma2 PacketBuffer in the HandleSigma2a()
         // method.
         ByteSpan responderRandom;
         ByteSpan responderEphPubKey;
@@ -290,6 +302,58 @@ protected:
         bool responderSessionParamStructPresent = false;
     };
 
+    struct SendSigma2Data
+    {
+        FabricIndex fabricIndex;
+
+        // Use one or the other
+        const FabricTable * fabricTable;
+        const Crypto::OperationalKeystore * keystore;
+
+        // Generated and used for ECDH in the background, and released with this data: its private key is never exported,
+        // which ECDH-only keys (e.g. with PSA) do not allow. The session keeps a copy of its public key.
+        Crypto::P256Keypair ephemeralKey;
+        Crypto::P256PublicKey initiatorEphPubKey;
+        Crypto::P256ECDHDerivedSecret sharedSecret;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
+        MutableByteSpan msgR2SignedSpan;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> icacBuf;
+        MutableByteSpan icaCert;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> nocBuf;
+        MutableByteSpan nocCert;
+
+        Crypto::P256ECDSASignature tbsData2Signature;
+    };
+
+    struct HandleSigma2Data
+    {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
+        MutableByteSpan msgR2SignedSpan;
+
+        // Below ByteSpans are Backed by: msgR2Signed member of this struct.
+        ByteSpan responderNOC;
+        ByteSpan responderICAC;
+
+        uint8_t rootCertBuf[Credentials::kMaxCHIPCertLength];
+        ByteSpan fabricRCAC;
+
+        Crypto::P256ECDSASignature tbsData2Signature;
+
+        FabricId fabricId;
+        NodeId responderNodeId;
+
+        Credentials::ValidationContext validContext;
+
+        // Applied to the session once the responder identity has been verified.
+        uint16_t responderSessionId;
+        SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        SessionParameters responderSessionParams;
+        bool responderSessionParamStructPresent = false;
+    };
+
     struct SendSigma3Data
     {
         FabricIndex fabricIndex;
@@ -493,13 +557,18 @@ private:
     CHIP_ERROR TryResumeSession(SessionResumptionStorage::ConstResumptionIdView resumptionId, ByteSpan resume1MIC,
                                 ByteSpan initiatorRandom);
 
-    CHIP_ERROR PrepareSigma2(EncodeSigma2Inputs & output);
+    CHIP_ERROR SendSigma2a();
+    static CHIP_ERROR SendSigma2b(SendSigma2Data & data, bool & cancel);
+    CHIP_ERROR SendSigma2c(SendSigma2Data & data, CHIP_ERROR status);
+    CHIP_ERROR PrepareSigma2(SendSigma2Data & data, EncodeSigma2Inputs & output);
     CHIP_ERROR PrepareSigma2Resume(EncodeSigma2ResumeInputs & output);
     CHIP_ERROR SendSigma2(System::PacketBufferHandle && msg_R2);
     CHIP_ERROR SendSigma2Resume(System::PacketBufferHandle && msg_R2_resume);
 
     CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
-    CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2a(System::PacketBufferHandle && msg);
+    static CHIP_ERROR HandleSigma2b(HandleSigma2Data & data, bool & cancel);
+    CHIP_ERROR HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
 
     CHIP_ERROR SendSigma3a();
@@ -514,8 +583,8 @@ private:
     CHIP_ERROR DeriveSigmaKey(const ByteSpan & salt, const ByteSpan & info, AutoReleaseSessionKey & key) const;
     CHIP_ERROR ConstructSaltSigma2(const ByteSpan & rand, const Crypto::P256PublicKey & pubkey, const ByteSpan & ipk,
                                    MutableByteSpan & salt);
-    CHIP_ERROR ConstructTBSData(const ByteSpan & senderNOC, const ByteSpan & senderICAC, const ByteSpan & senderPubKey,
-                                const ByteSpan & receiverPubKey, MutableByteSpan & outTbsData);
+    static CHIP_ERROR ConstructTBSData(const ByteSpan & senderNOC, const ByteSpan & senderICAC, const ByteSpan & senderPubKey,
+                                       const ByteSpan & receiverPubKey, MutableByteSpan & outTbsData);
     CHIP_ERROR ConstructSaltSigma3(const ByteSpan & ipk, MutableByteSpan & salt);
 
     CHIP_ERROR ConstructSigmaResumeKey(const ByteSpan & initiatorRandom, const ByteSpan & resumptionID, const ByteSpan & skInfo,
@@ -557,14 +626,21 @@ private:
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     void SetStopSigmaHandshakeAt(Optional<State> state) { mStopHandshakeAtState = state; }
+    // Makes the pending background work unable to schedule its after work callback, which leaves it to the watchdog.
+    void FailScheduleAfterWorkForTest();
 #endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
 
     Crypto::Hash_SHA256_stream mCommissioningHash;
     Crypto::P256PublicKey mRemotePubKey;
     Crypto::P256Keypair * mEphemeralKey = nullptr;
+    // Public key of the responder's ephemeral keypair, which stays with the Sigma2 background work.
+    Crypto::P256PublicKey mResponderEphPubKey;
     Crypto::P256ECDHDerivedSecret mSharedSecret;
     Credentials::ValidationContext mValidContext;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+#if CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+    CASEDestinationIdCache * mDestinationIdCache = nullptr;
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
 
     uint8_t mMessageDigest[Crypto::kSHA256_Hash_Length];
     uint8_t mIPK[kIPKSize];
@@ -585,6 +661,8 @@ private:
 
     template <class DATA>
     class WorkHelper;
+    Platform::SharedPtr<WorkHelper<SendSigma2Data>> mSendSigma2Helper;
+    Platform::SharedPtr<WorkHelper<HandleSigma2Data>> mHandleSigma2Helper;
     Platform::SharedPtr<WorkHelper<SendSigma3Data>> mSendSigma3Helper;
     Platform::SharedPtr<WorkHelper<HandleSigma3Data>> mHandleSigma3Helper;
 
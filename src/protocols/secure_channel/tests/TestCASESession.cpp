@@ -44,6 +44,7 @@
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <messaging/tests/MessagingContext.h>
+#include <protocols/secure_channel/CASEEphemeralKeypairPool.h>
 #include <protocols/secure_channel/CASEServer.h>
 #include <protocols/secure_channel/CASESession.h>
 
@@ -101,27 +102,39 @@ public:
     }
 
     void ServiceEvents();
+    // Runs the scheduled work, without delivering the messages that it sends.
+    void RunScheduledWork();
+    void StartSigmaHandshake(SessionManager & sessionManager, CASESession & pairingInitiator,
+                             TestCASESecurePairingDelegate & delegateInitiator, CASESession & pairingResponder,
+                             TestCASESecurePairingDelegate & delegateResponder);
     void SecurePairingHandshakeTestCommon(SessionManager & sessionManager, CASESession & pairingCommissioner,
                                           TestCASESecurePairingDelegate & delegateCommissioner);
 
     void SimulateUpdateNOCInvalidatePendingEstablishment();
+    void ClearSessionWithPendingSigma2Work();
+    void Sigma2WorkWatchdogTest();
 };
 
 void TestCASESession::ServiceEvents()
 {
     // Takes a few rounds of this because handling IO messages may schedule work,
-    // and scheduled work may queue messages for sending...
-    for (int i = 0; i < 3; ++i)
+    // and scheduled work may queue messages for sending...  Sigma2, Sigma2 handling
+    // and Sigma3 handling each go through background work before the next message.
+    for (int i = 0; i < 5; ++i)
     {
         DrainAndServiceIO();
-
-        EXPECT_SUCCESS(chip::DeviceLayer::PlatformMgr().ScheduleWork(
-            [](intptr_t) -> void { TEMPORARY_RETURN_IGNORED chip::DeviceLayer::PlatformMgr().StopEventLoopTask(); },
-            (intptr_t) nullptr));
-        chip::DeviceLayer::PlatformMgr().RunEventLoop();
+        RunScheduledWork();
     }
 }
 
+void TestCASESession::RunScheduledWork()
+{
+    EXPECT_SUCCESS(chip::DeviceLayer::PlatformMgr().ScheduleWork(
+        [](intptr_t) -> void { TEMPORARY_RETURN_IGNORED chip::DeviceLayer::PlatformMgr().StopEventLoopTask(); },
+        (intptr_t) nullptr));
+    chip::DeviceLayer::PlatformMgr().RunEventLoop();
+}
+
 class TemporarySessionManager
 {
 public:
@@ -201,6 +214,15 @@ public:
     uint32_t mNumInvalidParamResponse = 0;
 };
 
+// Stands in for the ephemeral keypairs of platforms (e.g. PSA) that can only use them for ECDH: their private key can be
+// neither exported nor imported.
+class NonExportableP256Keypair : public Crypto::P256Keypair
+{
+public:
+    CHIP_ERROR Serialize(Crypto::P256SerializedKeypair & output) const override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR Deserialize(Crypto::P256SerializedKeypair & input) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+};
+
 class TestOperationalKeystore : public chip::Crypto::OperationalKeystore
 {
 public:
@@ -215,6 +237,15 @@ public:
         mKeypair           = nullptr;
     }
 
+    // Restores the default behavior after a test changed it.
+    void ResetForTest()
+    {
+        mSignInBackground               = false;
+        mSignError                      = CHIP_NO_ERROR;
+        mCorruptSignatures              = false;
+        mNonExportableEphemeralKeypairs = false;
+    }
+
     bool HasPendingOpKeypair() const override { return false; }
     bool HasOpKeypairForFabric(FabricIndex fabricIndex) const override { return mSingleFabricIndex != kUndefinedFabricIndex; }
 
@@ -238,13 +269,33 @@ public:
     {
         VerifyOrReturnError(mKeypair != nullptr, CHIP_ERROR_INCORRECT_STATE);
         VerifyOrReturnError(fabricIndex == mSingleFabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
-        return mKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+        ReturnErrorOnFailure(mSignError);
+        ReturnErrorOnFailure(mKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature));
+        if (mCorruptSignatures)
+        {
+            outSignature.Bytes()[0] ^= 0xFF;
+        }
+        return CHIP_NO_ERROR;
     }
 
-    Crypto::P256Keypair * AllocateEphemeralKeypairForCASE() override { return Platform::New<Crypto::P256Keypair>(); }
+    bool SupportsSignWithOpKeypairInBackground() const override { return mSignInBackground; }
+
+    Crypto::P256Keypair * AllocateEphemeralKeypairForCASE() override
+    {
+        if (mNonExportableEphemeralKeypairs)
+        {
+            return Platform::New<NonExportableP256Keypair>();
+        }
+        return Platform::New<Crypto::P256Keypair>();
+    }
 
     void ReleaseEphemeralKeypair(Crypto::P256Keypair * keypair) override { Platform::Delete<Crypto::P256Keypair>(keypair); }
 
+    bool mSignInBackground               = false;
+    CHIP_ERROR mSignError                = CHIP_NO_ERROR;
+    bool mCorruptSignatures              = false;
+    bool mNonExportableEphemeralKeypairs = false;
+
 protected:
     Platform::UniquePtr<P256Keypair> mKeypair;
     FabricIndex mSingleFabricIndex = kUndefinedFabricIndex;
@@ -643,6 +694,86 @@ TEST_F(TestCASESession, ClientReceivesBusyTest)
     gPairingServer.Shutdown();
 }
 
+void TestCASESession::StartSigmaHandshake(SessionManager & sessionManager, CASESession & pairingInitiator,
+                                          TestCASESecurePairingDelegate & delegateInitiator, CASESession & pairingResponder,
+                                          TestCASESecurePairingDelegate & delegateResponder)
+{
+    pairingInitiator.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    ExchangeContext * contextInitiator = NewUnauthenticatedExchangeToBob(&pairingInitiator);
+
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                            &pairingResponder),
+              CHIP_NO_ERROR);
+    pairingResponder.SetGroupDataProvider(&gDeviceGroupDataProvider);
+
+    EXPECT_SUCCESS(pairingResponder.PrepareForSessionEstablishment(sessionManager, &gDeviceFabrics, nullptr, nullptr,
+                                                                   &delegateResponder, ScopedNodeId(),
+                                                                   Optional<ReliableMessageProtocolConfig>::Missing()));
+    EXPECT_SUCCESS(pairingInitiator.EstablishSession(
+        sessionManager, &gCommissionerFabrics, ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextInitiator, nullptr,
+        nullptr, &delegateInitiator, Optional<ReliableMessageProtocolConfig>::Missing()));
+}
+
+TEST_F(TestCASESession, NonExportableEphemeralKeypairTest)
+{
+    // The handshake must only ever use an ephemeral keypair where it was generated, never copy it into another one.
+    gDeviceOperationalKeystore.mNonExportableEphemeralKeypairs = true;
+
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
+
+    gDeviceOperationalKeystore.ResetForTest();
+}
+
+/* This tests that a failure in the background work of either side of Sigma2 makes that side send a status report and abort.
+    Test will be repeated twice; by failing the Sigma2 signature (SendSigma2b) and by corrupting it (HandleSigma2b) */
+TEST_F(TestCASESession, Sigma2BackgroundWorkFailsCASE)
+{
+    for (bool failSigning : { true, false })
+    {
+        TemporarySessionManager sessionManager(*this);
+        TestCASESecurePairingDelegate delegateInitiator;
+        TestCASESecurePairingDelegate delegateResponder;
+        CASESession pairingInitiator;
+        CASESession pairingResponder;
+
+        gDeviceOperationalKeystore.mSignInBackground = true;
+        if (failSigning)
+        {
+            gDeviceOperationalKeystore.mSignError = CHIP_ERROR_INTERNAL;
+        }
+        else
+        {
+            gDeviceOperationalKeystore.mCorruptSignatures = true;
+        }
+
+        StartSigmaHandshake(sessionManager, pairingInitiator, delegateInitiator, pairingResponder, delegateResponder);
+        ServiceEvents();
+
+        EXPECT_EQ(delegateResponder.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateInitiator.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateResponder.mNumPairingErrors, 1u);
+        EXPECT_EQ(delegateInitiator.mNumPairingErrors, 1u);
+
+        // The status report comes from the side whose background work failed.
+        if (failSigning)
+        {
+            EXPECT_EQ(delegateInitiator.mNumInvalidParamResponse, 1u);
+            EXPECT_EQ(delegateResponder.mNumInvalidParamResponse, 0u);
+        }
+        else
+        {
+            EXPECT_EQ(delegateInitiator.mNumInvalidParamResponse, 0u);
+            EXPECT_EQ(delegateResponder.mNumInvalidParamResponse, 1u);
+        }
+
+        gDeviceOperationalKeystore.ResetForTest();
+    }
+}
+
 #if CHIP_WITH_NLFAULTINJECTION
 
 /* This tests that Corrupting Signature during a CASE Handshake will lead to CASE Failing and to the Correct Error returned.
@@ -777,6 +908,175 @@ TEST_F(TestCASESession, DestinationIdTest)
     EXPECT_FALSE(destinationIdSpan.data_equal(ByteSpan(kExpectedDestinationIdFromSpec)));
 }
 
+#if CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+TEST_F(TestCASESession, DestinationIdCacheTest)
+{
+    const FabricInfo * fabricInfo = gDeviceFabrics.FindFabricWithIndex(gDeviceFabricIndex);
+    ASSERT_NE(fabricInfo, nullptr);
+
+    Crypto::P256PublicKey rootPubKey;
+    ASSERT_EQ(gDeviceFabrics.FetchRootPubkey(gDeviceFabricIndex, rootPubKey), CHIP_NO_ERROR);
+    Credentials::P256PublicKeySpan rootPubKeySpan{ rootPubKey.ConstBytes() };
+
+    uint8_t initiatorRandom[kSigmaParamRandomNumberSize] = { 0x7e, 0x17, 0x12 };
+
+    // Gets the IPK at keyIdx from the group data provider and the destination identifier it gives.
+    auto generateDestinationId = [&](size_t keyIdx, uint8_t (&ipk)[kIPKSize], uint8_t (&destinationId)[kSHA256_Hash_Length]) {
+        GroupDataProvider::KeySet ipkKeySet;
+        ASSERT_EQ(gDeviceGroupDataProvider.GetIpkKeySet(gDeviceFabricIndex, ipkKeySet), CHIP_NO_ERROR);
+        ASSERT_LT(keyIdx, ipkKeySet.num_keys_used);
+        memcpy(ipk, ipkKeySet.epoch_keys[keyIdx].key, kIPKSize);
+
+        MutableByteSpan destinationIdSpan(destinationId);
+        EXPECT_EQ(GenerateCaseDestinationId(ByteSpan(ipk), ByteSpan(initiatorRandom), rootPubKeySpan, fabricInfo->GetFabricId(),
+                                            fabricInfo->GetNodeId(), destinationIdSpan),
+                  CHIP_NO_ERROR);
+    };
+
+    uint8_t ipks[2][kIPKSize];
+    uint8_t destinationIds[2][kSHA256_Hash_Length];
+    generateDestinationId(0, ipks[0], destinationIds[0]);
+
+    CASEDestinationIdCache cache;
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    NodeId nodeId           = kUndefinedNodeId;
+    uint8_t ipk[kIPKSize];
+    MutableByteSpan ipkSpan(ipk);
+
+    EXPECT_EQ(cache.FindLocalNode(ByteSpan(destinationIds[0]), ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan),
+              CHIP_ERROR_INCORRECT_STATE);
+    ASSERT_EQ(cache.Init(&gDeviceFabrics, &gDeviceGroupDataProvider), CHIP_NO_ERROR);
+
+    // Twice, the second time from the cached keys.
+    for (int i = 0; i < 2; i++)
+    {
+        ipkSpan = MutableByteSpan(ipk);
+        EXPECT_EQ(cache.FindLocalNode(ByteSpan(destinationIds[0]), ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(fabricIndex, gDeviceFabricIndex);
+        EXPECT_EQ(nodeId, fabricInfo->GetNodeId());
+        EXPECT_TRUE(ipkSpan.data_equal(ByteSpan(ipks[0])));
+    }
+
+    // Another initiator random does not match.
+    initiatorRandom[0] ^= 1;
+    EXPECT_EQ(cache.FindLocalNode(ByteSpan(destinationIds[0]), ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan),
+              CHIP_ERROR_KEY_NOT_FOUND);
+    initiatorRandom[0] ^= 1;
+
+    // Keys added to the group data provider are only seen once the cache is invalidated.
+    ASSERT_EQ(InitTestIpk(gDeviceGroupDataProvider, *fabricInfo, /* numIpks= */ 2), CHIP_NO_ERROR);
+    generateDestinationId(1, ipks[1], destinationIds[1]);
+    EXPECT_EQ(cache.FindLocalNode(ByteSpan(destinationIds[1]), ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan),
+              CHIP_ERROR_KEY_NOT_FOUND);
+    cache.Invalidate();
+    ipkSpan = MutableByteSpan(ipk);
+    EXPECT_EQ(cache.FindLocalNode(ByteSpan(destinationIds[1]), ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan),
+              CHIP_NO_ERROR);
+    EXPECT_TRUE(ipkSpan.data_equal(ByteSpan(ipks[1])));
+
+    // A fabric update notification reloads the fabric.
+    ASSERT_EQ(InitTestIpk(gDeviceGroupDataProvider, *fabricInfo, /* numIpks= */ 1), CHIP_NO_ERROR);
+    gDeviceFabrics.SendUpdateFabricNotificationForTest(gDeviceFabricIndex);
+    EXPECT_EQ(cache.FindLocalNode(ByteSpan(destinationIds[1]), ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan),
+              CHIP_ERROR_KEY_NOT_FOUND);
+
+    cache.Shutdown();
+    EXPECT_EQ(cache.FindLocalNode(ByteSpan(destinationIds[0]), ByteSpan(initiatorRandom), fabricIndex, nodeId, ipkSpan),
+              CHIP_ERROR_INCORRECT_STATE);
+}
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE
+
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+TEST_F(TestCASESession, EphemeralKeypairPoolTest)
+{
+    constexpr size_t kCapacity = CASEEphemeralKeypairPool::kCapacity;
+    auto & pool                = CASEEphemeralKeypairPool::Instance();
+
+    // The pool is refilled one keypair per background work item.
+    auto fillPool = [&]() {
+        for (size_t i = 0; i < 2 * kCapacity && pool.GetAvailableCount() < kCapacity; i++)
+        {
+            ServiceEvents();
+        }
+    };
+
+    ASSERT_EQ(pool.Init(), CHIP_NO_ERROR);
+    pool.ResetStats();
+    fillPool();
+    EXPECT_EQ(pool.GetAvailableCount(), kCapacity);
+
+    // Both sides of a handshake take their ephemeral keypair from the pool.
+    {
+        TemporarySessionManager sessionManager(*this);
+        TestCASESecurePairingDelegate delegateCommissioner;
+        CASESession pairingCommissioner;
+        pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+        SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
+    }
+
+    CASEEphemeralKeypairPool::Stats stats = pool.GetStats();
+    EXPECT_EQ(stats.taken, 2u);
+    EXPECT_EQ(stats.missed, 0u);
+
+    // The two keypairs taken were replaced, whether or not that already happened during the handshake.
+    fillPool();
+    EXPECT_EQ(pool.GetAvailableCount(), kCapacity);
+    EXPECT_EQ(pool.GetStats().generated, kCapacity + 2);
+
+    // Pooled keypairs are usable for ECDH, and never handed out twice.
+    P256Keypair keypairs[2];
+    ASSERT_EQ(pool.TakeKeypair(keypairs[0]), CHIP_NO_ERROR);
+    ASSERT_EQ(pool.TakeKeypair(keypairs[1]), CHIP_NO_ERROR);
+    EXPECT_NE(memcmp(keypairs[0].Pubkey().ConstBytes(), keypairs[1].Pubkey().ConstBytes(), kP256_PublicKey_Length), 0);
+
+    P256ECDHDerivedSecret secrets[2];
+    EXPECT_EQ(keypairs[0].ECDH_derive_secret(keypairs[1].Pubkey(), secrets[0]), CHIP_NO_ERROR);
+    EXPECT_EQ(keypairs[1].ECDH_derive_secret(keypairs[0].Pubkey(), secrets[1]), CHIP_NO_ERROR);
+    EXPECT_TRUE(secrets[0].Span().data_equal(secrets[1].Span()));
+
+    // An empty pool counts misses, and hands out nothing once its last user is gone.
+    P256Keypair keypair;
+    while (pool.TakeKeypair(keypair) == CHIP_NO_ERROR)
+    {
+    }
+    EXPECT_EQ(pool.GetStats().missed, 1u);
+
+    pool.Shutdown();
+    EXPECT_EQ(pool.GetAvailableCount(), 0u);
+    EXPECT_EQ(pool.TakeKeypair(keypair), CHIP_ERROR_INCORRECT_STATE);
+    ServiceEvents();
+}
+
+TEST_F(TestCASESession, CASEServerEphemeralKeypairPoolTest)
+{
+    auto & pool = CASEEphemeralKeypairPool::Instance();
+    P256Keypair keypair;
+
+    // Listening again does not register the server with the pool a second time, so one Shutdown() releases it.
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(gPairingServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gDeviceFabrics,
+                                                               nullptr, nullptr, &gDeviceGroupDataProvider),
+                  CHIP_NO_ERROR);
+    }
+    ServiceEvents();
+    EXPECT_EQ(pool.TakeKeypair(keypair), CHIP_NO_ERROR);
+
+    gPairingServer.Shutdown();
+    EXPECT_EQ(pool.TakeKeypair(keypair), CHIP_ERROR_INCORRECT_STATE);
+
+    // Shutting the server down again does not release a registration that belongs to another user.
+    ASSERT_EQ(pool.Init(), CHIP_NO_ERROR);
+    gPairingServer.Shutdown();
+    ServiceEvents();
+    EXPECT_EQ(pool.TakeKeypair(keypair), CHIP_NO_ERROR);
+
+    pool.Shutdown();
+    ServiceEvents();
+}
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+
 template <typename Params>
 static CHIP_ERROR EncodeSigma1Helper(MutableByteSpan & buf)
 {
@@ -1826,6 +2126,124 @@ TEST_F_FROM_FIXTURE(TestCASESession, SimulateUpdateNOCInvalidatePendingEstablish
     EXPECT_EQ(delegateAccessory.mNumPairingComplete, 0u);
     EXPECT_EQ(delegateCommissioner.mNumPairingComplete, 0u);
 }
+
+TEST_F_FROM_FIXTURE(TestCASESession, ClearSessionWithPendingSigma2Work)
+{
+    TemporarySessionManager sessionManager(*this);
+
+    // The responder is cleared while it prepares Sigma2 in the background.
+    {
+        TestCASESecurePairingDelegate delegateInitiator;
+        TestCASESecurePairingDelegate delegateResponder;
+        CASESession pairingInitiator;
+        CASESession pairingResponder;
+
+        StartSigmaHandshake(sessionManager, pairingInitiator, delegateInitiator, pairingResponder, delegateResponder);
+        DrainAndServiceIO();
+        ASSERT_TRUE(pairingResponder.mSendSigma2Helper);
+
+        pairingResponder.Clear();
+        EXPECT_FALSE(pairingResponder.mSendSigma2Helper);
+        ServiceEvents();
+
+        // The cancelled work neither sends Sigma2 nor touches the session.
+        EXPECT_EQ(pairingInitiator.mState, CASESession::State::kSentSigma1);
+        EXPECT_EQ(pairingResponder.mState, CASESession::State::kInitialized);
+        EXPECT_EQ(delegateResponder.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateResponder.mNumPairingErrors, 0u);
+        EXPECT_EQ(delegateInitiator.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateInitiator.mNumPairingErrors, 0u);
+    }
+
+    // The initiator is cleared while it validates Sigma2 in the background.
+    {
+        TestCASESecurePairingDelegate delegateInitiator;
+        TestCASESecurePairingDelegate delegateResponder;
+        CASESession pairingInitiator;
+        CASESession pairingResponder;
+
+        StartSigmaHandshake(sessionManager, pairingInitiator, delegateInitiator, pairingResponder, delegateResponder);
+        DrainAndServiceIO();
+        RunScheduledWork();
+        DrainAndServiceIO();
+        ASSERT_TRUE(pairingInitiator.mHandleSigma2Helper);
+
+        pairingInitiator.Clear();
+        EXPECT_FALSE(pairingInitiator.mHandleSigma2Helper);
+        ServiceEvents();
+
+        // The cancelled work neither sends Sigma3 nor touches the session.
+        EXPECT_EQ(pairingInitiator.mState, CASESession::State::kInitialized);
+        EXPECT_EQ(pairingResponder.mState, CASESession::State::kSentSigma2);
+        EXPECT_EQ(delegateResponder.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateResponder.mNumPairingErrors, 0u);
+        EXPECT_EQ(delegateInitiator.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateInitiator.mNumPairingErrors, 0u);
+    }
+}
+
+TEST_F_FROM_FIXTURE(TestCASESession, Sigma2WorkWatchdogTest)
+{
+    TemporarySessionManager sessionManager(*this);
+
+    // The responder's Sigma2 work is unable to hand its result back to the Matter thread.
+    {
+        TestCASESecurePairingDelegate delegateInitiator;
+        TestCASESecurePairingDelegate delegateResponder;
+        CASESession pairingInitiator;
+        CASESession pairingResponder;
+
+        StartSigmaHandshake(sessionManager, pairingInitiator, delegateInitiator, pairingResponder, delegateResponder);
+        DrainAndServiceIO();
+        ASSERT_TRUE(pairingResponder.mSendSigma2Helper);
+
+        pairingResponder.FailScheduleAfterWorkForTest();
+        RunScheduledWork();
+        EXPECT_TRUE(pairingResponder.mSendSigma2Helper);
+
+        // The watchdog finishes the work on the Matter thread, which aborts the handshake with a status report.
+        EXPECT_TRUE(pairingResponder.InvokeBackgroundWorkWatchdog());
+        EXPECT_FALSE(pairingResponder.mSendSigma2Helper);
+        EXPECT_FALSE(pairingResponder.InvokeBackgroundWorkWatchdog());
+        ServiceEvents();
+
+        EXPECT_EQ(delegateResponder.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateResponder.mNumPairingErrors, 1u);
+        EXPECT_EQ(delegateInitiator.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateInitiator.mNumPairingErrors, 1u);
+        EXPECT_EQ(delegateInitiator.mNumInvalidParamResponse, 1u);
+    }
+
+    // The initiator's Sigma2 work is unable to hand its result back to the Matter thread.
+    {
+        TestCASESecurePairingDelegate delegateInitiator;
+        TestCASESecurePairingDelegate delegateResponder;
+        CASESession pairingInitiator;
+        CASESession pairingResponder;
+
+        StartSigmaHandshake(sessionManager, pairingInitiator, delegateInitiator, pairingResponder, delegateResponder);
+        DrainAndServiceIO();
+        RunScheduledWork();
+        DrainAndServiceIO();
+        ASSERT_TRUE(pairingInitiator.mHandleSigma2Helper);
+
+        pairingInitiator.FailScheduleAfterWorkForTest();
+        RunScheduledWork();
+        EXPECT_TRUE(pairingInitiator.mHandleSigma2Helper);
+
+        // The watchdog finishes the work on the Matter thread, which aborts the handshake with a status report.
+        EXPECT_TRUE(pairingInitiator.InvokeBackgroundWorkWatchdog());
+        EXPECT_FALSE(pairingInitiator.mHandleSigma2Helper);
+        EXPECT_FALSE(pairingInitiator.InvokeBackgroundWorkWatchdog());
+        ServiceEvents();
+
+        EXPECT_EQ(delegateResponder.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateResponder.mNumPairingErrors, 1u);
+        EXPECT_EQ(delegateResponder.mNumInvalidParamResponse, 1u);
+        EXPECT_EQ(delegateInitiator.mNumPairingComplete, 0u);
+        EXPECT_EQ(delegateInitiator.mNumPairingErrors, 1u);
+    }
+}
 #endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
 
 class ExpectErrorExchangeDelegate : public ExchangeDelegate
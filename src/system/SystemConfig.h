@@ -394,6 +394,36 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+ *
+ *  @brief
+ *      When packet buffers are allocated using malloc (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0), this selects whether
+ *      allocations are rounded up to a size class (1) or made with their exact size (0).
+ *
+ *      With size classes, released buffers are kept on a free list of their class, up to
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_FREE_LIMIT buffers per class, and reused by the next allocations of that
+ *      class instead of going back to malloc. Each thread has its own free lists.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+#ifdef __linux__
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES 1
+#else
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES 0
+#endif
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_FREE_LIMIT
+ *
+ *  @brief
+ *      The largest number of released packet buffers kept by each thread on the free list of each size class, when
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES is enabled.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_FREE_LIMIT
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_FREE_LIMIT 32
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_FREE_LIMIT */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -854,3 +884,15 @@ struct LwIPEvent;
 #ifndef CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES
 #define CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES (64000)
 #endif
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+ *
+ *  @brief
+ *      Maximum number of ready file descriptors collected by a single epoll_wait() call.
+ *      Descriptors that are still ready beyond this limit are reported on the next
+ *      iteration of the event loop.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+#define CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS 64
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
@@ -0,0 +1,547 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll(7) and timerfd.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+constexpr Clock::Seconds64 kDefaultMinSleepPeriod = Clock::Seconds64(60 * 60 * 24 * 30); // Month [sec]
+
+CriticalFailure LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    mEventCount    = 0;
+    mWaitTimeoutMs = -1;
+
+    // Create an event to allow an arbitrary thread to wake the thread in the epoll loop.
+    ReturnErrorOnFailure(mWakeEvent.Open());
+
+    CHIP_ERROR err           = CHIP_NO_ERROR;
+    struct epoll_event event = {};
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    mTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrExit(mTimerFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    event.events   = EPOLLIN;
+    event.data.ptr = &mTimerFd;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &event) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    event.events   = EPOLLIN;
+    event.data.ptr = &mWakeEvent;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mWakeEvent.GetReadFD(), &event) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+
+exit:
+    if (mTimerFd >= 0)
+    {
+        close(mTimerFd);
+        mTimerFd = -1;
+    }
+    if (mEpollFd >= 0)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+    mWakeEvent.Close();
+    return err;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.SetShuttingDown());
+
+    // Watches left behind by clients refer to descriptors that the clients own; only forget about them.
+    mSocketWatchPool.ReleaseAll();
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+    mWakeEvent.Close();
+
+    close(mTimerFd);
+    mTimerFd = -1;
+    close(mEpollFd);
+    mEpollFd = -1;
+
+    mEventCount = 0;
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by setting the wake event.
+     *
+     * If this is being called from within an I/O event callback, then this can be skipped,
+     * since the I/O thread is already awake.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Send notification to wake up the epoll_wait call.
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CriticalFailure LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(delay.count() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    assertChipStackLockedByCurrentThread();
+
+    Clock::Timeout remainingTime = mTimerList.GetRemainingTime(onComplete, appState);
+    if (remainingTime.count() < delay.count())
+    {
+        // Just call StartTimer; it will invoke CancelTimer(), then start a new timer.
+        return StartTimer(delay, onComplete, appState);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool LayerImplEpoll::IsTimerActive(TimerCompleteCallback onComplete, void * appState)
+{
+    bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
+
+    if (!timerIsActive)
+    {
+        // check if the timer is in the mExpiredTimers list about to be fired.
+        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
+        {
+            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
+            {
+                return true;
+            }
+        }
+    }
+
+    return timerIsActive;
+}
+
+Clock::Timeout LayerImplEpoll::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
+{
+    return mTimerList.GetRemainingTime(onComplete, appState);
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    if (timer == nullptr)
+    {
+        // The timer might be in the chunk of expired timers currently being fired.
+        timer = mExpiredTimers.Remove(onComplete, appState);
+    }
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CriticalFailure LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // As in LayerImplSelect, use an expires-ASAP timer as a closure capturing `this`, onComplete and appState,
+    // and do not cancel existing timers with the same callback so ScheduleWork invocations don't stomp on each other.
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = nullptr;
+    mSocketWatchPool.ForEachActiveObject([&](SocketWatch * w) {
+        if (w->mFD == fd)
+        {
+            watch = w;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+
+    if (watch == nullptr)
+    {
+        // The descriptor is added to the epoll set lazily, once a callback is requested, so that hang-up
+        // conditions on a socket nobody is listening to do not keep waking the loop.
+        watch = mSocketWatchPool.CreateObject(fd);
+        VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+    }
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateEpollInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateEpollInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateEpollInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateEpollInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    VerifyOrReturnError(tokenInOut != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mEpollEvents != 0)
+    {
+        // The descriptor is still open at this point (see LayerSockets::StopWatchingSocket), so the
+        // removal cannot fail in a way we could act upon.
+        (void) epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+    }
+
+    // The watch may be referenced by events that HandleEvents() has not dispatched yet.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (mEvents[i].data.ptr == watch)
+        {
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+    mSocketWatchPool.ReleaseObject(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateEpollInterest(SocketWatch & watch)
+{
+    struct epoll_event event = {};
+    if (watch.mPendingIO.Has(SocketEventFlags::kRead))
+    {
+        event.events |= EPOLLIN;
+    }
+    if (watch.mPendingIO.Has(SocketEventFlags::kWrite))
+    {
+        event.events |= EPOLLOUT;
+    }
+    event.data.ptr = &watch;
+
+    VerifyOrReturnError(event.events != watch.mEpollEvents, CHIP_NO_ERROR);
+
+    int op;
+    if (watch.mEpollEvents == 0)
+    {
+        op = EPOLL_CTL_ADD;
+    }
+    else if (event.events == 0)
+    {
+        op = EPOLL_CTL_DEL;
+    }
+    else
+    {
+        op = EPOLL_CTL_MOD;
+    }
+
+    VerifyOrReturnError(epoll_ctl(mEpollFd, op, watch.mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+    watch.mEpollEvents = event.events;
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Translate the events reported by epoll_wait() for a watched socket into SocketEvents.
+ *
+ *  Error and hang-up conditions are reported as readiness for whichever operations were requested,
+ *  matching the way select() marks such descriptors as readable and writable.
+ */
+SocketEvents LayerImplEpoll::SocketEventsFromEpoll(const SocketWatch & watch, uint32_t events)
+{
+    SocketEvents res;
+
+    const bool failed = (events & (EPOLLERR | EPOLLHUP)) != 0;
+    if (watch.mPendingIO.Has(SocketEventFlags::kRead) && (failed || (events & EPOLLIN) != 0))
+    {
+        res.Set(SocketEventFlags::kRead);
+    }
+    if (watch.mPendingIO.Has(SocketEventFlags::kWrite) && (failed || (events & EPOLLOUT) != 0))
+    {
+        res.Set(SocketEventFlags::kWrite);
+    }
+
+    return res;
+}
+
+enum : intptr_t
+{
+    kLoopHandlerInactive = 0, // default value for EventLoopHandler::mState
+    kLoopHandlerPending,
+    kLoopHandlerActive,
+};
+
+void LayerImplEpoll::AddLoopHandler(EventLoopHandler & handler)
+{
+    // Add the handler as pending because this method can be called at any point
+    // in a PrepareEvents() / WaitForEvents() / HandleEvents() sequence.
+    // It will be marked active when we call PrepareEvents() on it for the first time.
+    auto & state = LoopHandlerState(handler);
+    VerifyOrDie(state == kLoopHandlerInactive);
+    state = kLoopHandlerPending;
+    mLoopHandlers.PushBack(&handler);
+}
+
+void LayerImplEpoll::RemoveLoopHandler(EventLoopHandler & handler)
+{
+    mLoopHandlers.Remove(&handler);
+    LoopHandlerState(handler) = kLoopHandlerInactive;
+}
+
+void LayerImplEpoll::ArmTimerFd(Clock::Timeout timeout)
+{
+    struct itimerspec spec = {};
+    // A zero it_value disarms the timer; WaitForEvents() does not block in that case anyway.
+    spec.it_value.tv_sec  = static_cast<time_t>(timeout.count() / kMillisecondsPerSecond);
+    spec.it_value.tv_nsec = static_cast<long>((timeout.count() % kMillisecondsPerSecond) * kNanosecondsPerMillisecond);
+
+    if (timerfd_settime(mTimerFd, 0, &spec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+    }
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer)
+    {
+        awakenTime = std::min(awakenTime, timer->AwakenTime());
+    }
+
+    // Activate added EventLoopHandlers and call PrepareEvents on active handlers.
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        switch (auto & state = LoopHandlerState(loop))
+        {
+        case kLoopHandlerPending:
+            state = kLoopHandlerActive;
+            [[fallthrough]];
+        case kLoopHandlerActive:
+            awakenTime = std::min(awakenTime, loop.PrepareEvents(currentTime));
+            break;
+        }
+    }
+
+    const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+    ArmTimerFd(std::chrono::duration_cast<Clock::Milliseconds32>(sleepTime));
+    mWaitTimeoutMs = (sleepTime == Clock::kZero) ? 0 : -1;
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mEventCount = epoll_wait(mEpollFd, mEvents, CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS, mWaitTimeoutMs);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        mEventCount = 0;
+        VerifyOrReturn(errno != EINTR); // EINTR is not really an error (and we don't use it for signal handling)
+        ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+    // Only the descriptors that are actually ready are visited. Callbacks may stop watching sockets whose
+    // events are still pending in mEvents; StopWatchingSocket() clears those entries.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        void * const source = mEvents[i].data.ptr;
+        if (source == &mWakeEvent)
+        {
+            mWakeEvent.Confirm();
+        }
+        else if (source == &mTimerFd)
+        {
+            uint64_t expirations;
+            (void) read(mTimerFd, &expirations, sizeof(expirations));
+        }
+        else if (source != nullptr)
+        {
+            SocketWatch * watch = static_cast<SocketWatch *>(source);
+            if (watch->mCallback != nullptr)
+            {
+                SocketEvents events = SocketEventsFromEpoll(*watch, mEvents[i].events);
+                if (events.HasAny())
+                {
+                    watch->mCallback(events, watch->mCallbackData);
+                }
+            }
+        }
+    }
+    mEventCount = 0;
+
+    // Call HandleEvents for active loop handlers
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        if (LoopHandlerState(loop) == kLoopHandlerActive)
+        {
+            loop.HandleEvents();
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux epoll(7).
+ *
+ *      Unlike LayerImplSelect, the cost of a wakeup is proportional to the number of
+ *      ready file descriptors rather than the number of watched ones, and the number
+ *      of watched descriptors is not limited by FD_SETSIZE.
+ */
+
+#pragma once
+
+#include "system/SystemConfig.h"
+
+#if !CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_LIBEV
+#error "LayerImplEpoll requires CHIP_SYSTEM_CONFIG_USE_SOCKETS and is not compatible with CHIP_SYSTEM_CONFIG_USE_LIBEV"
+#endif
+
+#include <sys/epoll.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/ObjectLifeCycle.h>
+#include <lib/support/Pool.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/WakeEvent.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * System::Layer implementation based on epoll(7), selected with `chip_system_config_event_loop = "Epoll"`.
+ *
+ * Socket watches are registered with the kernel only while a read or write callback is requested, using
+ * level-triggered notification so that the SocketWatch contract (one callback per iteration while the
+ * condition holds) is identical to LayerImplSelect. Timer deadlines and EventLoopHandler wake times are
+ * programmed into a timerfd that is part of the same epoll set.
+ *
+ * LayerImplSelect::EventSource is fd_set based and is therefore not supported by this implementation.
+ */
+class LayerImplEpoll : public LayerSelectLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() override { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CriticalFailure Init() override;
+    void Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CriticalFailure StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    bool IsTimerActive(TimerCompleteCallback onComplete, void * appState) override;
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CriticalFailure ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSelectLoop overrides.
+    void Signal() override;
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+    void AddLoopHandler(EventLoopHandler & handler) override;
+    void RemoveLoopHandler(EventLoopHandler & handler) override;
+
+    // Expose the result of WaitForEvents() for non-blocking socket implementations.
+    bool IsSelectResultValid() const { return mEventCount >= 0; }
+
+protected:
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0);
+
+    struct SocketWatch
+    {
+        SocketWatch(int fd) : mFD(fd) {}
+
+        int mFD;
+        SocketEvents mPendingIO;
+        // Events currently registered with the epoll instance; 0 if the descriptor is not in the epoll set.
+        uint32_t mEpollEvents         = 0;
+        SocketWatchCallback mCallback = nullptr;
+        intptr_t mCallbackData        = 0;
+    };
+
+    static SocketEvents SocketEventsFromEpoll(const SocketWatch & watch, uint32_t events);
+
+    CHIP_ERROR UpdateEpollInterest(SocketWatch & watch);
+    void ArmTimerFd(Clock::Timeout timeout);
+
+    ObjectPool<SocketWatch, kSocketWatchMax> mSocketWatchPool;
+
+    TimerPool<TimerList::Node> mTimerPool;
+    TimerList mTimerList;
+    // List of expired timers being processed right now.  Stored in a member so
+    // we can cancel them.
+    TimerList mExpiredTimers;
+
+    IntrusiveList<EventLoopHandler> mLoopHandlers;
+
+    int mEpollFd = -1;
+    int mTimerFd = -1;
+
+    // Timeout passed to epoll_wait(): 0 when work is already due, -1 when the timerfd carries the deadline.
+    int mWaitTimeoutMs = -1;
+
+    // Results of epoll_wait(), carried between WaitForEvents() and HandleEvents().
+    struct epoll_event mEvents[CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS];
+    int mEventCount = 0;
+
+    ObjectLifeCycle mLayerState;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleSelectThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    WakeEvent mWakeEvent;
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
@@ -123,6 +123,148 @@ void PacketBuffer::InternalCheck(const PacketBuffer * buffer)
 }
 #endif // CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+//
+// Size classes for heap allocation of PacketBuffer objects.
+//
+
+static_assert(PacketBuffer::kSizeClassAllocSizes[PacketBuffer::kNumSizeClasses - 2] < PacketBuffer::kMaxSizeWithoutReserve,
+              "CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX is too small for the packet buffer size classes");
+
+namespace {
+
+// Released blocks of each size class, linked through their first bytes.
+//
+// Each thread keeps its own free lists, so that allocating and releasing a buffer takes no lock; a buffer released on another
+// thread than the one that allocated it joins the lists of the releasing thread. The blocks are taken from malloc directly rather
+// than from Platform::MemoryAlloc, since a thread's lists are only released when it exits, which for the main thread is after
+// Platform::MemoryShutdown().
+class SizeClassFreeLists
+{
+public:
+    ~SizeClassFreeLists()
+    {
+        for (FreeBlock * block : mHeads)
+        {
+            while (block != nullptr)
+            {
+                FreeBlock * next = block->next;
+                free(block);
+                block = next;
+            }
+        }
+    }
+
+    void * Take(size_t sizeClass)
+    {
+        FreeBlock * block = mHeads[sizeClass];
+        if (block != nullptr)
+        {
+            mHeads[sizeClass] = block->next;
+            mLengths[sizeClass]--;
+        }
+        return block;
+    }
+
+    // Returns false if the free list is full, in which case the caller frees the block.
+    bool Put(size_t sizeClass, void * memory)
+    {
+        VerifyOrReturnValue(mLengths[sizeClass] < CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_FREE_LIMIT, false);
+        FreeBlock * block = static_cast<FreeBlock *>(memory);
+        block->next       = mHeads[sizeClass];
+        mHeads[sizeClass] = block;
+        mLengths[sizeClass]++;
+        return true;
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock * next;
+    };
+
+    FreeBlock * mHeads[PacketBuffer::kNumSizeClasses] = {};
+    size_t mLengths[PacketBuffer::kNumSizeClasses]    = {};
+};
+
+thread_local SizeClassFreeLists sSizeClassFreeLists;
+
+// Returns the smallest size class for buffers of aAllocSize bytes, or kNumSizeClasses if they are larger than all classes.
+size_t SizeClassFor(size_t aAllocSize)
+{
+    size_t sizeClass = 0;
+    while (sizeClass < PacketBuffer::kNumSizeClasses && PacketBuffer::kSizeClassAllocSizes[sizeClass] < aAllocSize)
+    {
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+} // namespace
+
+size_t PacketBuffer::BlockAllocSize(size_t aAllocSize)
+{
+    const size_t sizeClass = SizeClassFor(aAllocSize);
+    return (sizeClass < kNumSizeClasses) ? kSizeClassAllocSizes[sizeClass] : aAllocSize;
+}
+
+PacketBuffer * PacketBuffer::AllocateBlock(size_t aBlockAllocSize)
+{
+    const size_t sizeClass = SizeClassFor(aBlockAllocSize);
+    void * block           = nullptr;
+    if (sizeClass < kNumSizeClasses && kSizeClassAllocSizes[sizeClass] == aBlockAllocSize)
+    {
+        block = sSizeClassFreeLists.Take(sizeClass);
+        if (block == nullptr)
+        {
+            block = malloc(kStructureSize + aBlockAllocSize);
+        }
+        if (block != nullptr)
+        {
+            SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs128 + sizeClass);
+        }
+    }
+    else
+    {
+        block = chip::Platform::MemoryAlloc(kStructureSize + aBlockAllocSize);
+    }
+    return reinterpret_cast<PacketBuffer *>(block);
+}
+
+void PacketBuffer::ReleaseBlock(PacketBuffer * aPacket, size_t aBlockAllocSize)
+{
+    const size_t sizeClass = SizeClassFor(aBlockAllocSize);
+    if (sizeClass < kNumSizeClasses && kSizeClassAllocSizes[sizeClass] == aBlockAllocSize)
+    {
+        SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs128 + sizeClass);
+        if (!sSizeClassFreeLists.Put(sizeClass, aPacket))
+        {
+            free(aPacket);
+        }
+        return;
+    }
+    chip::Platform::MemoryFree(aPacket);
+}
+
+#else // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+
+size_t PacketBuffer::BlockAllocSize(size_t aAllocSize)
+{
+    return aAllocSize;
+}
+
+PacketBuffer * PacketBuffer::AllocateBlock(size_t aBlockAllocSize)
+{
+    return reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(kStructureSize + aBlockAllocSize));
+}
+
+void PacketBuffer::ReleaseBlock(PacketBuffer * aPacket, size_t aBlockAllocSize)
+{
+    chip::Platform::MemoryFree(aPacket);
+}
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+
 // Number of unused bytes below which \c RightSize() won't bother reallocating.
 constexpr uint16_t kRightSizingThreshold = 16;
 
@@ -138,13 +280,13 @@ void PacketBufferHandle::InternalRightSize()
     const uint8_t * const start   = mBuffer->ReserveStart();
     const uint8_t * const payload = mBuffer->Start();
     const size_t usedSize         = static_cast<size_t>(payload - start + static_cast<ptrdiff_t>(mBuffer->len));
-    if (usedSize + kRightSizingThreshold > mBuffer->alloc_size)
+    const size_t allocSize        = PacketBuffer::BlockAllocSize(usedSize);
+    if (allocSize + kRightSizingThreshold > mBuffer->alloc_size)
     {
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
-    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+    PacketBuffer * newBuffer = PacketBuffer::AllocateBlock(allocSize);
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -159,7 +301,7 @@ void PacketBufferHandle::InternalRightSize()
     newBuffer->tot_len       = mBuffer->tot_len;
     newBuffer->len           = mBuffer->len;
     newBuffer->ref           = 1;
-    newBuffer->alloc_size    = usedSize;
+    newBuffer->alloc_size    = allocSize;
     memcpy(newStart, start, usedSize);
 
     PacketBuffer::Free(mBuffer);
@@ -641,10 +783,10 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     UNLOCK_BUF_POOL();
 
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-    // sumOfSizes is essentially (kStructureSize + lAllocSize) which we already
-    // checked to fit in a size_t.
-    const size_t lBlockSize = static_cast<size_t>(sumOfSizes);
-    lPacket                 = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+    // The block may have more space than requested when allocations are rounded up to size classes. The block size is no
+    // larger than kStructureSize + kMaxAllocSize, which fits in a size_t.
+    const size_t lBlockAllocSize = PacketBuffer::BlockAllocSize(lAllocSize);
+    lPacket                      = PacketBuffer::AllocateBlock(lBlockAllocSize);
 
 #else
 #error "Unimplemented PacketBuffer storage case"
@@ -663,7 +805,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     lPacket->next                   = nullptr;
     lPacket->ref                    = 1;
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-    lPacket->alloc_size = lAllocSize;
+    lPacket->alloc_size = lBlockAllocSize;
 #endif
 
     return PacketBufferHandle(lPacket);
@@ -725,13 +867,14 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+            const size_t allocSize = aPacket->alloc_size;
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            chip::Platform::MemoryFree(aPacket);
+            ReleaseBlock(aPacket, allocSize);
 #endif
             aPacket       = lNextPacket;
         }
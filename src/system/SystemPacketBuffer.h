@@ -159,6 +159,15 @@ public:
     static constexpr size_t kMaxAllocSize          = kMaxSizeWithoutReserve;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+    /**
+     * Allocation sizes (reserved plus payload data space) of the size classes for heap allocated buffers, in increasing order.
+     * Larger buffers are allocated with their exact size.
+     */
+    static constexpr size_t kSizeClassAllocSizes[] = { 128, 256, 512, kMaxSizeWithoutReserve };
+    static constexpr size_t kNumSizeClasses        = MATTER_ARRAY_SIZE(kSizeClassAllocSizes);
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+
     /**
      * Return the size of the allocation including the reserved and payload data spaces but not including space
      * allocated for the PacketBuffer structure.
@@ -394,6 +403,14 @@ private:
     static void InternalCheck(const PacketBuffer * buffer);
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+    // Heap allocation of the memory of a buffer with aAllocSize bytes of reserved and payload data space. BlockAllocSize()
+    // gives the space of the block that is allocated for such a buffer, which is what AllocateBlock() and ReleaseBlock() take.
+    static size_t BlockAllocSize(size_t aAllocSize);
+    static PacketBuffer * AllocateBlock(size_t aBlockAllocSize);
+    static void ReleaseBlock(PacketBuffer * aPacket, size_t aBlockAllocSize);
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+
     void AddRef();
     bool HasSoleOwnership() const { return (this->ref == 1); }
     static void Free(PacketBuffer * aPacket);
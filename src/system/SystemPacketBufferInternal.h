@@ -49,6 +49,18 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+ *
+ * True if heap-allocated packet buffers are rounded up to size classes and recycled through per-class free lists. This requires
+ * the platform memory to be malloc, since the blocks of the size classes come from malloc directly.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES && CHIP_CONFIG_MEMORY_MGMT_MALLOC
+#define CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES 0
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_POOL
  *
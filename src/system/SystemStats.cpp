@@ -44,6 +44,12 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #undef LWIP_PBUF_MEMPOOL
 #else
     "Packet Buffers",
+#if !CHIP_SYSTEM_CONFIG_USE_LWIP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE == 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+    "Packet Buffers (128)",
+    "Packet Buffers (256)",
+    "Packet Buffers (512)",
+    "Packet Buffers (max)",
+#endif
 #endif
     "Timers",
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
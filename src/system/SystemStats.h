@@ -54,6 +54,13 @@ enum
 #undef LWIP_PBUF_MEMPOOL
 #else
     kSystemLayer_NumPacketBufs,
+#if !CHIP_SYSTEM_CONFIG_USE_LWIP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE == 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+    // Packet buffers of each size class, in the order of PacketBuffer::kSizeClassAllocSizes.
+    kSystemLayer_NumPacketBufs128,
+    kSystemLayer_NumPacketBufs256,
+    kSystemLayer_NumPacketBufs512,
+    kSystemLayer_NumPacketBufsMax,
+#endif
 #endif
     kSystemLayer_NumTimers,
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
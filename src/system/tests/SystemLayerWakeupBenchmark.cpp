@@ -0,0 +1,195 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the wakeup latency of the configured System::Layer event loop
+ *      (LayerImplSelect or LayerImplEpoll) as a function of the number of
+ *      watched sockets.
+ *
+ *      For each socket count, every watched socket has a read callback requested,
+ *      and a single datagram is written to one of them per iteration. The latency
+ *      is the time from the write until the corresponding callback runs, including
+ *      PrepareEvents(), WaitForEvents() and HandleEvents().
+ *
+ *      Build the benchmark once with `chip_system_config_event_loop = "Select"` and
+ *      once with `"Epoll"` to compare the two implementations.
+ */
+
+#include <benchmarks/BenchmarkHelpers.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::System;
+
+namespace {
+
+constexpr size_t kSocketCounts[] = { 100, 1000, 10000 };
+constexpr size_t kIterations     = 2000;
+
+const ResultWriter gResults("event-loop-wakeup", "sockets");
+
+struct WatchedSocket
+{
+    int fds[2]             = { -1, -1 };
+    SocketWatchToken token = 0;
+};
+
+struct BenchmarkState
+{
+    SteadyClock::time_point received;
+    size_t callbacks = 0;
+};
+
+LayerSelectLoop & SystemLayer()
+{
+    return static_cast<LayerSelectLoop &>(DeviceLayer::SystemLayer());
+}
+
+void OnReadable(SocketEvents events, intptr_t data)
+{
+    auto * state     = reinterpret_cast<BenchmarkState *>(data);
+    state->received  = SteadyClock::now();
+    state->callbacks = state->callbacks + 1;
+}
+
+void RaiseFileDescriptorLimit(size_t needed)
+{
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < needed)
+    {
+        limit.rlim_cur = std::min<rlim_t>(limit.rlim_max, static_cast<rlim_t>(needed));
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+void CloseSockets(std::vector<WatchedSocket> & sockets)
+{
+    for (auto & s : sockets)
+    {
+        if (s.token != SystemLayer().InvalidSocketWatchToken())
+        {
+            LogErrorOnFailure(SystemLayer().StopWatchingSocket(&s.token));
+        }
+        if (s.fds[0] >= 0)
+        {
+            close(s.fds[0]);
+            close(s.fds[1]);
+        }
+    }
+    sockets.clear();
+}
+
+void RunBenchmark(size_t socketCount)
+{
+    BenchmarkState state;
+    std::vector<WatchedSocket> sockets(socketCount);
+
+    for (auto & s : sockets)
+    {
+        s.token = SystemLayer().InvalidSocketWatchToken();
+    }
+
+    auto watch = [&state](WatchedSocket & s) -> CHIP_ERROR {
+        VerifyOrReturnError(socketpair(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0, s.fds) == 0, CHIP_ERROR_POSIX(errno));
+        ReturnErrorOnFailure(SystemLayer().StartWatchingSocket(s.fds[0], &s.token));
+        ReturnErrorOnFailure(SystemLayer().SetCallback(s.token, OnReadable, reinterpret_cast<intptr_t>(&state)));
+        return SystemLayer().RequestCallbackOnPendingRead(s.token);
+    };
+
+    for (auto & s : sockets)
+    {
+        CHIP_ERROR err = watch(s);
+        if (err != CHIP_NO_ERROR)
+        {
+            // e.g. LayerImplSelect is limited to kSocketWatchMax watches.
+            printf("event-loop-wakeup,%zu,skipped,%" CHIP_ERROR_FORMAT "\n", socketCount, err.Format());
+            CloseSockets(sockets);
+            return;
+        }
+    }
+
+    std::vector<double> latenciesUs;
+    latenciesUs.reserve(kIterations);
+
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        // Spread writes over the whole set so that no implementation benefits from the ready socket being first.
+        WatchedSocket & target           = sockets[ScrambledIndex(i, socketCount)];
+        const size_t expectedCallbacks   = state.callbacks + 1;
+        const SteadyClock::time_point t0 = SteadyClock::now();
+        VerifyOrDie(write(target.fds[1], "x", 1) == 1);
+
+        while (state.callbacks < expectedCallbacks)
+        {
+            SystemLayer().PrepareEvents();
+            SystemLayer().WaitForEvents();
+            SystemLayer().HandleEvents();
+        }
+
+        char byte;
+        VerifyOrDie(read(target.fds[0], &byte, 1) == 1);
+        latenciesUs.push_back(std::chrono::duration<double, std::micro>(state.received - t0).count());
+    }
+
+    std::sort(latenciesUs.begin(), latenciesUs.end());
+    double total = 0;
+    for (double latency : latenciesUs)
+    {
+        total += latency;
+    }
+
+    gResults.Print(socketCount, "mean_us", Better::kLower, total / static_cast<double>(latenciesUs.size()), 2);
+    gResults.Print(socketCount, "p50_us", Better::kLower, latenciesUs[latenciesUs.size() / 2], 2);
+    gResults.Print(socketCount, "p99_us", Better::kLower, latenciesUs[(latenciesUs.size() * 99) / 100], 2);
+
+    CloseSockets(sockets);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    RaiseFileDescriptorLimit(2 * kSocketCounts[MATTER_ARRAY_SIZE(kSocketCounts) - 1] + 64);
+
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+    VerifyOrDie(DeviceLayer::PlatformMgr().InitChipStack() == CHIP_NO_ERROR);
+
+    gResults.PrintHeader();
+    for (size_t socketCount : kSocketCounts)
+    {
+        RunBenchmark(socketCount);
+    }
+
+    DeviceLayer::PlatformMgr().Shutdown();
+    Platform::MemoryShutdown();
+    return 0;
+}
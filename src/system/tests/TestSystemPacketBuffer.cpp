@@ -195,6 +195,9 @@ public:
     void CheckRead();
     void CheckSetDataLength();
     void CheckSetStart();
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+    void CheckSizeClasses();
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
 };
 
 /**
@@ -1598,6 +1601,58 @@ TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckHandleRightSize)
 #endif // CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHTSIZE
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckSizeClasses)
+{
+    // Allocations are rounded up to the smallest size class that holds them.
+    PacketBufferHandle small = PacketBufferHandle::New(10, 0);
+    ASSERT_FALSE(small.IsNull());
+    EXPECT_EQ(small->AllocSize(), PacketBuffer::kSizeClassAllocSizes[0]);
+
+    PacketBufferHandle medium = PacketBufferHandle::New(PacketBuffer::kSizeClassAllocSizes[0] + 1, 0);
+    ASSERT_FALSE(medium.IsNull());
+    EXPECT_EQ(medium->AllocSize(), PacketBuffer::kSizeClassAllocSizes[1]);
+
+    PacketBufferHandle received = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve, 0);
+    ASSERT_FALSE(received.IsNull());
+    EXPECT_EQ(received->AllocSize(), PacketBuffer::kMaxSizeWithoutReserve);
+
+    // Take the buffers kept on the free list of the smallest class, so that the next one released there is kept.
+    std::vector<PacketBufferHandle> held;
+    for (size_t i = 0; i < CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASS_FREE_LIMIT; i++)
+    {
+        held.push_back(PacketBufferHandle::New(1, 0));
+    }
+
+    // A released buffer is reused by the next allocation of its class.
+    const PacketBuffer * const released = small.mBuffer;
+    small                               = nullptr;
+    PacketBufferHandle reused           = PacketBufferHandle::New(20, 0);
+    EXPECT_EQ(reused.mBuffer, released);
+
+    // Right-sizing a received datagram moves it to the smallest class that holds it.
+    constexpr size_t kDatagramSize = 200;
+    memset(received->Start(), 0xA5, kDatagramSize);
+    received->SetDataLength(kDatagramSize);
+    received.RightSize();
+    EXPECT_EQ(received->AllocSize(), PacketBuffer::kSizeClassAllocSizes[1]);
+    EXPECT_EQ(received->DataLength(), kDatagramSize);
+    EXPECT_EQ(received->Start()[kDatagramSize - 1], 0xA5);
+
+    // A buffer already in the smallest class that holds it is left in place.
+    const PacketBuffer * const rightSized = received.mBuffer;
+    received.RightSize();
+    EXPECT_EQ(received.mBuffer, rightSized);
+
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    // Buffers larger than all classes are allocated with their exact size.
+    PacketBufferHandle large = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve + 1, 0);
+    ASSERT_FALSE(large.IsNull());
+    EXPECT_EQ(large->AllocSize(), PacketBuffer::kMaxSizeWithoutReserve + 1);
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+
 TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckHandleCloneData)
 {
     uint8_t lPayload[2 * PacketBuffer::kMaxAllocSize];
@@ -0,0 +1,227 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for the SocketWatch contract of
+ *      <tt>chip::System::LayerSockets</tt> event-loop implementations
+ *      (LayerImplSelect, LayerImplEpoll).
+ */
+
+#include <pw_unit_test/framework.h>
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+// The fake PlatformManagerImpl does not drive the system layer event loop
+#if !CHIP_DEVICE_LAYER_TARGET_FAKE
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemLayer.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::System;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+struct SocketPair
+{
+    SocketPair() { EXPECT_EQ(socketpair(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0, fds), 0); }
+    ~SocketPair()
+    {
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    void Send() { EXPECT_EQ(write(fds[1], "x", 1), 1); }
+    void Drain()
+    {
+        char byte;
+        while (read(fds[0], &byte, 1) == 1)
+        {
+        }
+    }
+
+    int fds[2];
+};
+
+struct WatchState
+{
+    SocketWatchToken token = 0;
+    SocketPair * pair      = nullptr;
+    SocketEvents lastEvents;
+    int calls = 0;
+    // Optionally stop watching another socket from within this socket's callback.
+    WatchState * stopOther = nullptr;
+};
+
+class TestSystemSocketWatch : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(DeviceLayer::PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        DeviceLayer::PlatformMgr().Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    static LayerSelectLoop & SystemLayer() { return static_cast<LayerSelectLoop &>(DeviceLayer::SystemLayer()); }
+
+    static void OnSocketEvent(SocketEvents events, intptr_t data)
+    {
+        auto * state = reinterpret_cast<WatchState *>(data);
+        state->calls++;
+        state->lastEvents = events;
+        state->pair->Drain();
+        if (state->stopOther != nullptr)
+        {
+            EXPECT_SUCCESS(SystemLayer().StopWatchingSocket(&state->stopOther->token));
+        }
+    }
+
+    static void Watch(WatchState & state, SocketPair & pair)
+    {
+        state.pair = &pair;
+        EXPECT_SUCCESS(SystemLayer().StartWatchingSocket(pair.fds[0], &state.token));
+        EXPECT_SUCCESS(SystemLayer().SetCallback(state.token, OnSocketEvent, reinterpret_cast<intptr_t>(&state)));
+        EXPECT_SUCCESS(SystemLayer().RequestCallbackOnPendingRead(state.token));
+    }
+
+    // Runs a single event loop iteration, bounded by a short timer so that it returns even without socket activity.
+    static void RunOnce()
+    {
+        TimerCompleteCallback noop = [](Layer *, void *) {};
+        EXPECT_SUCCESS(SystemLayer().StartTimer(10_ms, noop, nullptr));
+        SystemLayer().PrepareEvents();
+        SystemLayer().WaitForEvents();
+        SystemLayer().HandleEvents();
+        SystemLayer().CancelTimer(noop, nullptr);
+    }
+};
+
+TEST_F(TestSystemSocketWatch, ReadCallback)
+{
+    SocketPair pair;
+    WatchState state;
+    Watch(state, pair);
+
+    RunOnce();
+    EXPECT_EQ(state.calls, 0);
+
+    pair.Send();
+    RunOnce();
+    EXPECT_EQ(state.calls, 1);
+    EXPECT_TRUE(state.lastEvents.Has(SocketEventFlags::kRead));
+    EXPECT_FALSE(state.lastEvents.Has(SocketEventFlags::kWrite));
+
+    // Data that is not consumed keeps being reported.
+    SocketWatchCallback countOnly = [](SocketEvents, intptr_t data) { reinterpret_cast<WatchState *>(data)->calls++; };
+    EXPECT_SUCCESS(SystemLayer().SetCallback(state.token, countOnly, reinterpret_cast<intptr_t>(&state)));
+    pair.Send();
+    RunOnce();
+    RunOnce();
+    EXPECT_EQ(state.calls, 3);
+    pair.Drain();
+
+    EXPECT_SUCCESS(SystemLayer().StopWatchingSocket(&state.token));
+}
+
+TEST_F(TestSystemSocketWatch, ClearCallback)
+{
+    SocketPair pair;
+    WatchState state;
+    Watch(state, pair);
+
+    EXPECT_SUCCESS(SystemLayer().ClearCallbackOnPendingRead(state.token));
+    pair.Send();
+    RunOnce();
+    EXPECT_EQ(state.calls, 0);
+
+    EXPECT_SUCCESS(SystemLayer().RequestCallbackOnPendingRead(state.token));
+    RunOnce();
+    EXPECT_EQ(state.calls, 1);
+
+    EXPECT_SUCCESS(SystemLayer().StopWatchingSocket(&state.token));
+}
+
+TEST_F(TestSystemSocketWatch, WriteCallback)
+{
+    SocketPair pair;
+    WatchState state;
+    Watch(state, pair);
+
+    EXPECT_SUCCESS(SystemLayer().ClearCallbackOnPendingRead(state.token));
+    EXPECT_SUCCESS(SystemLayer().RequestCallbackOnPendingWrite(state.token));
+    RunOnce();
+    EXPECT_EQ(state.calls, 1);
+    EXPECT_TRUE(state.lastEvents.Has(SocketEventFlags::kWrite));
+    EXPECT_FALSE(state.lastEvents.Has(SocketEventFlags::kRead));
+
+    EXPECT_SUCCESS(SystemLayer().StopWatchingSocket(&state.token));
+}
+
+TEST_F(TestSystemSocketWatch, StartWatchingTwiceReturnsSameToken)
+{
+    SocketPair pair;
+    SocketWatchToken first  = SystemLayer().InvalidSocketWatchToken();
+    SocketWatchToken second = SystemLayer().InvalidSocketWatchToken();
+
+    EXPECT_SUCCESS(SystemLayer().StartWatchingSocket(pair.fds[0], &first));
+    EXPECT_SUCCESS(SystemLayer().StartWatchingSocket(pair.fds[0], &second));
+    EXPECT_EQ(first, second);
+
+    EXPECT_SUCCESS(SystemLayer().StopWatchingSocket(&first));
+    EXPECT_EQ(first, SystemLayer().InvalidSocketWatchToken());
+}
+
+TEST_F(TestSystemSocketWatch, StopWatchingFromCallback)
+{
+    SocketPair pair1;
+    SocketPair pair2;
+    WatchState state1;
+    WatchState state2;
+    Watch(state1, pair1);
+    Watch(state2, pair2);
+
+    // Whichever callback runs first stops the other watch; the other callback must not be invoked.
+    state1.stopOther = &state2;
+    state2.stopOther = &state1;
+
+    pair1.Send();
+    pair2.Send();
+    RunOnce();
+    EXPECT_EQ(state1.calls + state2.calls, 1);
+
+    WatchState & remaining = (state1.calls == 1) ? state1 : state2;
+    remaining.stopOther    = nullptr;
+    EXPECT_SUCCESS(SystemLayer().StopWatchingSocket(&remaining.token));
+}
+
+} // namespace
+
+#endif // !CHIP_DEVICE_LAYER_TARGET_FAKE
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && !CHIP_SYSTEM_CONFIG_USE_LIBEV
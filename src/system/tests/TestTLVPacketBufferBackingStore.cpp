@@ -165,6 +165,10 @@ TEST_F(TestTLVPacketBufferBackingStore, MultiBufferEncode)
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_STANDARD_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
     // In case of pool allocation, the buffer size is always the maximum size.
     constexpr size_t bufferSizes[] = { PacketBuffer::kMaxSizeWithoutReserve, totalSize - PacketBuffer::kMaxSizeWithoutReserve };
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+    // In case of size classes, the first buffer is rounded up to the smallest class.
+    constexpr size_t bufferSizes[] = { PacketBuffer::kSizeClassAllocSizes[0], PacketBuffer::kMaxSizeWithoutReserve,
+                                       totalSize - PacketBuffer::kSizeClassAllocSizes[0] - PacketBuffer::kMaxSizeWithoutReserve };
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
     constexpr size_t bufferSizes[] = { 2, PacketBuffer::kMaxSizeWithoutReserve,
                                        totalSize - 2 - PacketBuffer::kMaxSizeWithoutReserve };
@@ -243,7 +247,12 @@ TEST_F(TestTLVPacketBufferBackingStore, MultiBufferEncode)
 TEST_F(TestTLVPacketBufferBackingStore, NonChainedBufferCanReserve)
 {
     // Start with a too-small buffer.
-    uint32_t smallSize             = 5;
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+    // Allocations are rounded up to a size class, so ask for a whole one.
+    uint32_t smallSize = static_cast<uint32_t>(PacketBuffer::kSizeClassAllocSizes[0]);
+#else
+    uint32_t smallSize = 5;
+#endif
     uint32_t smallerSizeToReserver = smallSize - 1;
 
     auto buffer = PacketBufferHandle::New(smallSize, /* aReservedSize = */ 0);
@@ -314,7 +323,12 @@ TEST_F(TestTLVPacketBufferBackingStore, TestWriterReserveUnreserveDoesNotOverflo
 TEST_F(TestTLVPacketBufferBackingStore, TestWriterReserve)
 {
     // Start with a too-small buffer.
-    uint32_t smallSize             = 5;
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_SIZE_CLASSES
+    // Allocations are rounded up to a size class, so ask for a whole one.
+    uint32_t smallSize = static_cast<uint32_t>(PacketBuffer::kSizeClassAllocSizes[0]);
+#else
+    uint32_t smallSize = 5;
+#endif
     uint32_t smallerSizeToReserver = smallSize - 1;
 
     auto buffer = PacketBufferHandle::New(smallSize, 0);
@@ -55,6 +55,9 @@ CryptoContext::CryptoContext() : mKeyAvailable(false) {}
 
 CryptoContext::~CryptoContext()
 {
+    mEncryptionCipher.Release();
+    mDecryptionCipher.Release();
+
     if (mKeystore)
     {
         mKeystore->DestroyKey(mEncryptionKey);
@@ -83,6 +86,9 @@ CHIP_ERROR CryptoContext::InitFromSecret(SessionKeystore & keystore, const ByteS
     ReturnErrorOnFailure(keystore.DeriveSessionKeys(secret, salt, info, i2rKey, r2iKey, mAttestationChallenge));
 #endif
 
+    mEncryptionCipher.Init(mEncryptionKey);
+    mDecryptionCipher.Init(mDecryptionKey);
+
     mKeyAvailable = true;
     mSessionRole  = role;
     mKeystore     = &keystore;
@@ -108,6 +114,9 @@ CHIP_ERROR CryptoContext::InitFromSecret(Crypto::SessionKeystore & keystore, con
     ReturnErrorOnFailure(keystore.DeriveSessionKeys(hkdfKey, salt, info, i2rKey, r2iKey, mAttestationChallenge));
 #endif
 
+    mEncryptionCipher.Init(mEncryptionKey);
+    mDecryptionCipher.Init(mDecryptionKey);
+
     mKeyAvailable = true;
     mSessionRole  = role;
     mKeystore     = &keystore;
@@ -220,7 +229,7 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
         ReturnErrorOnFailure(
-            AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output, tag, taglen));
+            mEncryptionCipher.Encrypt(input, input_length, AAD, aadLen, nonce.data(), nonce.size(), output, tag, taglen));
     }
 
     mac.SetTag(tag, taglen);
@@ -255,7 +264,7 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
         ReturnErrorOnFailure(
-            AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(), nonce.size(), output));
+            mDecryptionCipher.Decrypt(input, input_length, AAD, aadLen, tag, taglen, nonce.data(), nonce.size(), output));
     }
     return CHIP_NO_ERROR;
 }
@@ -166,6 +166,10 @@ private:
     bool mKeyAvailable;
     Crypto::Aes128KeyHandle mEncryptionKey;
     Crypto::Aes128KeyHandle mDecryptionKey;
+    // Bound to mEncryptionKey and mDecryptionKey once the keys are derived, so that the cipher is not set up again for
+    // every message. Declared after the keys so that they are released first.
+    Crypto::Aes128CcmCipher mEncryptionCipher;
+    Crypto::Aes128CcmCipher mDecryptionCipher;
     Crypto::AttestationChallenge mAttestationChallenge;
     Crypto::SessionKeystore * mKeystore       = nullptr;
     Crypto::SymmetricKeyContext * mKeyContext = nullptr;
@@ -0,0 +1,121 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <transport/GroupSessionDecryptCache.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Transport {
+
+size_t GroupSessionDecryptCache::IndexOf(uint16_t aSessionId, const Sender & aSender) const
+{
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (mEntries[i].sessionId == aSessionId && mEntries[i].sender == aSender)
+        {
+            return i;
+        }
+    }
+    return mCount;
+}
+
+void GroupSessionDecryptCache::MoveToFront(size_t aIndex)
+{
+    Entry entry = mEntries[aIndex];
+    for (size_t i = aIndex; i > 0; i--)
+    {
+        mEntries[i] = mEntries[i - 1];
+    }
+    mEntries[0] = entry;
+}
+
+void GroupSessionDecryptCache::RemoveAt(size_t aIndex)
+{
+    for (size_t i = aIndex + 1; i < mCount; i++)
+    {
+        mEntries[i - 1] = mEntries[i];
+    }
+    mCount--;
+}
+
+bool GroupSessionDecryptCache::Find(uint16_t aSessionId, const Sender & aSender, Candidate & aCandidate)
+{
+    const size_t index = IndexOf(aSessionId, aSender);
+    VerifyOrReturnValue(index < mCount, false);
+
+    MoveToFront(index);
+    aCandidate = mEntries[0].candidate;
+    return true;
+}
+
+void GroupSessionDecryptCache::Remember(uint16_t aSessionId, const Sender & aSender, const Candidate & aCandidate)
+{
+    size_t index = IndexOf(aSessionId, aSender);
+    if (index == mCount)
+    {
+        // Not found: reuse the least recently used entry if the cache is full.
+        if (mCount < kCacheSize)
+        {
+            mCount++;
+        }
+        index                     = mCount - 1;
+        mEntries[index].sessionId = aSessionId;
+        mEntries[index].sender    = aSender;
+    }
+    mEntries[index].candidate = aCandidate;
+    MoveToFront(index);
+}
+
+void GroupSessionDecryptCache::Forget(uint16_t aSessionId, const Sender & aSender)
+{
+    const size_t index = IndexOf(aSessionId, aSender);
+    VerifyOrReturn(index < mCount);
+    RemoveAt(index);
+}
+
+void GroupSessionDecryptCache::FabricRemoved(FabricIndex aFabricIndex)
+{
+    for (size_t i = mCount; i > 0; i--)
+    {
+        if (mEntries[i - 1].candidate.fabricIndex == aFabricIndex)
+        {
+            RemoveAt(i - 1);
+        }
+    }
+}
+
+void GroupSessionDecryptCache::Clear()
+{
+    mCount = 0;
+}
+
+void GroupSessionDecryptCache::RecordMessage(bool aCacheHit, uint16_t aAttempts)
+{
+    mStats.messages++;
+    if (aCacheHit)
+    {
+        mStats.cacheHits++;
+    }
+    else
+    {
+        mStats.cacheMisses++;
+    }
+    mStats.decryptAttempts += aAttempts;
+}
+
+} // namespace Transport
+} // namespace chip
@@ -0,0 +1,146 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the cache of the group keys that last decrypted messages from a given group sender.
+ *
+ */
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/GroupId.h>
+#include <lib/core/NodeId.h>
+#include <transport/raw/PeerAddress.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Group messages only carry a session id, which is a hash of the operational group key, so the receiver has to try every
+ * group key with that hash until one of them decrypts the message.  The sender of a message uses the same key for all of
+ * its messages to a group, so remembering which key worked for a (session id, sender) pair lets the next message from that
+ * sender be decrypted on the first attempt.
+ *
+ * Keys are identified by their position among the candidates returned by GroupDataProvider::IterateGroupSessions for the
+ * session id, along with their fabric and group so that a stale entry is detected when the key configuration changed.
+ *
+ * The source node of a message with privacy enabled is only known after decryption, so such messages are identified by the
+ * address they came from instead.
+ *
+ * The cache is a fixed size LRU: the most recently used entry is at index 0.
+ */
+class GroupSessionDecryptCache
+{
+public:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_GROUP_DECRYPT_CACHE_SIZE;
+    static_assert(kCacheSize > 0, "CHIP_CONFIG_GROUP_DECRYPT_CACHE_SIZE must be at least 1");
+
+    /**
+     * The sender of a message: its source node when the message header is in the clear, or else the address it came from.
+     */
+    class Sender
+    {
+    public:
+        Sender() = default;
+        Sender(NodeId aSourceNodeId) : mSourceNodeId(aSourceNodeId) {}
+        Sender(const PeerAddress & aPeerAddress) : mPeerAddress(aPeerAddress) {}
+
+        bool operator==(const Sender & aOther) const
+        {
+            return mSourceNodeId == aOther.mSourceNodeId && mPeerAddress == aOther.mPeerAddress;
+        }
+
+    private:
+        NodeId mSourceNodeId = kUndefinedNodeId;
+        PeerAddress mPeerAddress;
+    };
+
+    struct Candidate
+    {
+        uint16_t index          = 0;
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        GroupId groupId         = kUndefinedGroupId;
+    };
+
+    struct Stats
+    {
+        // Group messages that went through trial decryption.
+        uint32_t messages = 0;
+        // Messages decrypted by the remembered key.
+        uint32_t cacheHits = 0;
+        // Messages for which no key was remembered, or the remembered key did not decrypt the message.
+        uint32_t cacheMisses = 0;
+        // Decryption attempts, over all messages; divide by messages for the average number of attempts per message.
+        uint32_t decryptAttempts = 0;
+    };
+
+    /**
+     * Looks up the key that last decrypted a message for the given session id and sender, and marks it as most recently used.
+     *
+     * @return true if a candidate was found, in which case it is written to aCandidate.
+     */
+    bool Find(uint16_t aSessionId, const Sender & aSender, Candidate & aCandidate);
+
+    /**
+     * Remembers that aCandidate decrypted a message for the given session id and sender, evicting the least recently used
+     * entry if needed.
+     */
+    void Remember(uint16_t aSessionId, const Sender & aSender, const Candidate & aCandidate);
+
+    /**
+     * Forgets the key remembered for the given session id and sender, if any.
+     */
+    void Forget(uint16_t aSessionId, const Sender & aSender);
+
+    void FabricRemoved(FabricIndex aFabricIndex);
+    void Clear();
+
+    /**
+     * Accounts for one group message that took aAttempts decryption attempts.
+     */
+    void RecordMessage(bool aCacheHit, uint16_t aAttempts);
+
+    const Stats & GetStats() const { return mStats; }
+    void ResetStats() { mStats = Stats(); }
+
+private:
+    struct Entry
+    {
+        uint16_t sessionId = 0;
+        Sender sender;
+        Candidate candidate;
+    };
+
+    // Index of the entry for the given key in mEntries, or mCount if there is none.
+    size_t IndexOf(uint16_t aSessionId, const Sender & aSender) const;
+
+    // Moves the entry at aIndex to the front, shifting the more recently used ones back by one.
+    void MoveToFront(size_t aIndex);
+
+    // Removes the entry at aIndex, keeping the order of the others.
+    void RemoveAt(size_t aIndex);
+
+    Entry mEntries[kCacheSize];
+    size_t mCount = 0;
+    Stats mStats;
+};
+
+} // namespace Transport
+} // namespace chip
@@ -21,6 +21,9 @@
 #include <transport/SecureSession.h>
 #include <transport/SecureSessionTable.h>
 
+#include <algorithm>
+#include <iterator>
+
 namespace chip {
 namespace Transport {
 
@@ -53,6 +56,10 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
 
     SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
                                                    peerSessionId, fabricIndex, config);
+    if (result != nullptr)
+    {
+        AddToIndexes(result);
+    }
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,6 +80,10 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
         allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        if (allocated != nullptr)
+        {
+            AddToIndexes(allocated);
+        }
     }
     else
     {
@@ -136,34 +147,42 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
     // Compute two key stats for each session - the number of other sessions that
     // match its fabric, as well as the number of other sessions that match its peer.
     //
-    // This will be used by the session eviction algorithm later.
+    // This will be used by the session eviction algorithm later. Sessions to the same peer
+    // are counted on the peer index, and sessions on the same fabric are tallied pairwise
+    // once all the candidates are collected.
     //
     ForEachSession([&index, &sortableSessions, this](auto * session) {
+        const ScopedNodeId peer = session->GetPeer();
+
         sortableSessions[index].mSession             = session;
         sortableSessions[index].mNumMatchingOnFabric = 0;
         sortableSessions[index].mNumMatchingOnPeer   = 0;
 
-        ForEachSession([session, index, &sortableSessions](auto * otherSession) {
-            if (session != otherSession)
+        for (SecureSession * otherSession = mSessionsByPeer[PeerBucket(peer)]; otherSession != nullptr;
+             otherSession                 = otherSession->mNextByPeer)
+        {
+            if (session != otherSession && otherSession->GetPeer() == peer)
             {
-                if (session->GetFabricIndex() == otherSession->GetFabricIndex())
-                {
-                    sortableSessions[index].mNumMatchingOnFabric++;
-
-                    if (session->GetPeerNodeId() == otherSession->GetPeerNodeId())
-                    {
-                        sortableSessions[index].mNumMatchingOnPeer++;
-                    }
-                }
+                sortableSessions[index].mNumMatchingOnPeer++;
             }
-
-            return Loop::Continue;
-        });
+        }
 
         index++;
         return Loop::Continue;
     });
 
+    for (unsigned int i = 0; i < index; i++)
+    {
+        for (unsigned int j = i + 1; j < index; j++)
+        {
+            if (sortableSessions[i].mSession->GetFabricIndex() == sortableSessions[j].mSession->GetFabricIndex())
+            {
+                sortableSessions[i].mNumMatchingOnFabric++;
+                sortableSessions[j].mNumMatchingOnFabric++;
+            }
+        }
+    }
+
     auto sortableSessionSpan = Span<SortableSession>(sortableSessions, mEntries.Allocated());
     EvictionPolicyContext policyContext(sortableSessionSpan, sessionEvictionHint);
 
@@ -216,8 +235,8 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
             auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
-            VerifyOrDie(session != nullptr);
-            return retSession;
+            VerifyOrDie(retSession != nullptr);
+            return AddToIndexes(retSession);
         }
     }
 
@@ -338,68 +357,100 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
-        if (session->GetLocalSessionId() == localSessionId)
-        {
-            result = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    SecureSession * result = FindSessionByLocalSessionId(localSessionId);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+    for (uint32_t i = 0; i <= kMaxSessionID; i++)
     {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
+        uint16_t candidate = static_cast<uint16_t>(i + mNextSessionId);
+        if (candidate != kUnsecuredSessionId && FindSessionByLocalSessionId(candidate) == nullptr)
         {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
+            return MakeOptional<uint16_t>(candidate);
         }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
+    }
+
+    return NullOptional;
+}
+
+void SecureSessionTable::ReleaseSession(SecureSession * session)
+{
+    RemoveFromIndexes(session);
+    mEntries.ReleaseObject(session);
+}
+
+void SecureSessionTable::PeerChanged(SecureSession * session, const ScopedNodeId & previousPeer)
+{
+    SecureSession ** link = &mSessionsByPeer[PeerBucket(previousPeer)];
+    while (*link != nullptr && *link != session)
+    {
+        link = &(*link)->mNextByPeer;
+    }
+    // Sessions constructed outside of the table (e.g. by tests) are not indexed.
+    VerifyOrReturn(*link != nullptr);
+    *link = session->mNextByPeer;
+
+    SecureSession *& head = mSessionsByPeer[PeerBucket(session->GetPeer())];
+    session->mNextByPeer  = head;
+    head                  = session;
+}
+
+void SecureSessionTable::ReleaseAll()
+{
+    mEntries.ReleaseAll();
+    std::fill(std::begin(mSessionsByLocalSessionId), std::end(mSessionsByLocalSessionId), nullptr);
+    std::fill(std::begin(mSessionsByPeer), std::end(mSessionsByPeer), nullptr);
+}
+
+SecureSession * SecureSessionTable::FindSessionByLocalSessionId(uint16_t localSessionId) const
+{
+    for (SecureSession * session = mSessionsByLocalSessionId[LocalSessionIdBucket(localSessionId)]; session != nullptr;
+         session                 = session->mNextByLocalSessionId)
+    {
+        if (session->GetLocalSessionId() == localSessionId)
         {
-            break; // Any bit clear means we have an available ID in this bucket.
+            return session;
         }
     }
-    if (candidate_mask != UINT64_MAX)
+    return nullptr;
+}
+
+SecureSession * SecureSessionTable::AddToIndexes(SecureSession * session)
+{
+    SecureSession *& byLocalSessionId = mSessionsByLocalSessionId[LocalSessionIdBucket(session->GetLocalSessionId())];
+    session->mNextByLocalSessionId    = byLocalSessionId;
+    byLocalSessionId                  = session;
+
+    SecureSession *& byPeer = mSessionsByPeer[PeerBucket(session->GetPeer())];
+    session->mNextByPeer    = byPeer;
+    byPeer                  = session;
+
+    return session;
+}
+
+void SecureSessionTable::RemoveFromIndexes(SecureSession * session)
+{
+    for (SecureSession ** link = &mSessionsByLocalSessionId[LocalSessionIdBucket(session->GetLocalSessionId())];
+         *link != nullptr; link = &(*link)->mNextByLocalSessionId)
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        if (*link == session)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            *link = session->mNextByLocalSessionId;
+            break;
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
 
-    return NullOptional;
+    for (SecureSession ** link = &mSessionsByPeer[PeerBucket(session->GetPeer())]; *link != nullptr;
+         link                  = &(*link)->mNextByPeer)
+    {
+        if (*link == session)
+        {
+            *link = session->mNextByPeer;
+            break;
+        }
+    }
 }
 
 } // namespace Transport
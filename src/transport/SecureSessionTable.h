@@ -29,6 +29,17 @@ namespace Transport {
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+// Number of hash buckets for the SecureSessionTable indexes: the smallest power of two that holds the whole pool.
+constexpr size_t SecureSessionIndexBucketCount(size_t poolSize)
+{
+    size_t count = 1;
+    while (count < poolSize)
+    {
+        count <<= 1;
+    }
+    return count;
+}
+
 /**
  * Handles a set of sessions.
  *
@@ -39,7 +50,7 @@ inline constexpr uint16_t kUnsecuredSessionId = 0;
 class SecureSessionTable
 {
 public:
-    ~SecureSessionTable() { mEntries.ReleaseAll(); }
+    ~SecureSessionTable() { ReleaseAll(); }
 
     void Init() { mNextSessionId = chip::Crypto::GetRandU16(); }
 
@@ -76,7 +87,7 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session);
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +95,48 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Call the provided function on each session whose peer matches the provided ScopedNodeId.
+     *
+     * This only visits the sessions in the peer's index bucket instead of the whole table. As with ForEachSession, the
+     * function may release any session, including the one it is called on.
+     *
+     * @returns Loop::Break if the function returned Loop::Break, Loop::Finish otherwise.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+        // Hold a reference on both the current and the next session in the bucket, so that neither can be released (and
+        // unlinked) out from under the iteration while the function runs.
+        SecureSession * session = mSessionsByPeer[PeerBucket(peer)];
+        if (session != nullptr)
+        {
+            session->Retain();
+        }
+        while (session != nullptr)
+        {
+            SecureSession * next = session->mNextByPeer;
+            if (next != nullptr)
+            {
+                next->Retain();
+            }
+
+            Loop result = (session->GetPeer() == peer) ? function(session) : Loop::Continue;
+            session->Release();
+
+            if (result == Loop::Break)
+            {
+                if (next != nullptr)
+                {
+                    next->Release();
+                }
+                return Loop::Break;
+            }
+            session = next;
+        }
+        return Loop::Finish;
+    }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -100,17 +153,15 @@ public:
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachSessionWithPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
-            SessionHandle ref(*oldSession);
-
             // This will give all SessionHolders pointing to oldSession a chance to switch to the provided session
             //
             // See documentation for SessionDelegate::GetNewSessionHandlingPolicy about how session auto-shifting works, and how
             // to disable it for a specific SessionHolder in a specific scenario.
-            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE && oldSession->GetPeer() == session->GetPeer() &&
+            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE &&
                 oldSession->GetPeerCATs() == session->GetPeerCATs())
             {
                 oldSession->NewerSessionAvailable(SessionHandle(*session));
@@ -120,6 +171,10 @@ public:
         });
     }
 
+    // Re-indexes a session whose peer changed from previousPeer. Sessions that are not in this table are ignored.
+    // This is an internal API, only meant to be called by SecureSession.
+    void PeerChanged(SecureSession * session, const ScopedNodeId & previousPeer);
+
 private:
     friend class TestSecureSessionTable;
 
@@ -243,22 +298,51 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Session IDs are probed in order from the starting mNextSessionId clue, looking
+     * each one up in the local session ID index. Since IDs are handed out sequentially,
+     * the first candidate is almost always free.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * The session table keeps two side indexes so that the lookups on the message receive path
+     * and by peer don't have to scan every session in the pool:
+     *
+     *  - by local session ID, used to dispatch inbound messages to their session.
+     *  - by peer ScopedNodeId, used to find and update the sessions to a given node.
+     *
+     * Each index is a fixed array of hash buckets, each the head of a chain linked through the
+     * sessions themselves. Sessions are added to both indexes when they are allocated and
+     * removed when they are released. The peer of a session is set by SecureSession::Activate
+     * (or changed by AdoptFabricIndex), which re-indexes it through PeerChanged.
+     */
+    static constexpr size_t kIndexBucketCount = SecureSessionIndexBucketCount(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+
+    static size_t LocalSessionIdBucket(uint16_t localSessionId) { return localSessionId & (kIndexBucketCount - 1); }
+    static size_t PeerBucket(const ScopedNodeId & peer)
+    {
+        // Fibonacci hashing: operational node IDs are random, but PAKE key IDs only differ in their low bits.
+        uint64_t key = peer.GetNodeId() ^ (static_cast<uint64_t>(peer.GetFabricIndex()) << 56);
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (kIndexBucketCount - 1);
+    }
+
+    SecureSession * FindSessionByLocalSessionId(uint16_t localSessionId) const;
+
+    // Adds a session newly created in mEntries to the indexes. Returns the session for convenience.
+    SecureSession * AddToIndexes(SecureSession * session);
+    void RemoveFromIndexes(SecureSession * session);
+    // Releases every session and empties both indexes.
+    void ReleaseAll();
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
+    SecureSession * mSessionsByLocalSessionId[kIndexBucketCount] = {};
+    SecureSession * mSessionsByPeer[kIndexBucketCount]           = {};
+
     size_t GetMaxSessionTableSize() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -131,6 +131,8 @@ CHIP_ERROR SessionManager::Init(System::Layer * systemLayer, TransportMgrBase *
 
     // Ensure MessageStats struct is at default state on Init
     mMessageStats = MessageStats();
+    mGroupDecryptCache.Clear();
+    mGroupDecryptCache.ResetStats();
 
     return CHIP_NO_ERROR;
 }
@@ -172,6 +174,7 @@ void SessionManager::Shutdown()
 void SessionManager::FabricRemoved(FabricIndex fabricIndex)
 {
     TEMPORARY_RETURN_IGNORED gGroupPeerTable->FabricRemoved(fabricIndex);
+    mGroupDecryptCache.FabricRemoved(fabricIndex);
 }
 
 CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, PayloadHeader & payloadHeader,
@@ -645,9 +648,8 @@ void SessionManager::ExpireAllSecureSessions()
 
 void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Optional<Transport::SecureSession::Type> & type)
 {
-    mSecureSessions.ForEachSession([&node, &type](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == node &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+    mSecureSessions.ForEachSessionWithPeer(node, [&type](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             session->MarkAsDefunct();
         }
@@ -657,10 +659,10 @@ void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Opti
 
 void SessionManager::UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr)
 {
-    mSecureSessions.ForEachSession([&node, &addr](auto session) {
+    mSecureSessions.ForEachSessionWithPeer(node, [&addr](auto session) {
         // Arguably we should only be updating active and defunct sessions, but there is no harm
         // in updating evicted sessions.
-        if (session->GetPeer() == node && Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
+        if (Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
         {
             session->SetPeerAddress(addr);
         }
@@ -717,6 +719,20 @@ CHIP_ERROR SessionManager::InjectCaseSessionWithTestKey(SessionHolder & sessionH
     return CHIP_NO_ERROR;
 }
 
+void SessionManager::OnMessageSendFailed(const PeerAddress & destination, const System::PacketBufferHandle & msg, CHIP_ERROR err)
+{
+#if CHIP_ERROR_LOGGING
+    char addressStr[Transport::PeerAddress::kMaxToStringSize] = { 0 };
+    destination.ToString(addressStr);
+    ChipLogError(Inet, "Sending to %s failed after SendMessage(): %" CHIP_ERROR_FORMAT, addressStr, err.Format());
+#endif // CHIP_ERROR_LOGGING
+
+    if (mCB != nullptr)
+    {
+        mCB->OnMessageSendFailed(msg, err);
+    }
+}
+
 void SessionManager::OnMessageReceived(const PeerAddress & peerAddress, System::PacketBufferHandle && msg,
                                        Transport::MessageTransportContext * ctxt)
 {
@@ -1096,34 +1112,40 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
  * Helper function to implement a single attempt to decrypt a groupcast message
  * using the given group key and privacy setting.
  *
+ * The attempt works on a copy of the message in scratch, so that msg is left intact for the next key when this one fails.
+ *
  * @param[in] partialPacketHeader The partial packet header with non-obfuscated message fields (result of calling DecodeFixed).
  * @param[out] packetHeaderCopy A copy of the packet header, to be filled with privacy decrypted fields
  * @param[out] payloadHeader The payload header of the decrypted message
  * @param[in] applyPrivacy Whether to apply privacy deobfuscation
- * @param[out] msgCopy A copy of the message, to be filled with the decrypted message
+ * @param[in] msg The received message
  * @param[in] mac The MAC of the message
  * @param[in] groupContext The group context to use for decryption key material
+ * @param[out] scratch At least as large as msg, to be filled with the decrypted message
+ * @param[out] payloadOffset The offset of the application payload in scratch
  *
  * @return true if the message was decrypted successfully
  * @return false if the message could not be decrypted
  */
 static bool GroupKeyDecryptAttempt(const PacketHeader & partialPacketHeader, PacketHeader & packetHeaderCopy,
-                                   PayloadHeader & payloadHeader, bool applyPrivacy, System::PacketBufferHandle & msgCopy,
+                                   PayloadHeader & payloadHeader, bool applyPrivacy, const System::PacketBufferHandle & msg,
                                    const MessageAuthenticationCode & mac,
-                                   const Credentials::GroupDataProvider::GroupSession & groupContext)
+                                   const Credentials::GroupDataProvider::GroupSession & groupContext, uint8_t * scratch,
+                                   size_t & payloadOffset)
 {
-    bool decrypted = false;
     CryptoContext context(groupContext.keyContext);
+    const size_t len = msg->DataLength();
+    memcpy(scratch, msg->Start(), len);
 
     if (applyPrivacy)
     {
         // Perform privacy deobfuscation, if applicable.
-        uint8_t * privacyHeader = partialPacketHeader.PrivacyHeader(msgCopy->Start());
+        uint8_t * privacyHeader = partialPacketHeader.PrivacyHeader(scratch);
         size_t privacyLength    = partialPacketHeader.PrivacyHeaderLength();
 
         // Bounds check: we decrypt in place a privacy header located inside the packet.
         // Validate that we are still within the packet as the length is based on header flags.
-        VerifyOrReturnValue((privacyHeader + privacyLength) <= (msgCopy->Start() + msgCopy->TotalLength()), false);
+        VerifyOrReturnValue((privacyHeader + privacyLength) <= (scratch + len), false);
 
         if (CHIP_NO_ERROR != context.PrivacyDecrypt(privacyHeader, privacyLength, privacyHeader, partialPacketHeader, mac))
         {
@@ -1131,7 +1153,8 @@ static bool GroupKeyDecryptAttempt(const PacketHeader & partialPacketHeader, Pac
         }
     }
 
-    if (packetHeaderCopy.DecodeAndConsume(msgCopy) != CHIP_NO_ERROR)
+    uint16_t headerSize = 0;
+    if (packetHeaderCopy.Decode(scratch, len, &headerSize) != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Failed to decode Groupcast packet header. Discarding.");
         return false;
@@ -1144,14 +1167,22 @@ static bool GroupKeyDecryptAttempt(const PacketHeader & partialPacketHeader, Pac
         return false;
     }
 
-    CryptoContext::NonceStorage nonce;
-    CHIP_ERROR nonceResult =
-        CryptoContext::BuildNonce(nonce, packetHeaderCopy.GetSecurityFlags(), packetHeaderCopy.GetMessageCounter(),
-                                  packetHeaderCopy.GetSourceNodeId().Value());
-    decrypted = (nonceResult == CHIP_NO_ERROR) &&
-        (CHIP_NO_ERROR == SecureMessageCodec::Decrypt(context, nonce, payloadHeader, packetHeaderCopy, msgCopy));
+    const uint16_t footerLen = packetHeaderCopy.MICTagLength();
+    VerifyOrReturnValue(headerSize + footerLen <= len, false);
+    const size_t cipherTextLen = len - headerSize - footerLen;
+    uint8_t * cipherText       = scratch + headerSize;
 
-    return decrypted;
+    CryptoContext::NonceStorage nonce;
+    VerifyOrReturnValue(CryptoContext::BuildNonce(nonce, packetHeaderCopy.GetSecurityFlags(), packetHeaderCopy.GetMessageCounter(),
+                                                  packetHeaderCopy.GetSourceNodeId().Value()) == CHIP_NO_ERROR,
+                        false);
+    VerifyOrReturnValue(context.Decrypt(cipherText, cipherTextLen, cipherText, nonce, packetHeaderCopy, mac) == CHIP_NO_ERROR,
+                        false);
+
+    uint16_t payloadHeaderSize = 0;
+    VerifyOrReturnValue(payloadHeader.Decode(cipherText, cipherTextLen, &payloadHeaderSize) == CHIP_NO_ERROR, false);
+    payloadOffset = headerSize + payloadHeaderSize;
+    return true;
 }
 
 void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPacketHeader,
@@ -1166,7 +1197,6 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
 
     PayloadHeader payloadHeader;
     PacketHeader packetHeaderCopy; /// Packet header decoded per group key, with privacy decrypted fields
-    System::PacketBufferHandle msgCopy;
     Credentials::GroupDataProvider * groups = Credentials::GetGroupDataProvider();
     VerifyOrReturn(nullptr != groups);
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1183,53 +1213,115 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         return;
     }
 
-    // Trial decryption with GroupDataProvider
-    Credentials::GroupDataProvider::GroupSession groupContext;
-
-    AutoRelease<Credentials::GroupDataProvider::GroupSessionIterator> iter(
-        groups->IterateGroupSessions(partialPacketHeader.GetSessionId()));
-
-    if (iter.IsNull())
-    {
-        ChipLogError(Inet, "Failed to retrieve Groups iterator. Discarding everything");
-        return;
-    }
-
     // Extract MIC from the end of the message.
     uint8_t * data     = msg->Start();
     size_t len         = msg->TotalLength();
     uint16_t footerLen = partialPacketHeader.MICTagLength();
     VerifyOrReturn(footerLen <= len);
+    if (len > sizeof(mGroupDecryptScratch))
+    {
+        ChipLogError(Inet, "Groupcast message too large: %u bytes. Discarding.", static_cast<unsigned>(len));
+        return;
+    }
 
     uint16_t taglen = 0;
     MessageAuthenticationCode mac;
     ReturnOnFailure(mac.Decode(partialPacketHeader, &data[len - footerLen], footerLen, &taglen));
     VerifyOrReturn(taglen == footerLen);
 
+    const bool privacy       = partialPacketHeader.HasPrivacyFlag();
+    const uint16_t sessionId = partialPacketHeader.GetSessionId();
+
+    // The source node id can only be read before decryption when it is not obfuscated: messages with privacy enabled
+    // are told apart by the address they came from instead.
+    Transport::GroupSessionDecryptCache::Sender sender(peerAddress);
+    if (!privacy)
+    {
+        PacketHeader clearHeader;
+        uint16_t headerSize = 0;
+        if (clearHeader.Decode(data, len, &headerSize) == CHIP_NO_ERROR)
+        {
+            sender = clearHeader.GetSourceNodeId().ValueOr(kUndefinedNodeId);
+        }
+    }
+
     // Groupcast Testing
     auto & testing = chip::Groupcast::GetTesting();
 
+    // Trial decryption with GroupDataProvider.
+    //
+    // Every attempt decrypts a copy of the message in mGroupDecryptScratch, and only the payload of the attempt that
+    // succeeds is copied back into msg.
+    Credentials::GroupDataProvider::GroupSession groupContext;
+    Transport::GroupSessionDecryptCache::Candidate cached;
+    const bool hasCached              = mGroupDecryptCache.Find(sessionId, sender, cached);
     bool decrypted                    = false;
+    bool cacheHit                     = false;
+    bool triedCached                  = false;
     bool hasAnyKeysForFabricUnderTest = false;
-    while (!decrypted && iter->Next(groupContext))
+    uint16_t attempts                 = 0;
+    uint16_t decryptedIndex           = 0;
+    size_t payloadOffset              = 0;
+
+    // The first pass only tries the key that decrypted the last message from this sender, if any, and the second pass
+    // tries all the others.
+    for (int pass = hasCached ? 0 : 1; pass < 2 && !decrypted; pass++)
     {
-        if (testing.IsEnabled() && testing.IsFabricUnderTest(groupContext.fabric_index))
+        AutoRelease<Credentials::GroupDataProvider::GroupSessionIterator> iter(groups->IterateGroupSessions(sessionId));
+
+        if (iter.IsNull())
         {
-            hasAnyKeysForFabricUnderTest = true;
+            ChipLogError(Inet, "Failed to retrieve Groups iterator. Discarding everything");
+            return;
         }
-        CryptoContext context(groupContext.keyContext);
-        msgCopy = msg.CloneData();
-        if (msgCopy.IsNull())
+
+        for (uint16_t index = 0; !decrypted && iter->Next(groupContext); index++)
         {
-            ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
-            return;
+            if (testing.IsEnabled() && testing.IsFabricUnderTest(groupContext.fabric_index))
+            {
+                hasAnyKeysForFabricUnderTest = true;
+            }
+
+            if (pass == 0)
+            {
+                if (index != cached.index)
+                {
+                    continue;
+                }
+                if (groupContext.fabric_index != cached.fabricIndex || groupContext.group_id != cached.groupId)
+                {
+                    // The group keys changed since we remembered this one; the second pass tries every key.
+                    break;
+                }
+                triedCached = true;
+            }
+            else if (triedCached && index == cached.index)
+            {
+                continue;
+            }
+
+            attempts++;
+            decrypted      = GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, privacy, msg, mac,
+                                                    groupContext, mGroupDecryptScratch, payloadOffset);
+            decryptedIndex = index;
+
+            if (pass == 0)
+            {
+                cacheHit = decrypted;
+                break;
+            }
         }
+    }
 
-        bool privacy = partialPacketHeader.HasPrivacyFlag();
-        decrypted =
-            GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, privacy, msgCopy, mac, groupContext);
+    mGroupDecryptCache.RecordMessage(cacheHit, attempts);
+    if (decrypted)
+    {
+        mGroupDecryptCache.Remember(sessionId, sender, { decryptedIndex, groupContext.fabric_index, groupContext.group_id });
+    }
+    else if (hasCached)
+    {
+        mGroupDecryptCache.Forget(sessionId, sender);
     }
-    iter.Release();
 
     if (testing.IsEnabled())
     {
@@ -1258,7 +1350,9 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         ChipLogError(Inet, "Failed to decrypt group message. Discarding everything");
         return;
     }
-    msg = std::move(msgCopy);
+    msg->ConsumeHead(payloadOffset);
+    memcpy(msg->Start(), &mGroupDecryptScratch[payloadOffset], len - payloadOffset - footerLen);
+    msg->SetDataLength(len - payloadOffset - footerLen);
 
     // MCSP check
     if (packetHeaderCopy.IsValidMCSPMsg())
@@ -1369,13 +1463,12 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
     SecureSession * tcpSession = nullptr;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &mrpSession,
+    mSecureSessions.ForEachSessionWithPeer(peerNodeId, [&type, &mrpSession,
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &tcpSession,
+                                                        &tcpSession,
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &transportPayloadCapability](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == peerNodeId &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+                                                        &transportPayloadCapability](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             if (transportPayloadCapability == TransportPayloadCapability::kMRPOrTCPCompatiblePayload ||
                 transportPayloadCapability == TransportPayloadCapability::kLargePayload)
@@ -40,6 +40,7 @@
 #include <transport/CryptoContext.h>
 #include <transport/GroupPeerMessageCounter.h>
 #include <transport/GroupSession.h>
+#include <transport/GroupSessionDecryptCache.h>
 #include <transport/MessageCounterManagerInterface.h>
 #include <transport/MessageStats.h>
 #include <transport/SecureSessionTable.h>
@@ -50,6 +51,7 @@
 #include <transport/TransportMgr.h>
 #include <transport/UnauthenticatedSessionTable.h>
 #include <transport/raw/Base.h>
+#include <transport/raw/MessageHeader.h>
 #include <transport/raw/PeerAddress.h>
 #include <transport/raw/Tuple.h>
 
@@ -99,6 +101,9 @@ public:
 
     uint32_t GetMessageCounter() const;
 
+    // Whether this handle and aBuffer refer to the same buffer.
+    bool IsSameBuffer(const System::PacketBufferHandle & aBuffer) const { return PacketBufferHandle::operator==(aBuffer); }
+
     /**
      * Creates a copy of the data in this packet.
      *
@@ -217,12 +222,8 @@ public:
     template <typename Function>
     void ForEachMatchingSession(const ScopedNodeId & node, Function && function)
     {
-        mSecureSessions.ForEachSession([&](auto * session) {
-            if (session->GetPeer() == node)
-            {
-                function(session);
-            }
-
+        mSecureSessions.ForEachSessionWithPeer(node, [&](auto * session) {
+            function(session);
             return Loop::Continue;
         });
     }
@@ -473,6 +474,9 @@ public:
     void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf,
                            Transport::MessageTransportContext * ctxt = nullptr) override;
 
+    void OnMessageSendFailed(const Transport::PeerAddress & destination, const System::PacketBufferHandle & msgBuf,
+                             CHIP_ERROR err) override;
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     CHIP_ERROR TCPConnect(const Transport::PeerAddress & peerAddress, Transport::AppTCPConnectionCallbackCtxt * appState,
                           Transport::ActiveTCPConnectionHandle & peerConnState);
@@ -532,6 +536,11 @@ public:
 
     MessageStats GetMessageStats() const { return mMessageStats; }
 
+    /**
+     * Statistics of the trial decryption of incoming group messages.
+     */
+    const Transport::GroupSessionDecryptCache::Stats & GetGroupDecryptStats() const { return mGroupDecryptCache.GetStats(); }
+
 private:
     /**
      *    The State of a secure transport object.
@@ -556,6 +565,11 @@ private:
     State mState; // < Initialization state of the object
     chip::Transport::GroupOutgoingCounters mGroupClientCounter;
     MessageStats mMessageStats;
+    Transport::GroupSessionDecryptCache mGroupDecryptCache;
+
+    // Group messages are decrypted here rather than in place, so that a key that fails leaves the received message intact
+    // for the next one.  Group messages are only sent over UDP, in datagrams that fit the IPv6 minimum MTU.
+    uint8_t mGroupDecryptScratch[detail::kMaxIPPacketSizeBytes - detail::kMaxUDPAndIPHeaderSizeBytes];
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     OnTCPConnectionReceivedCallback mConnReceivedCb = nullptr;
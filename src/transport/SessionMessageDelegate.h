@@ -53,6 +53,15 @@ public:
     virtual void OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                    const SessionHandle & session, DuplicateMessage isDuplicate,
                                    System::PacketBufferHandle && msgBuf) = 0;
+
+    /**
+     * @brief
+     *   Called when a message that SendPreparedMessage() reported as sent failed to be sent by the transport.
+     *
+     * @param msgBuf        The buffer of the prepared message
+     * @param err           The error sending the message
+     */
+    virtual void OnMessageSendFailed(const System::PacketBufferHandle & msgBuf, CHIP_ERROR err) {}
 };
 
 } // namespace chip
@@ -58,6 +58,17 @@ public:
     virtual void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf,
                                    Transport::MessageTransportContext * ctxt = nullptr) = 0;
 
+    /**
+     * @brief
+     *   Handle a message that the transport accepted for sending but then failed to send.
+     *
+     * @param destination   the address the message was sent to
+     * @param msgBuf        the buffer that was passed to the transport
+     * @param err           the error sending the message
+     */
+    virtual void OnMessageSendFailed(const Transport::PeerAddress & destination, const System::PacketBufferHandle & msgBuf,
+                                     CHIP_ERROR err){};
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     /**
      * @brief
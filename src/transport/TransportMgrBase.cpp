@@ -88,6 +88,15 @@ void TransportMgrBase::HandleMessageReceived(const Transport::PeerAddress & peer
     }
 }
 
+void TransportMgrBase::HandleMessageSendFailed(const Transport::PeerAddress & peerAddress, const System::PacketBufferHandle & msg,
+                                               CHIP_ERROR err)
+{
+    if (mSessionManager != nullptr)
+    {
+        mSessionManager->OnMessageSendFailed(peerAddress, msg, err);
+    }
+}
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
 void TransportMgrBase::HandleConnectionReceived(Transport::ActiveTCPConnectionState & conn)
 {
@@ -62,6 +62,9 @@ public:
     void HandleMessageReceived(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg,
                                Transport::MessageTransportContext * ctxt = nullptr) override;
 
+    void HandleMessageSendFailed(const Transport::PeerAddress & peerAddress, const System::PacketBufferHandle & msg,
+                                 CHIP_ERROR err) override;
+
 private:
     TransportMgrDelegate * mSessionManager = nullptr;
     Transport::Base * mTransport           = nullptr;
@@ -51,6 +51,11 @@ public:
     virtual void HandleMessageReceived(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg,
                                        MessageTransportContext * ctxt = nullptr) = 0;
 
+    // Called when a message that SendMessage() accepted fails to be sent later on. msg is the buffer that was passed to
+    // SendMessage().
+    virtual void HandleMessageSendFailed(const Transport::PeerAddress & peerAddress, const System::PacketBufferHandle & msg,
+                                         CHIP_ERROR err){};
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     virtual void HandleConnectionReceived(ActiveTCPConnectionState & conn){};
     virtual void HandleConnectionAttemptComplete(ActiveTCPConnectionHandle & conn, CHIP_ERROR conErr){};
@@ -127,6 +132,15 @@ protected:
         mDelegate->HandleMessageReceived(source, std::move(buffer), ctxt);
     }
 
+    /**
+     * Method used by subclasses that send messages after SendMessage() has returned, to notify that a message failed
+     * to be sent.
+     */
+    void HandleMessageSendFailed(const PeerAddress & destination, const System::PacketBufferHandle & buffer, CHIP_ERROR err)
+    {
+        mDelegate->HandleMessageSendFailed(destination, buffer, err);
+    }
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     // Handle an incoming connection request from a peer.
     void HandleConnectionReceived(ActiveTCPConnectionState & conn) { mDelegate->HandleConnectionReceived(conn); }
@@ -80,6 +80,22 @@ uint16_t UDP::GetBoundPort()
 
 void UDP::Close()
 {
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+    if (mFlushScheduled)
+    {
+        mFlushScheduled = false;
+        mUDPEndPoint->GetSystemLayer().CancelTimer(FlushPendingMessages, this);
+    }
+    SendPendingMessages();
+
+    // The delegate may be going away with this transport, so the failures are only logged.
+    for (size_t i = 0; i < mFailedCount; i++)
+    {
+        ChipLogError(Inet, "Failed to send UDP message: %" CHIP_ERROR_FORMAT, mFailedMessages[i].error.Format());
+        mFailedMessages[i].message = nullptr;
+    }
+    mFailedCount = 0;
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
     mUDPEndPoint.Release();
     mState = State::kNotReady;
 }
@@ -100,8 +116,106 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     // Drop the message and return. Free the buffer.
     CHIP_FAULT_INJECT(FaultInjection::kFault_DropOutgoingUDPMsg, msgBuf = nullptr; return CHIP_ERROR_CONNECTION_ABORTED;);
 
-    return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+    VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (!mFlushScheduled)
+    {
+        mFlushScheduled = (mUDPEndPoint->GetSystemLayer().ScheduleWork(FlushPendingMessages, this) == CHIP_NO_ERROR);
+    }
+
+    // Queue the message only if the scheduled work is there to report a failure to send it; otherwise send it now and
+    // return the error.
+    if (mFlushScheduled)
+    {
+        mPendingInfos[mPendingCount]    = addrInfo;
+        mPendingMessages[mPendingCount] = std::move(msgBuf);
+        mPendingCount++;
+
+        if (mPendingCount == INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE)
+        {
+            SendPendingMessages();
+        }
+        return CHIP_NO_ERROR;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+
+    CHIP_ERROR err = mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
+    if (err == CHIP_NO_ERROR)
+    {
+        mSendStatistics.datagrams++;
+    }
+    mSendStatistics.sendOperations++;
+    return err;
+}
+
+void UDP::FlushPendingMessages()
+{
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+    if (mFlushScheduled)
+    {
+        mFlushScheduled = false;
+        mUDPEndPoint->GetSystemLayer().CancelTimer(FlushPendingMessages, this);
+    }
+
+    SendPendingMessages();
+    ReportFailedMessages();
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+}
+
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+void UDP::FlushPendingMessages(System::Layer * systemLayer, void * appState)
+{
+    UDP * udp            = static_cast<UDP *>(appState);
+    udp->mFlushScheduled = false;
+    udp->FlushPendingMessages();
+}
+
+void UDP::SendPendingMessages()
+{
+    size_t next = 0;
+    while (next < mPendingCount)
+    {
+        size_t sentCount = 0;
+        CHIP_ERROR err   = mUDPEndPoint->SendMsgs(&mPendingInfos[next], &mPendingMessages[next], mPendingCount - next, sentCount);
+        mSendStatistics.datagrams += sentCount;
+        mSendStatistics.sendOperations++;
+        next += sentCount;
+
+        if (err != CHIP_NO_ERROR)
+        {
+            // Keep the message that failed for ReportFailedMessages() and carry on with the next ones.
+            if (mFailedCount < MATTER_ARRAY_SIZE(mFailedMessages))
+            {
+                mFailedMessages[mFailedCount].info    = mPendingInfos[next];
+                mFailedMessages[mFailedCount].message = std::move(mPendingMessages[next]);
+                mFailedMessages[mFailedCount].error   = err;
+                mFailedCount++;
+            }
+            else
+            {
+                ChipLogError(Inet, "Failed to send UDP message: %" CHIP_ERROR_FORMAT, err.Format());
+                mPendingMessages[next] = nullptr;
+            }
+            next++;
+        }
+    }
+    mPendingCount = 0;
+}
+
+void UDP::ReportFailedMessages()
+{
+    // The delegate may send again and a full queue is sent right away; new failures are appended and reported by this loop.
+    for (size_t i = 0; i < mFailedCount; i++)
+    {
+        FailedMessage & failed             = mFailedMessages[i];
+        System::PacketBufferHandle message = std::move(failed.message);
+        HandleMessageSendFailed(PeerAddress::UDP(failed.info.DestAddress, failed.info.DestPort, failed.info.Interface), message,
+                                failed.error);
+    }
+    mFailedCount = 0;
 }
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
 
 void UDP::OnUdpReceive(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle && buffer, const Inet::IPPacketInfo * pktInfo)
 {
@@ -108,6 +108,21 @@ class DLL_EXPORT UDP : public Base
     };
 
 public:
+    /**
+     * Counts of the datagrams sent by the transport and of the endpoint send operations that sent them. On platforms using
+     * sockets, each send operation is a single system call.
+     */
+    struct SendStatistics
+    {
+        uint64_t datagrams      = 0;
+        uint64_t sendOperations = 0;
+    };
+
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+    // Send the queued messages before the endpoint goes away.
+    ~UDP() override { Close(); }
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+
     /**
      * Initialize a UDP transport on a given port.
      *
@@ -123,12 +138,28 @@ public:
     uint16_t GetBoundPort();
 
     /**
-     * Close the open endpoint without destroying the object
+     * Close the open endpoint without destroying the object. Messages still waiting to be sent are sent first.
      */
     void Close() override;
 
+    /**
+     * Send a message to a peer.
+     *
+     * @details
+     *   When INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE is more than 1, the message is queued and the messages queued during
+     *   an event loop turn are sent together, with as few system calls as possible, by work scheduled on the system layer
+     *   or as soon as the queue is full. Errors sending a queued message are reported to the delegate through
+     *   HandleMessageSendFailed(), from the scheduled work, rather than returned.
+     */
     CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf) override;
 
+    /**
+     * Send the messages queued by SendMessage() now, and report the ones that failed to the delegate.
+     */
+    void FlushPendingMessages();
+
+    const SendStatistics & GetSendStatistics() const { return mSendStatistics; }
+
     CHIP_ERROR MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join) override;
 
     bool CanListenMulticast() override
@@ -149,6 +180,33 @@ private:
 
     static void OnUdpError(Inet::UDPEndPoint * endPoint, CHIP_ERROR err, const Inet::IPPacketInfo * pktInfo);
 
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+    static void FlushPendingMessages(System::Layer * systemLayer, void * appState);
+
+    // Sends the queued messages and keeps the ones that failed for ReportFailedMessages(). This may run from within
+    // SendMessage(), where calling back into the delegate is not safe.
+    void SendPendingMessages();
+    void ReportFailedMessages();
+
+    struct FailedMessage
+    {
+        Inet::IPPacketInfo info;
+        System::PacketBufferHandle message;
+        CHIP_ERROR error = CHIP_NO_ERROR;
+    };
+
+    // Messages queued by SendMessage(), with their destinations, in the order they were sent.
+    Inet::IPPacketInfo mPendingInfos[INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE];
+    System::PacketBufferHandle mPendingMessages[INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE];
+    size_t mPendingCount = 0;
+    // Messages that failed to be sent and have not been reported yet.
+    FailedMessage mFailedMessages[INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE];
+    size_t mFailedCount  = 0;
+    bool mFlushScheduled = false;
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+
+    SendStatistics mSendStatistics;
+
     Inet::UDPEndPointHandle mUDPEndPoint;                                 ///< UDP socket used by the transport
     Inet::IPAddressType mUDPEndpointType = Inet::IPAddressType::kUnknown; ///< Socket listening type
     State mState                         = State::kNotReady;              ///< State of the UDP transport
@@ -46,6 +46,7 @@ constexpr uint32_t kMessageCounter  = 18;
 
 const char PAYLOAD[]        = "Hello!";
 int ReceiveHandlerCallCount = 0;
+int SendFailedCallCount     = 0;
 
 class MockTransportMgrDelegate : public TransportMgrDelegate
 {
@@ -70,6 +71,14 @@ public:
 
         ReceiveHandlerCallCount++;
     }
+
+    void OnMessageSendFailed(const Transport::PeerAddress & destination, const System::PacketBufferHandle & msgBuf,
+                             CHIP_ERROR err) override
+    {
+        EXPECT_NE(err, CHIP_NO_ERROR);
+        EXPECT_FALSE(msgBuf.IsNull());
+        SendFailedCallCount++;
+    }
 };
 
 } // namespace
@@ -148,6 +157,90 @@ protected:
 
         EXPECT_EQ(ReceiveHandlerCallCount, 1);
     }
+
+    void CheckBurstTest(const IPAddress & addr)
+    {
+        constexpr int kMessageCount = 20;
+
+        Transport::UDP udp;
+
+        CHIP_ERROR err = udp.Init(
+            Transport::UdpListenParameters(mIOContext->GetUDPEndPointManager()).SetAddressType(addr.Type()).SetListenPort(0));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+
+        MockTransportMgrDelegate gMockTransportMgrDelegate;
+        TransportMgrBase gTransportMgrBase;
+        gTransportMgrBase.SetSessionManager(&gMockTransportMgrDelegate);
+        EXPECT_SUCCESS(gTransportMgrBase.Init(&udp));
+
+        ReceiveHandlerCallCount = 0;
+
+        PacketHeader header;
+        header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+        // Messages sent during one event loop turn are all delivered.
+        for (int i = 0; i < kMessageCount; i++)
+        {
+            chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+            ASSERT_FALSE(buffer.IsNull());
+            EXPECT_EQ(header.EncodeBeforeData(buffer), CHIP_NO_ERROR);
+            EXPECT_EQ(udp.SendMessage(Transport::PeerAddress::UDP(addr, udp.GetBoundPort()), std::move(buffer)), CHIP_NO_ERROR);
+        }
+
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(1), []() { return ReceiveHandlerCallCount == kMessageCount; });
+
+        EXPECT_EQ(ReceiveHandlerCallCount, kMessageCount);
+        EXPECT_EQ(udp.GetSendStatistics().datagrams, static_cast<uint64_t>(kMessageCount));
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+        EXPECT_LT(udp.GetSendStatistics().sendOperations, static_cast<uint64_t>(kMessageCount));
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+    }
+
+    void CheckSendFailureTest(const IPAddress & addr, const IPAddress & unreachableAddr)
+    {
+        Transport::UDP udp;
+
+        CHIP_ERROR err = udp.Init(
+            Transport::UdpListenParameters(mIOContext->GetUDPEndPointManager()).SetAddressType(addr.Type()).SetListenPort(0));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+
+        MockTransportMgrDelegate gMockTransportMgrDelegate;
+        TransportMgrBase gTransportMgrBase;
+        gTransportMgrBase.SetSessionManager(&gMockTransportMgrDelegate);
+        EXPECT_SUCCESS(gTransportMgrBase.Init(&udp));
+
+        ReceiveHandlerCallCount = 0;
+        SendFailedCallCount     = 0;
+
+        PacketHeader header;
+        header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+        // The endpoint cannot send to an address of another type. The message sent after it is still delivered.
+        chip::System::PacketBufferHandle failing = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(failing.IsNull());
+        EXPECT_EQ(header.EncodeBeforeData(failing), CHIP_NO_ERROR);
+        err = udp.SendMessage(Transport::PeerAddress::UDP(unreachableAddr, udp.GetBoundPort()), std::move(failing));
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+        // The message was queued; the failure is reported to the delegate once the queue is sent.
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+#else
+        EXPECT_NE(err, CHIP_NO_ERROR);
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+
+        chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+        EXPECT_EQ(header.EncodeBeforeData(buffer), CHIP_NO_ERROR);
+        EXPECT_EQ(udp.SendMessage(Transport::PeerAddress::UDP(addr, udp.GetBoundPort()), std::move(buffer)), CHIP_NO_ERROR);
+
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(1), []() { return ReceiveHandlerCallCount != 0; });
+
+        EXPECT_EQ(ReceiveHandlerCallCount, 1);
+#if INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+        EXPECT_EQ(SendFailedCallCount, 1);
+#else
+        EXPECT_EQ(SendFailedCallCount, 0);
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1
+    }
 };
 
 IOContext * TestUDP::mIOContext = nullptr;
@@ -177,3 +270,21 @@ TEST_F(TestUDP, CheckMessageTest6)
     IPAddress::FromString("::1", addr);
     CheckMessageTest(addr);
 }
+
+TEST_F(TestUDP, CheckBurstTest6)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckBurstTest(addr);
+}
+
+#if INET_CONFIG_ENABLE_IPV4
+TEST_F(TestUDP, CheckSendFailureTest6)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    IPAddress unreachableAddr;
+    IPAddress::FromString("127.0.0.1", unreachableAddr);
+    CheckSendFailureTest(addr, unreachableAddr);
+}
+#endif
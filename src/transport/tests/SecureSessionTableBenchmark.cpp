@@ -0,0 +1,159 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures SecureSessionTable lookups, per second, for tables holding
+ *      from a handful to thousands of active CASE sessions:
+ *
+ *        - scan_dispatch_per_s: finding the session of an inbound message by
+ *          scanning the whole table for its local session ID.
+ *        - index_dispatch_per_s: FindSecureSessionByLocalKey(), which uses the
+ *          local session ID index (inbound message dispatch).
+ *        - scan_peer_per_s: finding the sessions to a peer by scanning the
+ *          whole table.
+ *        - index_peer_per_s: ForEachSessionWithPeer(), which uses the peer
+ *          index (FindSecureSessionForNode and friends).
+ *
+ *      Tables larger than CHIP_CONFIG_SECURE_SESSION_POOL_SIZE require a heap
+ *      object pool. The index bucket count follows the pool size, so index
+ *      chains lengthen once a table outgrows its configured size.
+ */
+
+#include <benchmarks/BenchmarkHelpers.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <transport/SecureSessionTable.h>
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::Transport;
+
+namespace {
+
+constexpr size_t kSessionCounts[]    = { 16, 256, 4096 };
+constexpr size_t kLookups            = 1000000;
+constexpr FabricIndex kFabricIndex   = 1;
+constexpr NodeId kLocalNodeId        = 0x0000000012340000ull;
+constexpr NodeId kFirstPeerNodeId    = 0x00000000ABCD0000ull;
+constexpr uint16_t kFirstLocalSessId = 0x8000;
+
+const ResultWriter gResults("secure-session-table", "sessions");
+
+template <typename Lookup>
+double MeasureLookups(size_t sessionCount, Lookup && lookup)
+{
+    size_t found = 0;
+
+    SteadyClock::time_point start = SteadyClock::now();
+    for (size_t i = 0; i < kLookups; i++)
+    {
+        found += lookup(ScrambledIndex(i, sessionCount));
+    }
+    const double seconds = SecondsSince(start);
+
+    VerifyOrDie(found == kLookups);
+    return static_cast<double>(kLookups) / seconds;
+}
+
+void RunBenchmark(size_t sessionCount)
+{
+    SecureSessionTable table;
+    table.Init();
+
+    ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(300), System::Clock::Milliseconds32(300),
+                                         System::Clock::Milliseconds16(4000));
+    // Test sessions start out active, so the table keeps them once the returned handles go away.
+    for (size_t i = 0; i < sessionCount; i++)
+    {
+        auto session =
+            table.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, static_cast<uint16_t>(kFirstLocalSessId + i), kLocalNodeId,
+                                                kFirstPeerNodeId + i, CATValues(), 1, kFabricIndex, config);
+        VerifyOrDie(session.HasValue());
+    }
+
+    auto localSessionId = [](size_t i) { return static_cast<uint16_t>(kFirstLocalSessId + i); };
+    auto peer           = [](size_t i) { return ScopedNodeId(kFirstPeerNodeId + i, kFabricIndex); };
+
+    const double scanDispatch = MeasureLookups(sessionCount, [&](size_t i) -> size_t {
+        const uint16_t id      = localSessionId(i);
+        SecureSession * result = nullptr;
+        table.ForEachSession([&](auto * session) {
+            if (session->GetLocalSessionId() == id)
+            {
+                result = session;
+                return Loop::Break;
+            }
+            return Loop::Continue;
+        });
+        return result != nullptr;
+    });
+
+    const double indexDispatch = MeasureLookups(
+        sessionCount, [&](size_t i) -> size_t { return table.FindSecureSessionByLocalKey(localSessionId(i)).HasValue(); });
+
+    const double scanPeer = MeasureLookups(sessionCount, [&](size_t i) -> size_t {
+        const ScopedNodeId target = peer(i);
+        size_t matches            = 0;
+        table.ForEachSession([&](auto * session) {
+            if (session->IsActiveSession() && session->GetPeer() == target)
+            {
+                matches++;
+            }
+            return Loop::Continue;
+        });
+        return matches;
+    });
+
+    const double indexPeer = MeasureLookups(sessionCount, [&](size_t i) -> size_t {
+        size_t matches = 0;
+        table.ForEachSessionWithPeer(peer(i), [&](auto * session) {
+            if (session->IsActiveSession())
+            {
+                matches++;
+            }
+            return Loop::Continue;
+        });
+        return matches;
+    });
+
+    table.ForEachSession([](auto * session) {
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+
+    gResults.Print(sessionCount, "scan_dispatch_per_s", Better::kHigher, scanDispatch);
+    gResults.Print(sessionCount, "index_dispatch_per_s", Better::kHigher, indexDispatch);
+    gResults.Print(sessionCount, "scan_peer_per_s", Better::kHigher, scanPeer);
+    gResults.Print(sessionCount, "index_peer_per_s", Better::kHigher, indexPeer);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    gResults.PrintHeader();
+    for (size_t sessionCount : kSessionCounts)
+    {
+        RunBenchmark(sessionCount);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
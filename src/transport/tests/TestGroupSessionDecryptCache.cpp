@@ -0,0 +1,147 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <inet/IPAddress.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <transport/GroupSessionDecryptCache.h>
+#include <transport/raw/PeerAddress.h>
+
+namespace {
+
+using namespace chip;
+using Transport::GroupSessionDecryptCache;
+
+constexpr uint16_t kSessionId = 0x1234;
+constexpr NodeId kSourceNode  = 0x0102030405060708;
+constexpr uint16_t kPort      = 5540;
+
+GroupSessionDecryptCache::Candidate MakeCandidate(uint16_t index, FabricIndex fabricIndex = 1, GroupId groupId = 0x0101)
+{
+    GroupSessionDecryptCache::Candidate candidate;
+    candidate.index       = index;
+    candidate.fabricIndex = fabricIndex;
+    candidate.groupId     = groupId;
+    return candidate;
+}
+
+TEST(TestGroupSessionDecryptCache, TestRememberAndFind)
+{
+    GroupSessionDecryptCache cache;
+    GroupSessionDecryptCache::Candidate candidate;
+
+    EXPECT_FALSE(cache.Find(kSessionId, kSourceNode, candidate));
+
+    cache.Remember(kSessionId, kSourceNode, MakeCandidate(3));
+    EXPECT_TRUE(cache.Find(kSessionId, kSourceNode, candidate));
+    EXPECT_EQ(candidate.index, 3u);
+    EXPECT_EQ(candidate.fabricIndex, 1u);
+    EXPECT_EQ(candidate.groupId, 0x0101u);
+
+    // The key is both the session id and the source.
+    EXPECT_FALSE(cache.Find(kSessionId, kSourceNode + 1, candidate));
+    EXPECT_FALSE(cache.Find(kSessionId + 1, kSourceNode, candidate));
+
+    cache.Remember(kSessionId, kSourceNode, MakeCandidate(4));
+    EXPECT_TRUE(cache.Find(kSessionId, kSourceNode, candidate));
+    EXPECT_EQ(candidate.index, 4u);
+
+    cache.Forget(kSessionId, kSourceNode);
+    EXPECT_FALSE(cache.Find(kSessionId, kSourceNode, candidate));
+}
+
+TEST(TestGroupSessionDecryptCache, TestSendersByAddress)
+{
+    GroupSessionDecryptCache cache;
+    GroupSessionDecryptCache::Candidate candidate;
+
+    Inet::IPAddress address1;
+    Inet::IPAddress address2;
+    ASSERT_TRUE(Inet::IPAddress::FromString("fe80::1", address1));
+    ASSERT_TRUE(Inet::IPAddress::FromString("fe80::2", address2));
+    const Transport::PeerAddress peer1 = Transport::PeerAddress::UDP(address1, kPort);
+    const Transport::PeerAddress peer2 = Transport::PeerAddress::UDP(address2, kPort);
+
+    // Senders of messages with privacy enabled keep their own key.
+    cache.Remember(kSessionId, peer1, MakeCandidate(1));
+    cache.Remember(kSessionId, peer2, MakeCandidate(2));
+    EXPECT_TRUE(cache.Find(kSessionId, peer1, candidate));
+    EXPECT_EQ(candidate.index, 1u);
+    EXPECT_TRUE(cache.Find(kSessionId, peer2, candidate));
+    EXPECT_EQ(candidate.index, 2u);
+
+    // The port is part of the sender, and an address is never mistaken for a source node.
+    EXPECT_FALSE(cache.Find(kSessionId, Transport::PeerAddress::UDP(address1, kPort + 1), candidate));
+    EXPECT_FALSE(cache.Find(kSessionId, kUndefinedNodeId, candidate));
+}
+
+TEST(TestGroupSessionDecryptCache, TestEvictsLeastRecentlyUsed)
+{
+    GroupSessionDecryptCache cache;
+    GroupSessionDecryptCache::Candidate candidate;
+
+    for (size_t i = 0; i < GroupSessionDecryptCache::kCacheSize; i++)
+    {
+        cache.Remember(kSessionId, kSourceNode + i, MakeCandidate(static_cast<uint16_t>(i)));
+    }
+
+    // Using the oldest entry makes the second oldest one the next to go.
+    EXPECT_TRUE(cache.Find(kSessionId, kSourceNode, candidate));
+    cache.Remember(kSessionId + 1, kSourceNode, MakeCandidate(0));
+
+    EXPECT_TRUE(cache.Find(kSessionId, kSourceNode, candidate));
+    EXPECT_TRUE(cache.Find(kSessionId + 1, kSourceNode, candidate));
+    if (GroupSessionDecryptCache::kCacheSize > 1)
+    {
+        EXPECT_FALSE(cache.Find(kSessionId, kSourceNode + 1, candidate));
+    }
+}
+
+TEST(TestGroupSessionDecryptCache, TestFabricRemoved)
+{
+    GroupSessionDecryptCache cache;
+    GroupSessionDecryptCache::Candidate candidate;
+
+    cache.Remember(kSessionId, kSourceNode, MakeCandidate(0, 1));
+    cache.Remember(kSessionId, kSourceNode + 1, MakeCandidate(1, 2));
+
+    cache.FabricRemoved(1);
+    EXPECT_FALSE(cache.Find(kSessionId, kSourceNode, candidate));
+    if (GroupSessionDecryptCache::kCacheSize > 1)
+    {
+        EXPECT_TRUE(cache.Find(kSessionId, kSourceNode + 1, candidate));
+        EXPECT_EQ(candidate.fabricIndex, 2u);
+    }
+}
+
+TEST(TestGroupSessionDecryptCache, TestStats)
+{
+    GroupSessionDecryptCache cache;
+
+    cache.RecordMessage(false, 3);
+    cache.RecordMessage(true, 1);
+
+    EXPECT_EQ(cache.GetStats().messages, 2u);
+    EXPECT_EQ(cache.GetStats().cacheHits, 1u);
+    EXPECT_EQ(cache.GetStats().cacheMisses, 1u);
+    EXPECT_EQ(cache.GetStats().decryptAttempts, 4u);
+
+    cache.ResetStats();
+    EXPECT_EQ(cache.GetStats().messages, 0u);
+}
+
+} // namespace
@@ -461,5 +461,146 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+namespace {
+
+constexpr FabricIndex kIndexTestFabric1 = 1;
+constexpr FabricIndex kIndexTestFabric2 = 2;
+constexpr FabricIndex kIndexTestFabric3 = 3;
+
+const ReliableMessageProtocolConfig kTestMRPConfig(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                                   System::Clock::Milliseconds16(0));
+
+unsigned CountSessionsWithPeer(SecureSessionTable & table, const ScopedNodeId & peer)
+{
+    unsigned count = 0;
+    table.ForEachSessionWithPeer(peer, [&](SecureSession * session) {
+        EXPECT_EQ(session->GetPeer(), peer);
+        count++;
+        return Loop::Continue;
+    });
+    return count;
+}
+
+} // namespace
+
+TEST_F(TestSecureSessionTable, FindSessionByLocalKey)
+{
+    SecureSessionTable table;
+    table.Init();
+
+    Optional<SessionHandle> sessions[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+    for (auto & session : sessions)
+    {
+        session = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(session.HasValue());
+    }
+
+    for (const auto & session : sessions)
+    {
+        auto found = table.FindSecureSessionByLocalKey(session.Value()->AsSecureSession()->GetLocalSessionId());
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_TRUE(found.Value() == session.Value());
+    }
+
+    // Releasing every other session must remove it from the index, and leave the others findable.
+    std::vector<uint16_t> releasedIds;
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(sessions); i += 2)
+    {
+        releasedIds.push_back(sessions[i].Value()->AsSecureSession()->GetLocalSessionId());
+        sessions[i].ClearValue();
+    }
+
+    for (uint16_t id : releasedIds)
+    {
+        EXPECT_FALSE(table.FindSecureSessionByLocalKey(id).HasValue());
+    }
+    for (const auto & session : sessions)
+    {
+        if (session.HasValue())
+        {
+            auto found = table.FindSecureSessionByLocalKey(session.Value()->AsSecureSession()->GetLocalSessionId());
+            ASSERT_TRUE(found.HasValue());
+            EXPECT_TRUE(found.Value() == session.Value());
+        }
+    }
+
+    // New sessions never get the ID of a session that is still in the table.
+    auto newSession = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(newSession.HasValue());
+    uint16_t newId = newSession.Value()->AsSecureSession()->GetLocalSessionId();
+    EXPECT_NE(newId, kUnsecuredSessionId);
+    for (const auto & session : sessions)
+    {
+        if (session.HasValue())
+        {
+            EXPECT_NE(session.Value()->AsSecureSession()->GetLocalSessionId(), newId);
+        }
+    }
+}
+
+TEST_F(TestSecureSessionTable, FindSessionsByPeer)
+{
+    SecureSessionTable table;
+    table.Init();
+
+    const ScopedNodeId localNode1(1, kIndexTestFabric1);
+    const ScopedNodeId localNode2(1, kIndexTestFabric2);
+    const ScopedNodeId peerA1(0x1234, kIndexTestFabric1);
+    const ScopedNodeId peerB1(0x5678, kIndexTestFabric1);
+    const ScopedNodeId peerA2(0x1234, kIndexTestFabric2);
+
+    const ScopedNodeId localNodes[] = { localNode1, localNode1, localNode1, localNode2 };
+    const ScopedNodeId peers[]      = { peerA1, peerA1, peerB1, peerA2 };
+    Optional<SessionHandle> sessions[MATTER_ARRAY_SIZE(peers)];
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(peers); i++)
+    {
+        sessions[i] = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(sessions[i].HasValue());
+        sessions[i].Value()->AsSecureSession()->Activate(localNodes[i], peers[i], CATValues(), 1, kTestMRPConfig);
+    }
+
+    EXPECT_EQ(CountSessionsWithPeer(table, peerA1), 2u);
+    EXPECT_EQ(CountSessionsWithPeer(table, peerB1), 1u);
+    EXPECT_EQ(CountSessionsWithPeer(table, peerA2), 1u);
+    EXPECT_EQ(CountSessionsWithPeer(table, ScopedNodeId(0x5678, kIndexTestFabric2)), 0u);
+
+    // A PASE session moves in the index when it adopts a fabric.
+    auto pase = table.CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    ASSERT_TRUE(pase.HasValue());
+    const ScopedNodeId pakePeer(NodeIdFromPAKEKeyId(kDefaultCommissioningPasscodeId), kUndefinedFabricIndex);
+    pase.Value()->AsSecureSession()->Activate(ScopedNodeId(), pakePeer, CATValues(), 2, kTestMRPConfig);
+    EXPECT_EQ(CountSessionsWithPeer(table, pakePeer), 1u);
+
+    EXPECT_EQ(pase.Value()->AsSecureSession()->AdoptFabricIndex(kIndexTestFabric3), CHIP_NO_ERROR);
+    EXPECT_EQ(CountSessionsWithPeer(table, pakePeer), 0u);
+    EXPECT_EQ(CountSessionsWithPeer(table, ScopedNodeId(pakePeer.GetNodeId(), kIndexTestFabric3)), 1u);
+
+    // Sessions released from within the iteration are removed from the index.
+    sessions[0].ClearValue();
+    sessions[1].ClearValue();
+    table.ForEachSessionWithPeer(peerA1, [](SecureSession * session) {
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+    EXPECT_EQ(CountSessionsWithPeer(table, peerA1), 0u);
+    unsigned remaining = 0;
+    table.ForEachSession([&](auto *) {
+        remaining++;
+        return Loop::Continue;
+    });
+    EXPECT_EQ(remaining, 3u);
+    EXPECT_EQ(CountSessionsWithPeer(table, peerB1), 1u);
+    EXPECT_EQ(CountSessionsWithPeer(table, peerA2), 1u);
+
+    for (auto & session : sessions)
+    {
+        if (session.HasValue())
+        {
+            session.Value()->AsSecureSession()->MarkForEviction();
+        }
+    }
+    pase.Value()->AsSecureSession()->MarkForEviction();
+}
+
 } // namespace Transport
 } // namespace chip
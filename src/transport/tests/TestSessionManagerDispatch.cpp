@@ -793,6 +793,63 @@ TEST_F(TestSessionManagerDispatch, TestGroupIncomingPrivacyBoundsCheck)
     sessionManager.Shutdown();
 }
 
+TEST_F(TestSessionManagerDispatch, TestGroupDecryptCache)
+{
+    using namespace chip::TestCerts;
+
+    SessionManager sessionManager;
+    TestGroupPrivacyMessageDelegate delegate;
+    TestSessionManagerInit(mContext, sessionManager, *mResources);
+    sessionManager.SetMessageDelegate(&delegate);
+
+    // Loads test parameters for GroupId 2
+    const MessageTestEntry & testEntry = theMessageTestVector[7];
+
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    SetupGroupKeys(sessionManager, fabricIndex, testEntry.groupId, testEntry.epochKey);
+
+    Transport::OutgoingGroupSession outgoingSession(testEntry.groupId, fabricIndex);
+    SessionHandle outgoingHandle(outgoingSession);
+    SessionHolder outgoingHolder(outgoingHandle);
+
+    IPAddress loopbackAddress;
+    IPAddress::FromString("::1", loopbackAddress);
+    const PeerAddress peerAddress = PeerAddress::UDP(loopbackAddress, CHIP_PORT);
+
+    uint32_t firstMessageAttempts = 0;
+    for (uint32_t i = 1; i <= 2; i++)
+    {
+        PayloadHeader payloadHeader;
+        payloadHeader.SetMessageType(chip::Protocols::InteractionModel::MsgType::InvokeCommandRequest);
+        const char testPayload[] = "CacheTest";
+        System::PacketBufferHandle payloadBuf =
+            MessagePacketBuffer::NewWithData(reinterpret_cast<const uint8_t *>(testPayload), sizeof(testPayload));
+        ASSERT_FALSE(payloadBuf.IsNull());
+
+        EncryptedPacketBufferHandle preparedMessage;
+        EXPECT_EQ(CHIP_NO_ERROR,
+                  sessionManager.PrepareMessage(outgoingHolder.Get().Value(), payloadHeader, std::move(payloadBuf),
+                                                preparedMessage));
+
+        delegate.mMessageReceived = false;
+        sessionManager.OnMessageReceived(peerAddress, preparedMessage.CastToWritable());
+        EXPECT_TRUE(delegate.mMessageReceived);
+        EXPECT_EQ(sessionManager.GetGroupDecryptStats().messages, i);
+        if (i == 1)
+        {
+            firstMessageAttempts = sessionManager.GetGroupDecryptStats().decryptAttempts;
+        }
+    }
+
+    // The key that decrypted the first message is remembered and decrypts the second one on the first attempt.
+    const Transport::GroupSessionDecryptCache::Stats & stats = sessionManager.GetGroupDecryptStats();
+    EXPECT_EQ(stats.cacheMisses, 1u);
+    EXPECT_EQ(stats.cacheHits, 1u);
+    EXPECT_EQ(stats.decryptAttempts, firstMessageAttempts + 1);
+
+    sessionManager.Shutdown();
+}
+
 TEST_F(TestSessionManagerDispatch, TestGroupPrepareMessageChainedBufferFailure)
 {
     using namespace chip::TestCerts;